@@ -0,0 +1,271 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/Component/TickBus.h>
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/containers/span.h>
+#include <AzCore/std/containers/vector.h>
+
+namespace AZ
+{
+    /**
+     * Alternative to connecting every instance of a type to the AZ::TickBus.
+     * Instances that connect with BatchTickConnect are grouped by type and tick order, and each group connects a single
+     * handler to the TickBus. When the group is ticked, the static function T::OnBatchTick is called once with a contiguous
+     * span of all the instances in the group, so the type can update its instances in a single loop or distribute them over
+     * the TaskGraph instead of receiving a virtual OnTick call per instance.
+     * Groups are ticked at the position of their tick order on the TickBus, so the order relative to handlers with other tick
+     * orders is the same as when every instance connects to the TickBus. There is no order between instances in a group.
+     *
+     * The type has to derive from BatchTickHandler<T> and implement:
+     * @code{.cpp}
+     * static void OnBatchTick(AZStd::span<T* const> instances, float deltaTime, AZ::ScriptTimePoint time);
+     * @endcode
+     * Instances that are disconnected while their group is ticking are replaced by nullptr in the span, so the span can
+     * contain nullptr entries if OnBatchTick disconnects other instances in the group. Instances that are connected while
+     * their group is ticking are ticked from the next tick.
+     *
+     * Like the TickBus, connecting and disconnecting is only allowed from the main thread.
+     * @note The groups are stored per module, so instances of a type should be connected from the module the type is in.
+     */
+    template <class T>
+    class BatchTickHandler
+    {
+    public:
+        using InstanceSpan = AZStd::span<T* const>;
+
+        //! Adds the instance to the group of instances of its type that tick at the provided tick order.
+        void BatchTickConnect(int tickOrder = TICK_DEFAULT);
+        //! Removes the instance from its group.
+        void BatchTickDisconnect();
+        //! Returns true if the instance is in a group.
+        bool BatchTickIsConnected() const;
+
+        //! Returns the number of groups that currently exist for the type, one for each tick order that's in use.
+        static size_t GetNumBatches();
+
+    protected:
+        BatchTickHandler() = default;
+        ~BatchTickHandler();
+
+        BatchTickHandler(const BatchTickHandler&) = delete;
+        BatchTickHandler& operator=(const BatchTickHandler&) = delete;
+
+    private:
+        class Batch
+            : public TickBus::Handler
+        {
+        public:
+            AZ_CLASS_ALLOCATOR(Batch, SystemAllocator);
+
+            explicit Batch(int tickOrder);
+            ~Batch() override;
+
+            void Add(T* instance);
+            //! Removes the instance and returns true if the batch is empty and can be deleted.
+            bool Remove(T* instance);
+
+            int GetTickOrder() override;
+            void OnTick(float deltaTime, ScriptTimePoint time) override;
+
+            AZStd::vector<T*> m_instances;
+            //! Instances that were connected while the batch was ticking.
+            AZStd::vector<T*> m_pendingInstances;
+            Batch* m_next{ nullptr };
+            int m_tickOrder;
+            bool m_isTicking{ false };
+            bool m_hasRemovedInstances{ false };
+        };
+
+        static BatchTickHandler& AsHandler(T* instance);
+        static void DestroyBatch(Batch* batch);
+
+        static constexpr size_t PendingIndex = static_cast<size_t>(-1);
+
+        //! Linked list of the groups for this type. Usually a type only uses a few tick orders.
+        static inline Batch* s_batches{ nullptr };
+
+        Batch* m_batch{ nullptr };
+        size_t m_batchIndex{ 0 };
+    };
+
+    template <class T>
+    BatchTickHandler<T>::~BatchTickHandler()
+    {
+        AZ_Assert(m_batch == nullptr, "BatchTickDisconnect must be called before the instance is destroyed.");
+        BatchTickDisconnect();
+    }
+
+    template <class T>
+    void BatchTickHandler<T>::BatchTickConnect(int tickOrder)
+    {
+        if (m_batch)
+        {
+            if (m_batch->m_tickOrder == tickOrder)
+            {
+                return;
+            }
+            BatchTickDisconnect();
+        }
+
+        Batch* batch = s_batches;
+        while (batch && batch->m_tickOrder != tickOrder)
+        {
+            batch = batch->m_next;
+        }
+        if (!batch)
+        {
+            batch = aznew Batch(tickOrder);
+            batch->m_next = s_batches;
+            s_batches = batch;
+        }
+        batch->Add(static_cast<T*>(this));
+    }
+
+    template <class T>
+    void BatchTickHandler<T>::BatchTickDisconnect()
+    {
+        if (m_batch)
+        {
+            Batch* batch = m_batch;
+            if (batch->Remove(static_cast<T*>(this)))
+            {
+                DestroyBatch(batch);
+            }
+        }
+    }
+
+    template <class T>
+    bool BatchTickHandler<T>::BatchTickIsConnected() const
+    {
+        return m_batch != nullptr;
+    }
+
+    template <class T>
+    size_t BatchTickHandler<T>::GetNumBatches()
+    {
+        size_t count = 0;
+        for (Batch* batch = s_batches; batch; batch = batch->m_next)
+        {
+            ++count;
+        }
+        return count;
+    }
+
+    template <class T>
+    BatchTickHandler<T>& BatchTickHandler<T>::AsHandler(T* instance)
+    {
+        return *static_cast<BatchTickHandler*>(instance);
+    }
+
+    template <class T>
+    void BatchTickHandler<T>::DestroyBatch(Batch* batch)
+    {
+        Batch** link = &s_batches;
+        while (*link != batch)
+        {
+            link = &(*link)->m_next;
+        }
+        *link = batch->m_next;
+        delete batch;
+    }
+
+    template <class T>
+    BatchTickHandler<T>::Batch::Batch(int tickOrder)
+        : m_tickOrder(tickOrder)
+    {
+        TickBus::Handler::BusConnect();
+    }
+
+    template <class T>
+    BatchTickHandler<T>::Batch::~Batch()
+    {
+        TickBus::Handler::BusDisconnect();
+    }
+
+    template <class T>
+    void BatchTickHandler<T>::Batch::Add(T* instance)
+    {
+        BatchTickHandler& handler = AsHandler(instance);
+        handler.m_batch = this;
+        if (m_isTicking)
+        {
+            // Adding to the instances could reallocate the storage of the span that's being ticked.
+            handler.m_batchIndex = PendingIndex;
+            m_pendingInstances.push_back(instance);
+        }
+        else
+        {
+            handler.m_batchIndex = m_instances.size();
+            m_instances.push_back(instance);
+        }
+    }
+
+    template <class T>
+    bool BatchTickHandler<T>::Batch::Remove(T* instance)
+    {
+        BatchTickHandler& handler = AsHandler(instance);
+        handler.m_batch = nullptr;
+        if (handler.m_batchIndex == PendingIndex)
+        {
+            m_pendingInstances.erase(AZStd::find(m_pendingInstances.begin(), m_pendingInstances.end(), instance));
+        }
+        else if (m_isTicking)
+        {
+            // Keep the span stable while it's being ticked, the instances are compacted after the tick.
+            m_instances[handler.m_batchIndex] = nullptr;
+            m_hasRemovedInstances = true;
+        }
+        else
+        {
+            T* last = m_instances.back();
+            m_instances[handler.m_batchIndex] = last;
+            AsHandler(last).m_batchIndex = handler.m_batchIndex;
+            m_instances.pop_back();
+        }
+        return !m_isTicking && m_instances.empty() && m_pendingInstances.empty();
+    }
+
+    template <class T>
+    int BatchTickHandler<T>::Batch::GetTickOrder()
+    {
+        return m_tickOrder;
+    }
+
+    template <class T>
+    void BatchTickHandler<T>::Batch::OnTick(float deltaTime, ScriptTimePoint time)
+    {
+        m_isTicking = true;
+        T::OnBatchTick(InstanceSpan(m_instances.data(), m_instances.size()), deltaTime, time);
+        m_isTicking = false;
+
+        if (m_hasRemovedInstances)
+        {
+            m_instances.erase(AZStd::remove(m_instances.begin(), m_instances.end(), nullptr), m_instances.end());
+            for (size_t i = 0; i < m_instances.size(); ++i)
+            {
+                AsHandler(m_instances[i]).m_batchIndex = i;
+            }
+            m_hasRemovedInstances = false;
+        }
+        for (T* instance : m_pendingInstances)
+        {
+            AsHandler(instance).m_batchIndex = m_instances.size();
+            m_instances.push_back(instance);
+        }
+        m_pendingInstances.clear();
+
+        if (m_instances.empty())
+        {
+            // The TickBus supports handlers that delete themselves while handling an event.
+            DestroyBatch(this);
+        }
+    }
+} // namespace AZ
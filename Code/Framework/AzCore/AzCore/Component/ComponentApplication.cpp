@@ -21,6 +21,7 @@
 #include <AzCore/Memory/AllocationRecords.h>
 
 #include <AzCore/Memory/AllocatorManager.h>
+#include <AzCore/Memory/FrameArenaAllocator.h>
 
 #include <AzCore/Metrics/EventLoggerFactoryImpl.h>
 #include <AzCore/Metrics/JsonTraceEventLogger.h>
@@ -1619,6 +1620,9 @@ namespace AZ
     {
         AZ_PROFILE_SCOPE(System, "Component application simulation tick");
 
+        // Memory from the frame arena stays valid until the end of the next tick.
+        static_cast<FrameArenaAllocator&>(AllocatorInstance<FrameArenaAllocator>::Get()).AdvanceFrame();
+
         // Only record when the record metrics on tick callback is set
         if (m_recordMetricsOnTickCallback)
         {
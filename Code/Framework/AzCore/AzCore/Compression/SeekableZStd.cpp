@@ -0,0 +1,330 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Compression/SeekableZStd.h>
+#include <AzCore/Jobs/JobCompletion.h>
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Jobs/JobFunction.h>
+#include <AzCore/Jobs/JobManager.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/limits.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+
+#include <zstd.h>
+
+namespace AZ::SeekableZStd
+{
+    namespace Internal
+    {
+        //! Size of a seek table entry, the compressed and decompressed size of a frame. Checksums aren't written.
+        static constexpr size_t SeekTableEntrySize = 8;
+        //! Descriptor bit that's set when the seek table entries include a checksum.
+        static constexpr u8 ChecksumFlag = 0x80;
+        //! Bits of the descriptor that have to be zero.
+        static constexpr u8 ReservedFlags = 0x7C;
+        //! Maximum number of frames allowed by the format.
+        static constexpr u32 MaxFrameCount = 0x8000000;
+
+        static u32 ReadU32(const u8* data)
+        {
+            return static_cast<u32>(data[0]) | (static_cast<u32>(data[1]) << 8) | (static_cast<u32>(data[2]) << 16) |
+                (static_cast<u32>(data[3]) << 24);
+        }
+
+        static void WriteU32(u8* data, u32 value)
+        {
+            data[0] = static_cast<u8>(value);
+            data[1] = static_cast<u8>(value >> 8);
+            data[2] = static_cast<u8>(value >> 16);
+            data[3] = static_cast<u8>(value >> 24);
+        }
+
+        static size_t GetFrameCount(size_t size, size_t frameSize)
+        {
+            return AZStd::max<size_t>((size + frameSize - 1) / frameSize, 1);
+        }
+
+        static size_t GetSeekTableSize(size_t frameCount, size_t entrySize)
+        {
+            return SeekTableHeaderSize + frameCount * entrySize + SeekTableFooterSize;
+        }
+
+        //! Decompresses the part of the frame that overlaps [offset, offset + size) into output, which holds the data
+        //! starting at offset.
+        static bool DecompressFrame(const Frame& frame, const u8* frameData, u64 offset, u64 size, u8* output)
+        {
+            const u64 frameBegin = frame.m_decompressedOffset;
+            const u64 frameEnd = frameBegin + frame.m_decompressedSize;
+            const u64 copyBegin = AZStd::max(offset, frameBegin);
+            const u64 copyEnd = AZStd::min(offset + size, frameEnd);
+            u8* target = output + (copyBegin - offset);
+
+            if (copyBegin == frameBegin && copyEnd == frameEnd)
+            {
+                const size_t result = ZSTD_decompress(target, frame.m_decompressedSize, frameData, frame.m_compressedSize);
+                if (ZSTD_isError(result) || result != frame.m_decompressedSize)
+                {
+                    AZ_Error("SeekableZStd", false, "Failed to decompress frame at offset %llu: %s", frameBegin,
+                        ZSTD_isError(result) ? ZSTD_getErrorName(result) : "unexpected size");
+                    return false;
+                }
+                return true;
+            }
+
+            // Only part of the frame is needed, so decompress it in full to a temporary buffer.
+            AZStd::unique_ptr<u8[]> buffer(new u8[frame.m_decompressedSize]);
+            const size_t result = ZSTD_decompress(buffer.get(), frame.m_decompressedSize, frameData, frame.m_compressedSize);
+            if (ZSTD_isError(result) || result != frame.m_decompressedSize)
+            {
+                AZ_Error("SeekableZStd", false, "Failed to decompress frame at offset %llu: %s", frameBegin,
+                    ZSTD_isError(result) ? ZSTD_getErrorName(result) : "unexpected size");
+                return false;
+            }
+            memcpy(target, buffer.get() + (copyBegin - frameBegin), copyEnd - copyBegin);
+            return true;
+        }
+    } // namespace Internal
+
+    size_t SeekTable::GetSeekTableSize(const void* footer)
+    {
+        const u8* bytes = reinterpret_cast<const u8*>(footer);
+        const u32 frameCount = Internal::ReadU32(bytes);
+        const u8 descriptor = bytes[4];
+        if (Internal::ReadU32(bytes + 5) != SeekTableFooterMagic || (descriptor & Internal::ReservedFlags) != 0 ||
+            frameCount > Internal::MaxFrameCount)
+        {
+            return 0;
+        }
+        const size_t entrySize = Internal::SeekTableEntrySize + ((descriptor & Internal::ChecksumFlag) ? 4 : 0);
+        return Internal::GetSeekTableSize(frameCount, entrySize);
+    }
+
+    bool SeekTable::Load(const void* seekTable, size_t seekTableSize)
+    {
+        m_frames.clear();
+        if (seekTableSize < Internal::GetSeekTableSize(0, Internal::SeekTableEntrySize))
+        {
+            return false;
+        }
+
+        const u8* bytes = reinterpret_cast<const u8*>(seekTable);
+        const u8* footer = bytes + seekTableSize - SeekTableFooterSize;
+        if (GetSeekTableSize(footer) != seekTableSize || Internal::ReadU32(bytes) != SeekTableFrameMagic ||
+            Internal::ReadU32(bytes + 4) != seekTableSize - SeekTableHeaderSize)
+        {
+            return false;
+        }
+
+        const u32 frameCount = Internal::ReadU32(footer);
+        const size_t entrySize = Internal::SeekTableEntrySize + ((footer[4] & Internal::ChecksumFlag) ? 4 : 0);
+        m_frames.reserve(frameCount);
+        u64 compressedOffset = 0;
+        u64 decompressedOffset = 0;
+        for (const u8* entry = bytes + SeekTableHeaderSize; entry < footer; entry += entrySize)
+        {
+            Frame& frame = m_frames.emplace_back();
+            frame.m_compressedOffset = compressedOffset;
+            frame.m_decompressedOffset = decompressedOffset;
+            frame.m_compressedSize = Internal::ReadU32(entry);
+            frame.m_decompressedSize = Internal::ReadU32(entry + 4);
+            compressedOffset += frame.m_compressedSize;
+            decompressedOffset += frame.m_decompressedSize;
+        }
+        return true;
+    }
+
+    const AZStd::vector<Frame>& SeekTable::GetFrames() const
+    {
+        return m_frames;
+    }
+
+    u64 SeekTable::GetCompressedSize() const
+    {
+        return m_frames.empty() ? 0 : m_frames.back().m_compressedOffset + m_frames.back().m_compressedSize;
+    }
+
+    u64 SeekTable::GetDecompressedSize() const
+    {
+        return m_frames.empty() ? 0 : m_frames.back().m_decompressedOffset + m_frames.back().m_decompressedSize;
+    }
+
+    AZStd::pair<size_t, size_t> SeekTable::FindFrames(u64 offset, u64 size) const
+    {
+        AZ_Assert(!m_frames.empty(), "Can't find frames in an empty seek table.");
+        auto findFrame = [this](u64 decompressedOffset)
+        {
+            // Find the last frame that starts at or before the offset.
+            auto frame = AZStd::upper_bound(m_frames.begin(), m_frames.end(), decompressedOffset,
+                [](u64 value, const Frame& frame)
+                {
+                    return value < frame.m_decompressedOffset;
+                });
+            return frame == m_frames.begin() ? size_t{ 0 } : static_cast<size_t>(AZStd::distance(m_frames.begin(), frame) - 1);
+        };
+        const size_t first = findFrame(offset);
+        const size_t last = size == 0 ? first : findFrame(offset + size - 1);
+        return { first, last };
+    }
+
+    size_t CompressBound(size_t size, size_t frameSize)
+    {
+        const size_t frameCount = Internal::GetFrameCount(size, frameSize);
+        return frameCount * ZSTD_compressBound(frameSize) + Internal::GetSeekTableSize(frameCount, Internal::SeekTableEntrySize);
+    }
+
+    size_t Compress(
+        void* compressed, size_t compressedCapacity, const void* uncompressed, size_t uncompressedSize, int compressionLevel,
+        size_t frameSize)
+    {
+        AZ_Assert(frameSize > 0 && frameSize <= AZStd::numeric_limits<u32>::max(), "Invalid seekable zstd frame size %zu.", frameSize);
+
+        const size_t frameCount = Internal::GetFrameCount(uncompressedSize, frameSize);
+        if (frameCount > Internal::MaxFrameCount)
+        {
+            AZ_Error("SeekableZStd", false, "Data of %zu bytes needs more frames than the seekable format supports.", uncompressedSize);
+            return 0;
+        }
+
+        AZStd::vector<u32> compressedSizes;
+        compressedSizes.reserve(frameCount);
+
+        ZSTD_CCtx* context = ZSTD_createCCtx();
+        u8* output = reinterpret_cast<u8*>(compressed);
+        const u8* input = reinterpret_cast<const u8*>(uncompressed);
+        size_t written = 0;
+        for (size_t frame = 0; frame < frameCount; ++frame)
+        {
+            const size_t inputOffset = frame * frameSize;
+            const size_t inputSize = AZStd::min(frameSize, uncompressedSize - inputOffset);
+            const size_t result = ZSTD_compressCCtx(
+                context, output + written, compressedCapacity - written, input + inputOffset, inputSize, compressionLevel);
+            if (ZSTD_isError(result))
+            {
+                AZ_Error("SeekableZStd", false, "Error compressing using zstd: %s", ZSTD_getErrorName(result));
+                ZSTD_freeCCtx(context);
+                return 0;
+            }
+            compressedSizes.push_back(static_cast<u32>(result));
+            written += result;
+        }
+        ZSTD_freeCCtx(context);
+
+        const size_t seekTableSize = Internal::GetSeekTableSize(frameCount, Internal::SeekTableEntrySize);
+        if (compressedCapacity - written < seekTableSize)
+        {
+            AZ_Error("SeekableZStd", false, "Not enough room to store the seek table for %zu frames.", frameCount);
+            return 0;
+        }
+
+        u8* seekTable = output + written;
+        Internal::WriteU32(seekTable, SeekTableFrameMagic);
+        Internal::WriteU32(seekTable + 4, static_cast<u32>(seekTableSize - SeekTableHeaderSize));
+        u8* entry = seekTable + SeekTableHeaderSize;
+        for (size_t frame = 0; frame < frameCount; ++frame)
+        {
+            const size_t inputSize = AZStd::min(frameSize, uncompressedSize - frame * frameSize);
+            Internal::WriteU32(entry, compressedSizes[frame]);
+            Internal::WriteU32(entry + 4, static_cast<u32>(inputSize));
+            entry += Internal::SeekTableEntrySize;
+        }
+        Internal::WriteU32(entry, static_cast<u32>(frameCount));
+        entry[4] = 0; // Descriptor, no checksums.
+        Internal::WriteU32(entry + 5, SeekTableFooterMagic);
+
+        return written + seekTableSize;
+    }
+
+    bool IsSeekable(const void* compressed, size_t compressedSize)
+    {
+        if (compressedSize < SeekTableFooterSize)
+        {
+            return false;
+        }
+        const size_t seekTableSize =
+            SeekTable::GetSeekTableSize(reinterpret_cast<const u8*>(compressed) + compressedSize - SeekTableFooterSize);
+        return seekTableSize != 0 && seekTableSize <= compressedSize;
+    }
+
+    bool DecompressRange(
+        const SeekTable& seekTable, const void* compressedFrames, size_t compressedSize, u64 offset, u64 size, void* output,
+        JobContext* jobContext)
+    {
+        if (size == 0)
+        {
+            return true;
+        }
+
+        if (offset + size > seekTable.GetDecompressedSize())
+        {
+            AZ_Error("SeekableZStd", false, "Range %llu-%llu is outside the decompressed data of %llu bytes.",
+                offset, offset + size, seekTable.GetDecompressedSize());
+            return false;
+        }
+
+        const AZStd::vector<Frame>& frames = seekTable.GetFrames();
+        const auto [first, last] = seekTable.FindFrames(offset, size);
+        const u64 baseOffset = frames[first].m_compressedOffset;
+        if (frames[last].m_compressedOffset + frames[last].m_compressedSize - baseOffset > compressedSize)
+        {
+            AZ_Error("SeekableZStd", false, "The compressed data doesn't contain all frames for range %llu-%llu.", offset, offset + size);
+            return false;
+        }
+
+        const u8* compressedBytes = reinterpret_cast<const u8*>(compressedFrames);
+        u8* outputBytes = reinterpret_cast<u8*>(output);
+        AZStd::atomic_bool success{ true };
+        auto decompress = [&](size_t frame)
+        {
+            if (!Internal::DecompressFrame(
+                    frames[frame], compressedBytes + (frames[frame].m_compressedOffset - baseOffset), offset, size, outputBytes))
+            {
+                success = false;
+            }
+        };
+
+        if (jobContext == nullptr || first == last)
+        {
+            for (size_t frame = first; frame <= last; ++frame)
+            {
+                decompress(frame);
+            }
+            return success;
+        }
+
+        // Fork a job for every frame but the first, which is decompressed on this thread. If this is a worker thread of the
+        // job context, the frames become children of the current job so the thread keeps working while waiting for them.
+        Job* currentJob = jobContext->GetJobManager().GetCurrentJob();
+        JobCompletion completion(jobContext);
+        for (size_t frame = first + 1; frame <= last; ++frame)
+        {
+            Job* job = CreateJobFunction([&decompress, frame]() { decompress(frame); }, true, jobContext);
+            if (currentJob)
+            {
+                currentJob->StartAsChild(job);
+            }
+            else
+            {
+                job->SetDependent(&completion);
+                job->Start();
+            }
+        }
+
+        decompress(first);
+
+        if (currentJob)
+        {
+            currentJob->WaitForChildren();
+        }
+        else
+        {
+            completion.StartAndWaitForCompletion();
+        }
+        return success;
+    }
+} // namespace AZ::SeekableZStd
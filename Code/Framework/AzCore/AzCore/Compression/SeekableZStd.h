@@ -0,0 +1,94 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/base.h>
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/utility/pair.h>
+
+namespace AZ
+{
+    class JobContext;
+
+    /*
+    Seekable zstd container, following the seekable format from the zstd repository:
+    https://github.com/facebook/zstd/blob/dev/contrib/seekable_format/zstd_seekable_compression_format.md
+
+    The data is split in frames that are compressed independently, followed by a skippable frame with a seek table
+    that lists the compressed and decompressed size of every frame. Because the seek table is stored in a skippable
+    frame, the container can still be decompressed in one go by any zstd decoder, but a range of the decompressed data
+    can also be restored by only reading and decompressing the frames that overlap it.
+    */
+    namespace SeekableZStd
+    {
+        //! Magic number of the skippable frame that holds the seek table.
+        inline constexpr u32 SeekTableFrameMagic = 0x184D2A5E;
+        //! Magic number at the very end of a seekable container.
+        inline constexpr u32 SeekTableFooterMagic = 0x8F92EAB1;
+        //! Size of the skippable frame header, the magic number and the size of the frame.
+        inline constexpr size_t SeekTableHeaderSize = 8;
+        //! Size of the footer at the end of the seek table, the number of frames, the descriptor and the magic number.
+        inline constexpr size_t SeekTableFooterSize = 9;
+        //! Size of the decompressed data stored in a single frame unless specified otherwise.
+        inline constexpr size_t DefaultFrameSize = 256 * 1024;
+
+        struct Frame
+        {
+            u64 m_compressedOffset = 0;
+            u64 m_decompressedOffset = 0;
+            u32 m_compressedSize = 0;
+            u32 m_decompressedSize = 0;
+        };
+
+        class AZCORE_API SeekTable
+        {
+        public:
+            AZ_CLASS_ALLOCATOR(SeekTable, AZ::SystemAllocator);
+
+            //! Returns the size of the seek table frame if the footer is the footer of a seek table, otherwise 0.
+            //! @param footer The last SeekTableFooterSize bytes of the compressed data.
+            static size_t GetSeekTableSize(const void* footer);
+
+            //! Reads the seek table frame, which has to be the last GetSeekTableSize bytes of the compressed data.
+            bool Load(const void* seekTable, size_t seekTableSize);
+
+            const AZStd::vector<Frame>& GetFrames() const;
+            //! Size of all frames, without the seek table.
+            u64 GetCompressedSize() const;
+            u64 GetDecompressedSize() const;
+
+            //! Returns the index of the first and last frame that overlap the range of decompressed data.
+            AZStd::pair<size_t, size_t> FindFrames(u64 offset, u64 size) const;
+
+        private:
+            AZStd::vector<Frame> m_frames;
+        };
+
+        //! Returns the maximum size of the seekable container for data of the given size.
+        AZCORE_API size_t CompressBound(size_t size, size_t frameSize = DefaultFrameSize);
+
+        //! Compresses the data into a seekable container.
+        //! @return The size of the container or 0 if the data couldn't be compressed or didn't fit.
+        AZCORE_API size_t Compress(
+            void* compressed, size_t compressedCapacity, const void* uncompressed, size_t uncompressedSize,
+            int compressionLevel = 1, size_t frameSize = DefaultFrameSize);
+
+        //! Returns true if the compressed data ends with a seek table.
+        AZCORE_API bool IsSeekable(const void* compressed, size_t compressedSize);
+
+        //! Decompresses a range of the data in a seekable container.
+        //! @param compressedFrames The compressed data, starting at the first frame returned by SeekTable::FindFrames for the range.
+        //! @param compressedSize Size of compressedFrames, which has to cover all frames that overlap the range.
+        //! @param jobContext If not null, frames are decompressed in parallel on this job context.
+        //! @return True if all frames were decompressed.
+        AZCORE_API bool DecompressRange(
+            const SeekTable& seekTable, const void* compressedFrames, size_t compressedSize, u64 offset, u64 size, void* output,
+            JobContext* jobContext = nullptr);
+    } // namespace SeekableZStd
+} // namespace AZ
@@ -182,6 +182,7 @@ namespace AZ
             static constexpr bool EnableEventQueue = Traits::EnableEventQueue;
             static constexpr bool EventQueueingActiveByDefault = Traits::EventQueueingActiveByDefault;
             static constexpr bool EnableQueuedReferences = Traits::EnableQueuedReferences;
+            static constexpr bool EnableLockFreeEventQueue = Traits::EnableLockFreeEventQueue;
 
             /**
              * True if the EBus supports more than one address. Otherwise, false.
@@ -868,13 +869,10 @@ namespace AZ
             auto& context = Bus::GetOrCreateContext(false);
             if (context.m_queue.IsActive())
             {
-                AZStd::scoped_lock<decltype(context.m_queue.m_messagesMutex)> messageLock(context.m_queue.m_messagesMutex);
-                context.m_queue.m_messages.push(typename Bus::QueuePolicy::BusMessageCall(
-                    [func = AZStd::forward<Function>(func), args...]() mutable
+                context.m_queue.Push([func = AZStd::forward<Function>(func), args...]() mutable
                 {
                     AZStd::invoke(AZStd::forward<Function>(func), AZStd::forward<InputArgs>(args)...);
-                },
-                    typename Traits::AllocatorType()));
+                });
             }
             else
             {
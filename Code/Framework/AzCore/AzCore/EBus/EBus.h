@@ -186,6 +186,22 @@ namespace AZ
          */
         using EventQueueMutexType = NullMutex;
 
+        /**
+         * Specifies whether the event queue is stored in a lock-free ring instead of a queue that's guarded by #EventQueueMutexType.
+         * Use this for buses that many threads queue events on at the same time. Queueing an event doesn't take a lock and
+         * doesn't allocate unless the captured arguments are too large to store inline or the ring is full.
+         * #EventQueueMutexType is not used when this is enabled.
+         * Used only when #EnableEventQueue is true.
+         */
+        static constexpr bool EnableLockFreeEventQueue = false;
+
+        /**
+         * The number of events that can be stored in the lock-free event queue before events are stored in a queue that's
+         * guarded by a mutex. Each event takes 64 bytes. Must be a power of two.
+         * Used only when #EnableLockFreeEventQueue is true.
+         */
+        static constexpr size_t LockFreeEventQueueCapacity = 512;
+
         /**
          * Enables custom logic to run when a handler connects or
          * disconnects from the EBus.
@@ -497,7 +513,8 @@ namespace AZ
         /**
          * Policy for the function queue.
          */
-        using QueuePolicy = EBusQueuePolicy<Traits::EnableEventQueue, ThisType, EventQueueMutexType>;
+        using QueuePolicy = AZStd::conditional_t<ImplTraits::EnableEventQueue && ImplTraits::EnableLockFreeEventQueue,
+            EBusLockFreeQueuePolicy<ThisType>, EBusQueuePolicy<Traits::EnableEventQueue, ThisType, EventQueueMutexType>>;
 
         /**
          * Enables custom logic to run when a handler connects to
@@ -0,0 +1,200 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/base.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/exponential_backoff.h>
+#include <AzCore/std/typetraits/aligned_storage.h>
+#include <AzCore/std/typetraits/decay.h>
+#include <AzCore/std/utils.h>
+
+namespace AZ
+{
+    namespace Internal
+    {
+        /**
+         * Bounded multi-producer/single-consumer ring of type erased calls, used by the lock-free EBus event queue.
+         * Each cell stores its call inline if it fits in the cell, otherwise the call is stored on the heap using the
+         * provided allocator. Producers reserve a cell by advancing the enqueue position and publish it through the
+         * sequence number of the cell, so queueing never takes a lock. The consumer side is not thread safe, callers
+         * have to make sure only one thread consumes at a time.
+         *
+         * \tparam Capacity     The number of cells in the ring. Must be a power of two.
+         * \tparam Allocator    The allocator used for calls that don't fit in a cell.
+         */
+        template <size_t Capacity, class Allocator>
+        class EBusEventQueueRing
+        {
+        public:
+            static_assert(Capacity > 0 && (Capacity & (Capacity - 1)) == 0, "The capacity of the event queue ring has to be a power of two.");
+
+            //! Size in bytes of the call that can be stored in a cell without allocating. Cells are sized to a typical cache line.
+            static constexpr size_t InlineCallSize = 48;
+
+            EBusEventQueueRing()
+            {
+                for (size_t i = 0; i < Capacity; ++i)
+                {
+                    m_cells[i].m_sequence.store(i, AZStd::memory_order_relaxed);
+                }
+            }
+
+            ~EBusEventQueueRing()
+            {
+                Consume(m_enqueuePosition.load(AZStd::memory_order_acquire), false);
+            }
+
+            EBusEventQueueRing(const EBusEventQueueRing&) = delete;
+            EBusEventQueueRing& operator=(const EBusEventQueueRing&) = delete;
+
+            //! Stores the call in the ring. Returns false without touching the call if the ring is full. Safe to call from any thread.
+            template <class Function>
+            bool TryPush(Function&& func)
+            {
+                using CallType = AZStd::decay_t<Function>;
+
+                size_t position = m_enqueuePosition.load(AZStd::memory_order_relaxed);
+                Cell* cell;
+                for (;;)
+                {
+                    cell = &m_cells[position & (Capacity - 1)];
+                    const size_t sequence = cell->m_sequence.load(AZStd::memory_order_acquire);
+                    const intptr_t difference = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(position);
+                    if (difference == 0)
+                    {
+                        if (m_enqueuePosition.compare_exchange_weak(position, position + 1, AZStd::memory_order_relaxed))
+                        {
+                            break;
+                        }
+                    }
+                    else if (difference < 0)
+                    {
+                        // The consumer hasn't released this cell yet, so the ring is full.
+                        return false;
+                    }
+                    else
+                    {
+                        position = m_enqueuePosition.load(AZStd::memory_order_relaxed);
+                    }
+                }
+
+                if constexpr (sizeof(CallType) <= InlineCallSize && alignof(CallType) <= alignof(CellStorage))
+                {
+                    new (&cell->m_storage) CallType(AZStd::forward<Function>(func));
+                    cell->m_operations = &InlineCall<CallType>::s_operations;
+                }
+                else
+                {
+                    Allocator allocator;
+                    void* address = allocator.allocate(sizeof(CallType), alignof(CallType));
+                    *reinterpret_cast<CallType**>(&cell->m_storage) = new (address) CallType(AZStd::forward<Function>(func));
+                    cell->m_operations = &HeapCall<CallType>::s_operations;
+                }
+                cell->m_sequence.store(position + 1, AZStd::memory_order_release);
+                return true;
+            }
+
+            //! Returns the position the next call will be stored at. Calls stored before this position can be consumed with Consume.
+            size_t GetEnqueuePosition() const
+            {
+                return m_enqueuePosition.load(AZStd::memory_order_acquire);
+            }
+
+            //! Executes, or only destroys if execute is false, all calls stored before the end position. Calls that have been
+            //! reserved but not fully stored yet are waited on. Calls that are queued while consuming are left for the next time.
+            //! Only one thread can consume at a time.
+            void Consume(size_t endPosition, bool execute)
+            {
+                size_t position = m_dequeuePosition.load(AZStd::memory_order_relaxed);
+                while (static_cast<intptr_t>(endPosition - position) > 0)
+                {
+                    Cell& cell = m_cells[position & (Capacity - 1)];
+                    AZStd::exponential_backoff backoff;
+                    while (cell.m_sequence.load(AZStd::memory_order_acquire) != position + 1)
+                    {
+                        // A producer has reserved this cell but is still storing the call.
+                        backoff.wait();
+                    }
+
+                    // Move past the cell before running the call so a call that consumes the queue again doesn't run itself.
+                    m_dequeuePosition.store(position + 1, AZStd::memory_order_relaxed);
+                    if (execute)
+                    {
+                        cell.m_operations->m_invoke(&cell.m_storage);
+                    }
+                    cell.m_operations->m_destroy(&cell.m_storage);
+                    cell.m_sequence.store(position + Capacity, AZStd::memory_order_release);
+
+                    position = m_dequeuePosition.load(AZStd::memory_order_relaxed);
+                }
+            }
+
+            //! Returns the number of calls in the ring. This is an estimate if calls are being queued or consumed at the same time.
+            size_t Count() const
+            {
+                const size_t dequeuePosition = m_dequeuePosition.load(AZStd::memory_order_relaxed);
+                const size_t enqueuePosition = m_enqueuePosition.load(AZStd::memory_order_relaxed);
+                return enqueuePosition > dequeuePosition ? enqueuePosition - dequeuePosition : 0;
+            }
+
+        private:
+            struct CallOperations
+            {
+                void (*m_invoke)(void* storage);
+                void (*m_destroy)(void* storage);
+            };
+
+            template <class CallType>
+            struct InlineCall
+            {
+                static void Invoke(void* storage)
+                {
+                    (*reinterpret_cast<CallType*>(storage))();
+                }
+                static void Destroy(void* storage)
+                {
+                    reinterpret_cast<CallType*>(storage)->~CallType();
+                }
+                static constexpr CallOperations s_operations{ &Invoke, &Destroy };
+            };
+
+            template <class CallType>
+            struct HeapCall
+            {
+                static void Invoke(void* storage)
+                {
+                    (**reinterpret_cast<CallType**>(storage))();
+                }
+                static void Destroy(void* storage)
+                {
+                    CallType* call = *reinterpret_cast<CallType**>(storage);
+                    call->~CallType();
+                    Allocator allocator;
+                    allocator.deallocate(call, sizeof(CallType), alignof(CallType));
+                }
+                static constexpr CallOperations s_operations{ &Invoke, &Destroy };
+            };
+
+            using CellStorage = AZStd::aligned_storage_t<InlineCallSize, alignof(void*)>;
+
+            struct Cell
+            {
+                AZStd::atomic<size_t> m_sequence;
+                const CallOperations* m_operations;
+                CellStorage m_storage;
+            };
+
+            Cell m_cells[Capacity];
+            AZStd::atomic<size_t> m_enqueuePosition{ 0 };
+            // Producers and the consumer update their positions independently, so keep them on separate cache lines.
+            char m_padding[64 - sizeof(AZStd::atomic<size_t>)];
+            AZStd::atomic<size_t> m_dequeuePosition{ 0 };
+        };
+    } // namespace Internal
+} // namespace AZ
@@ -18,7 +18,10 @@
 #include <AzCore/std/function/invoke.h>
 #include <AzCore/std/containers/queue.h>
 #include <AzCore/std/containers/intrusive_set.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/mutex.h>
 #include <AzCore/std/parallel/scoped_lock.h>
+#include <AzCore/EBus/Internal/EventQueueRing.h>
 
 
 namespace AZ
@@ -247,6 +250,13 @@ namespace AZ
         MessageQueueType            m_messages;
         MutexType                   m_messagesMutex;        ///< Used to control access to the m_messages. Make sure you never interlock with the EBus mutex. Otherwise, a deadlock can occur.
 
+        template <class Function>
+        void Push(Function&& func)
+        {
+            AZStd::scoped_lock lock(m_messagesMutex);
+            m_messages.push(BusMessageCall(AZStd::forward<Function>(func), typename Bus::AllocatorType()));
+        }
+
         void Execute()
         {
             AZ_Warning("System", m_isActive, "You are calling execute queued functions on a bus which has not activated its function queuing! Call YourBus::AllowFunctionQueuing(true)!");
@@ -296,6 +306,105 @@ namespace AZ
         }
     };
 
+    /**
+     * Queue policy used when AZ::EBusTraits::EnableLockFreeEventQueue is set.
+     * Queued calls are stored in a lock-free ring of fixed-size cells so queueing from multiple threads doesn't contend on a mutex,
+     * and calls that fit in a cell don't allocate. Calls that are queued while the ring is full are stored in an overflow queue
+     * that's guarded by a mutex, after which calls keep going to the overflow queue until the next execute so calls from a single
+     * thread are always executed in the order they were queued.
+     * Only one thread executes the queue at a time, the queue is locked while the queued calls are executed.
+     */
+    template <class Bus>
+    struct EBusLockFreeQueuePolicy
+    {
+        typedef AZStd::function<void()> BusMessageCall;
+
+        typedef AZStd::deque<BusMessageCall, typename Bus::AllocatorType> DequeType;
+        typedef AZStd::queue<BusMessageCall, DequeType > MessageQueueType;
+
+        using RingType = AZ::Internal::EBusEventQueueRing<Bus::Traits::LockFreeEventQueueCapacity, typename Bus::AllocatorType>;
+
+        EBusLockFreeQueuePolicy() = default;
+
+        AZStd::atomic_bool          m_isActive{ Bus::Traits::EventQueueingActiveByDefault };
+        RingType                    m_ring;
+        MessageQueueType            m_overflowMessages;     ///< Calls that were queued while the ring was full.
+        AZStd::mutex                m_overflowMutex;        ///< Used to control access to m_overflowMessages and m_isOverflowing.
+        AZStd::atomic_bool          m_isOverflowing{ false }; ///< Set while there are overflow messages, new calls are added to the overflow queue.
+        AZStd::recursive_mutex      m_consumerMutex;        ///< Only one thread can consume the ring. Recursive as queued calls can execute the queue.
+
+        template <class Function>
+        void Push(Function&& func)
+        {
+            if (!m_isOverflowing.load(AZStd::memory_order_acquire) && m_ring.TryPush(AZStd::forward<Function>(func)))
+            {
+                return;
+            }
+
+            AZStd::scoped_lock lock(m_overflowMutex);
+            m_overflowMessages.push(BusMessageCall(AZStd::forward<Function>(func), typename Bus::AllocatorType()));
+            m_isOverflowing.store(true, AZStd::memory_order_release);
+        }
+
+        void Execute()
+        {
+            AZ_Warning("System", m_isActive, "You are calling execute queued functions on a bus which has not activated its function queuing! Call YourBus::AllowFunctionQueuing(true)!");
+
+            AZStd::scoped_lock consumerLock(m_consumerMutex);
+
+            // Only the calls that have been queued up to this point are executed. The end of the ring is read while the overflow queue
+            // is locked and before overflowing is cleared. Until then, a thread that has a call in the overflow queue keeps queueing to
+            // the overflow queue, so every call it queued to the ring before that is inside the end position and every call it queues
+            // to the ring afterwards is outside it and left for the next execute, after the overflow calls.
+            size_t endPosition;
+            MessageQueueType localMessages;
+            {
+                AZStd::scoped_lock lock(m_overflowMutex);
+                endPosition = m_ring.GetEnqueuePosition();
+                AZStd::swap(localMessages, m_overflowMessages);
+                m_isOverflowing.store(false, AZStd::memory_order_release);
+            }
+
+            m_ring.Consume(endPosition, true);
+            while (!localMessages.empty())
+            {
+                const BusMessageCall& localMessage = localMessages.front();
+                localMessage();
+                localMessages.pop();
+            }
+        }
+
+        void Clear()
+        {
+            AZStd::scoped_lock consumerLock(m_consumerMutex);
+
+            AZStd::scoped_lock lock(m_overflowMutex);
+            m_ring.Consume(m_ring.GetEnqueuePosition(), false);
+            m_overflowMessages = {};
+            m_isOverflowing.store(false, AZStd::memory_order_release);
+        }
+
+        void SetActive(bool isActive)
+        {
+            m_isActive = isActive;
+            if (!isActive)
+            {
+                Clear();
+            }
+        };
+
+        bool IsActive()
+        {
+            return m_isActive;
+        }
+
+        size_t Count()
+        {
+            AZStd::scoped_lock lock(m_overflowMutex);
+            return m_ring.Count() + m_overflowMessages.size();
+        }
+    };
+
     /// @endcond
 
     ////////////////////////////////////////////////////////////
@@ -28,6 +28,8 @@ namespace AZ::IO
         m_conflictResolution = rhs.m_conflictResolution;
         m_isCompressed = rhs.m_isCompressed;
         m_isSharedPak = rhs.m_isSharedPak;
+        m_mappedData = AZStd::move(rhs.m_mappedData);
+        m_seekTable = AZStd::move(rhs.m_seekTable);
 
         return *this;
     }
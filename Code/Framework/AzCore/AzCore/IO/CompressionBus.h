@@ -12,10 +12,16 @@
 #include <AzCore/IO/Streamer/RequestPath.h>
 #include <AzCore/std/parallel/mutex.h>
 #include <AzCore/std/functional.h>
+#include <AzCore/std/smart_ptr/shared_ptr.h>
 #include <AzCore/std/string/string_view.h>
 
 namespace AZ
 {
+    namespace SeekableZStd
+    {
+        class SeekTable;
+    }
+
     namespace IO
     {
         union CompressionTag
@@ -61,6 +67,13 @@ namespace AZ
             bool m_isCompressed = false;
             //! Whether or not the pak file is used in multiple location or reads can be done exclusively.
             bool m_isSharedPak = false; 
+            //! If the file is stored uncompressed in a memory mapped archive, this points to the file data inside the mapping,
+            //! otherwise nullptr. The data is read-only. The pointer shares ownership of the mapping, so the data stays valid
+            //! for as long as the request holds on to it, even if the archive is closed in the meantime.
+            AZStd::shared_ptr<const void> m_mappedData;
+            //! If the file is compressed as a seekable zstd container, this holds the table with its frames, otherwise nullptr.
+            //! Reads of part of the file only need to read and decompress the frames that overlap the requested range.
+            AZStd::shared_ptr<const SeekableZStd::SeekTable> m_seekTable;
         };
 
         class Compression
@@ -0,0 +1,108 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/IO/Streamer/DeadlineStatistics.h>
+#include <AzCore/std/string/string.h>
+
+namespace AZ::IO
+{
+    static constexpr const char* BandNames[DeadlineStatistics::BandCount] = {
+        "Low priority reads", "Medium priority reads", "High priority reads", "Highest priority reads"
+    };
+    static constexpr const char* QueueTimeBucketNames[DeadlineStatistics::QueueTimeBucketCount] = {
+        "<1ms", "<4ms", "<16ms", "<64ms", "<256ms", ">=256ms"
+    };
+
+    size_t DeadlineStatistics::GetBandIndex(IStreamerTypes::Priority priority)
+    {
+        constexpr size_t BandSize = (size_t{ IStreamerTypes::s_priorityHighest } + 1) / BandCount;
+        return priority / BandSize;
+    }
+
+    void DeadlineStatistics::RecordQueueTime(IStreamerTypes::Priority priority, Statistic::TimeValue queueTime)
+    {
+        Band& band = m_bands[GetBandIndex(priority)];
+        band.m_queueTime.PushEntry(queueTime);
+
+        size_t bucket = 0;
+        while (bucket < QueueTimeBucketBounds.size() && queueTime >= QueueTimeBucketBounds[bucket])
+        {
+            ++bucket;
+        }
+        band.m_queueTimeHistogram[bucket]++;
+    }
+
+    void DeadlineStatistics::RecordCompletion(
+        IStreamerTypes::Priority priority, AZStd::chrono::steady_clock::time_point deadline,
+        AZStd::chrono::steady_clock::time_point completionTime)
+    {
+        Band& band = m_bands[GetBandIndex(priority)];
+        band.m_completedCount++;
+        if (completionTime > deadline)
+        {
+            band.m_missedDeadlineCount++;
+            band.m_lateness.PushEntry(AZStd::chrono::duration_cast<Statistic::TimeValue>(completionTime - deadline));
+        }
+    }
+
+    void DeadlineStatistics::RecordShed(IStreamerTypes::Priority priority)
+    {
+        m_bands[GetBandIndex(priority)].m_shedCount++;
+    }
+
+    auto DeadlineStatistics::GetBand(size_t index) const -> const Band&
+    {
+        AZ_Assert(index < BandCount, "Priority band %zu is out of range.", index);
+        return m_bands[index];
+    }
+
+    void DeadlineStatistics::CollectStatistics(AZStd::vector<Statistic>& statistics) const
+    {
+        for (size_t i = 0; i < BandCount; ++i)
+        {
+            const Band& band = m_bands[i];
+            if (band.m_completedCount == 0 && band.m_queueTime.GetNumRecorded() == 0 && band.m_shedCount == 0)
+            {
+                continue;
+            }
+
+            statistics.push_back(Statistic::CreateTimeRange(
+                BandNames[i], "Queue time", band.m_queueTime.CalculateAverage(), band.m_queueTime.GetMinimum(),
+                band.m_queueTime.GetMaximum(),
+                "The time between the scheduler receiving a read and queuing it for processing. Long queue times mean there are more "
+                "important reads or more reads than the storage can keep up with."));
+
+            AZStd::string histogram;
+            for (size_t bucket = 0; bucket < QueueTimeBucketCount; ++bucket)
+            {
+                histogram += AZStd::string::format(
+                    "%s%s: %llu", bucket == 0 ? "" : ", ", QueueTimeBucketNames[bucket], band.m_queueTimeHistogram[bucket]);
+            }
+            statistics.push_back(Statistic::CreatePersistentString(
+                BandNames[i], "Queue time histogram", AZStd::move(histogram),
+                "The number of reads per queue time bucket since Streamer started."));
+
+            double missedPercentage = band.m_completedCount > 0
+                ? aznumeric_cast<double>(band.m_missedDeadlineCount) / aznumeric_cast<double>(band.m_completedCount)
+                : 0.0;
+            statistics.push_back(Statistic::CreatePercentage(
+                BandNames[i], "Missed deadlines", missedPercentage,
+                "The percentage of reads that completed after their deadline since Streamer started."));
+            statistics.push_back(Statistic::CreateTimeRange(
+                BandNames[i], "Lateness", band.m_lateness.CalculateAverage(), band.m_lateness.GetMinimum(),
+                band.m_lateness.GetMaximum(),
+                "How late reads that missed their deadline completed. If the queue time is small compared to this, the reads themselves "
+                "are too slow, otherwise the scheduler had more work than it could finish in time."));
+            statistics.push_back(Statistic::CreateInteger(
+                BandNames[i], "Shed prefetches", aznumeric_caster(band.m_shedCount),
+                "The number of prefetches that were canceled because the scheduler was overloaded. See cl_streamerOverloadPolicy.",
+                Statistic::GraphType::None));
+        }
+    }
+} // namespace AZ::IO
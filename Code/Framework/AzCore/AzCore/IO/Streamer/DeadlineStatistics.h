@@ -0,0 +1,66 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/base.h>
+#include <AzCore/IO/IStreamerTypes.h>
+#include <AzCore/IO/Streamer/Statistics.h>
+#include <AzCore/IO/Streamer/StreamerConfiguration.h>
+#include <AzCore/std/chrono/chrono.h>
+#include <AzCore/std/containers/array.h>
+#include <AzCore/std/containers/vector.h>
+
+namespace AZ::IO
+{
+    //! Keeps track of how long read requests wait in the scheduler and how many of them miss their deadline.
+    //! Requests are grouped in bands by their priority, so it's possible to tell which kind of requests are struggling,
+    //! for instance if only low priority prefetches miss their deadlines or if high priority requests are held up as well.
+    //! This class isn't thread safe and should only be updated from the scheduling thread.
+    class AZCORE_API DeadlineStatistics final
+    {
+    public:
+        //! Number of priority bands. Each band covers a quarter of the priority range.
+        static constexpr size_t BandCount = 4;
+        //! Upper bounds of the buckets in the queue time histogram. The last bucket holds all queue times that are
+        //! larger than the last bound.
+        static constexpr AZStd::array<Statistic::TimeValue, 5> QueueTimeBucketBounds = {
+            Statistic::TimeValue(1000), Statistic::TimeValue(4000), Statistic::TimeValue(16000), Statistic::TimeValue(64000),
+            Statistic::TimeValue(256000) };
+        static constexpr size_t QueueTimeBucketCount = QueueTimeBucketBounds.size() + 1;
+
+        struct Band
+        {
+            //! Number of requests per queue time bucket.
+            AZStd::array<u64, QueueTimeBucketCount> m_queueTimeHistogram{};
+            //! Time between the scheduler receiving a request and queuing it on the stream stack.
+            TimedAverageWindow<s_statisticsWindowSize> m_queueTime;
+            //! How late requests that missed their deadline completed.
+            TimedAverageWindow<s_statisticsWindowSize> m_lateness;
+            u64 m_completedCount{ 0 };
+            u64 m_missedDeadlineCount{ 0 };
+            //! Number of prefetches that were canceled because the scheduler was overloaded.
+            u64 m_shedCount{ 0 };
+        };
+
+        static size_t GetBandIndex(IStreamerTypes::Priority priority);
+
+        void RecordQueueTime(IStreamerTypes::Priority priority, Statistic::TimeValue queueTime);
+        void RecordCompletion(
+            IStreamerTypes::Priority priority, AZStd::chrono::steady_clock::time_point deadline,
+            AZStd::chrono::steady_clock::time_point completionTime);
+        void RecordShed(IStreamerTypes::Priority priority);
+
+        const Band& GetBand(size_t index) const;
+
+        void CollectStatistics(AZStd::vector<Statistic>& statistics) const;
+
+    private:
+        AZStd::array<Band, BandCount> m_bands;
+    };
+} // namespace AZ::IO
@@ -76,6 +76,7 @@ namespace AZ::IO::Requests
         RequestPath m_path; //!< Relative path to the target file.
         IStreamerTypes::RequestMemoryAllocator* m_allocator; //!< Allocator used to manage the memory for this request.
         AZStd::chrono::steady_clock::time_point m_deadline; //!< Time by which this request should have been completed.
+        AZStd::chrono::steady_clock::time_point m_queueTime; //!< Time at which the scheduler received this request.
         void* m_output; //!< The memory address assigned (during processing) to store the read data to.
         u64 m_outputSize; //!< The memory size of the addressed used to store the read data.
         u64 m_offset; //!< The offset in bytes into the file.
@@ -7,6 +7,7 @@
  */
 
 #include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/Compression/SeekableZStd.h>
 #include <AzCore/Debug/Profiler.h>
 #include <AzCore/IO/CompressionBus.h>
 #include <AzCore/IO/Streamer/FileRequest.h>
@@ -48,6 +49,23 @@ namespace AZ::IO
     static constexpr char ReadBoundName[] = "Read bound";
 #endif // AZ_STREAMER_ADD_EXTRA_PROFILING_INFO
 
+    //! Returns the offset in the archive and the size of the compressed data that needs to be read for the request. This is
+    //! the entire compressed file unless the file has a seek table, in which case only the frames that overlap the requested
+    //! range are read.
+    static AZStd::pair<u64, size_t> GetCompressedReadRange(const Requests::CompressedReadData& data)
+    {
+        const CompressionInfo& info = data.m_compressionInfo;
+        if (info.m_seekTable && !info.m_seekTable->GetFrames().empty())
+        {
+            const AZStd::vector<SeekableZStd::Frame>& frames = info.m_seekTable->GetFrames();
+            auto [firstFrame, lastFrame] = info.m_seekTable->FindFrames(data.m_readOffset, data.m_readSize);
+            u64 begin = frames[firstFrame].m_compressedOffset;
+            u64 end = frames[lastFrame].m_compressedOffset + frames[lastFrame].m_compressedSize;
+            return { info.m_offset + begin, aznumeric_cast<size_t>(end - begin) };
+        }
+        return { info.m_offset, info.m_compressedSize };
+    }
+
     bool FullFileDecompressor::DecompressionInformation::IsProcessing() const
     {
         return !!m_compressedData;
@@ -116,7 +134,14 @@ namespace AZ::IO
             using Command = AZStd::decay_t<decltype(args)>;
             if constexpr (AZStd::is_same_v<Command, Requests::CompressedReadData>)
             {
-                m_pendingReads.push_back(request);
+                if (args.m_compressionInfo.m_mappedData)
+                {
+                    CopyFromMappedArchive(request, args);
+                }
+                else
+                {
+                    m_pendingReads.push_back(request);
+                }
             }
             else if constexpr (AZStd::is_same_v<Command, Requests::FileExistsCheckData>)
             {
@@ -210,7 +235,7 @@ namespace AZ::IO
                 auto data = AZStd::get_if<Requests::CompressedReadData>(&compressedRequest->GetCommand());
                 AZ_Assert(data, "Compressed request in the decompression queue in FullFileDecompressor didn't contain compression read data.");
 
-                size_t bytesToDecompress = data->m_compressionInfo.m_compressedSize;
+                size_t bytesToDecompress = GetCompressedReadRange(*data).second;
                 auto decompressionDuration = AZStd::chrono::microseconds(
                     aznumeric_cast<u64>((bytesToDecompress * totalDecompressionDuration) / totalBytesDecompressed));
                 auto timeInProcessing = now - m_processingJobs[i].m_jobStartTime;
@@ -261,7 +286,7 @@ namespace AZ::IO
             FileRequest* compressedRequest = m_readRequests[i]->GetParent();
             auto data = AZStd::get_if<Requests::CompressedReadData>(&compressedRequest->GetCommand());
 
-            size_t bytesToDecompress = data->m_compressionInfo.m_compressedSize;
+            size_t bytesToDecompress = GetCompressedReadRange(*data).second;
             auto decompressionDuration = AZStd::chrono::microseconds(
                 aznumeric_cast<u64>((bytesToDecompress * totalDecompressionDuration) / totalBytesDecompressed));
             smallestDecompressionDuration = AZStd::min(smallestDecompressionDuration, decompressionDuration);
@@ -298,7 +323,7 @@ namespace AZ::IO
         if (data)
         {
             AZStd::chrono::microseconds processingTime = decompressionDelay;
-            size_t bytesToDecompress = data->m_compressionInfo.m_compressedSize;
+            size_t bytesToDecompress = GetCompressedReadRange(*data).second;
             processingTime += AZStd::chrono::microseconds(
                 aznumeric_cast<u64>((bytesToDecompress * totalDecompressionDurationUs) / totalBytesDecompressed));
 
@@ -363,6 +388,13 @@ namespace AZ::IO
 #endif
         }
 
+        if (m_mappedBytesCopied > 0)
+        {
+            statistics.push_back(Statistic::CreateByteSize(
+                m_name, "Copied from mapped archives", m_mappedBytesCopied,
+                "The total amount of data that was copied directly out of memory mapped archives without going through a file read."));
+        }
+
         StreamStackEntry::CollectStatistics(statistics);
     }
 
@@ -382,9 +414,11 @@ namespace AZ::IO
         if (CompressionUtils::FindCompressionInfo(info, data.m_path.GetRelativePath()))
         {
             FileRequest* nextRequest = m_context->GetNewInternalRequest();
-            if (info.m_isCompressed)
+            if (info.m_isCompressed || info.m_mappedData)
             {
-                AZ_Assert(info.m_decompressor,
+                // Uncompressed files in memory mapped archives also go through a compressed read so they can be
+                // copied straight out of the mapping instead of being read from the archive.
+                AZ_Assert(!info.m_isCompressed || info.m_decompressor,
                     "FullFileDecompressor::PrepareRequest found a compressed file, but no decompressor to decompress with.");
                 nextRequest->CreateCompressedRead(request, AZStd::move(info), data.m_output, data.m_offset, data.m_size);
             }
@@ -507,6 +541,19 @@ namespace AZ::IO
         }
     }
 
+    void FullFileDecompressor::CopyFromMappedArchive(FileRequest* request, const Requests::CompressedReadData& data)
+    {
+        AZ_PROFILE_FUNCTION(AzCore);
+        AZ_Assert(data.m_output, "Read from a memory mapped archive was queued without an output buffer.");
+
+        const u8* source = reinterpret_cast<const u8*>(data.m_compressionInfo.m_mappedData.get()) + data.m_readOffset;
+        memcpy(data.m_output, source, data.m_readSize);
+        m_mappedBytesCopied += data.m_readSize;
+
+        request->SetStatus(IStreamerTypes::RequestStatus::Completed);
+        m_context->MarkRequestAsCompleted(request);
+    }
+
     void FullFileDecompressor::StartArchiveRead(FileRequest* compressedReadRequest)
     {
         if (!m_next)
@@ -531,15 +578,16 @@ namespace AZ::IO
                 // The buffer is aligned down but the offset is not corrected. If the offset was adjusted it would mean the same data is read
                 // multiple times and negates the block cache's ability to detect these cases. By still adjusting it means that the reads between
                 // the BlockCache's prolog and epilog are read into aligned buffers.
-                size_t offsetAdjustment = info.m_offset - AZ_SIZE_ALIGN_DOWN(info.m_offset, aznumeric_cast<size_t>(m_alignment));
-                size_t bufferSize = AZ_SIZE_ALIGN_UP((info.m_compressedSize + offsetAdjustment), aznumeric_cast<size_t>(m_alignment));
+                auto [readOffset, readSize] = GetCompressedReadRange(*data);
+                size_t offsetAdjustment = readOffset - AZ_SIZE_ALIGN_DOWN(readOffset, aznumeric_cast<size_t>(m_alignment));
+                size_t bufferSize = AZ_SIZE_ALIGN_UP((readSize + offsetAdjustment), aznumeric_cast<size_t>(m_alignment));
                 m_readBuffers[i] = reinterpret_cast<Buffer>(AZ::AllocatorInstance<AZ::SystemAllocator>::Get().Allocate(
                     bufferSize, m_alignment));
                 m_memoryUsage += bufferSize;
 
                 FileRequest* archiveReadRequest = m_context->GetNewInternalRequest();
                 archiveReadRequest->CreateRead(compressedReadRequest, m_readBuffers[i] + offsetAdjustment, bufferSize, info.m_archiveFilename,
-                    info.m_offset, info.m_compressedSize, info.m_isSharedPak);
+                    readOffset, readSize, info.m_isSharedPak);
                 archiveReadRequest->SetCompletionCallback(
                     [this, readSlot = i](FileRequest& request)
                     {
@@ -584,9 +632,9 @@ namespace AZ::IO
         {
             auto data = AZStd::get_if<Requests::CompressedReadData>(&compressedRequest->GetCommand());
             AZ_Assert(data, "Compressed request in FullFileDecompressor that finished unsuccessfully didn't contain compression read data.");
-            CompressionInfo& info = data->m_compressionInfo;
-            size_t offsetAdjustment = info.m_offset - AZ_SIZE_ALIGN_DOWN(info.m_offset, aznumeric_cast<size_t>(m_alignment));
-            size_t bufferSize = AZ_SIZE_ALIGN_UP((info.m_compressedSize + offsetAdjustment), aznumeric_cast<size_t>(m_alignment));
+            auto [readOffset, readSize] = GetCompressedReadRange(*data);
+            size_t offsetAdjustment = readOffset - AZ_SIZE_ALIGN_DOWN(readOffset, aznumeric_cast<size_t>(m_alignment));
+            size_t bufferSize = AZ_SIZE_ALIGN_UP((readSize + offsetAdjustment), aznumeric_cast<size_t>(m_alignment));
             m_memoryUsage -= bufferSize;
 
             if (m_readBuffers[readSlot] != nullptr)
@@ -647,10 +695,20 @@ namespace AZ::IO
                 AZ_Assert(data, "Compressed request in FullFileDecompressor that's starting decompression didn't contain compression read data.");
                 AZ_Assert(data->m_compressionInfo.m_decompressor, "FullFileDecompressor is queuing a decompression job but couldn't find a decompressor.");
 
-                info.m_alignmentOffset = aznumeric_caster(data->m_compressionInfo.m_offset -
-                    AZ_SIZE_ALIGN_DOWN(data->m_compressionInfo.m_offset, aznumeric_cast<size_t>(m_alignment)));
+                u64 readOffset = GetCompressedReadRange(*data).first;
+                info.m_alignmentOffset = aznumeric_caster(readOffset - AZ_SIZE_ALIGN_DOWN(readOffset, aznumeric_cast<size_t>(m_alignment)));
 
-                if (data->m_readOffset == 0 && data->m_readSize == data->m_compressionInfo.m_uncompressedSize)
+                if (data->m_compressionInfo.m_seekTable)
+                {
+                    // Only the frames overlapping the requested range were read and they can be decompressed directly into the
+                    // output, so no intermediate buffer is needed.
+                    auto job = [this, &info]()
+                    {
+                        SeekableDecompression(m_context, info, m_decompressionjobContext.get());
+                    };
+                    decompressionJob = AZ::CreateJobFunction(job, true, m_decompressionjobContext.get());
+                }
+                else if (data->m_readOffset == 0 && data->m_readSize == data->m_compressionInfo.m_uncompressedSize)
                 {
                     auto job = [this, &info]()
                     {
@@ -699,11 +757,12 @@ namespace AZ::IO
         AZ_Assert(compressedRequest, "A wait request attached to FullFileDecompressor was completed but didn't have a parent compressed request.");
         auto data = AZStd::get_if<Requests::CompressedReadData>(&compressedRequest->GetCommand());
         AZ_Assert(data, "Compressed request in FullFileDecompressor that completed decompression didn't contain compression read data.");
-        CompressionInfo& info = data->m_compressionInfo;
-        size_t offsetAdjustment = info.m_offset - AZ_SIZE_ALIGN_DOWN(info.m_offset, aznumeric_cast<size_t>(m_alignment));
-        size_t bufferSize = AZ_SIZE_ALIGN_UP((info.m_compressedSize + offsetAdjustment), aznumeric_cast<size_t>(m_alignment));
+        auto [readOffset, readSize] = GetCompressedReadRange(*data);
+        size_t offsetAdjustment = readOffset - AZ_SIZE_ALIGN_DOWN(readOffset, aznumeric_cast<size_t>(m_alignment));
+        size_t bufferSize = AZ_SIZE_ALIGN_UP((readSize + offsetAdjustment), aznumeric_cast<size_t>(m_alignment));
         m_memoryUsage -= bufferSize;
-        if (data->m_readOffset != 0 || data->m_readSize != data->m_compressionInfo.m_uncompressedSize)
+        if (!data->m_compressionInfo.m_seekTable &&
+            (data->m_readOffset != 0 || data->m_readSize != data->m_compressionInfo.m_uncompressedSize))
         {
             m_memoryUsage -= data->m_compressionInfo.m_uncompressedSize;
         }
@@ -712,7 +771,7 @@ namespace AZ::IO
             jobInfo.m_jobStartTime - jobInfo.m_queueStartTime).count());
         m_decompressionDurationMicroSec.PushEntry(AZStd::chrono::duration_cast<AZStd::chrono::microseconds>(
             endTime - jobInfo.m_jobStartTime).count());
-        m_bytesDecompressed.PushEntry(data->m_compressionInfo.m_compressedSize);
+        m_bytesDecompressed.PushEntry(readSize);
 
         AZ::AllocatorInstance<AZ::SystemAllocator>::Get().DeAllocate(jobInfo.m_compressedData, bufferSize, m_alignment);
         jobInfo.m_compressedData = nullptr;
@@ -768,6 +827,27 @@ namespace AZ::IO
         context->WakeUpSchedulingThread();
     }
 
+    void FullFileDecompressor::SeekableDecompression(StreamerContext* context, DecompressionInformation& info, JobContext* jobContext)
+    {
+        info.m_jobStartTime = AZStd::chrono::steady_clock::now();
+
+        FileRequest* compressedRequest = info.m_waitRequest->GetParent();
+        AZ_Assert(compressedRequest, "A wait request attached to FullFileDecompressor was completed but didn't have a parent compressed request.");
+        auto request = AZStd::get_if<Requests::CompressedReadData>(&compressedRequest->GetCommand());
+        AZ_Assert(request, "Compressed request in FullFileDecompressor that's running seekable decompression didn't contain compression read data.");
+        CompressionInfo& compressionInfo = request->m_compressionInfo;
+        AZ_Assert(compressionInfo.m_seekTable, "Seekable decompressor job started, but there's no seek table assigned.");
+
+        // The frames are decompressed in parallel on the decompression job context. While this job waits for the frames
+        // to be decompressed, its worker thread picks up frame jobs as well.
+        bool success = SeekableZStd::DecompressRange(*compressionInfo.m_seekTable, info.m_compressedData + info.m_alignmentOffset,
+            GetCompressedReadRange(*request).second, request->m_readOffset, request->m_readSize, request->m_output, jobContext);
+        info.m_waitRequest->SetStatus(success ? IStreamerTypes::RequestStatus::Completed : IStreamerTypes::RequestStatus::Failed);
+
+        context->MarkRequestAsCompleted(info.m_waitRequest);
+        context->WakeUpSchedulingThread();
+    }
+
     void FullFileDecompressor::Report(const Requests::ReportData& data) const
     {
         switch (data.m_reportType)
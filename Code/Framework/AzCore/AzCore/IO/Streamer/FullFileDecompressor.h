@@ -53,6 +53,8 @@ namespace AZ::IO
     //! Finally, the lack of an upper limit also means that the duration of the decompression job
     //! can vary largely so a dedicated job system is used to decompress on to avoid blocking
     //! the main job system from working.
+    //! Files that are stored with a seek table are the exception. For these only the frames that overlap
+    //! the requested range are read and the frames are decompressed in parallel directly into the output.
     class AZCORE_API FullFileDecompressor
         : public StreamStackEntry
     {
@@ -100,6 +102,7 @@ namespace AZ::IO
         void EstimateCompressedReadRequest(FileRequest* request, AZStd::chrono::microseconds& cumulativeDelay,
             AZStd::chrono::microseconds decompressionDelay, double totalDecompressionDurationUs, double totalBytesDecompressed) const;
 
+        void CopyFromMappedArchive(FileRequest* request, const Requests::CompressedReadData& data);
         void StartArchiveRead(FileRequest* compressedReadRequest);
         void FinishArchiveRead(FileRequest* readRequest, u32 readSlot);
         bool StartDecompressions();
@@ -107,6 +110,7 @@ namespace AZ::IO
 
         static void FullDecompression(StreamerContext* context, DecompressionInformation& info);
         static void PartialDecompression(StreamerContext* context, DecompressionInformation& info);
+        static void SeekableDecompression(StreamerContext* context, DecompressionInformation& info, JobContext* jobContext);
 
         void Report(const Requests::ReportData& data) const;
 
@@ -131,6 +135,7 @@ namespace AZ::IO
         AZStd::unique_ptr<JobContext> m_decompressionjobContext;
 
         size_t m_memoryUsage{ 0 }; //!< Amount of memory used for buffers by the decompressor.
+        u64 m_mappedBytesCopied{ 0 }; //!< Total number of bytes copied directly out of memory mapped archives.
         u32 m_maxNumReads{ 2 };
         u32 m_numInFlightReads{ 0 };
         u32 m_numPendingDecompression{ 0 };
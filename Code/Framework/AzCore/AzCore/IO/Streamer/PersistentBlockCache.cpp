@@ -0,0 +1,566 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/Debug/Profiler.h>
+#include <AzCore/IO/FileIO.h>
+#include <AzCore/IO/Path/Path.h>
+#include <AzCore/IO/Streamer/FileRequest.h>
+#include <AzCore/IO/Streamer/PersistentBlockCache.h>
+#include <AzCore/IO/Streamer/StreamerContext.h>
+#include <AzCore/Math/Crc.h>
+#include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/hash.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
+
+namespace AZ::IO
+{
+    AZStd::shared_ptr<StreamStackEntry> PersistentBlockCacheConfig::AddStreamStackEntry(
+        const HardwareInformation& hardware, AZStd::shared_ptr<StreamStackEntry> parent)
+    {
+        AZ::IO::FixedMaxPath cachePath;
+        FileIOBase* fileIO = FileIOBase::GetInstance();
+        if (fileIO == nullptr || !fileIO->ResolvePath(cachePath, AZ::IO::PathView(m_cachePath)))
+        {
+            AZ_Warning("Streamer", false, "Unable to resolve the path '%s' for the PersistentBlockCache. The cache will not be used.",
+                m_cachePath.c_str());
+            return parent;
+        }
+
+        size_t alignment = hardware.m_maxPhysicalSectorSize;
+        u64 blockSize = SizeAlignUp(m_blockSizeKib * 1_kib, alignment);
+        u64 cacheSize = m_cacheSizeMib * 1_mib;
+        if (blockSize > cacheSize)
+        {
+            AZ_Warning("Streamer", false, "Size (%llu) for PersistentBlockCache isn't big enough to hold at least one cache block of size "
+                "(%llu). The cache size will be increased to fit one cache block.", cacheSize, blockSize);
+            cacheSize = blockSize;
+        }
+
+        auto stackEntry = AZStd::make_shared<PersistentBlockCache>(
+            cachePath.Native(), cacheSize, aznumeric_cast<u32>(blockSize), aznumeric_cast<u32>(alignment));
+        stackEntry->SetNext(AZStd::move(parent));
+        return stackEntry;
+    }
+
+    void PersistentBlockCacheConfig::Reflect(AZ::ReflectContext* context)
+    {
+        if (auto serializeContext = azrtti_cast<AZ::SerializeContext*>(context); serializeContext != nullptr)
+        {
+            serializeContext->Class<PersistentBlockCacheConfig, IStreamerStackConfig>()
+                ->Version(1)
+                ->Field("CachePath", &PersistentBlockCacheConfig::m_cachePath)
+                ->Field("CacheSizeMib", &PersistentBlockCacheConfig::m_cacheSizeMib)
+                ->Field("BlockSizeKib", &PersistentBlockCacheConfig::m_blockSizeKib);
+        }
+    }
+
+    static constexpr char CacheHitRateName[] = "Cache hit rate";
+
+    // Blocks are identified by a SHA-1 based uuid of the path instead of the path hash, which is too small to rule out collisions
+    // between all the files that go through the cache over its lifetime. A collision would return the blocks of another file.
+    static Uuid CreatePathId(const RequestPath& path)
+    {
+        return Uuid::CreateName(path.GetAbsolutePath().Native());
+    }
+
+    bool PersistentBlockCache::BlockKey::operator==(const BlockKey& rhs) const
+    {
+        return m_pathId == rhs.m_pathId && m_modificationTime == rhs.m_modificationTime && m_offset == rhs.m_offset;
+    }
+
+    size_t PersistentBlockCache::BlockKeyHasher::operator()(const BlockKey& key) const
+    {
+        size_t hash = key.m_pathId.GetHash();
+        AZStd::hash_combine(hash, key.m_modificationTime, key.m_offset);
+        return hash;
+    }
+
+    PersistentBlockCache::PersistentBlockCache(AZStd::string_view cachePath, u64 cacheSize, u32 blockSize, u32 alignment)
+        : StreamStackEntry("Persistent block cache")
+        , m_cachePath(cachePath)
+        , m_blockSize(blockSize)
+        , m_alignment(alignment)
+    {
+        AZ_Assert(IStreamerTypes::IsPowerOf2(alignment), "Alignment needs to be a power of 2.");
+        AZ_Assert(IStreamerTypes::IsAlignedTo(blockSize, alignment), "Block size needs to be a multiple of the alignment.");
+
+        m_numBlocks = aznumeric_caster(cacheSize / blockSize);
+        m_recentlyUsed = RecentlyUsedIndex<u32>(m_numBlocks);
+        m_blockEntries = AZStd::unique_ptr<BlockEntry[]>(new BlockEntry[m_numBlocks]);
+        m_validatedBlocks = AZStd::unique_ptr<bool[]>(new bool[m_numBlocks]);
+        m_blockBuffer = reinterpret_cast<u8*>(AZ::AllocatorInstance<AZ::SystemAllocator>::Get().Allocate(m_blockSize, m_alignment));
+
+        // The block data starts after the header and the block entries and is aligned so blocks can be read without buffering.
+        m_dataOffset = SizeAlignUp(sizeof(CacheFileHeader) + sizeof(BlockEntry) * m_numBlocks, m_alignment);
+
+        m_isCacheFileOpen = OpenCacheFile();
+    }
+
+    PersistentBlockCache::~PersistentBlockCache()
+    {
+        m_cacheFile.Close();
+        AZ::AllocatorInstance<AZ::SystemAllocator>::Get().DeAllocate(m_blockBuffer, m_blockSize, m_alignment);
+    }
+
+    void PersistentBlockCache::QueueRequest(FileRequest* request)
+    {
+        AZ_Assert(request, "QueueRequest was provided a null request.");
+
+        AZStd::visit([this, request](auto&& args)
+        {
+            using Command = AZStd::decay_t<decltype(args)>;
+            if constexpr (AZStd::is_same_v<Command, Requests::ReadData>)
+            {
+                ReadFile(request, args);
+                return;
+            }
+            else
+            {
+                if constexpr (AZStd::is_same_v<Command, Requests::FlushData>)
+                {
+                    FlushCache(args.m_path);
+                }
+                else if constexpr (AZStd::is_same_v<Command, Requests::FlushAllData>)
+                {
+                    FlushEntireCache();
+                }
+                StreamStackEntry::QueueRequest(request);
+            }
+        }, request->GetCommand());
+    }
+
+    void PersistentBlockCache::UpdateStatus(Status& status) const
+    {
+        StreamStackEntry::UpdateStatus(status);
+        status.m_isIdle = status.m_isIdle && m_numInFlightRequests == 0;
+    }
+
+    void PersistentBlockCache::FlushCache(const RequestPath& filePath)
+    {
+        Uuid pathId = CreatePathId(filePath);
+        for (u32 i = 0; i < m_numBlocks; ++i)
+        {
+            if (m_blockEntries[i].m_size != 0 && m_blockEntries[i].m_pathId == pathId)
+            {
+                InvalidateBlock(i);
+            }
+        }
+        if (auto it = m_fileInfo.find(filePath); it != m_fileInfo.end())
+        {
+            // Clear the file information so it's retrieved again on the next read.
+            it->second = {};
+        }
+    }
+
+    void PersistentBlockCache::FlushEntireCache()
+    {
+        if (m_isCacheFileOpen)
+        {
+            m_isCacheFileOpen = ResetCacheFile();
+        }
+        m_fileInfo.clear();
+    }
+
+    void PersistentBlockCache::CollectStatistics(AZStd::vector<Statistic>& statistics) const
+    {
+        statistics.push_back(Statistic::CreatePercentage(
+            m_name, CacheHitRateName, CalculateHitRatePercentage(),
+            "The percentage of requests that could be fully serviced with data from the cache file. After a restart this value should "
+            "quickly go up if the same data is loaded as in the previous run. If it stays low, the cache may be too small to hold all "
+            "frequently used data."));
+        statistics.push_back(Statistic::CreateInteger(
+            m_name, "Cached blocks", m_numCachedBlocks,
+            "The number of blocks in the cache file that hold data.", Statistic::GraphType::None));
+        statistics.push_back(Statistic::CreateInteger(
+            m_name, "Invalidated blocks", m_numInvalidatedBlocks,
+            "The number of blocks that were found in the cache file but couldn't be used because they failed validation. A high number "
+            "can indicate problems with the storage the cache file is on.", Statistic::GraphType::None));
+
+        StreamStackEntry::CollectStatistics(statistics);
+    }
+
+    double PersistentBlockCache::CalculateHitRatePercentage() const
+    {
+        return m_hitRateStat.GetAverage();
+    }
+
+    bool PersistentBlockCache::IsCacheFileOpen() const
+    {
+        return m_isCacheFileOpen;
+    }
+
+    u32 PersistentBlockCache::GetNumCachedBlocks() const
+    {
+        return m_numCachedBlocks;
+    }
+
+    const AZStd::string& PersistentBlockCache::GetCacheFilePath() const
+    {
+        return m_cachePath;
+    }
+
+    void PersistentBlockCache::ReadFile(FileRequest* request, Requests::ReadData& data)
+    {
+        if (!m_next)
+        {
+            request->SetStatus(IStreamerTypes::RequestStatus::Failed);
+            m_context->MarkRequestAsCompleted(request);
+            return;
+        }
+
+        FileInfo fileInfo;
+        if (!m_isCacheFileOpen || data.m_size == 0 || !GetFileInfo(data.m_path, fileInfo) ||
+            data.m_offset + data.m_size > fileInfo.m_size)
+        {
+            StreamStackEntry::QueueRequest(request);
+            return;
+        }
+
+        u8* output = reinterpret_cast<u8*>(data.m_output);
+        u64 firstBlock = data.m_offset / m_blockSize;
+        u64 lastBlock = (data.m_offset + data.m_size - 1) / m_blockSize;
+        u64 firstMissingBlock = 0;
+        bool isMissingBlocks = false;
+        bool fullyCached = true;
+        for (u64 block = firstBlock; block <= lastBlock; ++block)
+        {
+            BlockKey key{ fileInfo.m_pathId, fileInfo.m_modificationTime, block * m_blockSize };
+            u64 blockSize = AZStd::min<u64>(m_blockSize, fileInfo.m_size - key.m_offset);
+            if (ReadFromCache(key, blockSize, output, data.m_offset, data.m_size))
+            {
+                if (isMissingBlocks)
+                {
+                    QueueMissingBlocks(request, data, fileInfo, firstMissingBlock, block - 1);
+                    isMissingBlocks = false;
+                }
+            }
+            else
+            {
+                fullyCached = false;
+                if (!isMissingBlocks)
+                {
+                    firstMissingBlock = block;
+                    isMissingBlocks = true;
+                }
+            }
+        }
+        if (isMissingBlocks)
+        {
+            // Consecutive missing blocks are read with a single request to avoid adding additional seeks.
+            QueueMissingBlocks(request, data, fileInfo, firstMissingBlock, lastBlock);
+        }
+
+        m_hitRateStat.PushSample(fullyCached ? 1.0 : 0.0);
+        Statistic::PlotImmediate(m_name, CacheHitRateName, m_hitRateStat.GetMostRecentSample());
+
+        if (fullyCached)
+        {
+            request->SetStatus(IStreamerTypes::RequestStatus::Completed);
+            m_context->MarkRequestAsCompleted(request);
+        }
+    }
+
+    void PersistentBlockCache::QueueMissingBlocks(
+        FileRequest* request, Requests::ReadData& data, const FileInfo& fileInfo, u64 firstBlock, u64 lastBlock)
+    {
+        u64 readOffset = firstBlock * m_blockSize;
+        u64 readSize = AZStd::min<u64>((lastBlock - firstBlock + 1) * m_blockSize, fileInfo.m_size - readOffset);
+        u64 bufferSize = SizeAlignUp(readSize, m_alignment);
+        u8* buffer = reinterpret_cast<u8*>(AZ::AllocatorInstance<AZ::SystemAllocator>::Get().Allocate(bufferSize, m_alignment));
+
+        BlockKey firstKey{ fileInfo.m_pathId, fileInfo.m_modificationTime, readOffset };
+        u8* output = reinterpret_cast<u8*>(data.m_output);
+        u64 outputOffset = data.m_offset;
+        u64 outputSize = data.m_size;
+        u64 fileSize = fileInfo.m_size;
+
+        FileRequest* readRequest = m_context->GetNewInternalRequest();
+        readRequest->CreateRead(request, buffer, bufferSize, data.m_path, readOffset, readSize, data.m_sharedRead);
+        readRequest->SetCompletionCallback(
+            [this, buffer, bufferSize, output, outputOffset, outputSize, firstKey, fileSize](FileRequest& readRequest)
+            {
+                AZ_PROFILE_FUNCTION(AzCore);
+                CompleteMissingBlocks(readRequest, buffer, bufferSize, output, outputOffset, outputSize, firstKey, fileSize);
+            });
+        m_numInFlightRequests++;
+        m_next->QueueRequest(readRequest);
+    }
+
+    void PersistentBlockCache::CompleteMissingBlocks(
+        FileRequest& readRequest, u8* buffer, u64 bufferSize, u8* output, u64 outputOffset, u64 outputSize, BlockKey firstKey,
+        u64 fileSize)
+    {
+        if (readRequest.GetStatus() == IStreamerTypes::RequestStatus::Completed)
+        {
+            u64 readSize = AZStd::min(bufferSize, fileSize - firstKey.m_offset);
+
+            u64 copyStart = AZStd::max(outputOffset, firstKey.m_offset);
+            u64 copyEnd = AZStd::min(outputOffset + outputSize, firstKey.m_offset + readSize);
+            memcpy(output + (copyStart - outputOffset), buffer + (copyStart - firstKey.m_offset), copyEnd - copyStart);
+
+            for (u64 offset = 0; offset < readSize; offset += m_blockSize)
+            {
+                BlockKey key = firstKey;
+                key.m_offset += offset;
+                WriteToCache(key, buffer + offset, AZStd::min<u64>(m_blockSize, readSize - offset));
+            }
+        }
+
+        AZ::AllocatorInstance<AZ::SystemAllocator>::Get().DeAllocate(buffer, bufferSize, m_alignment);
+        AZ_Assert(m_numInFlightRequests > 0, "Persistent block cache completed more reads than it queued.");
+        m_numInFlightRequests--;
+    }
+
+    bool PersistentBlockCache::GetFileInfo(const RequestPath& filePath, FileInfo& fileInfo)
+    {
+        auto it = m_fileInfo.find(filePath);
+        if (it != m_fileInfo.end() && it->second.m_modificationTime != 0)
+        {
+            fileInfo = it->second;
+            return true;
+        }
+
+        // The modification time isn't available through the streaming stack, so it's retrieved directly. This is only done the
+        // first time a file is read or after it has been flushed.
+        const char* path = filePath.GetAbsolutePathCStr();
+        fileInfo.m_pathId = CreatePathId(filePath);
+        fileInfo.m_modificationTime = SystemFile::ModificationTime(path);
+        fileInfo.m_size = SystemFile::Length(path);
+        if (fileInfo.m_modificationTime == 0 || fileInfo.m_size == 0)
+        {
+            return false;
+        }
+        if (it != m_fileInfo.end())
+        {
+            it->second = fileInfo;
+        }
+        else
+        {
+            m_fileInfo.emplace(filePath, fileInfo);
+        }
+        return true;
+    }
+
+    bool PersistentBlockCache::ReadFromCache(const BlockKey& key, u64 blockSize, u8* output, u64 outputOffset, u64 outputSize)
+    {
+        auto it = m_cachedBlocks.find(key);
+        if (it == m_cachedBlocks.end())
+        {
+            return false;
+        }
+
+        u32 index = it->second;
+        if (m_blockEntries[index].m_size != blockSize)
+        {
+            m_numInvalidatedBlocks++;
+            InvalidateBlock(index);
+            return false;
+        }
+
+        u64 copyStart = AZStd::max(outputOffset, key.m_offset);
+        u64 copyEnd = AZStd::min(outputOffset + outputSize, key.m_offset + blockSize);
+        u8* copyTarget = output + (copyStart - outputOffset);
+        if (m_validatedBlocks[index])
+        {
+            // The block has already been validated so only read the part that's needed.
+            u64 copySize = copyEnd - copyStart;
+            m_cacheFile.Seek(GetBlockDataOffset(index) + (copyStart - key.m_offset), SystemFile::SF_SEEK_BEGIN);
+            if (m_cacheFile.Read(copySize, copyTarget) != copySize)
+            {
+                InvalidateBlock(index);
+                return false;
+            }
+        }
+        else
+        {
+            m_cacheFile.Seek(GetBlockDataOffset(index), SystemFile::SF_SEEK_BEGIN);
+            if (m_cacheFile.Read(blockSize, m_blockBuffer) != blockSize ||
+                static_cast<u32>(AZ::Crc32(m_blockBuffer, blockSize)) != m_blockEntries[index].m_checksum)
+            {
+                m_numInvalidatedBlocks++;
+                InvalidateBlock(index);
+                return false;
+            }
+            m_validatedBlocks[index] = true;
+            memcpy(copyTarget, m_blockBuffer + (copyStart - key.m_offset), copyEnd - copyStart);
+        }
+
+        m_recentlyUsed.Touch(index);
+        return true;
+    }
+
+    void PersistentBlockCache::WriteToCache(const BlockKey& key, const u8* data, u64 blockSize)
+    {
+        if (!m_isCacheFileOpen || m_cachedBlocks.find(key) != m_cachedBlocks.end())
+        {
+            return;
+        }
+
+        u32 index = m_recentlyUsed.TouchLeastRecentlyUsed();
+        BlockEntry& entry = m_blockEntries[index];
+        if (entry.m_size != 0)
+        {
+            InvalidateBlock(index);
+            m_recentlyUsed.Touch(index);
+        }
+
+        // The entry is still marked as unused at this point, so if the application stops while the data is being written
+        // the block won't be used on the next run.
+        m_cacheFile.Seek(GetBlockDataOffset(index), SystemFile::SF_SEEK_BEGIN);
+        if (m_cacheFile.Write(data, blockSize) != blockSize)
+        {
+            m_recentlyUsed.Flush(index);
+            return;
+        }
+
+        entry.m_pathId = key.m_pathId;
+        entry.m_modificationTime = key.m_modificationTime;
+        entry.m_offset = key.m_offset;
+        entry.m_size = aznumeric_cast<u32>(blockSize);
+        entry.m_checksum = static_cast<u32>(AZ::Crc32(data, blockSize));
+        if (!WriteBlockEntry(index))
+        {
+            entry = {};
+            m_recentlyUsed.Flush(index);
+            return;
+        }
+
+        m_validatedBlocks[index] = true;
+        m_cachedBlocks.emplace(key, index);
+        m_numCachedBlocks++;
+    }
+
+    bool PersistentBlockCache::OpenCacheFile()
+    {
+        // Processes that use the same settings, such as the Editor and a game launcher, resolve to the same cache file. Only one
+        // can use it, the others use the next numbered cache file that isn't in use.
+        AZ::IO::Path configuredPath(m_cachePath);
+        AZ::IO::Path extension = configuredPath.Extension();
+        for (u32 i = 0; i < s_maxCacheFiles; ++i)
+        {
+            AZ::IO::Path path = configuredPath;
+            if (i > 0)
+            {
+                path.ReplaceExtension(AZ::IO::PathView(AZStd::string::format(".%u%s", i, extension.c_str())));
+            }
+            if (LockCacheFile(path.c_str()))
+            {
+                m_cachePath = path.Native();
+                break;
+            }
+        }
+        if (!m_cacheFile.IsOpen())
+        {
+            AZ_Warning("Streamer", false, "Unable to open a cache file at '%s' for the PersistentBlockCache that isn't in use by another "
+                "process. The cache will not be used.", m_cachePath.c_str());
+            return false;
+        }
+
+        CacheFileHeader header{};
+        u64 entriesSize = sizeof(BlockEntry) * m_numBlocks;
+        if (m_cacheFile.Read(sizeof(header), &header) == sizeof(header) &&
+            header.m_magic == s_cacheFileMagic && header.m_version == s_cacheFileVersion &&
+            header.m_blockSize == m_blockSize && header.m_numBlocks == m_numBlocks &&
+            m_cacheFile.Read(entriesSize, m_blockEntries.get()) == entriesSize)
+        {
+            for (u32 i = 0; i < m_numBlocks; ++i)
+            {
+                BlockEntry& entry = m_blockEntries[i];
+                m_validatedBlocks[i] = false;
+                if (entry.m_size != 0 && entry.m_size <= m_blockSize)
+                {
+                    m_cachedBlocks.emplace(BlockKey{ entry.m_pathId, entry.m_modificationTime, entry.m_offset }, i);
+                    m_recentlyUsed.Touch(i);
+                    m_numCachedBlocks++;
+                }
+                else
+                {
+                    entry = {};
+                }
+            }
+            return true;
+        }
+
+        // The cache file is new or was created with different settings.
+        return ResetCacheFile();
+    }
+
+    bool PersistentBlockCache::LockCacheFile(const char* path)
+    {
+        // The file is never truncated when it's opened, as that would destroy the cache of a process that has it locked.
+        if (!m_cacheFile.Open(path, SystemFile::SF_OPEN_READ_WRITE | SystemFile::SF_OPEN_CREATE_NEW | SystemFile::SF_OPEN_CREATE_PATH) &&
+            !m_cacheFile.Open(path, SystemFile::SF_OPEN_READ_WRITE))
+        {
+            return false;
+        }
+        if (!m_cacheFile.TryLockExclusive())
+        {
+            m_cacheFile.Close();
+            return false;
+        }
+        return true;
+    }
+
+    bool PersistentBlockCache::ResetCacheFile()
+    {
+        m_cachedBlocks.clear();
+        m_recentlyUsed.FlushAll();
+        m_numCachedBlocks = 0;
+        for (u32 i = 0; i < m_numBlocks; ++i)
+        {
+            m_blockEntries[i] = {};
+            m_validatedBlocks[i] = false;
+        }
+
+        // The file stays open so the lock is kept. Writing the empty block entries is enough to drop all blocks.
+        CacheFileHeader header{ s_cacheFileMagic, s_cacheFileVersion, m_blockSize, m_numBlocks };
+        u64 entriesSize = sizeof(BlockEntry) * m_numBlocks;
+        m_cacheFile.Seek(0, SystemFile::SF_SEEK_BEGIN);
+        if (m_cacheFile.Write(&header, sizeof(header)) != sizeof(header) ||
+            m_cacheFile.Write(m_blockEntries.get(), entriesSize) != entriesSize)
+        {
+            AZ_Warning("Streamer", false, "Unable to write to cache file '%s' for the PersistentBlockCache. The cache will not be used.",
+                m_cachePath.c_str());
+            m_cacheFile.Close();
+            return false;
+        }
+        return true;
+    }
+
+    bool PersistentBlockCache::WriteBlockEntry(u32 index)
+    {
+        m_cacheFile.Seek(GetBlockEntryOffset(index), SystemFile::SF_SEEK_BEGIN);
+        return m_cacheFile.Write(&m_blockEntries[index], sizeof(BlockEntry)) == sizeof(BlockEntry);
+    }
+
+    void PersistentBlockCache::InvalidateBlock(u32 index)
+    {
+        BlockEntry& entry = m_blockEntries[index];
+        if (entry.m_size != 0)
+        {
+            m_cachedBlocks.erase(BlockKey{ entry.m_pathId, entry.m_modificationTime, entry.m_offset });
+            m_numCachedBlocks--;
+            entry = {};
+            WriteBlockEntry(index);
+        }
+        m_validatedBlocks[index] = false;
+        m_recentlyUsed.Flush(index);
+    }
+
+    u64 PersistentBlockCache::GetBlockEntryOffset(u32 index) const
+    {
+        return sizeof(CacheFileHeader) + sizeof(BlockEntry) * index;
+    }
+
+    u64 PersistentBlockCache::GetBlockDataOffset(u32 index) const
+    {
+        return m_dataOffset + u64{ m_blockSize } * index;
+    }
+} // namespace AZ::IO
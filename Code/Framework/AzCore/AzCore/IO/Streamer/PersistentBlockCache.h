@@ -0,0 +1,183 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/IO/SystemFile.h>
+#include <AzCore/IO/Streamer/RecentlyUsedIndex.h>
+#include <AzCore/IO/Streamer/RequestPath.h>
+#include <AzCore/IO/Streamer/Statistics.h>
+#include <AzCore/IO/Streamer/StreamerConfiguration.h>
+#include <AzCore/IO/Streamer/StreamStackEntry.h>
+#include <AzCore/Math/Uuid.h>
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/Statistics/RunningStatistic.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+#include <AzCore/std/string/string.h>
+
+namespace AZ::IO
+{
+    namespace Requests
+    {
+        struct ReadData;
+    }
+
+    //! Configuration for the PersistentBlockCache. The cache keeps blocks of previously read files in a file on local storage
+    //! so they're still available after the application restarts. Place it directly above the storage drive that reads from
+    //! slow storage, such as network attached volumes, and below any in-memory caches and decompressors.
+    struct AZCORE_API PersistentBlockCacheConfig final :
+        public IStreamerStackConfig
+    {
+        AZ_RTTI(AZ::IO::PersistentBlockCacheConfig, "{0ACB52F2-CE58-4665-8B69-6880564418EB}", IStreamerStackConfig);
+        AZ_CLASS_ALLOCATOR(PersistentBlockCacheConfig, AZ::SystemAllocator);
+
+        ~PersistentBlockCacheConfig() override = default;
+        AZStd::shared_ptr<StreamStackEntry> AddStreamStackEntry(
+            const HardwareInformation& hardware, AZStd::shared_ptr<StreamStackEntry> parent) override;
+        static void Reflect(AZ::ReflectContext* context);
+
+        //! The path to the file the cache is stored in. Aliases such as @user@ will be resolved. If the file is in use by another
+        //! process, a numbered file next to it is used instead, such as PersistentBlockCache.1.bin.
+        AZStd::string m_cachePath{ "@user@/Streamer/PersistentBlockCache.bin" };
+        //! The overall size of the cache file in megabytes.
+        u32 m_cacheSizeMib{ 1024 };
+        //! The size of the individual blocks inside the cache in kilobytes. This will be rounded up to the sector size of the drive.
+        u32 m_blockSizeKib{ 256 };
+    };
+
+    //! Second level cache that stores blocks of files in a cache file on local storage. Blocks are identified by a name based uuid
+    //! of the path of the file they're read from, the modification time of that file and their offset, so blocks from files that
+    //! have been changed since they were cached are never used. Each block is stored with a checksum which is validated the first
+    //! time a block is used after the cache file has been opened. When the cache is full the least recently used block is replaced.
+    //! The cache file is locked while it's open so processes that share the same configuration, such as the Editor and a game
+    //! launcher, never write to the same file.
+    //! Reading and writing the cache file is done synchronously as the cache file is expected to be on fast local storage.
+    class AZCORE_API PersistentBlockCache
+        : public StreamStackEntry
+    {
+    public:
+        PersistentBlockCache(AZStd::string_view cachePath, u64 cacheSize, u32 blockSize, u32 alignment);
+        PersistentBlockCache(PersistentBlockCache&& rhs) = delete;
+        PersistentBlockCache(const PersistentBlockCache& rhs) = delete;
+        ~PersistentBlockCache() override;
+
+        PersistentBlockCache& operator=(PersistentBlockCache&& rhs) = delete;
+        PersistentBlockCache& operator=(const PersistentBlockCache& rhs) = delete;
+
+        void QueueRequest(FileRequest* request) override;
+
+        void UpdateStatus(Status& status) const override;
+
+        void FlushCache(const RequestPath& filePath);
+        void FlushEntireCache();
+
+        void CollectStatistics(AZStd::vector<Statistic>& statistics) const override;
+
+        double CalculateHitRatePercentage() const;
+        //! Returns true if the cache file could be opened. If not, all requests are forwarded to the next entry.
+        bool IsCacheFileOpen() const;
+        //! Returns the number of blocks that currently hold data.
+        u32 GetNumCachedBlocks() const;
+        //! Returns the path of the cache file that's used, which is a numbered file if the configured one was in use.
+        const AZStd::string& GetCacheFilePath() const;
+
+    protected:
+        static constexpr u32 s_cacheFileMagic = 0x43425350; // 'PSBC'
+        static constexpr u32 s_cacheFileVersion = 2;
+        //! The number of cache files that are tried when the configured one is in use by another process.
+        static constexpr u32 s_maxCacheFiles = 8;
+
+        struct CacheFileHeader
+        {
+            u32 m_magic;
+            u32 m_version;
+            u32 m_blockSize;
+            u32 m_numBlocks;
+        };
+
+        //! Description of a block as it's stored in the cache file. A block with a size of zero is unused.
+        struct BlockEntry
+        {
+            Uuid m_pathId;
+            u64 m_modificationTime;
+            u64 m_offset;
+            u32 m_size;
+            u32 m_checksum;
+        };
+
+        struct BlockKey
+        {
+            Uuid m_pathId;
+            u64 m_modificationTime;
+            u64 m_offset;
+
+            bool operator==(const BlockKey& rhs) const;
+        };
+
+        struct BlockKeyHasher
+        {
+            size_t operator()(const BlockKey& key) const;
+        };
+
+        struct FileInfo
+        {
+            Uuid m_pathId;
+            u64 m_modificationTime;
+            u64 m_size;
+        };
+
+        void ReadFile(FileRequest* request, Requests::ReadData& data);
+        void QueueMissingBlocks(FileRequest* request, Requests::ReadData& data, const FileInfo& fileInfo, u64 firstBlock, u64 lastBlock);
+        void CompleteMissingBlocks(
+            FileRequest& readRequest, u8* buffer, u64 bufferSize, u8* output, u64 outputOffset, u64 outputSize, BlockKey firstKey,
+            u64 fileSize);
+        bool GetFileInfo(const RequestPath& filePath, FileInfo& fileInfo);
+
+        //! Copies the part of a cached block that overlaps with the output range. Returns false if the block isn't cached or
+        //! isn't valid anymore.
+        bool ReadFromCache(const BlockKey& key, u64 blockSize, u8* output, u64 outputOffset, u64 outputSize);
+        void WriteToCache(const BlockKey& key, const u8* data, u64 blockSize);
+
+        bool OpenCacheFile();
+        bool LockCacheFile(const char* path);
+        bool ResetCacheFile();
+        bool WriteBlockEntry(u32 index);
+        void InvalidateBlock(u32 index);
+
+        u64 GetBlockEntryOffset(u32 index) const;
+        u64 GetBlockDataOffset(u32 index) const;
+
+        //! Map of the blocks in the cache file to the index of the block.
+        AZStd::unordered_map<BlockKey, u32, BlockKeyHasher> m_cachedBlocks;
+        //! Path id, modification time and size of the files that have been read. Cleared entries are retrieved again.
+        AZStd::unordered_map<RequestPath, FileInfo> m_fileInfo;
+
+        AZ::Statistics::RunningStatistic m_hitRateStat;
+
+        RecentlyUsedIndex<u32> m_recentlyUsed;
+        SystemFile m_cacheFile;
+        AZStd::string m_cachePath;
+
+        //! The description of each block, matching what's stored in the cache file.
+        AZStd::unique_ptr<BlockEntry[]> m_blockEntries; // Array of m_numBlocks size.
+        //! Whether or not the checksum of the block has been validated since the cache file was opened.
+        AZStd::unique_ptr<bool[]> m_validatedBlocks; // Array of m_numBlocks size.
+        //! Scratch buffer to load a single block from the cache file in.
+        u8* m_blockBuffer{ nullptr };
+
+        u64 m_dataOffset{ 0 };
+        u32 m_blockSize;
+        u32 m_alignment;
+        u32 m_numBlocks;
+        u32 m_numCachedBlocks{ 0 };
+        u32 m_numInvalidatedBlocks{ 0 };
+        s32 m_numInFlightRequests{ 0 };
+        bool m_isCacheFileOpen{ false };
+    };
+} // namespace AZ::IO
@@ -9,6 +9,7 @@
 #include <AzCore/IO/Streamer/Scheduler.h>
 
 #include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/Console/IConsole.h>
 #include <AzCore/Debug/Profiler.h>
 #include <AzCore/IO/Streamer/FileRequest.h>
 #include <AzCore/std/containers/deque.h>
@@ -16,6 +17,15 @@
 
 namespace AZ::IO
 {
+    AZ_CVAR(bool, cl_streamerEarliestDeadlineFirst, false, nullptr, ConsoleFunctorFlags::Null,
+        "If enabled, AZ::IO::Streamer orders reads by deadline first and only uses the priority and file locality to break ties. "
+        "By default reads are ordered by file locality unless they're estimated to miss their deadline.");
+    AZ_CVAR(uint32_t, cl_streamerOverloadPolicy, 0, nullptr, ConsoleFunctorFlags::Null,
+        "How AZ::IO::Streamer reacts when reads are estimated to miss their deadline because more work is queued than can be finished "
+        "in time. 0: do nothing, 1: schedule prefetches after all other reads, 2: cancel prefetches that would miss their own deadline.");
+    AZ_CVAR(uint32_t, cl_streamerPrefetchPriority, IStreamerTypes::s_priorityLow, nullptr, ConsoleFunctorFlags::Null,
+        "Reads with this priority or lower are considered prefetches by cl_streamerOverloadPolicy.");
+
     static constexpr const char* SchedulerName = "Scheduler";
 #if AZ_STREAMER_ADD_EXTRA_PROFILING_INFO
     static constexpr const char* ImmediateReadsName = "Immediate reads";
@@ -139,6 +149,11 @@ namespace AZ::IO
             SchedulerName, "Is suspended", m_isSuspended,
             "Whether or not the scheduler is suspended. When suspended the scheduler will not do any processing and effectively prevents "
             "Streamer from doing any work.", Statistic::GraphType::None));
+        statistics.push_back(Statistic::CreateBoolean(
+            SchedulerName, "Is overloaded", m_threadData.m_isOverloaded,
+            "Whether or not the last scheduling pass estimated that reads would miss their deadline because more work is queued than "
+            "can be finished in time. Reads that were queued after their deadline had already passed are not considered. The per priority "
+            "queue times show which reads are held up, and cl_streamerOverloadPolicy can be used to demote or shed prefetches."));
 #if AZ_STREAMER_ADD_EXTRA_PROFILING_INFO
         statistics.push_back(Statistic::CreateBoolean(
             SchedulerName, "Is idle", m_stackStatus.m_isIdle,
@@ -346,6 +361,9 @@ namespace AZ::IO
                     m_processingSize += info.m_uncompressedSize;
 #endif
                 }
+                m_context.GetDeadlineStatistics().RecordQueueTime(parentReadRequest->m_priority,
+                    AZStd::chrono::duration_cast<Statistic::TimeValue>(AZStd::chrono::steady_clock::now() - parentReadRequest->m_queueTime));
+
                 AZ_PROFILE_INTERVAL_START_COLORED(AzCore, next, ProfilerColor,
                     "Streamer queued %zu: %s", next->GetCommand().index(), parentReadRequest->m_path.GetRelativePath());
                 m_threadData.m_streamStack->QueueRequest(next);
@@ -405,11 +423,11 @@ namespace AZ::IO
             }
         }
 
-#if AZ_STREAMER_ADD_EXTRA_PROFILING_INFO
         AZStd::chrono::steady_clock::time_point now = AZStd::chrono::steady_clock::now();
+#if AZ_STREAMER_ADD_EXTRA_PROFILING_INFO
         auto visitor = [this, now](auto&& args) -> void
 #else
-        auto visitor = [](auto&& args) -> void
+        auto visitor = [now](auto&& args) -> void
 #endif
         {
             using Command = AZStd::decay_t<decltype(args)>;
@@ -419,6 +437,7 @@ namespace AZ::IO
                 {
                     args.m_allocator->LockAllocator();
                 }
+                args.m_queueTime = now;
 #if AZ_STREAMER_ADD_EXTRA_PROFILING_INFO
                 m_immediateReadsPercentageStat.PushSample(args.m_deadline < now ? 1.0 : 0.0);
                 Statistic::PlotImmediate(SchedulerName, ImmediateReadsName, m_immediateReadsPercentageStat.GetMostRecentSample());
@@ -549,6 +568,30 @@ namespace AZ::IO
             return Order::Equal;
         }
 
+        // When overloaded, prefetches are only processed once all other reads have been queued.
+        if (m_threadData.m_demotePrefetches)
+        {
+            bool firstIsPrefetch = Thread_IsPrefetch(*firstRead);
+            bool secondIsPrefetch = Thread_IsPrefetch(*secondRead);
+            if (firstIsPrefetch != secondIsPrefetch)
+            {
+                return secondIsPrefetch ? Order::FirstRequest : Order::SecondRequest;
+            }
+        }
+
+        if (m_threadData.m_earliestDeadlineFirst)
+        {
+            if (firstRead->m_deadline != secondRead->m_deadline)
+            {
+                return firstRead->m_deadline < secondRead->m_deadline ? Order::FirstRequest : Order::SecondRequest;
+            }
+            if (firstRead->m_priority != secondRead->m_priority)
+            {
+                return firstRead->m_priority > secondRead->m_priority ? Order::FirstRequest : Order::SecondRequest;
+            }
+            // Both requests have the same deadline and priority, so continue to order them by the amount of seeking needed.
+        }
+
         bool firstInPanic = first->GetEstimatedCompletion() > firstRead->m_deadline;
         bool secondInPanic = second->GetEstimatedCompletion() > secondRead->m_deadline;
         // Both request are at risk of not completing before their deadline.
@@ -643,10 +686,16 @@ namespace AZ::IO
         AZStd::chrono::steady_clock::time_point now = AZStd::chrono::steady_clock::now();
         auto& pendingQueue = m_context.GetPreparedRequests();
 
+        m_threadData.m_earliestDeadlineFirst = cl_streamerEarliestDeadlineFirst;
+        m_threadData.m_prefetchPriority = aznumeric_cast<IStreamerTypes::Priority>(
+            AZStd::min<uint32_t>(cl_streamerPrefetchPriority, IStreamerTypes::s_priorityHighest));
+
         m_threadData.m_streamStack->UpdateCompletionEstimates(now, m_threadData.m_internalPendingRequests,
             pendingQueue.begin(), pendingQueue.end());
         m_threadData.m_internalPendingRequests.clear();
 
+        Thread_HandleOverload();
+
         if (m_context.GetNumPreparedRequests() > 1)
         {
             AZ_PROFILE_SCOPE(AzCore,
@@ -680,4 +729,53 @@ namespace AZ::IO
             AZStd::sort(pendingQueue.begin(), pendingQueue.end(), sorter);
         }
     }
+
+    void Scheduler::Thread_HandleOverload()
+    {
+        auto& pendingQueue = m_context.GetPreparedRequests();
+
+        bool isOverloaded = false;
+        for (const FileRequest* pending : pendingQueue)
+        {
+            // Reads that were queued after their deadline had already passed will be late regardless of the amount of work
+            // that's queued, so only reads that could have been completed in time are considered.
+            const Requests::ReadRequestData* read = pending->GetCommandFromChain<Requests::ReadRequestData>();
+            if (read != nullptr && !Thread_IsPrefetch(*read) && read->m_deadline > read->m_queueTime &&
+                pending->GetEstimatedCompletion() > read->m_deadline)
+            {
+                isOverloaded = true;
+                break;
+            }
+        }
+        m_threadData.m_isOverloaded = isOverloaded;
+
+        OverloadPolicy policy = static_cast<OverloadPolicy>(AZStd::min<uint32_t>(cl_streamerOverloadPolicy, 2));
+        m_threadData.m_demotePrefetches = isOverloaded && policy == OverloadPolicy::Demote;
+        if (!isOverloaded || policy != OverloadPolicy::Shed)
+        {
+            return;
+        }
+
+        auto pendingIt = pendingQueue.begin();
+        while (pendingIt != pendingQueue.end())
+        {
+            const Requests::ReadRequestData* read = (*pendingIt)->GetCommandFromChain<Requests::ReadRequestData>();
+            if (read != nullptr && Thread_IsPrefetch(*read) && (*pendingIt)->GetEstimatedCompletion() > read->m_deadline)
+            {
+                m_context.GetDeadlineStatistics().RecordShed(read->m_priority);
+                (*pendingIt)->SetStatus(IStreamerTypes::RequestStatus::Canceled);
+                m_context.MarkRequestAsCompleted(*pendingIt);
+                pendingIt = pendingQueue.erase(pendingIt);
+            }
+            else
+            {
+                ++pendingIt;
+            }
+        }
+    }
+
+    bool Scheduler::Thread_IsPrefetch(const Requests::ReadRequestData& read) const
+    {
+        return read.m_priority <= m_threadData.m_prefetchPriority;
+    }
 } // namespace AZ::IO
@@ -25,16 +25,27 @@ namespace AZ::IO
 {
     class FileRequest;
     class Streamer_SchedulerTest_RequestSorting_Test;
+    class Streamer_SchedulerTest_RequestSortingWithDeadlines_Test;
 
     namespace Requests
     {
         struct CancelData;
+        struct ReadRequestData;
         struct RescheduleData;
     } // namespace Requests
 
     class AZCORE_API Scheduler final
     {
     public:
+        //! How the scheduler reacts when it estimates that reads with a deadline will complete too late because there's more
+        //! work queued than the stream stack can finish in time.
+        enum class OverloadPolicy : u8
+        {
+            None, //!< Keep scheduling all requests as usual.
+            Demote, //!< Schedule prefetches after all other reads until the scheduler is no longer overloaded.
+            Shed //!< Cancel prefetches that are estimated to miss their own deadline.
+        };
+
         explicit Scheduler(AZStd::shared_ptr<StreamStackEntry> streamStack, u64 memoryAlignment = AZCORE_GLOBAL_NEW_ALIGNMENT,
             u64 sizeAlignment = 1, u64 granularity = 1_mib);
         ~Scheduler();
@@ -67,6 +78,7 @@ namespace AZ::IO
 
     private:
         friend class Streamer_SchedulerTest_RequestSorting_Test;
+        friend class Streamer_SchedulerTest_RequestSortingWithDeadlines_Test;
         inline static constexpr u32 ProfilerColor = 0x0080ffff; //!< A lite shade of blue. (See https://www.color-hex.com/color/0080ff).
 
         void Thread_MainLoop();
@@ -86,6 +98,9 @@ namespace AZ::IO
         //! Determine which of the two provided requests is more important to process next.
         Order Thread_PrioritizeRequests(const FileRequest* first, const FileRequest* second) const;
         void Thread_ScheduleRequests();
+        //! Checks if there are reads that are estimated to miss their deadline and if so applies the overload policy.
+        void Thread_HandleOverload();
+        bool Thread_IsPrefetch(const Requests::ReadRequestData& read) const;
 
         // Stores data that's unguarded and should only be changed by the scheduling thread.
         struct ThreadData final
@@ -96,6 +111,14 @@ namespace AZ::IO
             RequestPath m_lastFilePath; //!< Path of the last file queued for reading.
             AZStd::shared_ptr<StreamStackEntry> m_streamStack;
             u64 m_lastFileOffset{ 0 }; //!< Offset of into the last file queued after reading has completed.
+            //! If true, reads are ordered by deadline only and the priority is only used to break ties.
+            bool m_earliestDeadlineFirst{ false };
+            //! If true, prefetches are ordered after all other reads because the scheduler is overloaded.
+            bool m_demotePrefetches{ false };
+            //! Reads with this priority or lower are considered prefetches by the overload policy.
+            IStreamerTypes::Priority m_prefetchPriority{ IStreamerTypes::s_priorityLow };
+            //! Whether or not the last scheduling pass found reads that will miss their deadline.
+            bool m_isOverloaded{ false };
         };
         ThreadData m_threadData;
         StreamerContext m_context;
@@ -171,9 +171,7 @@ namespace AZ
         {
             AZ_PROFILE_FUNCTION(AzCore);
 
-#if AZ_STREAMER_ADD_EXTRA_PROFILING_INFO
             auto now = AZStd::chrono::steady_clock::now();
-#endif
             TaskGraph task("FinalizeCompletedRequests");
                             
             bool hasCompletedRequests = false;
@@ -226,6 +224,11 @@ namespace AZ
                         Statistic::PlotImmediate(ContextName, MissedDeadlinesName, m_missedDeadlinePercentageStat.GetMostRecentSample());
                     }
 #endif // AZ_STREAMER_ADD_EXTRA_PROFILING_INFO
+                    if (auto readData = AZStd::get_if<Requests::ReadRequestData>(&top->GetCommand());
+                        readData != nullptr && top->GetStatus() != IStreamerTypes::RequestStatus::Canceled)
+                    {
+                        m_deadlineStatistics.RecordCompletion(readData->m_priority, readData->m_deadline, now);
+                    }
 
                     // Get all information before calling the completion routine as it's technically possible that an external
                     // request is recycled during the callback.
@@ -374,6 +377,7 @@ namespace AZ
                 m_internalCompletionTimeAverage.GetMinimum(), m_internalCompletionTimeAverage.GetMaximum(),
                 "The average amount of time in microseconds spend on processing internal callbacks."));
 #endif // AZ_STREAMER_ADD_EXTRA_PROFILNG_INFO
+            m_deadlineStatistics.CollectStatistics(statistics);
             statistics.push_back(Statistic::CreateInteger(
                 ContextName, "Total requests", aznumeric_caster(m_pendingIdCounter), "The total number of requests Streamer has processed.",
                 Statistic::GraphType::None));
@@ -390,6 +394,11 @@ namespace AZ
                 "allocations from Streamer and speeds up creating new requests to issue to Streamer."));
         }
 
+        DeadlineStatistics& StreamerContext::GetDeadlineStatistics()
+        {
+            return m_deadlineStatistics;
+        }
+
         FileRequestPtr StreamerContext::GetNewExternalRequestUnguarded()
         {
             if (m_externalRecycleBin.empty())
@@ -8,6 +8,7 @@
 #pragma once
 
 #include <AzCore/base.h>
+#include <AzCore/IO/Streamer/DeadlineStatistics.h>
 #include <AzCore/IO/Streamer/Statistics.h>
 #include <AzCore/IO/Streamer/StreamerConfiguration.h>
 #include <AzCore/IO/Streamer/StreamerContext_Platform.h>
@@ -103,6 +104,9 @@ namespace AZ::IO
         //! context. Use the CollectStatistics on AZ::IO::Streamer to get all statistics.
         void CollectStatistics(AZStd::vector<Statistic>& statistics);
 
+        //! Returns the queue time and deadline statistics per priority band. These can only be updated from the main Streamer thread.
+        DeadlineStatistics& GetDeadlineStatistics();
+
     private:
         //! Gets a new FileRequestPtr. This version is for internal use only and is not thread-safe.
         //! This will be called by GetNewExternalRequest or GetNewExternalRequestBatch which are responsible
@@ -122,6 +126,9 @@ namespace AZ::IO
         // The prepared request queue is not guarded and should only be called from the main Streamer thread.
         PreparedQueue m_preparedRequests;
 
+        // Queue times and missed deadlines per priority band. Only updated from the main Streamer thread.
+        DeadlineStatistics m_deadlineStatistics;
+
 #if AZ_STREAMER_ADD_EXTRA_PROFILING_INFO
         //! By how much time the prediction was off. This mostly covers the latter part of scheduling, which
         //! gets more precise the closer the request gets to completion.
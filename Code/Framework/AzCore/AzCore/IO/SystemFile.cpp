@@ -28,6 +28,7 @@ namespace AZ::IO::Platform
     SystemFile::SizeType Read(FileHandleType handle, const SystemFile* systemFile, SizeType byteSize, void* buffer);
     SystemFile::SizeType Write(FileHandleType handle, const SystemFile* systemFile, const void* buffer, SizeType byteSize);
     void Flush(FileHandleType handle, const SystemFile* systemFile);
+    bool TryLockExclusive(FileHandleType handle, const SystemFile* systemFile);
     SystemFile::SizeType Length(FileHandleType handle, const SystemFile* systemFile);
 
     bool Exists(const char* fileName);
@@ -170,6 +171,11 @@ namespace AZ::IO
         Platform::Flush(m_handle, this);
     }
 
+    bool SystemFile::TryLockExclusive()
+    {
+        return Platform::TryLockExclusive(m_handle, this);
+    }
+
     SystemFile::SizeType SystemFile::Length() const
     {
         return Platform::Length(m_handle, this);
@@ -90,6 +90,10 @@ namespace AZ
             SizeType Write(const void* buffer, SizeType byteSize);
             /// Flush the contents of the file buffers to disk.
             void Flush();
+            /// Tries to take an exclusive lock on the file without waiting. Returns false if another process, or another SystemFile for the
+            /// same file, already holds it. The lock is released when the file is closed, including when the process exits. The lock is
+            /// advisory and doesn't prevent reading from or writing to the file.
+            bool TryLockExclusive();
             /// Return file length
             SizeType Length() const;
             /// Return disc offset if possible, otherwise 0
@@ -14,6 +14,7 @@
 #include <AzCore/Memory/AllocationRecords.h>
 #include <AzCore/Memory/AllocatorManager.h>
 #include <AzCore/Memory/ChildAllocatorSchema.h>
+#include <AzCore/Memory/FrameArenaAllocator.h>
 #include <AzCore/Memory/Memory.h>
 #include <AzCore/Memory/IAllocator.h>
 #include <AzCore/Memory/OSAllocator.h>
@@ -737,6 +738,11 @@ namespace AZ
             const char* name = allocator->GetName();
             size_t usedBytes = allocator->NumAllocatedBytes();
             size_t reservedBytes = allocator->Capacity();
+            if (auto frameArenaAllocator = azrtti_cast<AZ::FrameArenaAllocator*>(allocator); frameArenaAllocator != nullptr)
+            {
+                // Frame arenas can grow without limit, so report the memory reserved for the thread buffers instead.
+                reservedBytes = frameArenaAllocator->GetStatistics().m_reservedBytes;
+            }
             size_t consumedBytes = reservedBytes;
             const char* parentName = "";
             if (auto childAllocatorSchema = azrtti_cast<AZ::ChildAllocatorSchemaBase*>(allocator);
@@ -766,6 +772,23 @@ namespace AZ
 
         AZ_Printf(AZ::Debug::NoWindow, "-,Totals,%.2f,%.2f,%.2f,\n", totalUsedBytes / 1024.0f, totalReservedBytes / 1024.0f, totalConsumedBytes / 1024.0f);
         AZ_Printf(AZ::Debug::NoWindow, "%d allocators active\n", m_numAllocators);
+
+        for (int i = 0; i < m_numAllocators; i++)
+        {
+            if (auto frameArenaAllocator = azrtti_cast<AZ::FrameArenaAllocator*>(GetAllocator(i)); frameArenaAllocator != nullptr)
+            {
+                const AZ::FrameArenaAllocator::Statistics stats = frameArenaAllocator->GetStatistics();
+                AZ_Printf(
+                    AZ::Debug::NoWindow,
+                    "%s: frame %llu, %zu threads, peak frame %.2f KiB, %zu overflows (%.2f KiB)\n",
+                    frameArenaAllocator->GetName(),
+                    static_cast<unsigned long long>(stats.m_frame),
+                    stats.m_threadCount,
+                    stats.m_peakFrameBytes / 1024.0f,
+                    stats.m_overflowCount,
+                    stats.m_overflowBytes / 1024.0f);
+            }
+        }
     }
     void AllocatorManager::GetAllocatorStats(size_t& allocatedBytes, size_t& capacityBytes, AZStd::vector<AllocatorStats>* outStats)
     {
@@ -0,0 +1,592 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Memory/FrameArenaAllocator.h>
+
+#include <AzCore/Memory/OSAllocator.h>
+#include <AzCore/std/parallel/lock.h>
+
+namespace AZ
+{
+    namespace FrameArenaInternal
+    {
+        using size_type = FrameArenaAllocator::size_type;
+
+        //! Alignment of the pages and the minimum alignment of all allocations.
+        static constexpr size_type PageAlignment = 16;
+        //! Buffers are grown in steps of this size after they overflowed.
+        static constexpr size_type BufferGranularity = 64 * 1024;
+
+        //! Memory block requested from the OS. The memory for the allocations directly follows the header.
+        struct Page
+        {
+            Page* m_next;
+            AZ::u8* m_current;
+            AZ::u8* m_end;
+        };
+        static constexpr size_type PageHeaderSize = AZ_SIZE_ALIGN_UP(sizeof(Page), PageAlignment);
+
+        //! Every allocation is prefixed with its size so it can be reallocated.
+        using AllocationHeader = size_type;
+
+        static Page* CreatePage(size_type capacity)
+        {
+            void* memory = AZ_OS_MALLOC(PageHeaderSize + capacity, PageAlignment);
+            if (!memory)
+            {
+                return nullptr;
+            }
+            Page* page = static_cast<Page*>(memory);
+            page->m_next = nullptr;
+            page->m_current = static_cast<AZ::u8*>(memory) + PageHeaderSize;
+            page->m_end = page->m_current + capacity;
+            return page;
+        }
+
+        static AZ::u8* GetPageBegin(Page* page)
+        {
+            return reinterpret_cast<AZ::u8*>(page) + PageHeaderSize;
+        }
+
+        static size_type GetPageCapacity(Page* page)
+        {
+            return page->m_end - GetPageBegin(page);
+        }
+
+        static size_type GetPaddedSize(size_type byteSize, size_type alignment)
+        {
+            return byteSize + sizeof(AllocationHeader) + alignment;
+        }
+
+        static void* AllocateFromPage(Page* page, size_type byteSize, size_type alignment)
+        {
+            const uintptr_t start = reinterpret_cast<uintptr_t>(page->m_current) + sizeof(AllocationHeader);
+            const uintptr_t address = AZ_SIZE_ALIGN_UP(start, alignment);
+            if (address + byteSize > reinterpret_cast<uintptr_t>(page->m_end))
+            {
+                return nullptr;
+            }
+            reinterpret_cast<AllocationHeader*>(address)[-1] = byteSize;
+            page->m_current = reinterpret_cast<AZ::u8*>(address + byteSize);
+            return reinterpret_cast<void*>(address);
+        }
+
+        static bool IsLastAllocation(const Page* page, const AZ::u8* address, size_type byteSize)
+        {
+            return page && address + byteSize == page->m_current;
+        }
+
+        //! Thread data of the calling thread in every allocator it allocated from, most recently used first.
+        //! Its destructor hands the thread data back to the allocators when the thread exits.
+        struct ThreadRegistry
+        {
+            ~ThreadRegistry();
+
+            FrameArenaThreadData* m_threadData{ nullptr };
+        };
+        static thread_local ThreadRegistry t_threadRegistry;
+
+        //! Serializes exiting threads against allocators that are destroyed, so a thread never hands its data back
+        //! to an allocator that's already gone.
+        static AZStd::mutex& GetThreadExitMutex()
+        {
+            static AZStd::mutex s_threadExitMutex;
+            return s_threadExitMutex;
+        }
+
+        static AZStd::atomic<AZ::u64> s_nextInstanceId{ 1 };
+    } // namespace FrameArenaInternal
+
+    //! Linear buffer for one frame. The first page is the current page, the others are full.
+    struct FrameArenaBuffer
+    {
+        FrameArenaInternal::Page* m_pages{ nullptr };
+        //! Frame the buffer was last used for. Written by the owning thread, read when gathering statistics.
+        AZStd::atomic<AZ::u64> m_frame{ AZStd::numeric_limits<AZ::u64>::max() };
+        AZStd::atomic<FrameArenaAllocator::size_type> m_usedBytes{ 0 };
+    };
+
+    //! Buffers of a single thread. Only accessed by the owning thread, except for statistics and destruction.
+    //! When the thread exits its buffers are handed to the next thread that starts allocating, or released once
+    //! they no longer hold memory of the current or the previous frame.
+    struct FrameArenaThreadData
+    {
+        using size_type = FrameArenaAllocator::size_type;
+
+        // Thread data can outlive its allocator until the thread exits, which can be after the allocators are torn
+        // down, so it's allocated from the OS directly.
+        static FrameArenaThreadData* Create(FrameArenaAllocator& allocator)
+        {
+            void* memory = AZ_OS_MALLOC(sizeof(FrameArenaThreadData), alignof(FrameArenaThreadData));
+            return memory ? new (memory) FrameArenaThreadData(allocator) : nullptr;
+        }
+
+        static void Delete(FrameArenaThreadData* threadData)
+        {
+            threadData->~FrameArenaThreadData();
+            AZ_OS_FREE(threadData);
+        }
+
+        //! Called when a thread exits with the thread data of that thread in every allocator it allocated from.
+        static void ReleaseThread(FrameArenaThreadData* threadData)
+        {
+            AZStd::lock_guard<AZStd::mutex> exitLock(FrameArenaInternal::GetThreadExitMutex());
+            while (threadData)
+            {
+                FrameArenaThreadData* next = threadData->m_nextInThread;
+                threadData->m_nextInThread = nullptr;
+                if (threadData->m_orphaned.load(AZStd::memory_order_acquire))
+                {
+                    // The allocator was destroyed and already released the pages.
+                    Delete(threadData);
+                }
+                else
+                {
+                    FrameArenaAllocator& allocator = threadData->m_allocator;
+                    AZStd::lock_guard<AZStd::mutex> lock(allocator.m_threadDataMutex);
+                    threadData->m_threadExited = true;
+                    allocator.m_exitedThreadCount.fetch_add(1, AZStd::memory_order_relaxed);
+                }
+                threadData = next;
+            }
+        }
+
+        explicit FrameArenaThreadData(FrameArenaAllocator& allocator)
+            : m_allocator(allocator)
+            , m_allocatorId(allocator.m_instanceId)
+        {
+        }
+
+        //! Returns true if none of the buffers contain memory of the given frame or the frame before it.
+        bool IsIdle(AZ::u64 frame) const
+        {
+            for (const FrameArenaBuffer& buffer : m_buffers)
+            {
+                const AZ::u64 bufferFrame = buffer.m_frame.load(AZStd::memory_order_relaxed);
+                if (bufferFrame == frame || bufferFrame + 1 == frame)
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        FrameArenaBuffer& GetBuffer(AZ::u64 frame)
+        {
+            FrameArenaBuffer& buffer = m_buffers[frame & 1];
+            if (buffer.m_frame.load(AZStd::memory_order_relaxed) != frame)
+            {
+                // Anything in this buffer is at least two frames old.
+                ResetBuffer(buffer);
+                buffer.m_frame.store(frame, AZStd::memory_order_relaxed);
+            }
+            return buffer;
+        }
+
+        void* Allocate(FrameArenaBuffer& buffer, size_type byteSize, size_type alignment)
+        {
+            using namespace FrameArenaInternal;
+
+            void* address = buffer.m_pages ? AllocateFromPage(buffer.m_pages, byteSize, alignment) : nullptr;
+            if (!address)
+            {
+                address = AllocateOverflow(buffer, byteSize, alignment);
+                if (!address)
+                {
+                    return nullptr;
+                }
+            }
+            buffer.m_usedBytes.store(buffer.m_usedBytes.load(AZStd::memory_order_relaxed) + byteSize, AZStd::memory_order_relaxed);
+            return address;
+        }
+
+        void* AllocateOverflow(FrameArenaBuffer& buffer, size_type byteSize, size_type alignment)
+        {
+            using namespace FrameArenaInternal;
+
+            const size_type paddedSize = GetPaddedSize(byteSize, alignment);
+            const bool isOverflow = buffer.m_pages != nullptr;
+            const size_type capacity = AZStd::max(m_allocator.m_bufferSize, paddedSize);
+            Page* page = CreatePage(capacity);
+            if (!page)
+            {
+                return nullptr;
+            }
+            page->m_next = buffer.m_pages;
+            buffer.m_pages = page;
+            m_allocator.m_reservedBytes.fetch_add(capacity, AZStd::memory_order_relaxed);
+            if (isOverflow)
+            {
+                m_allocator.m_overflowCount.fetch_add(1, AZStd::memory_order_relaxed);
+                m_allocator.m_overflowBytes.fetch_add(byteSize, AZStd::memory_order_relaxed);
+            }
+            return AllocateFromPage(page, byteSize, alignment);
+        }
+
+        void ResetBuffer(FrameArenaBuffer& buffer)
+        {
+            using namespace FrameArenaInternal;
+
+            Page* page = buffer.m_pages;
+            if (!page)
+            {
+                return;
+            }
+
+            const size_type usedBytes = buffer.m_usedBytes.load(AZStd::memory_order_relaxed);
+            buffer.m_usedBytes.store(0, AZStd::memory_order_relaxed);
+            size_type peakBytes = m_allocator.m_peakFrameBytes.load(AZStd::memory_order_relaxed);
+            while (usedBytes > peakBytes &&
+                !m_allocator.m_peakFrameBytes.compare_exchange_weak(peakBytes, usedBytes, AZStd::memory_order_relaxed))
+            {
+            }
+
+            if (page->m_next == nullptr)
+            {
+                page->m_current = GetPageBegin(page);
+                return;
+            }
+
+            // The buffer overflowed, so replace all its pages with a single page that's big enough for the whole frame.
+            size_type reservedBytes = 0;
+            for (Page* current = page; current; current = current->m_next)
+            {
+                reservedBytes += GetPageCapacity(current);
+            }
+            ReleasePages(buffer);
+            const size_type capacity = AZ_SIZE_ALIGN_UP(AZStd::max(reservedBytes, m_allocator.m_bufferSize), BufferGranularity);
+            buffer.m_pages = CreatePage(capacity);
+            if (buffer.m_pages)
+            {
+                m_allocator.m_reservedBytes.fetch_add(capacity, AZStd::memory_order_relaxed);
+            }
+        }
+
+        void ReleasePages(FrameArenaBuffer& buffer)
+        {
+            using namespace FrameArenaInternal;
+
+            Page* page = buffer.m_pages;
+            while (page)
+            {
+                Page* next = page->m_next;
+                m_allocator.m_reservedBytes.fetch_sub(GetPageCapacity(page), AZStd::memory_order_relaxed);
+                AZ_OS_FREE(page);
+                page = next;
+            }
+            buffer.m_pages = nullptr;
+        }
+
+        void ReleaseAllPages()
+        {
+            ReleasePages(m_buffers[0]);
+            ReleasePages(m_buffers[1]);
+        }
+
+        FrameArenaAllocator& m_allocator;
+        const AZ::u64 m_allocatorId;
+        FrameArenaBuffer m_buffers[2];
+        //! Next thread data of the allocator, guarded by the allocator's thread data mutex.
+        FrameArenaThreadData* m_next{ nullptr };
+        //! Next thread data of the owning thread, only accessed by the owning thread.
+        FrameArenaThreadData* m_nextInThread{ nullptr };
+        //! Set when the owning thread exited, guarded by the allocator's thread data mutex.
+        bool m_threadExited{ false };
+        //! Set when the allocator was destroyed, after which only the owning thread still references the thread data.
+        AZStd::atomic<bool> m_orphaned{ false };
+    };
+
+    FrameArenaInternal::ThreadRegistry::~ThreadRegistry()
+    {
+        FrameArenaThreadData::ReleaseThread(m_threadData);
+    }
+
+    AZ_TYPE_INFO_WITH_NAME_IMPL(FrameArenaAllocator, "FrameArenaAllocator", "{2C4B7F6E-0B4D-4E4F-9C0A-6B7E3A9D51C2}");
+    AZ_RTTI_NO_TYPE_INFO_IMPL(FrameArenaAllocator, AllocatorBase);
+
+    FrameArenaAllocator::FrameArenaAllocator()
+        : FrameArenaAllocator(DefaultBufferSize)
+    {
+    }
+
+    FrameArenaAllocator::FrameArenaAllocator(size_type bufferSize)
+        : m_bufferSize(AZ_SIZE_ALIGN_UP(AZStd::max(bufferSize, FrameArenaInternal::PageAlignment), FrameArenaInternal::PageAlignment))
+        , m_instanceId(FrameArenaInternal::s_nextInstanceId++)
+    {
+        Create();
+        PostCreate();
+    }
+
+    FrameArenaAllocator::~FrameArenaAllocator()
+    {
+        PreDestroy();
+        Destroy();
+    }
+
+    bool FrameArenaAllocator::Create()
+    {
+        m_frame = 0;
+        return true;
+    }
+
+    void FrameArenaAllocator::Destroy()
+    {
+        AZStd::lock_guard<AZStd::mutex> exitLock(FrameArenaInternal::GetThreadExitMutex());
+        AZStd::lock_guard<AZStd::mutex> lock(m_threadDataMutex);
+        while (m_threadData)
+        {
+            FrameArenaThreadData* next = m_threadData->m_next;
+            m_threadData->ReleaseAllPages();
+            if (m_threadData->m_threadExited)
+            {
+                FrameArenaThreadData::Delete(m_threadData);
+            }
+            else
+            {
+                // Still referenced by its thread, which deletes it the next time it looks up thread data or exits.
+                m_threadData->m_orphaned.store(true, AZStd::memory_order_release);
+            }
+            m_threadData = next;
+        }
+        m_exitedThreadCount.store(0, AZStd::memory_order_relaxed);
+    }
+
+    AllocatorDebugConfig FrameArenaAllocator::GetDebugConfig()
+    {
+        // Allocations aren't freed individually, so allocation records would only report false leaks.
+        return AllocatorDebugConfig().ExcludeFromDebugging();
+    }
+
+    void FrameArenaAllocator::AdvanceFrame()
+    {
+        const AZ::u64 frame = m_frame.fetch_add(1) + 1;
+        if (m_exitedThreadCount.load(AZStd::memory_order_relaxed) != 0)
+        {
+            ReleaseExitedThreadData(frame);
+        }
+    }
+
+    AZ::u64 FrameArenaAllocator::GetFrame() const
+    {
+        return m_frame.load();
+    }
+
+    void FrameArenaAllocator::ReleaseExitedThreadData(AZ::u64 frame)
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_threadDataMutex);
+        FrameArenaThreadData** link = &m_threadData;
+        while (FrameArenaThreadData* threadData = *link)
+        {
+            if (threadData->m_threadExited && threadData->IsIdle(frame))
+            {
+                *link = threadData->m_next;
+                threadData->ReleaseAllPages();
+                FrameArenaThreadData::Delete(threadData);
+                m_exitedThreadCount.fetch_sub(1, AZStd::memory_order_relaxed);
+            }
+            else
+            {
+                link = &threadData->m_next;
+            }
+        }
+    }
+
+    FrameArenaThreadData& FrameArenaAllocator::GetThreadData()
+    {
+        if (FrameArenaThreadData* threadData = FindThreadData(); threadData)
+        {
+            return *threadData;
+        }
+
+        // Take over the buffers of a thread that exited before creating new ones. Memory that thread allocated
+        // during the current or the previous frame stays valid, because its buffers are reset like before.
+        FrameArenaThreadData* threadData = nullptr;
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_threadDataMutex);
+            if (m_exitedThreadCount.load(AZStd::memory_order_relaxed) != 0)
+            {
+                for (threadData = m_threadData; threadData && !threadData->m_threadExited; threadData = threadData->m_next)
+                {
+                }
+                if (threadData)
+                {
+                    threadData->m_threadExited = false;
+                    m_exitedThreadCount.fetch_sub(1, AZStd::memory_order_relaxed);
+                }
+            }
+        }
+        if (!threadData)
+        {
+            threadData = FrameArenaThreadData::Create(*this);
+            AZ_Assert(threadData, "FrameArenaAllocator failed to allocate the thread data.");
+            AZStd::lock_guard<AZStd::mutex> lock(m_threadDataMutex);
+            threadData->m_next = m_threadData;
+            m_threadData = threadData;
+        }
+
+        FrameArenaInternal::ThreadRegistry& registry = FrameArenaInternal::t_threadRegistry;
+        threadData->m_nextInThread = registry.m_threadData;
+        registry.m_threadData = threadData;
+        return *threadData;
+    }
+
+    FrameArenaThreadData* FrameArenaAllocator::FindThreadData() const
+    {
+        // Only walks the thread data of the calling thread, which has one entry per allocator it allocated from.
+        FrameArenaInternal::ThreadRegistry& registry = FrameArenaInternal::t_threadRegistry;
+        FrameArenaThreadData** link = &registry.m_threadData;
+        while (FrameArenaThreadData* threadData = *link)
+        {
+            if (threadData->m_orphaned.load(AZStd::memory_order_acquire))
+            {
+                *link = threadData->m_nextInThread;
+                FrameArenaThreadData::Delete(threadData);
+                continue;
+            }
+            if (&threadData->m_allocator == this && threadData->m_allocatorId == m_instanceId)
+            {
+                // Move to the front so the allocator that's used most is found first.
+                if (link != &registry.m_threadData)
+                {
+                    *link = threadData->m_nextInThread;
+                    threadData->m_nextInThread = registry.m_threadData;
+                    registry.m_threadData = threadData;
+                }
+                return threadData;
+            }
+            link = &threadData->m_nextInThread;
+        }
+        return nullptr;
+    }
+
+    AllocateAddress FrameArenaAllocator::allocate(size_type byteSize, size_type alignment)
+    {
+        if (byteSize == 0)
+        {
+            return AllocateAddress{};
+        }
+        alignment = AZStd::max(alignment, FrameArenaInternal::PageAlignment);
+        AZ_Assert((alignment & (alignment - 1)) == 0, "Alignment %zu must be a power of two.", alignment);
+
+        FrameArenaThreadData& threadData = GetThreadData();
+        FrameArenaBuffer& buffer = threadData.GetBuffer(m_frame.load(AZStd::memory_order_relaxed));
+        void* address = threadData.Allocate(buffer, byteSize, alignment);
+        if (!address)
+        {
+            AZ_Printf("Memory", "FrameArenaAllocator failed to allocate %zu bytes with alignment %zu.\n", byteSize, alignment);
+            OnOutOfMemory(byteSize, alignment);
+            return AllocateAddress{};
+        }
+        return AllocateAddress{ address, byteSize };
+    }
+
+    auto FrameArenaAllocator::deallocate(pointer ptr, [[maybe_unused]] size_type byteSize, [[maybe_unused]] size_type alignment)
+        -> size_type
+    {
+        if (!ptr)
+        {
+            return 0;
+        }
+
+        const size_type allocatedSize = get_allocated_size(ptr);
+        // Only the most recent allocation of the calling thread can be given back, everything else is released when
+        // its frame is reused.
+        if (FrameArenaThreadData* threadData = FindThreadData(); threadData)
+        {
+            const AZ::u64 frame = m_frame.load(AZStd::memory_order_relaxed);
+            FrameArenaBuffer& buffer = threadData->m_buffers[frame & 1];
+            AZ::u8* address = static_cast<AZ::u8*>(ptr);
+            if (buffer.m_frame.load(AZStd::memory_order_relaxed) == frame &&
+                FrameArenaInternal::IsLastAllocation(buffer.m_pages, address, allocatedSize))
+            {
+                buffer.m_pages->m_current = address - sizeof(FrameArenaInternal::AllocationHeader);
+                buffer.m_usedBytes.store(
+                    buffer.m_usedBytes.load(AZStd::memory_order_relaxed) - allocatedSize, AZStd::memory_order_relaxed);
+            }
+        }
+        return allocatedSize;
+    }
+
+    AllocateAddress FrameArenaAllocator::reallocate(pointer ptr, size_type newSize, size_type newAlignment)
+    {
+        if (!ptr)
+        {
+            return allocate(newSize, newAlignment);
+        }
+        if (newSize == 0)
+        {
+            deallocate(ptr);
+            return AllocateAddress{};
+        }
+
+        const size_type oldSize = get_allocated_size(ptr);
+        AZ::u8* address = static_cast<AZ::u8*>(ptr);
+
+        // The most recent allocation can be resized in place if it still fits in its page.
+        FrameArenaThreadData& threadData = GetThreadData();
+        FrameArenaBuffer& buffer = threadData.GetBuffer(m_frame.load(AZStd::memory_order_relaxed));
+        FrameArenaInternal::Page* page = buffer.m_pages;
+        if (FrameArenaInternal::IsLastAllocation(page, address, oldSize) && address + newSize <= page->m_end)
+        {
+            page->m_current = address + newSize;
+            reinterpret_cast<FrameArenaInternal::AllocationHeader*>(address)[-1] = newSize;
+            buffer.m_usedBytes.store(
+                buffer.m_usedBytes.load(AZStd::memory_order_relaxed) + newSize - oldSize, AZStd::memory_order_relaxed);
+            return AllocateAddress{ ptr, newSize };
+        }
+
+        AllocateAddress newAddress = allocate(newSize, newAlignment);
+        if (newAddress)
+        {
+            memcpy(newAddress.GetAddress(), ptr, AZStd::min(oldSize, newSize));
+        }
+        return newAddress;
+    }
+
+    auto FrameArenaAllocator::get_allocated_size(pointer ptr, [[maybe_unused]] size_type alignment) const -> size_type
+    {
+        return ptr ? reinterpret_cast<const FrameArenaInternal::AllocationHeader*>(ptr)[-1] : 0;
+    }
+
+    auto FrameArenaAllocator::NumAllocatedBytes() const -> size_type
+    {
+        // Only the buffers of the current and the previous frame contain memory that's still in use.
+        const AZ::u64 frame = m_frame.load();
+        size_type allocatedBytes = 0;
+        AZStd::lock_guard<AZStd::mutex> lock(m_threadDataMutex);
+        for (const FrameArenaThreadData* threadData = m_threadData; threadData; threadData = threadData->m_next)
+        {
+            for (const FrameArenaBuffer& buffer : threadData->m_buffers)
+            {
+                const AZ::u64 bufferFrame = buffer.m_frame.load(AZStd::memory_order_relaxed);
+                if (bufferFrame == frame || bufferFrame + 1 == frame)
+                {
+                    allocatedBytes += buffer.m_usedBytes.load(AZStd::memory_order_relaxed);
+                }
+            }
+        }
+        return allocatedBytes;
+    }
+
+    FrameArenaAllocator::Statistics FrameArenaAllocator::GetStatistics() const
+    {
+        Statistics statistics;
+        statistics.m_frame = m_frame.load();
+        statistics.m_overflowCount = m_overflowCount.load(AZStd::memory_order_relaxed);
+        statistics.m_overflowBytes = m_overflowBytes.load(AZStd::memory_order_relaxed);
+        statistics.m_reservedBytes = m_reservedBytes.load(AZStd::memory_order_relaxed);
+        statistics.m_peakFrameBytes = m_peakFrameBytes.load(AZStd::memory_order_relaxed);
+
+        AZStd::lock_guard<AZStd::mutex> lock(m_threadDataMutex);
+        for (const FrameArenaThreadData* threadData = m_threadData; threadData; threadData = threadData->m_next)
+        {
+            ++statistics.m_threadCount;
+        }
+        return statistics;
+    }
+} // namespace AZ
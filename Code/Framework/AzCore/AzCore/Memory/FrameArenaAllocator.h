@@ -0,0 +1,115 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/Memory/AllocatorBase.h>
+#include <AzCore/Memory/Memory.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/mutex.h>
+
+namespace AZ
+{
+    struct FrameArenaThreadData;
+
+    /**
+     * Frame arena allocator
+     * Linear allocator for temporary memory that only has to stay alive for the current and the next frame, like
+     * culling results, draw lists and event buffers.
+     * Every thread bumps allocations out of its own pair of buffers, one for even and one for odd frames, so allocating
+     * doesn't take any locks. Individual deallocations are ignored, except for the most recent allocation of the calling
+     * thread. Instead all memory allocated during frame N is released at once when frame N + 2 starts, so memory
+     * allocated during a frame can still be used during the whole next frame.
+     * Allocations that don't fit in a thread's buffer are served from overflow pages. When a buffer that overflowed is
+     * reused it's grown to the amount of memory that was used, so overflows are only expected after a spike.
+     */
+    class AZCORE_API FrameArenaAllocator
+        : public AllocatorBase
+    {
+    public:
+        AZ_TYPE_INFO_WITH_NAME_DECL_API(AZCORE_API, FrameArenaAllocator);
+        AZ_RTTI_NO_TYPE_INFO_DECL();
+
+        //! Size of the buffers that are created for each thread the first time it allocates.
+        static constexpr size_type DefaultBufferSize = 256 * 1024;
+
+        struct Statistics
+        {
+            AZ::u64 m_frame = 0;
+            //! Number of allocations that didn't fit in the buffer of a thread.
+            size_type m_overflowCount = 0;
+            //! Number of bytes that were requested by the allocations that didn't fit in the buffer of a thread.
+            size_type m_overflowBytes = 0;
+            //! Number of bytes reserved for the buffers of all threads, including overflow pages.
+            size_type m_reservedBytes = 0;
+            //! Highest number of bytes a single thread allocated during a single frame.
+            size_type m_peakFrameBytes = 0;
+            //! Number of threads that hold buffers in this allocator. Threads that exited keep their buffers until
+            //! another thread takes them over or they no longer contain memory of the current or the previous frame.
+            size_type m_threadCount = 0;
+        };
+
+        FrameArenaAllocator();
+        explicit FrameArenaAllocator(size_type bufferSize);
+        ~FrameArenaAllocator() override;
+
+        bool Create();
+        void Destroy() override;
+
+        //! Starts a new frame. From this point on memory that was allocated two frames ago will be reused.
+        //! Threads pick up the new frame the next time they allocate, so this doesn't need to be synchronized with
+        //! allocations, but none of the memory allocated two frames ago can still be in use.
+        void AdvanceFrame();
+        AZ::u64 GetFrame() const;
+
+        //! Returns the statistics of this allocator. These are also reported by AllocatorManager::DumpAllocators.
+        Statistics GetStatistics() const;
+
+        //////////////////////////////////////////////////////////////////////////
+        // IAllocator
+        AllocatorDebugConfig GetDebugConfig() override;
+
+        AllocateAddress allocate(size_type byteSize, size_type alignment) override;
+        size_type       deallocate(pointer ptr, size_type byteSize = 0, size_type alignment = 0) override;
+        AllocateAddress reallocate(pointer ptr, size_type newSize, size_type newAlignment) override;
+        size_type       get_allocated_size(pointer ptr, size_type alignment = 1) const override;
+
+        size_type       NumAllocatedBytes() const override;
+        //////////////////////////////////////////////////////////////////////////
+
+        AZ_DISABLE_COPY_MOVE(FrameArenaAllocator);
+
+    private:
+        FrameArenaThreadData& GetThreadData();
+        FrameArenaThreadData* FindThreadData() const;
+        //! Releases the buffers of threads that exited and no longer contain memory that's in use.
+        void ReleaseExitedThreadData(AZ::u64 frame);
+
+        const size_type m_bufferSize;
+        //! Unique id of this allocator, so the thread local lookup never returns the thread data of an allocator that
+        //! was destroyed and then recreated at the same address.
+        const AZ::u64 m_instanceId;
+
+        AZStd::atomic<AZ::u64> m_frame{ 0 };
+
+        mutable AZStd::mutex m_threadDataMutex;
+        FrameArenaThreadData* m_threadData{ nullptr };
+        //! Number of thread data entries whose thread exited.
+        AZStd::atomic<size_type> m_exitedThreadCount{ 0 };
+
+        AZStd::atomic<size_type> m_overflowCount{ 0 };
+        AZStd::atomic<size_type> m_overflowBytes{ 0 };
+        AZStd::atomic<size_type> m_reservedBytes{ 0 };
+        AZStd::atomic<size_type> m_peakFrameBytes{ 0 };
+
+        friend struct FrameArenaThreadData;
+    };
+    AZ_TYPE_INFO_WITH_NAME_DECL_EXT_API(AZCORE_API, FrameArenaAllocator);
+
+    //! Allocator that can be used by AZStd containers to allocate from the global frame arena.
+    using FrameArenaStdAllocator = AZStdAlloc<FrameArenaAllocator>;
+} // namespace AZ
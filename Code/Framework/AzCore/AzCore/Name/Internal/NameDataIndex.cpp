@@ -0,0 +1,238 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Name/Internal/NameDataIndex.h>
+#include <AzCore/std/algorithm.h>
+
+namespace AZ::Internal
+{
+    NameDataIndex::ReadScope::ReadScope(const NameDataIndex& index)
+        : m_index(index)
+        , m_epoch(index.EnterRead())
+    {
+    }
+
+    NameDataIndex::ReadScope::~ReadScope()
+    {
+        m_index.ExitRead(m_epoch);
+    }
+
+    NameDataIndex::Table::Table(size_t capacity)
+        : m_slots(new AZStd::atomic<NameData*>[capacity])
+        , m_mask(capacity - 1)
+    {
+        AZ_Assert(capacity > 0 && (capacity & (capacity - 1)) == 0, "NameDataIndex capacity needs to be a power of two, but was %zu.", capacity);
+        for (size_t i = 0; i < capacity; ++i)
+        {
+            m_slots[i].store(nullptr, AZStd::memory_order_relaxed);
+        }
+    }
+
+    NameDataIndex::NameDataIndex()
+    {
+        m_readers[0].store(0);
+        m_readers[1].store(0);
+        for (AZStd::atomic<uint64_t>& removalCount : m_removalCounts)
+        {
+            removalCount.store(0);
+        }
+        m_table.store(new Table(InitialCapacity));
+    }
+
+    NameDataIndex::~NameDataIndex()
+    {
+        // There can't be any readers left at this point, so everything that was retired can be released. NameData
+        // that's still in the table is owned by the NameDictionary.
+        for (RetiredEntry& entry : m_retired)
+        {
+            delete entry.m_nameData;
+            delete entry.m_table;
+        }
+        delete m_table.load();
+    }
+
+    bool NameDataIndex::IsTombstone(const NameData* nameData)
+    {
+        return nameData == GetTombstone();
+    }
+
+    NameData* NameDataIndex::GetTombstone()
+    {
+        return reinterpret_cast<NameData*>(static_cast<uintptr_t>(1));
+    }
+
+    uint64_t NameDataIndex::EnterRead() const
+    {
+        // Register with the current epoch and make sure the epoch didn't advance while registering. If it did, the
+        // writer may have already checked the reader count and could reclaim entries this reader is about to look at.
+        uint64_t epoch = m_epoch.load();
+        while (true)
+        {
+            m_readers[epoch & 1].fetch_add(1);
+            uint64_t currentEpoch = m_epoch.load();
+            if (currentEpoch == epoch)
+            {
+                return epoch;
+            }
+            m_readers[epoch & 1].fetch_sub(1);
+            epoch = currentEpoch;
+        }
+    }
+
+    void NameDataIndex::ExitRead(uint64_t epoch) const
+    {
+        m_readers[epoch & 1].fetch_sub(1);
+    }
+
+    NameData* NameDataIndex::Find(NameData::Hash hash) const
+    {
+        const Table* table = m_table.load(AZStd::memory_order_acquire);
+        for (size_t index = hash & table->m_mask;; index = (index + 1) & table->m_mask)
+        {
+            NameData* nameData = table->m_slots[index].load(AZStd::memory_order_acquire);
+            if (nameData == nullptr)
+            {
+                return nullptr;
+            }
+            if (!IsTombstone(nameData) && nameData->GetHash() == hash)
+            {
+                return nameData;
+            }
+        }
+    }
+
+    uint64_t NameDataIndex::GetRemovalCount(NameData::Hash hash) const
+    {
+        return m_removalCounts[hash & (RemovalCounterCount - 1)].load();
+    }
+
+    void NameDataIndex::Insert(NameData* nameData)
+    {
+        Table* table = m_table.load(AZStd::memory_order_relaxed);
+        // Keep at least half of the slots empty so probe sequences stay short. If most of the used slots are
+        // tombstones a rehash at the same size is enough to clean them up.
+        if ((table->m_usedSlots + 1) * 2 > table->m_mask + 1)
+        {
+            const size_t capacity = table->m_mask + 1;
+            Rehash((table->m_liveSlots + 1) * 4 > capacity ? capacity * 2 : capacity);
+            table = m_table.load(AZStd::memory_order_relaxed);
+        }
+
+        for (size_t index = nameData->GetHash() & table->m_mask;; index = (index + 1) & table->m_mask)
+        {
+            NameData* current = table->m_slots[index].load(AZStd::memory_order_relaxed);
+            AZ_Assert(current == nullptr || IsTombstone(current) || current->GetHash() != nameData->GetHash(),
+                "Hash %u was already added to the name index.", nameData->GetHash());
+            if (current == nullptr || IsTombstone(current))
+            {
+                if (current == nullptr)
+                {
+                    ++table->m_usedSlots;
+                }
+                ++table->m_liveSlots;
+                table->m_slots[index].store(nameData, AZStd::memory_order_release);
+                break;
+            }
+        }
+
+        Reclaim();
+    }
+
+    void NameDataIndex::Remove(NameData* nameData)
+    {
+        Table* table = m_table.load(AZStd::memory_order_relaxed);
+        for (size_t index = nameData->GetHash() & table->m_mask;; index = (index + 1) & table->m_mask)
+        {
+            NameData* current = table->m_slots[index].load(AZStd::memory_order_relaxed);
+            if (current == nullptr)
+            {
+                AZ_Assert(false, "Name '%.*s' can't be removed from the name index as it wasn't added.", AZ_STRING_ARG(nameData->GetName()));
+                return;
+            }
+            if (current == nameData)
+            {
+                table->m_slots[index].store(GetTombstone(), AZStd::memory_order_release);
+                --table->m_liveSlots;
+                break;
+            }
+        }
+
+        m_removalCounts[nameData->GetHash() & (RemovalCounterCount - 1)].fetch_add(1);
+        Retire(nameData, nullptr);
+        Reclaim();
+    }
+
+    size_t NameDataIndex::GetRetiredCount() const
+    {
+        return m_retired.size();
+    }
+
+    void NameDataIndex::Rehash(size_t capacity)
+    {
+        Table* oldTable = m_table.load(AZStd::memory_order_relaxed);
+        Table* newTable = new Table(capacity);
+        for (size_t i = 0; i <= oldTable->m_mask; ++i)
+        {
+            NameData* nameData = oldTable->m_slots[i].load(AZStd::memory_order_relaxed);
+            if (nameData == nullptr || IsTombstone(nameData))
+            {
+                continue;
+            }
+
+            size_t index = nameData->GetHash() & newTable->m_mask;
+            while (newTable->m_slots[index].load(AZStd::memory_order_relaxed) != nullptr)
+            {
+                index = (index + 1) & newTable->m_mask;
+            }
+            newTable->m_slots[index].store(nameData, AZStd::memory_order_relaxed);
+            ++newTable->m_usedSlots;
+            ++newTable->m_liveSlots;
+        }
+
+        m_table.store(newTable, AZStd::memory_order_release);
+        Retire(nullptr, oldTable);
+    }
+
+    void NameDataIndex::Retire(NameData* nameData, Table* table)
+    {
+        m_retired.push_back(RetiredEntry{ m_epoch.load(), nameData, table });
+    }
+
+    void NameDataIndex::Reclaim()
+    {
+        if (m_retired.empty())
+        {
+            return;
+        }
+
+        // Readers that registered in the previous epoch may still be looking at anything that was retired before the
+        // current epoch started. Once they're all gone, those entries can be released and the epoch can advance so
+        // entries retired in the current epoch will be released the next time around.
+        const uint64_t epoch = m_epoch.load();
+        if (m_readers[(epoch + 1) & 1].load() != 0)
+        {
+            return;
+        }
+
+        auto reclaimable = [epoch](const RetiredEntry& entry)
+        {
+            return entry.m_epoch < epoch;
+        };
+        for (RetiredEntry& entry : m_retired)
+        {
+            if (reclaimable(entry))
+            {
+                delete entry.m_nameData;
+                delete entry.m_table;
+            }
+        }
+        m_retired.erase(AZStd::remove_if(m_retired.begin(), m_retired.end(), reclaimable), m_retired.end());
+
+        m_epoch.store(epoch + 1);
+    }
+} // namespace AZ::Internal
@@ -0,0 +1,110 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Memory/OSAllocator.h>
+#include <AzCore/Name/Internal/NameData.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+
+namespace AZ::Internal
+{
+    //! Open addressing hash table that maps name hashes to NameData for the NameDictionary.
+    //! Lookups are wait-free and can run concurrently with a single writer. All functions that modify the index have
+    //! to be serialized by the caller.
+    //! Removed NameData and replaced tables are retired instead of deleted, and are only reclaimed once no reader that
+    //! could still observe them is active. Readers announce themselves by keeping a ReadScope alive for as long as they
+    //! access NameData returned by Find.
+    class NameDataIndex final
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(NameDataIndex, AZ::OSAllocator);
+
+        class ReadScope final
+        {
+        public:
+            explicit ReadScope(const NameDataIndex& index);
+            ~ReadScope();
+
+            ReadScope(const ReadScope&) = delete;
+            ReadScope& operator=(const ReadScope&) = delete;
+
+        private:
+            const NameDataIndex& m_index;
+            uint64_t m_epoch;
+        };
+
+        NameDataIndex();
+        ~NameDataIndex();
+
+        NameDataIndex(const NameDataIndex&) = delete;
+        NameDataIndex& operator=(const NameDataIndex&) = delete;
+
+        //! Returns the NameData registered with the hash or nullptr if there's none.
+        //! Can only be called while a ReadScope for this index is alive.
+        NameData* Find(NameData::Hash hash) const;
+
+        //! Returns the number of NameData that have been removed from the index with a hash that shares a removal
+        //! counter with the given hash. The NameData returned by Find is guaranteed to not have been reclaimed if
+        //! this value hasn't changed for its hash since the NameData was found.
+        uint64_t GetRemovalCount(NameData::Hash hash) const;
+
+        //! Adds a NameData to the index. The hash of the NameData can't already be in the index.
+        void Insert(NameData* nameData);
+        //! Removes a NameData from the index and deletes it once no reader can access it anymore.
+        void Remove(NameData* nameData);
+
+        //! Returns the number of removed NameData and replaced tables that haven't been deleted yet.
+        size_t GetRetiredCount() const;
+
+    private:
+        struct Table
+        {
+            AZ_CLASS_ALLOCATOR(Table, AZ::OSAllocator);
+            explicit Table(size_t capacity);
+
+            AZStd::unique_ptr<AZStd::atomic<NameData*>[]> m_slots;
+            size_t m_mask{ 0 };
+            size_t m_usedSlots{ 0 }; //!< Number of slots that are either occupied or a tombstone.
+            size_t m_liveSlots{ 0 }; //!< Number of slots that are occupied.
+        };
+
+        struct RetiredEntry
+        {
+            uint64_t m_epoch{ 0 };
+            NameData* m_nameData{ nullptr };
+            Table* m_table{ nullptr };
+        };
+
+        static constexpr size_t InitialCapacity = 1024;
+        //! Removals are counted per group of hashes, so removing a name only invalidates what was cached for the
+        //! names that share its counter.
+        static constexpr size_t RemovalCounterCount = 256;
+
+        static bool IsTombstone(const NameData* nameData);
+        static NameData* GetTombstone();
+
+        uint64_t EnterRead() const;
+        void ExitRead(uint64_t epoch) const;
+
+        void Rehash(size_t capacity);
+        void Retire(NameData* nameData, Table* table);
+        void Reclaim();
+
+        AZStd::atomic<Table*> m_table{ nullptr };
+
+        AZStd::atomic<uint64_t> m_epoch{ 0 };
+        //! Number of active readers for the current and previous epoch, indexed by the lowest bit of the epoch.
+        mutable AZStd::atomic<uint32_t> m_readers[2];
+        AZStd::atomic<uint64_t> m_removalCounts[RemovalCounterCount];
+
+        AZStd::vector<RetiredEntry, AZ::OSStdAllocator> m_retired;
+    };
+} // namespace AZ::Internal
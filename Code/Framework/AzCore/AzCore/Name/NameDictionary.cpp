@@ -9,6 +9,7 @@
 #include <AzCore/Interface/Interface.h>
 #include <AzCore/Name/NameDictionary.h>
 #include <AzCore/Name/Internal/NameData.h>
+#include <AzCore/Name/Internal/NameDataIndex.h>
 #include <AzCore/std/hash.h>
 #include <AzCore/Serialization/SerializeContext.h>
 #include <AzCore/std/parallel/lock.h>
@@ -25,6 +26,31 @@ namespace AZ
         // Pointer which indicated that the NameDictonary associated with the AZ::Interface
         // was created by the Create function below
         static AZ::EnvironmentVariable<AZStd::unique_ptr<AZ::NameDictionary>> s_staticNameDictionary;
+
+        static AZStd::atomic<AZ::u64> s_nextInstanceId{ 1 };
+
+        //! Entry in the per-thread cache of recently made names. Entries are keyed by the address and size of the
+        //! source string, which is stable for the literals and string tables that most names are made from. The
+        //! cache doesn't hold a reference to the name data; the removal count of its hash is used to detect if the
+        //! name data could have been released since it was cached.
+        struct RecentName
+        {
+            const NameDictionary* m_dictionary{ nullptr };
+            AZ::u64 m_dictionaryId{ 0 };
+            AZ::u64 m_removalCount{ 0 };
+            Name::Hash m_hash{ 0 };
+            const char* m_data{ nullptr };
+            size_t m_size{ 0 };
+            Internal::NameData* m_nameData{ nullptr };
+        };
+        static constexpr size_t RecentNameCacheSize = 64;
+        static thread_local RecentName t_recentNames[RecentNameCacheSize];
+
+        static RecentName& GetRecentName(AZStd::string_view name)
+        {
+            const uintptr_t address = reinterpret_cast<uintptr_t>(name.data());
+            return t_recentNames[((address >> 3) ^ (address >> 12) ^ name.size()) & (RecentNameCacheSize - 1)];
+        }
     }
 
     void NameDictionary::Create()
@@ -86,6 +112,8 @@ namespace AZ
 
     NameDictionary::NameDictionary(AZ::u64 maxHashSlots)
         : m_deferredHead(Name::FromStringLiteral("-fixed name dictionary deferred head-", nullptr))
+        , m_index(AZStd::make_unique<Internal::NameDataIndex>())
+        , m_instanceId(NameDictionaryInternal::s_nextInstanceId++)
         , m_maxHashSlots(maxHashSlots != 0 ? maxHashSlots : static_cast<AZ::u64>(AZStd::numeric_limits<Name::Hash>::max()) + 1)
     {
         // Ensure a Name that is valid for the life-cycle of this dictionary is the head of our literal linked list
@@ -129,23 +157,76 @@ namespace AZ
 
     Name NameDictionary::FindName(Name::Hash hash) const
     {
-        AZStd::shared_lock<AZStd::shared_mutex> lock(m_sharedMutex);
+        // Lookups go through the lock-free index. The read scope guarantees the name data isn't deleted while it's
+        // being acquired, even if another thread releases it at the same time.
+        Internal::NameDataIndex::ReadScope readScope(*m_index);
+        if (Internal::NameData* nameData = m_index->Find(hash); nameData)
+        {
+            return AcquireName(nameData);
+        }
+        return Name();
+    }
 
-        // The NameData m_useCount check is to avoid a multithread race condition
+    Name NameDictionary::AcquireName(Internal::NameData* nameData)
+    {
+        // Only take a reference if the name data is still in use. This is to avoid a multithread race condition
         // where thread B is in NameData::release and reduces the m_useCount to 0
         // and this thread(thread A) construct a Name using that NameData pointer
         // causing the m_useCount to go back up to 1.
         // If thread A continues along and releases the NameData again, before thread B can run
         // the the m_useCount can be reduced to 0 and multiple threads can be in the
         // NameData::release `if (m_useCount.fetch_sub(1) == 1)` block
-        if (auto iter = m_dictionary.find(hash);
-            iter != m_dictionary.end() && iter->second.m_nameData->m_useCount > 0)
+        int32_t useCount = nameData->m_useCount.load();
+        while (useCount > 0)
         {
-            return Name(iter->second.m_nameData);
+            if (nameData->m_useCount.compare_exchange_weak(useCount, useCount + 1))
+            {
+                Name name(nameData);
+                // The Name holds its own reference now so the count can't drop to zero here.
+                nameData->m_useCount.fetch_sub(1);
+                return name;
+            }
         }
         return Name();
     }
 
+    Name NameDictionary::FindRecentName(AZStd::string_view name) const
+    {
+        NameDictionaryInternal::RecentName& entry = NameDictionaryInternal::GetRecentName(name);
+        if (entry.m_dictionary != this || entry.m_dictionaryId != m_instanceId || entry.m_data != name.data() || entry.m_size != name.size())
+        {
+            return Name();
+        }
+
+        Internal::NameDataIndex::ReadScope readScope(*m_index);
+        // If no name sharing the removal counter of its hash was removed since the entry was cached, the name data is
+        // guaranteed to still be alive.
+        if (entry.m_removalCount != m_index->GetRemovalCount(entry.m_hash))
+        {
+            entry = {};
+            return Name();
+        }
+        // The same buffer may hold a different string by now.
+        if (entry.m_nameData->GetName() != name)
+        {
+            return Name();
+        }
+        return AcquireName(entry.m_nameData);
+    }
+
+    void NameDictionary::CacheRecentName(AZStd::string_view name, const Name& result) const
+    {
+        NameDictionaryInternal::RecentName& entry = NameDictionaryInternal::GetRecentName(name);
+        entry.m_dictionary = this;
+        entry.m_dictionaryId = m_instanceId;
+        // Read while the result still holds a reference so the name data can't have been removed yet.
+        entry.m_hash = result.m_data->GetHash();
+        entry.m_removalCount = m_index->GetRemovalCount(entry.m_hash);
+        entry.m_data = name.data();
+        entry.m_size = name.size();
+        entry.m_nameData = result.m_data.get();
+    }
+
     void NameDictionary::LoadLiteral(Name& nameLiteral)
     {
         if (nameLiteral.m_data == nullptr)
@@ -224,14 +305,20 @@ namespace AZ
             return Name();
         }
 
+        if (Name recentName = FindRecentName(nameString); !recentName.IsEmpty())
+        {
+            return recentName;
+        }
+
         Name::Hash hash = CalcHash(nameString);
 
         // If we find the same name with the same hash, just return it. 
-        // This path is faster than the loop below because FindName() takes a shared_lock whereas the
+        // This path is faster than the loop below because FindName() doesn't lock whereas the
         // loop requires a unique_lock to modify the dictionary.
         Name name = FindName(hash);
         if (name.GetStringView() == nameString)
         {
+            CacheRecentName(nameString, name);
             return AZStd::move(name);
         }
 
@@ -249,7 +336,9 @@ namespace AZ
                 nameData->m_hashCollision = collisionDetected;
                 // Piecewise construct to prevent creating a temporary ScopedNameDataWrapper that destructs
                 m_dictionary.emplace(AZStd::piecewise_construct, AZStd::forward_as_tuple(hash), AZStd::forward_as_tuple(*this, nameData));
-                return Name(nameData);
+                Name name(nameData);
+                m_index->Insert(nameData);
+                return name;
             }
             // Found the desired entry, return it
             else if (iter->second.m_nameData->GetName() == nameString)
@@ -312,7 +401,8 @@ namespace AZ
         if (nameData->m_useCount.compare_exchange_strong(expectedRefCount, -1))
         {
             m_dictionary.erase(nameData->GetHash());
-            delete nameData;
+            // Lock-free readers may still be looking at the name data, so the index deletes it once that's safe.
+            m_index->Remove(nameData);
         }
 
         ReportStats();
@@ -12,6 +12,7 @@
 #include <AzCore/std/string/string.h>
 #include <AzCore/std/string/string_view.h>
 #include <AzCore/std/parallel/shared_mutex.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
 #include <AzCore/Memory/Memory.h>
 #include <AzCore/Memory/OSAllocator.h>
 #include <AzCore/Name/Name.h>
@@ -33,6 +34,7 @@ namespace AZ
     namespace Internal
     {
         class NameData;
+        class NameDataIndex;
     };
 
     //! Maintains a list of unique strings for Name objects.
@@ -43,6 +45,9 @@ namespace AZ
     //! Benchmarks have shown that creating a new Name object can be quite slow when the name doesn't
     //! already exist in the NameDictionary, but is comparable to creating an AZStd::string for names
     //! that already exist.
+    //!
+    //! Looking up existing names doesn't take any locks and scales with the number of threads. Only adding
+    //! and releasing names is serialized.
     class AZCORE_API NameDictionary final
     {
     public:
@@ -112,6 +117,14 @@ namespace AZ
         //! Unloads the data with all deferred names registered using LoadDeferredName.
         void UnloadDeferredNames();
 
+        //! Returns a Name for the name data if it's still in use, otherwise an empty Name.
+        //! Should only be called on name data that can't be reclaimed during this call.
+        static Name AcquireName(Internal::NameData* nameData);
+        //! Looks up the name in the calling thread's cache of recently made names. Returns an empty Name on a miss.
+        Name FindRecentName(AZStd::string_view name) const;
+        //! Stores the name in the calling thread's cache of recently made names.
+        void CacheRecentName(AZStd::string_view name, const Name& result) const;
+
         //! Wrapper structure around a NameData pointer
         //! Which sets the Internal::NameData::m_nameDictionary pointer to this name dictionary
         //! instance on construction and to nullptr on destruction
@@ -127,8 +140,14 @@ namespace AZ
             NameDictionary& m_nameDictionary;
         };
 
+        //! Owns all the name data. Can only be accessed while holding m_sharedMutex.
         AZStd::unordered_map<Name::Hash, ScopedNameDataWrapper> m_dictionary;
         mutable AZStd::shared_mutex m_sharedMutex;
+        //! Lock-free copy of m_dictionary used to look up existing names. Modified while holding m_sharedMutex exclusively.
+        AZStd::unique_ptr<Internal::NameDataIndex> m_index;
+        //! Unique id of this dictionary, so entries in the thread local caches are never mistaken for entries of a
+        //! dictionary that was later created at the same address.
+        const AZ::u64 m_instanceId;
 
         //! A fixed Name used as the head of a linked list of Name literals.
         //! These literals can be static and have lifecycles not coupled to the name dictionary,
@@ -0,0 +1,531 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/IO/GenericStreams.h>
+#include <AzCore/Serialization/Json/JsonBinaryFormat.h>
+#include <AzCore/Serialization/Json/JsonSerialization.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/string/string_view.h>
+
+namespace AZ::JsonBinaryFormat
+{
+    namespace Internal
+    {
+        // Layout of a binary json document:
+        //     Signature, Version, number of keys, number of type ids (all u32 except the signature)
+        //     Key table: for every key the length (varint) and the characters.
+        //     Type id table: for every type id the length (varint) and the characters.
+        //     The root value.
+        // Values start with a tag that's followed by:
+        //     Null, False, True: nothing.
+        //     Int: zigzag encoded varint. Uint: varint. Double: 8 bytes.
+        //     String: the length (varint) and the characters.
+        //     Array: the number of elements (varint) followed by the elements.
+        //     Object: the number of members (varint) followed by the key index (varint) and the value for each member.
+        //     TypeId: index in the type id table (varint). Only used for the value of "$type" fields.
+        enum class Tag : u8
+        {
+            Null,
+            False,
+            True,
+            Int,
+            Uint,
+            Double,
+            String,
+            Array,
+            Object,
+            TypeId
+        };
+
+        // Limit the nesting to protect against stack overflows when reading corrupted data.
+        static constexpr u32 MaxDepth = 1024;
+
+        static void WriteVarUint(AZStd::vector<u8>& output, u64 value)
+        {
+            while (value >= 0x80)
+            {
+                output.push_back(static_cast<u8>(value | 0x80));
+                value >>= 7;
+            }
+            output.push_back(static_cast<u8>(value));
+        }
+
+        static void WriteU32(AZStd::vector<u8>& output, u32 value)
+        {
+            for (int i = 0; i < 4; ++i)
+            {
+                output.push_back(static_cast<u8>(value >> (i * 8)));
+            }
+        }
+
+        static void WriteString(AZStd::vector<u8>& output, AZStd::string_view string)
+        {
+            WriteVarUint(output, string.size());
+            output.insert(output.end(), string.begin(), string.end());
+        }
+
+        class Encoder
+        {
+        public:
+            bool Encode(const rapidjson::Value& value, u32 depth)
+            {
+                if (depth >= MaxDepth)
+                {
+                    return false;
+                }
+
+                switch (value.GetType())
+                {
+                case rapidjson::kNullType:
+                    WriteTag(Tag::Null);
+                    return true;
+                case rapidjson::kFalseType:
+                    WriteTag(Tag::False);
+                    return true;
+                case rapidjson::kTrueType:
+                    WriteTag(Tag::True);
+                    return true;
+                case rapidjson::kNumberType:
+                    if (value.IsDouble())
+                    {
+                        WriteTag(Tag::Double);
+                        const double number = value.GetDouble();
+                        u64 bits;
+                        memcpy(&bits, &number, sizeof(bits));
+                        for (int i = 0; i < 8; ++i)
+                        {
+                            m_body.push_back(static_cast<u8>(bits >> (i * 8)));
+                        }
+                    }
+                    else if (value.IsUint64())
+                    {
+                        WriteTag(Tag::Uint);
+                        WriteVarUint(m_body, value.GetUint64());
+                    }
+                    else
+                    {
+                        WriteTag(Tag::Int);
+                        const s64 number = value.GetInt64();
+                        WriteVarUint(m_body, (static_cast<u64>(number) << 1) ^ static_cast<u64>(number >> 63));
+                    }
+                    return true;
+                case rapidjson::kStringType:
+                    WriteTag(Tag::String);
+                    WriteString(m_body, AZStd::string_view(value.GetString(), value.GetStringLength()));
+                    return true;
+                case rapidjson::kArrayType:
+                    WriteTag(Tag::Array);
+                    WriteVarUint(m_body, value.Size());
+                    for (const rapidjson::Value& element : value.GetArray())
+                    {
+                        if (!Encode(element, depth + 1))
+                        {
+                            return false;
+                        }
+                    }
+                    return true;
+                case rapidjson::kObjectType:
+                    WriteTag(Tag::Object);
+                    WriteVarUint(m_body, value.MemberCount());
+                    for (const auto& member : value.GetObject())
+                    {
+                        AZStd::string_view name(member.name.GetString(), member.name.GetStringLength());
+                        WriteVarUint(m_body, GetIndex(name, m_keys, m_keyLookup));
+                        if (member.value.IsString() && name == JsonSerialization::TypeIdFieldIdentifier)
+                        {
+                            WriteTag(Tag::TypeId);
+                            AZStd::string_view typeId(member.value.GetString(), member.value.GetStringLength());
+                            WriteVarUint(m_body, GetIndex(typeId, m_typeIds, m_typeIdLookup));
+                        }
+                        else if (!Encode(member.value, depth + 1))
+                        {
+                            return false;
+                        }
+                    }
+                    return true;
+                default:
+                    return false;
+                }
+            }
+
+            void Finalize(AZStd::vector<u8>& output) const
+            {
+                output.insert(output.end(), AZStd::begin(Signature), AZStd::end(Signature));
+                WriteU32(output, Version);
+                WriteU32(output, aznumeric_cast<u32>(m_keys.size()));
+                WriteU32(output, aznumeric_cast<u32>(m_typeIds.size()));
+                for (AZStd::string_view key : m_keys)
+                {
+                    WriteString(output, key);
+                }
+                for (AZStd::string_view typeId : m_typeIds)
+                {
+                    WriteString(output, typeId);
+                }
+                output.insert(output.end(), m_body.begin(), m_body.end());
+            }
+
+        private:
+            using Lookup = AZStd::unordered_map<AZStd::string_view, u32>;
+
+            void WriteTag(Tag tag)
+            {
+                m_body.push_back(static_cast<u8>(tag));
+            }
+
+            static u32 GetIndex(AZStd::string_view string, AZStd::vector<AZStd::string_view>& table, Lookup& lookup)
+            {
+                auto [it, inserted] = lookup.emplace(string, aznumeric_cast<u32>(table.size()));
+                if (inserted)
+                {
+                    table.push_back(string);
+                }
+                return it->second;
+            }
+
+            // The strings in the tables point into the document that's being written.
+            AZStd::vector<AZStd::string_view> m_keys;
+            AZStd::vector<AZStd::string_view> m_typeIds;
+            Lookup m_keyLookup;
+            Lookup m_typeIdLookup;
+            AZStd::vector<u8> m_body;
+        };
+
+        class Decoder
+        {
+        public:
+            Decoder(AZStd::span<const u8> data, rapidjson::Document::AllocatorType& allocator)
+                : m_data(data)
+                , m_allocator(allocator)
+            {
+            }
+
+            bool ReadHeader()
+            {
+                if (!IsBinaryJson(m_data))
+                {
+                    return Fail("Data doesn't start with the binary json signature.");
+                }
+                m_position = sizeof(Signature);
+
+                u32 version;
+                u32 keyCount;
+                u32 typeIdCount;
+                if (!ReadU32(version) || !ReadU32(keyCount) || !ReadU32(typeIdCount))
+                {
+                    return false;
+                }
+                if (version != Version)
+                {
+                    return Fail("Unsupported binary json version.");
+                }
+
+                // Each entry takes at least one byte, which guards against reserving huge tables for corrupted counts.
+                if (keyCount > m_data.size() - m_position || typeIdCount > m_data.size() - m_position)
+                {
+                    return Fail("Binary json tables are larger than the data.");
+                }
+
+                m_keys.reserve(keyCount);
+                for (u32 i = 0; i < keyCount; ++i)
+                {
+                    AZStd::string_view key;
+                    if (!ReadTableString(key))
+                    {
+                        return false;
+                    }
+                    m_keys.push_back(key);
+                }
+
+                m_typeIds.reserve(typeIdCount);
+                for (u32 i = 0; i < typeIdCount; ++i)
+                {
+                    AZStd::string_view typeId;
+                    if (!ReadTableString(typeId))
+                    {
+                        return false;
+                    }
+                    m_typeIds.push_back(typeId);
+                }
+                return true;
+            }
+
+            bool Decode(rapidjson::Value& value, u32 depth)
+            {
+                if (depth >= MaxDepth)
+                {
+                    return Fail("Binary json document is nested too deeply.");
+                }
+                if (m_position >= m_data.size())
+                {
+                    return Fail("Unexpected end of binary json data.");
+                }
+
+                u64 count;
+                switch (static_cast<Tag>(m_data[m_position++]))
+                {
+                case Tag::Null:
+                    value.SetNull();
+                    return true;
+                case Tag::False:
+                    value.SetBool(false);
+                    return true;
+                case Tag::True:
+                    value.SetBool(true);
+                    return true;
+                case Tag::Int:
+                {
+                    u64 encoded;
+                    if (!ReadVarUint(encoded))
+                    {
+                        return false;
+                    }
+                    value.SetInt64(static_cast<s64>(encoded >> 1) ^ -static_cast<s64>(encoded & 1));
+                    return true;
+                }
+                case Tag::Uint:
+                {
+                    u64 number;
+                    if (!ReadVarUint(number))
+                    {
+                        return false;
+                    }
+                    value.SetUint64(number);
+                    return true;
+                }
+                case Tag::Double:
+                {
+                    if (m_data.size() - m_position < sizeof(u64))
+                    {
+                        return Fail("Unexpected end of binary json data.");
+                    }
+                    u64 bits = 0;
+                    for (int i = 0; i < 8; ++i)
+                    {
+                        bits |= static_cast<u64>(m_data[m_position++]) << (i * 8);
+                    }
+                    double number;
+                    memcpy(&number, &bits, sizeof(number));
+                    value.SetDouble(number);
+                    return true;
+                }
+                case Tag::String:
+                {
+                    const char* string;
+                    rapidjson::SizeType length;
+                    if (!ReadString(string, length))
+                    {
+                        return false;
+                    }
+                    value.SetString(string, length, m_allocator);
+                    return true;
+                }
+                case Tag::Array:
+                    if (!ReadCount(count))
+                    {
+                        return false;
+                    }
+                    value.SetArray();
+                    value.Reserve(aznumeric_cast<rapidjson::SizeType>(count), m_allocator);
+                    for (u64 i = 0; i < count; ++i)
+                    {
+                        rapidjson::Value element;
+                        if (!Decode(element, depth + 1))
+                        {
+                            return false;
+                        }
+                        value.PushBack(element, m_allocator);
+                    }
+                    return true;
+                case Tag::Object:
+                    if (!ReadCount(count))
+                    {
+                        return false;
+                    }
+                    value.SetObject();
+                    for (u64 i = 0; i < count; ++i)
+                    {
+                        u64 keyIndex;
+                        if (!ReadVarUint(keyIndex))
+                        {
+                            return false;
+                        }
+                        if (keyIndex >= m_keys.size())
+                        {
+                            return Fail("Binary json member refers to an unknown key.");
+                        }
+                        rapidjson::Value member;
+                        if (!Decode(member, depth + 1))
+                        {
+                            return false;
+                        }
+                        // Names are copied into the document, rapidjson keeps constant strings by pointer when values are copied
+                        // into another document, which would leave them pointing into this document's allocator.
+                        const AZStd::string_view key = m_keys[keyIndex];
+                        rapidjson::Value name(key.data(), aznumeric_cast<rapidjson::SizeType>(key.size()), m_allocator);
+                        value.AddMember(name, member, m_allocator);
+                    }
+                    return true;
+                case Tag::TypeId:
+                {
+                    u64 typeIndex;
+                    if (!ReadVarUint(typeIndex))
+                    {
+                        return false;
+                    }
+                    if (typeIndex >= m_typeIds.size())
+                    {
+                        return Fail("Binary json value refers to an unknown type id.");
+                    }
+                    const AZStd::string_view typeId = m_typeIds[typeIndex];
+                    value.SetString(typeId.data(), aznumeric_cast<rapidjson::SizeType>(typeId.size()), m_allocator);
+                    return true;
+                }
+                default:
+                    return Fail("Binary json data contains an unknown value type.");
+                }
+            }
+
+            const AZStd::string& GetError() const
+            {
+                return m_error;
+            }
+
+        private:
+            bool Fail(const char* message)
+            {
+                m_error = AZStd::string::format("%s (offset %zu)", message, m_position);
+                return false;
+            }
+
+            bool ReadU32(u32& value)
+            {
+                if (m_data.size() - m_position < sizeof(u32))
+                {
+                    return Fail("Unexpected end of binary json data.");
+                }
+                value = 0;
+                for (int i = 0; i < 4; ++i)
+                {
+                    value |= static_cast<u32>(m_data[m_position++]) << (i * 8);
+                }
+                return true;
+            }
+
+            bool ReadVarUint(u64& value)
+            {
+                value = 0;
+                for (u32 shift = 0; shift < 64; shift += 7)
+                {
+                    if (m_position >= m_data.size())
+                    {
+                        return Fail("Unexpected end of binary json data.");
+                    }
+                    const u8 byte = m_data[m_position++];
+                    value |= static_cast<u64>(byte & 0x7f) << shift;
+                    if ((byte & 0x80) == 0)
+                    {
+                        return true;
+                    }
+                }
+                return Fail("Invalid variable length integer in binary json data.");
+            }
+
+            bool ReadCount(u64& count)
+            {
+                // Every element takes at least one byte.
+                if (!ReadVarUint(count))
+                {
+                    return false;
+                }
+                if (count > m_data.size() - m_position)
+                {
+                    return Fail("Binary json container is larger than the data.");
+                }
+                return true;
+            }
+
+            bool ReadString(const char*& string, rapidjson::SizeType& length)
+            {
+                u64 size;
+                if (!ReadVarUint(size))
+                {
+                    return false;
+                }
+                if (size > m_data.size() - m_position)
+                {
+                    return Fail("Binary json string is larger than the data.");
+                }
+                string = reinterpret_cast<const char*>(m_data.data() + m_position);
+                length = aznumeric_cast<rapidjson::SizeType>(size);
+                m_position += size;
+                return true;
+            }
+
+            //! Reads a string from one of the tables. The result points into the binary data.
+            bool ReadTableString(AZStd::string_view& result)
+            {
+                const char* string;
+                rapidjson::SizeType length;
+                if (!ReadString(string, length))
+                {
+                    return false;
+                }
+                result = AZStd::string_view(string, length);
+                return true;
+            }
+
+            // The strings in the tables point into the binary data that's being read.
+            AZStd::vector<AZStd::string_view> m_keys;
+            AZStd::vector<AZStd::string_view> m_typeIds;
+            AZStd::string m_error;
+            AZStd::span<const u8> m_data;
+            rapidjson::Document::AllocatorType& m_allocator;
+            size_t m_position{ 0 };
+        };
+    } // namespace Internal
+
+    bool IsBinaryJson(AZStd::span<const u8> data)
+    {
+        return data.size() >= sizeof(Signature) && memcmp(data.data(), Signature, sizeof(Signature)) == 0;
+    }
+
+    AZ::Outcome<void, AZStd::string> Write(const rapidjson::Value& value, AZStd::vector<u8>& output)
+    {
+        Internal::Encoder encoder;
+        if (!encoder.Encode(value, 0))
+        {
+            return AZ::Failure(AZStd::string("Json value is nested too deeply to be stored in binary form."));
+        }
+        encoder.Finalize(output);
+        return AZ::Success();
+    }
+
+    AZ::Outcome<void, AZStd::string> Write(const rapidjson::Value& value, IO::GenericStream& stream)
+    {
+        AZStd::vector<u8> buffer;
+        auto result = Write(value, buffer);
+        if (result.IsSuccess() && stream.Write(buffer.size(), buffer.data()) != buffer.size())
+        {
+            return AZ::Failure(AZStd::string("Unable to write binary json to the stream."));
+        }
+        return result;
+    }
+
+    AZ::Outcome<rapidjson::Document, AZStd::string> Read(AZStd::span<const u8> data)
+    {
+        rapidjson::Document document;
+        Internal::Decoder decoder(data, document.GetAllocator());
+        if (!decoder.ReadHeader() || !decoder.Decode(document, 0))
+        {
+            return AZ::Failure(AZStd::string::format("Failed to read binary json: %s", decoder.GetError().c_str()));
+        }
+        return AZ::Success(AZStd::move(document));
+    }
+} // namespace AZ::JsonBinaryFormat
@@ -0,0 +1,52 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/JSON/document.h>
+#include <AzCore/Outcome/Outcome.h>
+#include <AzCore/std/containers/span.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/string/string.h>
+
+namespace AZ
+{
+    namespace IO
+    {
+        class GenericStream;
+    }
+
+    //! Compact binary encoding of json documents, intended for products that are loaded at runtime.
+    //! The binary form encodes the same document as the text form, so anything stored with JsonSerialization::Store can be written
+    //! in binary and the document that's read back can be used with JsonSerialization::Load, JsonMerger and patching without changes.
+    //! Reading a binary document skips the text parsing, so there's no tokenizing, number conversion or unescaping:
+    //!   - Member names are stored once in a key table and members refer to them by index.
+    //!   - The values of "$type" fields are stored once in a type table and fields refer to them by index.
+    //!   - Numbers are stored as variable length integers or raw doubles.
+    //! The tables only deduplicate strings to keep the data small and fast to decode. The result is a regular rapidjson document,
+    //! so JsonSerialization::Load still matches members by name and resolves "$type" strings the same way it does for text.
+    //! All strings in the document that's read back are owned by the document, so its values can be copied into other documents.
+    //! The functions in JsonSerializationUtils that read json detect the binary form automatically.
+    namespace JsonBinaryFormat
+    {
+        //! The first bytes of every binary json document.
+        static constexpr char Signature[] = { 'A', 'Z', 'J', 'B' };
+        static constexpr u32 Version = 1;
+
+        //! Returns true if the data starts with the signature of the binary json format.
+        AZCORE_API bool IsBinaryJson(AZStd::span<const u8> data);
+
+        //! Encodes the json value and appends it to the output.
+        AZCORE_API AZ::Outcome<void, AZStd::string> Write(const rapidjson::Value& value, AZStd::vector<u8>& output);
+        //! Encodes the json value and writes it to the stream.
+        AZCORE_API AZ::Outcome<void, AZStd::string> Write(const rapidjson::Value& value, IO::GenericStream& stream);
+
+        //! Decodes a binary json document. Any data after the encoded document is ignored.
+        AZCORE_API AZ::Outcome<rapidjson::Document, AZStd::string> Read(AZStd::span<const u8> data);
+    } // namespace JsonBinaryFormat
+} // namespace AZ
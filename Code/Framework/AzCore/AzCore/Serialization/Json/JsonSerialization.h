@@ -20,6 +20,11 @@ namespace AZ
     class BaseJsonSerializer;
 
     struct JsonImportSettings;
+
+    namespace IO
+    {
+        class GenericStream;
+    }
     
     enum class JsonMergeApproach
     {
@@ -177,6 +182,41 @@ namespace AZ
         static JsonSerializationResult::ResultCode Load(
             void* object, const Uuid& objectType, const rapidjson::Value& root, JsonDeserializerSettings& settings);
 
+        //! Loads the data from the json document in the stream into the supplied object. The object is expected to be created before
+        //! calling load. Unlike Load the document isn't fully parsed into memory first. Classes that are loaded through the Serialize
+        //! Context are read directly from the stream and a json value is only created, one at a time, for values that are loaded by
+        //! a custom serializer or stored in pointers. The result is the same as calling Load on the fully parsed document.
+        //! Documents in the binary form from JsonBinaryFormat are also accepted. If the stream can seek, the syntax of the
+        //! document is checked before loading so a malformed document is rejected without changing the object. If the stream
+        //! can't seek, syntax errors are only found while loading and the object may be partially loaded.
+        //! @param object Object where the data will be loaded into.
+        //! @param stream The stream to read the json document from, starting at the current position.
+        //! @param settings Optional additional settings to control the way document is deserialized.
+        template<typename T>
+        static JsonSerializationResult::ResultCode LoadFromStream(
+            T& object, IO::GenericStream& stream, const JsonDeserializerSettings& settings = JsonDeserializerSettings{});
+        //! Loads the data from the json document in the stream into the supplied object without fully parsing the document first.
+        //! @param object Object where the data will be loaded into.
+        //! @param stream The stream to read the json document from, starting at the current position.
+        //! @param settings Additional settings to control the way document is deserialized.
+        template<typename T>
+        static JsonSerializationResult::ResultCode LoadFromStream(T& object, IO::GenericStream& stream, JsonDeserializerSettings& settings);
+        //! Loads the data from the json document in the stream into the supplied object without fully parsing the document first.
+        //! @param object Pointer to the object where the data will be loaded into.
+        //! @param objectType Type id of the object passed in.
+        //! @param stream The stream to read the json document from, starting at the current position.
+        //! @param settings Optional additional settings to control the way document is deserialized.
+        static JsonSerializationResult::ResultCode LoadFromStream(
+            void* object, const Uuid& objectType, IO::GenericStream& stream,
+            const JsonDeserializerSettings& settings = JsonDeserializerSettings{});
+        //! Loads the data from the json document in the stream into the supplied object without fully parsing the document first.
+        //! @param object Pointer to the object where the data will be loaded into.
+        //! @param objectType Type id of the object passed in.
+        //! @param stream The stream to read the json document from, starting at the current position.
+        //! @param settings Additional settings to control the way document is deserialized.
+        static JsonSerializationResult::ResultCode LoadFromStream(
+            void* object, const Uuid& objectType, IO::GenericStream& stream, JsonDeserializerSettings& settings);
+
         //! Loads the type id from the provided input.
         //! Note: it's not recommended to use this function (frequently) as it requires users of the json file to have knowledge of the internal
         //!     type structure and is therefore harder to use.
@@ -359,6 +399,20 @@ namespace AZ
         return Load(&object, azrtti_typeid(object), root, settings);
     }
 
+    template<typename T>
+    JsonSerializationResult::ResultCode JsonSerialization::LoadFromStream(
+        T& object, IO::GenericStream& stream, const JsonDeserializerSettings& settings)
+    {
+        return LoadFromStream(&object, azrtti_typeid(object), stream, settings);
+    }
+
+    template<typename T>
+    JsonSerializationResult::ResultCode JsonSerialization::LoadFromStream(
+        T& object, IO::GenericStream& stream, JsonDeserializerSettings& settings)
+    {
+        return LoadFromStream(&object, azrtti_typeid(object), stream, settings);
+    }
+
     template<typename T>
     JsonSerializationResult::ResultCode JsonSerialization::Store(
         rapidjson::Value& output, rapidjson::Document::AllocatorType& allocator, const T& object, const JsonSerializerSettings& settings)
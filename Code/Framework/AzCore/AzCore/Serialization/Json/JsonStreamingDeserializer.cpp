@@ -0,0 +1,564 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/IO/GenericStreams.h>
+#include <AzCore/JSON/error/en.h>
+#include <AzCore/JSON/reader.h>
+#include <AzCore/Serialization/Json/BaseJsonSerializer.h>
+#include <AzCore/Serialization/Json/JsonBinaryFormat.h>
+#include <AzCore/Serialization/Json/JsonDeserializer.h>
+#include <AzCore/Serialization/Json/JsonStreamingDeserializer.h>
+#include <AzCore/Serialization/Json/RegistrationContext.h>
+#include <AzCore/std/containers/vector.h>
+
+namespace AZ
+{
+    //! Input stream for the rapidjson reader that reads the json text from a GenericStream in blocks.
+    class JsonStreamingDeserializer::StreamReader
+    {
+    public:
+        using Ch = char;
+
+        explicit StreamReader(IO::GenericStream& stream)
+            : m_stream(stream)
+        {
+            m_buffer.resize_no_construct(BufferSize);
+            Fill();
+        }
+
+        Ch Peek() const
+        {
+            return m_position < m_size ? m_buffer[m_position] : '\0';
+        }
+
+        Ch Take()
+        {
+            if (m_position >= m_size)
+            {
+                return '\0';
+            }
+            Ch result = m_buffer[m_position++];
+            if (m_position == m_size)
+            {
+                Fill();
+            }
+            return result;
+        }
+
+        size_t Tell() const
+        {
+            return m_consumed + m_position;
+        }
+
+        // The writing functions are only used for in-situ parsing, which isn't supported for streams.
+        Ch* PutBegin()
+        {
+            AZ_Assert(false, "In-situ parsing isn't supported by the json stream reader.");
+            return nullptr;
+        }
+        void Put(Ch)
+        {
+            AZ_Assert(false, "In-situ parsing isn't supported by the json stream reader.");
+        }
+        void Flush()
+        {
+            AZ_Assert(false, "In-situ parsing isn't supported by the json stream reader.");
+        }
+        size_t PutEnd(Ch*)
+        {
+            AZ_Assert(false, "In-situ parsing isn't supported by the json stream reader.");
+            return 0;
+        }
+
+        //! Returns the data that has been read from the stream but not consumed yet.
+        AZStd::span<const u8> GetBufferedData() const
+        {
+            return AZStd::span<const u8>(reinterpret_cast<const u8*>(m_buffer.data()) + m_position, m_size - m_position);
+        }
+
+        //! Appends all data that hasn't been consumed yet, including the remainder of the stream, to the output.
+        void ReadRemaining(AZStd::vector<u8>& output)
+        {
+            while (m_position < m_size)
+            {
+                AZStd::span<const u8> data = GetBufferedData();
+                output.insert(output.end(), data.begin(), data.end());
+                Fill();
+            }
+        }
+
+    private:
+        void Fill()
+        {
+            m_consumed += m_size;
+            m_position = 0;
+            m_size = aznumeric_cast<size_t>(m_stream.Read(BufferSize, m_buffer.data()));
+        }
+
+        static constexpr size_t BufferSize = 64 * 1024;
+
+        AZStd::vector<char> m_buffer;
+        IO::GenericStream& m_stream;
+        size_t m_consumed{ 0 };
+        size_t m_position{ 0 };
+        size_t m_size{ 0 };
+    };
+
+    //! Handler for the rapidjson reader that loads classes directly from the parse events and builds json values for everything
+    //! else. This follows the same steps as JsonDeserializer::Load and JsonDeserializer::LoadClass so the results, including
+    //! the reported issues, are the same as when loading from a fully parsed document.
+    class JsonStreamingDeserializer::StreamHandler
+    {
+    public:
+        StreamHandler(void* object, const Uuid& typeId, JsonDeserializerContext& context)
+            : m_rootObject(object)
+            , m_rootTypeId(typeId)
+            , m_context(context)
+        {
+        }
+
+        bool Null()
+        {
+            rapidjson::Value value;
+            return OnScalar(value);
+        }
+        bool Bool(bool boolean)
+        {
+            rapidjson::Value value(boolean);
+            return OnScalar(value);
+        }
+        bool Int(int number)
+        {
+            rapidjson::Value value(number);
+            return OnScalar(value);
+        }
+        bool Uint(unsigned number)
+        {
+            rapidjson::Value value(number);
+            return OnScalar(value);
+        }
+        bool Int64(int64_t number)
+        {
+            rapidjson::Value value(number);
+            return OnScalar(value);
+        }
+        bool Uint64(uint64_t number)
+        {
+            rapidjson::Value value(number);
+            return OnScalar(value);
+        }
+        bool Double(double number)
+        {
+            rapidjson::Value value(number);
+            return OnScalar(value);
+        }
+        bool RawNumber(const char* string, rapidjson::SizeType length, bool copy)
+        {
+            return String(string, length, copy);
+        }
+        bool String(const char* string, rapidjson::SizeType length, [[maybe_unused]] bool copy)
+        {
+            if (SkipScalar())
+            {
+                return true;
+            }
+            rapidjson::Value value(string, length, m_capture.GetAllocator());
+            return OnScalar(value);
+        }
+
+        bool StartObject()
+        {
+            if (SkipStartContainer())
+            {
+                return true;
+            }
+            if (!m_isCapturing)
+            {
+                void* object = m_frames.empty() ? m_rootObject : m_frames.back().m_element.m_data;
+                const Uuid& typeId = m_frames.empty() ? m_rootTypeId : m_frames.back().m_element.m_info->m_typeId;
+                const SerializeContext::ClassElement* element = m_frames.empty() ? nullptr : m_frames.back().m_element.m_info;
+                if (const SerializeContext::ClassData* classData = FindStreamableClass(object, typeId, element))
+                {
+                    ClassFrame& frame = m_frames.emplace_back();
+                    frame.m_object = object;
+                    frame.m_classData = classData;
+                    return true;
+                }
+            }
+            rapidjson::Value* slot = GetCaptureSlot();
+            slot->SetObject();
+            m_captureStack.push_back(slot);
+            return true;
+        }
+
+        bool Key(const char* string, rapidjson::SizeType length, [[maybe_unused]] bool copy)
+        {
+            if (m_skipDepth > 0)
+            {
+                return true;
+            }
+            if (m_isCapturing)
+            {
+                auto& allocator = m_capture.GetAllocator();
+                rapidjson::Value* container = m_captureStack.back();
+                rapidjson::Value name(string, length, allocator);
+                rapidjson::Value value;
+                container->AddMember(name, value, allocator);
+                m_captureMember = &(container->MemberEnd() - 1)->value;
+                return true;
+            }
+
+            using namespace JsonSerializationResult;
+
+            ClassFrame& frame = m_frames.back();
+            if (!frame.m_hasMembers)
+            {
+                // Compatibility with Reflection Serialize - it expects this callback before reading into a C++ class.
+                frame.m_hasMembers = true;
+                if (frame.m_classData->m_eventHandler)
+                {
+                    frame.m_classData->m_eventHandler->OnWriteBegin(frame.m_object);
+                }
+            }
+
+            AZStd::string_view name(string, length);
+            if (name == JsonSerialization::TypeIdFieldIdentifier)
+            {
+                m_skipNextValue = true;
+                return true;
+            }
+
+            frame.m_element = JsonDeserializer::FindElementByNameCrc(
+                *m_context.GetSerializeContext(), frame.m_object, *frame.m_classData, Crc32(name));
+            m_context.PushPath(name);
+            if (!frame.m_element.m_found)
+            {
+                frame.m_result.Combine(m_context.Report(Tasks::ReadField, Outcomes::Skipped,
+                    "Skipping field as there's no matching variable in the target."));
+                m_context.PopPath();
+                m_skipNextValue = true;
+            }
+            return true;
+        }
+
+        bool EndObject([[maybe_unused]] rapidjson::SizeType memberCount)
+        {
+            if (m_skipDepth > 0)
+            {
+                --m_skipDepth;
+                return true;
+            }
+            if (m_isCapturing)
+            {
+                return EndCaptureContainer();
+            }
+
+            using namespace JsonSerializationResult;
+
+            ClassFrame& frame = m_frames.back();
+            ResultCode result(Tasks::ReadField);
+            if (!frame.m_hasMembers)
+            {
+                result = m_context.Report(Tasks::ReadField, Outcomes::DefaultsUsed, "Value has an explicit default.");
+            }
+            else
+            {
+                size_t elementCount = JsonDeserializer::CountElements(*m_context.GetSerializeContext(), *frame.m_classData);
+                if (elementCount > frame.m_numLoads)
+                {
+                    frame.m_result.Combine(
+                        ResultCode(Tasks::ReadField, frame.m_numLoads == 0 ? Outcomes::DefaultsUsed : Outcomes::PartialDefaults));
+                }
+
+                // Compatibility with Reflection Serialize - it expects this callback after reading into a C++ class.
+                if (frame.m_classData->m_eventHandler)
+                {
+                    frame.m_classData->m_eventHandler->OnWriteEnd(frame.m_object);
+                }
+                result = frame.m_result;
+            }
+            m_frames.pop_back();
+            return CompleteValue(result);
+        }
+
+        bool StartArray()
+        {
+            if (SkipStartContainer())
+            {
+                return true;
+            }
+            rapidjson::Value* slot = GetCaptureSlot();
+            slot->SetArray();
+            m_captureStack.push_back(slot);
+            return true;
+        }
+
+        bool EndArray([[maybe_unused]] rapidjson::SizeType elementCount)
+        {
+            if (m_skipDepth > 0)
+            {
+                --m_skipDepth;
+                return true;
+            }
+            return EndCaptureContainer();
+        }
+
+        JsonSerializationResult::ResultCode Finish(const rapidjson::ParseResult& parseResult)
+        {
+            // Parsing is terminated by this handler if the root value failed to load, in which case the remainder of the
+            // document isn't needed. Any other error, including data after the root value, fails the load.
+            if (parseResult.IsError() && !(m_isDone && parseResult.Code() == rapidjson::kParseErrorTermination))
+            {
+                // Balance the OnWriteBegin calls for classes that were being loaded when the error was found.
+                for (auto it = m_frames.rbegin(); it != m_frames.rend(); ++it)
+                {
+                    if (it->m_hasMembers && it->m_classData->m_eventHandler)
+                    {
+                        it->m_classData->m_eventHandler->OnWriteEnd(it->m_object);
+                    }
+                }
+                m_frames.clear();
+                return ReportParseError(parseResult, m_context);
+            }
+            return m_result;
+        }
+
+        static JsonSerializationResult::ResultCode ReportParseError(
+            const rapidjson::ParseResult& parseResult, JsonDeserializerContext& context)
+        {
+            using namespace JsonSerializationResult;
+
+            return context.Report(Tasks::ReadField, Outcomes::Catastrophic,
+                AZStd::string::format("JSON parse error at offset %zu: %s", parseResult.Offset(),
+                    rapidjson::GetParseError_En(parseResult.Code())));
+        }
+
+    private:
+        struct ClassFrame
+        {
+            void* m_object{ nullptr };
+            const SerializeContext::ClassData* m_classData{ nullptr };
+            //! The element the next value will be loaded into.
+            JsonDeserializer::ElementDataResult m_element;
+            JsonSerializationResult::ResultCode m_result{ JsonSerializationResult::Tasks::ReadField };
+            size_t m_numLoads{ 0 };
+            bool m_hasMembers{ false };
+        };
+
+        //! Returns the class data if the value for the object can be loaded member by member. This is only the case for classes that
+        //! JsonDeserializer::Load would pass to JsonDeserializer::LoadClass, everything else is loaded from a json value.
+        const SerializeContext::ClassData* FindStreamableClass(
+            void* object, const Uuid& typeId, const SerializeContext::ClassElement* element)
+        {
+            if (!object || (element && (element->m_flags & SerializeContext::ClassElement::Flags::FLG_POINTER)))
+            {
+                return nullptr;
+            }
+            if (m_context.GetRegistrationContext()->GetSerializerForType(typeId))
+            {
+                return nullptr;
+            }
+            const SerializeContext::ClassData* classData = m_context.GetSerializeContext()->FindClassData(typeId);
+            if (!classData || classData->m_container)
+            {
+                return nullptr;
+            }
+            if (classData->m_azRtti &&
+                (classData->m_azRtti->GetGenericTypeId() != typeId ||
+                 (classData->m_azRtti->GetTypeTraits() & AZ::TypeTraits::is_enum) == AZ::TypeTraits::is_enum))
+            {
+                return nullptr;
+            }
+            return classData;
+        }
+
+        //! Returns true if the scalar is part of a value that's being skipped.
+        bool SkipScalar()
+        {
+            if (m_skipDepth > 0)
+            {
+                return true;
+            }
+            if (m_skipNextValue)
+            {
+                m_skipNextValue = false;
+                return true;
+            }
+            return false;
+        }
+
+        //! Returns true if the container is part of, or is, a value that's being skipped.
+        bool SkipStartContainer()
+        {
+            if (m_skipDepth > 0 || m_skipNextValue)
+            {
+                m_skipNextValue = false;
+                ++m_skipDepth;
+                return true;
+            }
+            return false;
+        }
+
+        bool OnScalar(rapidjson::Value& value)
+        {
+            if (SkipScalar())
+            {
+                return true;
+            }
+            *GetCaptureSlot() = value;
+            return m_captureStack.empty() ? CompleteCapture() : true;
+        }
+
+        //! Returns the value in the captured json that the next value will be stored in, and starts a new capture if needed.
+        rapidjson::Value* GetCaptureSlot()
+        {
+            if (!m_isCapturing)
+            {
+                m_isCapturing = true;
+                return &static_cast<rapidjson::Value&>(m_capture);
+            }
+
+            rapidjson::Value* container = m_captureStack.back();
+            if (container->IsArray())
+            {
+                rapidjson::Value value;
+                container->PushBack(value, m_capture.GetAllocator());
+                return &(*container)[container->Size() - 1];
+            }
+            return m_captureMember;
+        }
+
+        bool EndCaptureContainer()
+        {
+            m_captureStack.pop_back();
+            return m_captureStack.empty() ? CompleteCapture() : true;
+        }
+
+        bool CompleteCapture()
+        {
+            m_isCapturing = false;
+            JsonSerializationResult::ResultCode result = m_frames.empty()
+                ? JsonDeserializer::Load(m_rootObject, m_rootTypeId, m_capture, false, JsonDeserializer::UseTypeDeserializer::Yes, m_context)
+                : JsonDeserializer::LoadWithClassElement(
+                      m_frames.back().m_element.m_data, m_capture, *m_frames.back().m_element.m_info, m_context);
+
+            // Release the captured value and the memory that was allocated for it.
+            m_capture.SetNull();
+            m_capture.GetAllocator().Clear();
+            m_captureMember = nullptr;
+
+            return CompleteValue(result);
+        }
+
+        //! Called when the value for the root or the current element of the top class has been loaded.
+        bool CompleteValue(JsonSerializationResult::ResultCode result)
+        {
+            using namespace JsonSerializationResult;
+
+            if (m_frames.empty())
+            {
+                m_result = result;
+                m_isDone = true;
+                return true;
+            }
+
+            ClassFrame& frame = m_frames.back();
+            frame.m_result.Combine(result);
+            if (result.GetProcessing() == Processing::Halted)
+            {
+                JsonSerializationResult::ResultCode haltResult = m_context.Report(result, "Loading of element has failed.");
+                m_context.PopPath();
+                m_frames.pop_back();
+                // The rest of the class's object is no longer needed.
+                ++m_skipDepth;
+                if (!CompleteValue(haltResult))
+                {
+                    return false;
+                }
+                // Stop parsing if this was the root, there's no need to read the remainder of the document.
+                return !m_frames.empty();
+            }
+            else if (result.GetProcessing() != Processing::Altered)
+            {
+                frame.m_numLoads++;
+            }
+            m_context.PopPath();
+            return true;
+        }
+
+        AZStd::vector<ClassFrame> m_frames;
+
+        //! Json value for anything that can't be loaded directly from the parse events.
+        rapidjson::Document m_capture;
+        //! The arrays and objects in the captured value that are being read.
+        AZStd::vector<rapidjson::Value*> m_captureStack;
+        //! The value of the last member that was added to an object in the captured value.
+        rapidjson::Value* m_captureMember{ nullptr };
+
+        void* m_rootObject;
+        Uuid m_rootTypeId;
+        JsonDeserializerContext& m_context;
+        JsonSerializationResult::ResultCode m_result{ JsonSerializationResult::Tasks::ReadField };
+
+        //! Number of arrays and objects that are being skipped.
+        size_t m_skipDepth{ 0 };
+        bool m_skipNextValue{ false };
+        bool m_isCapturing{ false };
+        bool m_isDone{ false };
+    };
+
+    JsonSerializationResult::ResultCode JsonStreamingDeserializer::Load(
+        void* object, const Uuid& typeId, IO::GenericStream& stream, JsonDeserializerContext& context)
+    {
+        using namespace JsonSerializationResult;
+
+        constexpr unsigned int ParseFlags = rapidjson::kParseCommentsFlag | rapidjson::kParseIterativeFlag;
+
+        const IO::SizeType startPosition = stream.CanSeek() ? stream.GetCurPos() : 0;
+        StreamReader reader(stream);
+        if (JsonBinaryFormat::IsBinaryJson(reader.GetBufferedData()))
+        {
+            // The binary form doesn't need parsing and is already compact, so it's decoded to a document and loaded from there.
+            AZStd::vector<u8> data;
+            reader.ReadRemaining(data);
+            auto document = JsonBinaryFormat::Read(data);
+            if (!document.IsSuccess())
+            {
+                return context.Report(Tasks::ReadField, Outcomes::Catastrophic, document.GetError());
+            }
+            return JsonDeserializer::Load(
+                object, typeId, document.GetValue(), false, JsonDeserializer::UseTypeDeserializer::Yes, context);
+        }
+
+        rapidjson::Reader parser;
+        if (!stream.CanSeek())
+        {
+            // The document can only be read once, so syntax errors are found while loading. The object is left partially
+            // loaded in that case.
+            StreamHandler handler(object, typeId, context);
+            return handler.Finish(parser.Parse<ParseFlags>(reader, handler));
+        }
+
+        // Check the syntax of the entire document first so a malformed document, such as a truncated file, doesn't leave the
+        // object partially loaded. This doesn't build any values so it's cheap compared to loading.
+        {
+            rapidjson::BaseReaderHandler<> validator;
+            rapidjson::ParseResult validationResult = parser.Parse<ParseFlags>(reader, validator);
+            if (validationResult.IsError())
+            {
+                return StreamHandler::ReportParseError(validationResult, context);
+            }
+        }
+        stream.Seek(aznumeric_cast<IO::OffsetType>(startPosition), IO::GenericStream::ST_SEEK_BEGIN);
+
+        StreamReader loadReader(stream);
+        StreamHandler handler(object, typeId, context);
+        return handler.Finish(parser.Parse<ParseFlags>(loadReader, handler));
+    }
+} // namespace AZ
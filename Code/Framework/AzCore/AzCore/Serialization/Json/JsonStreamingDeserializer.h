@@ -0,0 +1,48 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Serialization/Json/JsonSerialization.h>
+
+namespace AZ
+{
+    class JsonDeserializerContext;
+    struct Uuid;
+
+    namespace IO
+    {
+        class GenericStream;
+    }
+
+    //! Loads objects from a json document that's read from a stream without first building a DOM of the entire document.
+    //! Classes that are loaded through the Serialize Context are read member by member directly from the stream. A json value
+    //! is only built for members that need one, such as values handled by a custom serializer (which includes containers) and
+    //! pointers, as their type can depend on the contents of the value. That json value is released as soon as the member is
+    //! loaded, so the peak memory use depends on the largest of these values instead of the size of the document.
+    //! The results are the same as loading the fully parsed document with the JsonDeserializer. For seekable streams the syntax
+    //! of the document is checked in a first pass that doesn't build any values, so malformed documents don't partially load.
+    class AZCORE_API JsonStreamingDeserializer final
+    {
+        friend class JsonSerialization;
+
+    private:
+        class StreamReader;
+        class StreamHandler;
+
+        JsonStreamingDeserializer() = delete;
+        ~JsonStreamingDeserializer() = delete;
+        JsonStreamingDeserializer& operator=(const JsonStreamingDeserializer& rhs) = delete;
+        JsonStreamingDeserializer& operator=(JsonStreamingDeserializer&& rhs) = delete;
+        JsonStreamingDeserializer(const JsonStreamingDeserializer& rhs) = delete;
+        JsonStreamingDeserializer(JsonStreamingDeserializer&& rhs) = delete;
+
+        static JsonSerializationResult::ResultCode Load(
+            void* object, const Uuid& typeId, IO::GenericStream& stream, JsonDeserializerContext& context);
+    };
+} // namespace AZ
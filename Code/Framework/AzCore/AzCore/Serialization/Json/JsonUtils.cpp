@@ -18,6 +18,7 @@
 #include <AzCore/JSON/error/en.h>
 #include <AzCore/JSON/prettywriter.h>
 #include <AzCore/Memory/OSAllocator.h>
+#include <AzCore/Serialization/Json/JsonBinaryFormat.h>
 #include <AzCore/Serialization/Json/JsonSerialization.h>
 #include <AzCore/Serialization/Utils.h>
 #include <AzCore/Utils/Utils.h>
@@ -54,6 +55,11 @@ namespace AZ::JsonSerializationUtils
 
     AZ::Outcome<void, AZStd::string> WriteJsonStream(const rapidjson::Document& document, IO::GenericStream& stream, WriteJsonSettings settings)
     {
+        if (settings.m_binaryFormat)
+        {
+            return JsonBinaryFormat::Write(document, stream);
+        }
+
         AZ::IO::RapidJSONStreamWriter jsonStreamWriter(&stream);
 
         rapidjson::PrettyWriter<AZ::IO::RapidJSONStreamWriter> writer(jsonStreamWriter);
@@ -212,6 +218,12 @@ namespace AZ::JsonSerializationUtils
             return AZ::Failure(AZStd::string("Failed to parse JSON: input string is empty."));
         }
 
+        AZStd::span<const u8> data(reinterpret_cast<const u8*>(jsonText.data()), jsonText.size());
+        if (JsonBinaryFormat::IsBinaryJson(data))
+        {
+            return JsonBinaryFormat::Read(data);
+        }
+
         rapidjson::Document jsonDocument;
         jsonDocument.Parse<rapidjson::kParseCommentsFlag>(jsonText.data(), jsonText.size());
         if (jsonDocument.HasParseError())
@@ -474,7 +486,7 @@ namespace AZ::JsonSerializationUtils
     AZ::Outcome<AZStd::any, AZStd::string> LoadAnyObjectFromFile(const AZStd::string& filePath, const JsonDeserializerSettings* settings)
     {
         AZ::IO::FileIOStream inputFileStream;
-        if (!inputFileStream.Open(filePath.c_str(), AZ::IO::OpenMode::ModeRead | AZ::IO::OpenMode::ModeText))
+        if (!inputFileStream.Open(filePath.c_str(), AZ::IO::OpenMode::ModeRead | AZ::IO::OpenMode::ModeBinary))
         {
             return AZ::Failure(AZStd::string::format("Error opening file '%s' for reading", filePath.c_str()));
         }
@@ -31,6 +31,7 @@ namespace AZ
         struct WriteJsonSettings
         {
             int m_maxDecimalPlaces = -1; // -1 means use default
+            bool m_binaryFormat = false; // Write the document in the binary form from JsonBinaryFormat instead of text.
         };
 
         ///////////////////////////////////////////////////////////////////////////////////
@@ -68,6 +69,8 @@ namespace AZ
         // Load functions
 
         //! Parse json text. Returns a failure with error message if the content is not valid JSON.
+        //! Json in the binary form from JsonBinaryFormat is detected and decoded without parsing. This applies to all read
+        //! and load functions below.
         AZCORE_API AZ::Outcome<rapidjson::Document, AZStd::string> ReadJsonString(AZStd::string_view jsonText);
 
         //! Parse a json file. Returns a failure with error message if the content is not valid JSON or if
@@ -111,7 +114,7 @@ namespace AZ
         AZ::Outcome<void, AZStd::string> LoadObjectFromFile(ObjectType& objectToLoad, const AZStd::string& filePath, const JsonDeserializerSettings* settings = nullptr)
         {
             AZ::IO::FileIOStream inputFileStream;
-            if (!inputFileStream.Open(filePath.c_str(), AZ::IO::OpenMode::ModeRead | AZ::IO::OpenMode::ModeText))
+            if (!inputFileStream.Open(filePath.c_str(), AZ::IO::OpenMode::ModeRead | AZ::IO::OpenMode::ModeBinary))
             {
                 return AZ::Failure(AZStd::string::format("Error opening file '%s' for reading", filePath.c_str()));
             }
@@ -28,7 +28,7 @@ namespace AZ
     // All submitted tasks are associated with a TaskDescriptor which defines the priority, affinitization,
     // and tracking of the task resource utilization.
     //
-    // TODO: Define various task kinds and provide a mechanism for cpuMask computation on different systems.
+    // TODO: Define various task kinds.
     struct TaskDescriptor
     {
         // Unique task kind label (e.g. "frustum culling")
@@ -44,6 +44,8 @@ namespace AZ
 
         // EXPERTS ONLY. A bitmask that restricts tasks of this kind to run only on cores
         // corresponding to a set bit. 0 is synonymous with all bits set
+        // Bit N corresponds to task worker N of the executor. Bits that don't map to a worker are ignored and
+        // a mask that doesn't select any worker is treated as 0
         uint32_t cpuMask = 0;
     };
 }
@@ -9,7 +9,9 @@
 #include <AzCore/Task/TaskExecutor.h>
 #include <AzCore/Task/TaskGraph.h>
 
+#include <AzCore/std/algorithm.h>
 #include <AzCore/std/containers/queue.h>
+#include <AzCore/std/limits.h>
 #include <AzCore/std/parallel/binary_semaphore.h>
 #include <AzCore/std/parallel/exponential_backoff.h>
 #include <AzCore/std/parallel/mutex.h>
@@ -109,6 +111,8 @@ namespace AZ
         // - offset to the "head" of the ring, from where we acquire elements
         // - offset to the "tail" of the ring, which tracks where new elements should be enqueued
         // - offset to a tail reservation index, which is used to reserve a slot to enqueue elements
+        // Tasks are claimed by swapping their slot to null, so thieves can take tasks that aren't at the head of a queue.
+        // Claimed slots are skipped when the head reaches them.
         class TaskQueue final
         {
         public:
@@ -116,6 +120,8 @@ namespace AZ
             // Each thread allocated by the task manager consumes ~2 MB.
             constexpr static uint16_t MaxQueueSize = 0xffff;
             constexpr static uint8_t PriorityLevelCount = static_cast<uint8_t>(TaskPriority::PRIORITY_COUNT);
+            // The number of tasks from the head of a queue that a thief looks at for a task it's allowed to run.
+            constexpr static uint16_t StealScanDepth = 16;
 
             TaskQueue() = default;
             TaskQueue(const TaskQueue&) = delete;
@@ -124,9 +130,14 @@ namespace AZ
             void Enqueue(Task* task);
             Task* TryDequeue();
 
+            // Dequeue the first task, within StealScanDepth of the head of the queue for the given priority, that's accepted
+            // by the provided function. Used by other workers to steal work from this queue.
+            template<typename CanRun>
+            Task* TrySteal(uint8_t priority, const CanRun& canRun);
+
         private:
             QueueStatus m_status[PriorityLevelCount] = {};
-            Task* m_queues[PriorityLevelCount][MaxQueueSize] = {};
+            AZStd::atomic<Task*> m_queues[PriorityLevelCount][MaxQueueSize] = {};
         };
 
         void TaskQueue::Enqueue(Task* task)
@@ -147,7 +158,7 @@ namespace AZ
                     // Try to reserve a slot
                     if (status.reserve.compare_exchange_weak(reserve, reserve + 1))
                     {
-                        m_queues[priority][reserve] = task;
+                        m_queues[priority][reserve].store(task);
 
                         uint16_t expectedReserve = reserve;
 
@@ -185,8 +196,11 @@ namespace AZ
                     }
                     else
                     {
-                        Task* task = m_queues[priority][status.head];
-                        if (status.head.compare_exchange_weak(head, head + 1))
+                        // Claim the task before moving the head past it. The slot is empty if a thief already took the task,
+                        // in which case the head is moved past it all the same.
+                        Task* task = m_queues[priority][head].exchange(nullptr);
+                        status.head.compare_exchange_strong(head, head + 1);
+                        if (task)
                         {
                             return task;
                         }
@@ -197,6 +211,32 @@ namespace AZ
             return nullptr;
         }
 
+        template<typename CanRun>
+        Task* TaskQueue::TrySteal(uint8_t priority, const CanRun& canRun)
+        {
+            QueueStatus& status = m_status[priority];
+            uint16_t head = status.head.load();
+            uint16_t tail = status.tail.load();
+            // Tasks that the thief isn't allowed to run, because of their cpuMask, are skipped so they don't block the tasks
+            // behind them. The scan is bounded to keep stealing cheap and to stay close to the order tasks were queued in.
+            const uint16_t scanCount = AZStd::min(static_cast<uint16_t>(tail - head), StealScanDepth);
+            for (uint16_t i = 0; i != scanCount; ++i)
+            {
+                const uint16_t index = static_cast<uint16_t>(head + i);
+                Task* task = m_queues[priority][index].load();
+                if (task && canRun(*task) && m_queues[priority][index].compare_exchange_strong(task, nullptr))
+                {
+                    if (i == 0)
+                    {
+                        // Move the head along if the task was at the head, otherwise the owner skips the slot later on.
+                        status.head.compare_exchange_strong(head, head + 1);
+                    }
+                    return task;
+                }
+            }
+            return nullptr;
+        }
+
         class TaskWorker
         {
         public:
@@ -205,6 +245,7 @@ namespace AZ
             void Spawn(::AZ::TaskExecutor& executor, uint32_t id, AZStd::semaphore& initSemaphore, bool affinitize)
             {
                 m_executor = &executor;
+                m_id = id;
 
                 m_threadName = AZStd::string::format("TaskWorker %u", id);
                 AZStd::thread_desc desc = {};
@@ -254,6 +295,22 @@ namespace AZ
                 m_semaphore.release();
             }
 
+            // Wake up the worker without queuing a task so it can look for work in the queues of other workers
+            void Wake()
+            {
+                m_semaphore.release();
+            }
+
+            bool IsIdle() const
+            {
+                return m_idle.load(AZStd::memory_order_acquire);
+            }
+
+            uint32_t GetId() const
+            {
+                return m_id;
+            }
+
             const char* GetThreadName() {return m_threadName.c_str();}
 
         private:
@@ -261,14 +318,18 @@ namespace AZ
             {
                 while (m_active)
                 {
+                    m_idle.store(true, AZStd::memory_order_release);
+                    ++m_executor->m_idleWorkerCount;
                     m_semaphore.acquire();
+                    --m_executor->m_idleWorkerCount;
+                    m_idle.store(false, AZStd::memory_order_release);
 
                     if (!m_active)
                     {
                         return;
                     }
 
-                    Task* task = m_queue.TryDequeue();
+                    Task* task = TryDequeueOrSteal();
                     while (task)
                     {
                         task->Invoke();
@@ -288,14 +349,48 @@ namespace AZ
                             m_executor->ReleaseGraph();
                         }
 
-                        task = m_queue.TryDequeue();
+                        task = TryDequeueOrSteal();
                     }
                 }
             }
 
+            Task* TryDequeueOrSteal()
+            {
+                if (Task* task = m_queue.TryDequeue(); task)
+                {
+                    return task;
+                }
+                if (!m_executor->m_workStealing)
+                {
+                    return nullptr;
+                }
+
+                // Look for work in the other workers, starting with the highest priority so priorities are honored
+                // across workers. The search starts at the neighboring worker to spread thieves over the victims.
+                auto canRun = [this](const Task& task)
+                {
+                    return m_executor->IsWorkerAllowed(task.GetCpuMask(), m_id);
+                };
+                const uint32_t workerCount = m_executor->m_threadCount;
+                for (uint8_t priority = 0; priority != TaskQueue::PriorityLevelCount; ++priority)
+                {
+                    for (uint32_t offset = 1; offset < workerCount; ++offset)
+                    {
+                        TaskWorker& victim = m_executor->m_workers[(m_id + offset) % workerCount];
+                        if (Task* task = victim.m_queue.TrySteal(priority, canRun); task)
+                        {
+                            return task;
+                        }
+                    }
+                }
+                return nullptr;
+            }
+
             AZStd::thread m_thread;
             AZStd::atomic<bool> m_active;
             AZStd::atomic<bool> m_enabled = true;
+            AZStd::atomic<bool> m_idle = false;
+            uint32_t m_id = 0;
             AZStd::binary_semaphore m_semaphore;
 
             ::AZ::TaskExecutor* m_executor;
@@ -370,11 +465,13 @@ namespace AZ
         }
     }
 
-    TaskExecutor::TaskExecutor(uint32_t threadCount)
-        : m_eventTracker(this)
+    TaskExecutor::TaskExecutor(uint32_t threadCount, bool workStealing)
+        : m_workStealing(workStealing)
+        , m_eventTracker(this)
     {
         // TODO: Configure thread count + affinity based on configuration
         m_threadCount = threadCount == 0 ? AZStd::thread::hardware_concurrency() : threadCount;
+        m_workerMask = m_threadCount >= 32 ? AZStd::numeric_limits<uint32_t>::max() : (1u << m_threadCount) - 1;
 
         m_workers = reinterpret_cast<Internal::TaskWorker*>(azmalloc(m_threadCount * sizeof(Internal::TaskWorker)));
 
@@ -451,18 +548,81 @@ namespace AZ
 
     void TaskExecutor::Submit(Internal::Task& task)
     {
-        // TODO: Something more sophisticated is likely needed here.
-        // First, we are completely ignoring affinity.
-        // Second, some heuristics on core availability will help distribute work more effectively
-        uint32_t nextWorker = ++m_lastSubmission % m_threadCount;
-        while (!m_workers[nextWorker].Enabled())
+        const uint32_t cpuMask = task.GetCpuMask();
+
+        // With work stealing, tasks submitted from a worker (usually successors that were just unblocked) stay on that
+        // worker as its caches are likely warm. Idle workers will steal them if the worker falls behind.
+        Internal::TaskWorker* worker = m_workStealing ? GetTaskWorker() : nullptr;
+        if (!worker || !worker->Enabled() || !IsWorkerAllowed(cpuMask, worker->GetId()))
+        {
+            worker = FindEnabledWorker(cpuMask);
+            if (!worker)
+            {
+                // All workers the task is allowed on are waiting for a graph to complete. Queuing the task on one of them
+                // could deadlock if the wait depends on the task, so the cpuMask is ignored instead.
+                AZ_Error("TaskExecutor", false,
+                    "No enabled task worker is allowed by cpu mask 0x%x. The task will be queued on any enabled worker.", cpuMask);
+                worker = FindEnabledWorker(0);
+            }
+            if (!worker)
+            {
+                AZ_Error("TaskExecutor", false,
+                    "All task workers are waiting for a graph to complete. The task won't run until one of the waits completes.");
+                worker = &m_workers[m_lastSubmission % m_threadCount];
+            }
+        }
+
+        worker->Enqueue(&task);
+
+        if (m_workStealing && !worker->IsIdle())
+        {
+            // The worker is busy so give an idle worker the chance to pick up the task.
+            WakeIdleWorker(cpuMask, worker);
+        }
+    }
+
+    Internal::TaskWorker* TaskExecutor::FindEnabledWorker(uint32_t cpuMask)
+    {
+        for (uint32_t attempt = 0; attempt != m_threadCount; ++attempt)
         {
+            uint32_t nextWorker = ++m_lastSubmission % m_threadCount;
             // Graphs that are waiting for the completion of a task graph cannot enqueue tasks onto
             // the thread issuing the wait.
-            nextWorker = ++m_lastSubmission % m_threadCount;
+            if (m_workers[nextWorker].Enabled() && IsWorkerAllowed(cpuMask, nextWorker))
+            {
+                return &m_workers[nextWorker];
+            }
         }
+        return nullptr;
+    }
 
-        m_workers[nextWorker].Enqueue(&task);
+    bool TaskExecutor::IsWorkerAllowed(uint32_t cpuMask, uint32_t workerId) const
+    {
+        const uint32_t mask = cpuMask & m_workerMask;
+        if (mask == 0)
+        {
+            return true;
+        }
+        return workerId < 32 && (mask & (1u << workerId)) != 0;
+    }
+
+    void TaskExecutor::WakeIdleWorker(uint32_t cpuMask, const Internal::TaskWorker* skipWorker)
+    {
+        if (m_idleWorkerCount.load(AZStd::memory_order_acquire) == 0)
+        {
+            return;
+        }
+
+        const uint32_t start = m_lastSubmission.load(AZStd::memory_order_relaxed);
+        for (uint32_t i = 0; i != m_threadCount; ++i)
+        {
+            Internal::TaskWorker& worker = m_workers[(start + i) % m_threadCount];
+            if (&worker != skipWorker && worker.IsIdle() && worker.Enabled() && IsWorkerAllowed(cpuMask, worker.GetId()))
+            {
+                worker.Wake();
+                return;
+            }
+        }
     }
 
     void TaskExecutor::ReleaseGraph()
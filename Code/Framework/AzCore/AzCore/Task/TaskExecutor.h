@@ -127,7 +127,9 @@ namespace AZ
         static void SetInstance(TaskExecutor* executor);
 
         // Passing 0 for the threadCount requests for the thread count to match the hardware concurrency
-        explicit TaskExecutor(uint32_t threadCount = 0);
+        // When workStealing is enabled, workers that run out of tasks take queued tasks from other workers instead of
+        // going idle. Tasks submitted from a worker are queued on that worker first to keep task chains local.
+        explicit TaskExecutor(uint32_t threadCount = 0, bool workStealing = true);
         ~TaskExecutor();
 
         // Submit a task graph for execution. Waitable task graphs cannot enqueue work on the task thread
@@ -147,9 +149,21 @@ namespace AZ
         void ReleaseGraph();
         void ReactivateTaskWorker();
 
+        // Returns the next enabled worker, in round robin order, that's allowed to run tasks with the provided cpuMask, or
+        // null if there's no such worker
+        Internal::TaskWorker* FindEnabledWorker(uint32_t cpuMask);
+        // Returns true if a task with the provided cpuMask is allowed to run on the worker with the provided id
+        bool IsWorkerAllowed(uint32_t cpuMask, uint32_t workerId) const;
+        // Wakes up an idle worker that's allowed to run tasks with the provided cpuMask so it can steal work
+        void WakeIdleWorker(uint32_t cpuMask, const Internal::TaskWorker* skipWorker);
+
         Internal::TaskWorker* m_workers;
         uint32_t m_threadCount = 0;
+        // Bits of the cpuMask that correspond to a worker
+        uint32_t m_workerMask = 0;
         AZStd::atomic<uint32_t> m_lastSubmission;
+        AZStd::atomic<uint32_t> m_idleWorkerCount{ 0 };
+        bool m_workStealing = true;
         AZStd::atomic<uint64_t> m_graphsRemaining;
 
         // Implement basic CompiledTaskGraph event breadcrumbs to help debug
@@ -33,6 +33,7 @@ set(FILES
     Casting/lossy_cast.h
     Casting/numeric_cast.h
     Casting/numeric_cast_internal.h
+    Component/BatchTickHandler.h
     Component/Component.cpp
     Component/Component.h
     Component/ComponentApplication.cpp
@@ -68,6 +69,8 @@ set(FILES
     Component/TransformBus.h
     Compression/compression.cpp
     Compression/Compression.h
+    Compression/SeekableZStd.cpp
+    Compression/SeekableZStd.h
     Compression/zstd_compression.cpp
     Compression/zstd_compression.h
     Console/Console.cpp
@@ -153,6 +156,7 @@ set(FILES
     EBus/Internal/BusContainer.h
     EBus/Internal/CallstackEntry.h
     EBus/Internal/Debug.h
+    EBus/Internal/EventQueueRing.h
     EBus/Internal/Handlers.h
     EBus/Internal/StoragePolicies.h
     Instance/InstancePool.h
@@ -198,6 +202,8 @@ set(FILES
     IO/TextStreamWriters.h
     IO/Streamer/BlockCache.h
     IO/Streamer/BlockCache.cpp
+    IO/Streamer/DeadlineStatistics.h
+    IO/Streamer/DeadlineStatistics.cpp
     IO/Streamer/DedicatedCache.h
     IO/Streamer/DedicatedCache.cpp
     IO/Streamer/FileRange.h
@@ -207,6 +213,8 @@ set(FILES
     IO/Streamer/FileRequest.cpp
     IO/Streamer/FullFileDecompressor.h
     IO/Streamer/FullFileDecompressor.cpp
+    IO/Streamer/PersistentBlockCache.h
+    IO/Streamer/PersistentBlockCache.cpp
     IO/Streamer/ReadSplitter.h
     IO/Streamer/ReadSplitter.cpp
     IO/Streamer/RecentlyUsedIndex.h
@@ -434,6 +442,8 @@ set(FILES
     Memory/ChildAllocatorSchema.h
     Memory/Config.h
     Memory/dlmalloc.inl
+    Memory/FrameArenaAllocator.cpp
+    Memory/FrameArenaAllocator.h
     Memory/HphaAllocator.cpp
     Memory/HphaAllocator.h
     Memory/IAllocator.h
@@ -484,6 +494,8 @@ set(FILES
     Name/NameSerializer.cpp
     Name/Internal/NameData.h
     Name/Internal/NameData.cpp
+    Name/Internal/NameDataIndex.h
+    Name/Internal/NameDataIndex.cpp
     NativeUI/NativeUISystemComponent.cpp
     NativeUI/NativeUISystemComponent.h
     NativeUI/NativeUIRequests.cpp
@@ -613,6 +625,8 @@ set(FILES
     Serialization/Json/DoubleSerializer.cpp
     Serialization/Json/IntSerializer.h
     Serialization/Json/IntSerializer.cpp
+    Serialization/Json/JsonBinaryFormat.h
+    Serialization/Json/JsonBinaryFormat.cpp
     Serialization/Json/JsonDeserializer.h
     Serialization/Json/JsonDeserializer.cpp
     Serialization/Json/JsonImporter.cpp
@@ -628,6 +642,8 @@ set(FILES
     Serialization/Json/JsonSerializationSettings.h
     Serialization/Json/JsonSerializer.h
     Serialization/Json/JsonSerializer.cpp
+    Serialization/Json/JsonStreamingDeserializer.h
+    Serialization/Json/JsonStreamingDeserializer.cpp
     Serialization/Json/JsonStringConversionUtils.h
     Serialization/Json/JsonSystemComponent.h
     Serialization/Json/JsonSystemComponent.cpp
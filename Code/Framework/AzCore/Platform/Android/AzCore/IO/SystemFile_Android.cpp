@@ -20,6 +20,7 @@
 #include <fcntl.h>
 #include <unistd.h>
 #include <sys/epoll.h>
+#include <sys/file.h>
 #include <sys/types.h>
 #include <sys/stat.h>
 #include <errno.h>
@@ -334,6 +335,16 @@ namespace AZ::IO::Platform
         }
     }
 
+    bool TryLockExclusive(FileHandleType handle, [[maybe_unused]] const SystemFile* systemFile)
+    {
+        if (handle != PlatformSpecificInvalidHandle)
+        {
+            return flock(fileno(handle), LOCK_EX | LOCK_NB) == 0;
+        }
+
+        return false;
+    }
+
     SystemFile::SizeType Length(FileHandleType handle, const SystemFile* systemFile)
     {
         if (handle != PlatformSpecificInvalidHandle)
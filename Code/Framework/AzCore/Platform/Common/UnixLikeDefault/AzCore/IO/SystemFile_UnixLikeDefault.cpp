@@ -17,6 +17,7 @@
 
 #include <fcntl.h>
 #include <unistd.h>
+#include <sys/file.h>
 #include <sys/types.h>
 #include <sys/stat.h>
 #include <errno.h>
@@ -243,6 +244,16 @@ namespace AZ::IO::Platform
         }
     }
 
+    bool TryLockExclusive(FileHandleType handle, [[maybe_unused]] const SystemFile* systemFile)
+    {
+        if (handle != PlatformSpecificInvalidHandle)
+        {
+            return flock(handle, LOCK_EX | LOCK_NB) == 0;
+        }
+
+        return false;
+    }
+
     SystemFile::SizeType Length(FileHandleType handle, const SystemFile* systemFile)
     {
         if (handle != PlatformSpecificInvalidHandle)
@@ -354,6 +354,21 @@ namespace AZ::IO::Platform
         }
     }
 
+    bool TryLockExclusive(FileHandleType handle, [[maybe_unused]] const SystemFile* systemFile)
+    {
+        if (handle != PlatformSpecificInvalidHandle)
+        {
+            // Locks on Windows block reading and writing the locked range, so a single byte far past the end of any real file is
+            // locked instead of the file's data.
+            OVERLAPPED overlapped{};
+            overlapped.Offset = MAXDWORD;
+            overlapped.OffsetHigh = MAXLONG;
+            return LockFileEx(handle, LOCKFILE_EXCLUSIVE_LOCK | LOCKFILE_FAIL_IMMEDIATELY, 0, 1, 0, &overlapped) != FALSE;
+        }
+
+        return false;
+    }
+
     SystemFile::SizeType Length(FileHandleType handle, [[maybe_unused]] const SystemFile* systemFile)
     {
         if (handle != PlatformSpecificInvalidHandle)
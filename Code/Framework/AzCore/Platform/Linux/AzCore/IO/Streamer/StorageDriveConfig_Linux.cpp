@@ -0,0 +1,63 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/IO/Streamer/StorageDrive_Linux.h>
+#include <AzCore/IO/Streamer/StorageDriveConfig_Linux.h>
+#include <AzCore/IO/Streamer/StreamerConfiguration_Linux.h>
+#include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
+
+namespace AZ::IO
+{
+    AZStd::shared_ptr<StreamStackEntry> LinuxStorageDriveConfig::AddStreamStackEntry(
+        const HardwareInformation& hardware, AZStd::shared_ptr<StreamStackEntry> parent)
+    {
+        LinuxDriveInformation drive;
+        if (const LinuxDriveInformation* collected = AZStd::any_cast<LinuxDriveInformation>(&hardware.m_platformData); collected)
+        {
+            drive = *collected;
+        }
+        else
+        {
+            drive.m_physicalSectorSize = hardware.m_maxPhysicalSectorSize;
+            drive.m_logicalSectorSize = hardware.m_maxLogicalSectorSize;
+        }
+
+        StorageDriveLinux::ConstructionOptions options;
+        options.m_enableIoUring = m_enableIoUring;
+        options.m_enableUnbufferedReads = m_enableUnbufferedReads;
+        options.m_hasSeekPenalty = drive.m_hasSeekPenalty;
+        options.m_minimalReporting = m_minimalReporting;
+
+        // The kernel reports the depth of the block layer queue, which is typically much larger than what's useful to keep in
+        // flight from a single thread, so cap it to the configured maximum.
+        u32 ioChannelCount = drive.m_ioChannelCount != 0 ? AZStd::min(drive.m_ioChannelCount, m_maxIoChannels) : m_maxIoChannels;
+
+        auto stackEntry = AZStd::make_shared<StorageDriveLinux>(
+            m_maxFileHandles, m_maxMetaDataCache, drive.m_physicalSectorSize, drive.m_logicalSectorSize, ioChannelCount,
+            m_overcommit, options);
+        stackEntry->SetNext(AZStd::move(parent));
+        return stackEntry;
+    }
+
+    void LinuxStorageDriveConfig::Reflect(ReflectContext* context)
+    {
+        if (auto serializeContext = azrtti_cast<SerializeContext*>(context); serializeContext != nullptr)
+        {
+            serializeContext->Class<LinuxStorageDriveConfig, IStreamerStackConfig>()
+                ->Version(1)
+                ->Field("MaxFileHandles", &LinuxStorageDriveConfig::m_maxFileHandles)
+                ->Field("MaxMetaDataCache", &LinuxStorageDriveConfig::m_maxMetaDataCache)
+                ->Field("MaxIoChannels", &LinuxStorageDriveConfig::m_maxIoChannels)
+                ->Field("Overcommit", &LinuxStorageDriveConfig::m_overcommit)
+                ->Field("EnableIoUring", &LinuxStorageDriveConfig::m_enableIoUring)
+                ->Field("EnableUnbufferedReads", &LinuxStorageDriveConfig::m_enableUnbufferedReads)
+                ->Field("MinimalReporting", &LinuxStorageDriveConfig::m_minimalReporting);
+        }
+    }
+} // namespace AZ::IO
@@ -0,0 +1,1517 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <errno.h>
+#include <fcntl.h>
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <time.h>
+#include <unistd.h>
+
+#include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/Debug/Profiler.h>
+#include <AzCore/IO/Streamer/FileRequest.h>
+#include <AzCore/IO/Streamer/StreamerContext.h>
+#include <AzCore/IO/Streamer/StorageDrive_Linux.h>
+#include <AzCore/Task/TaskExecutor.h>
+#include <AzCore/Task/TaskGraph.h>
+#include <AzCore/std/functional.h>
+#include <AzCore/std/parallel/thread.h>
+#include <AzCore/std/typetraits/decay.h>
+
+namespace AZ::IO
+{
+#if AZ_STREAMER_ADD_EXTRA_PROFILING_INFO
+    static constexpr char FileSwitchesName[] = "File switches";
+    static constexpr char SeeksName[] = "Seeks";
+    static constexpr char DirectReadsName[] = "Direct reads (no internal alloc)";
+    static constexpr char QueueDepthName[] = "Queue depth";
+#endif // AZ_STREAMER_ADD_EXTRA_PROFILING_INFO
+
+    const AZStd::chrono::microseconds StorageDriveLinux::s_averageSeekTime =
+        AZStd::chrono::milliseconds(9) + // Common average seek time for desktop hdd drives.
+        AZStd::chrono::milliseconds(3); // Rotational latency for a 7200RPM disk
+
+    //
+    // IoUring
+    //
+
+    //! Minimal io_uring wrapper that talks to the kernel directly through the system calls so no additional libraries are
+    //! needed. Submissions are only done from the streamer thread. Completions are reaped on a dedicated thread which
+    //! records the result and wakes up the streamer thread, similar to how overlapped IO completes on Windows.
+    class StorageDriveLinux::IoUring
+    {
+    public:
+        using CompletionCallback = AZStd::function<void(u64 userData, s32 result)>;
+
+        //! User data that's reserved to tell the reaper thread to stop.
+        inline static constexpr u64 ShutdownUserData = AZStd::numeric_limits<u64>::max();
+        //! Bit set on the user data of cancel operations. Their completions are ignored as the canceled read reports its own.
+        inline static constexpr u64 CancelUserDataFlag = u64{ 1 } << 63;
+        //! The longest time the reaper thread waits for completions before checking if it should stop, if the kernel supports
+        //! timed waits. This guarantees the thread stops even if the shutdown message couldn't be submitted.
+        inline static constexpr long ReaperWaitTimeoutNs = 100'000'000;
+
+        IoUring() = default;
+        ~IoUring()
+        {
+            Shutdown();
+        }
+
+        bool Initialize(u32 entries, CompletionCallback callback)
+        {
+            io_uring_params params{};
+            int ringFd = aznumeric_cast<int>(::syscall(__NR_io_uring_setup, entries, &params));
+            if (ringFd < 0)
+            {
+                return false;
+            }
+            m_ringFd = ringFd;
+
+            m_hasTimedWait = (params.features & IORING_FEAT_EXT_ARG) != 0;
+            m_sqRingSize = params.sq_off.array + params.sq_entries * sizeof(u32);
+            m_cqRingSize = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+            const bool singleMap = (params.features & IORING_FEAT_SINGLE_MMAP) != 0;
+            if (singleMap)
+            {
+                m_sqRingSize = m_cqRingSize = AZStd::max(m_sqRingSize, m_cqRingSize);
+            }
+
+            m_sqRing = ::mmap(nullptr, m_sqRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, m_ringFd, IORING_OFF_SQ_RING);
+            if (m_sqRing == MAP_FAILED)
+            {
+                m_sqRing = nullptr;
+                Shutdown();
+                return false;
+            }
+            if (singleMap)
+            {
+                m_cqRing = m_sqRing;
+            }
+            else
+            {
+                m_cqRing = ::mmap(nullptr, m_cqRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, m_ringFd, IORING_OFF_CQ_RING);
+                if (m_cqRing == MAP_FAILED)
+                {
+                    m_cqRing = nullptr;
+                    Shutdown();
+                    return false;
+                }
+            }
+
+            m_sqesSize = params.sq_entries * sizeof(io_uring_sqe);
+            void* sqes = ::mmap(nullptr, m_sqesSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, m_ringFd, IORING_OFF_SQES);
+            if (sqes == MAP_FAILED)
+            {
+                Shutdown();
+                return false;
+            }
+            m_sqes = reinterpret_cast<io_uring_sqe*>(sqes);
+
+            u8* sqRing = reinterpret_cast<u8*>(m_sqRing);
+            m_sqHead = reinterpret_cast<u32*>(sqRing + params.sq_off.head);
+            m_sqTail = reinterpret_cast<u32*>(sqRing + params.sq_off.tail);
+            m_sqMask = *reinterpret_cast<u32*>(sqRing + params.sq_off.ring_mask);
+            m_sqEntries = params.sq_entries;
+            m_sqArray = reinterpret_cast<u32*>(sqRing + params.sq_off.array);
+
+            u8* cqRing = reinterpret_cast<u8*>(m_cqRing);
+            m_cqHead = reinterpret_cast<u32*>(cqRing + params.cq_off.head);
+            m_cqTail = reinterpret_cast<u32*>(cqRing + params.cq_off.tail);
+            m_cqMask = *reinterpret_cast<u32*>(cqRing + params.cq_off.ring_mask);
+            m_cqes = reinterpret_cast<io_uring_cqe*>(cqRing + params.cq_off.cqes);
+
+            m_completionCallback = AZStd::move(callback);
+
+            AZStd::thread_desc threadDesc;
+            threadDesc.m_name = "Streamer io_uring completions";
+            m_isRunning = true;
+            m_reaperThread = AZStd::thread(threadDesc, [this]() { ReapCompletions(); });
+            return true;
+        }
+
+        bool QueueRead(int fileDescriptor, void* output, u32 size, u64 offset, u64 userData)
+        {
+            io_uring_sqe* sqe = GetNextSqe();
+            if (!sqe)
+            {
+                return false;
+            }
+            sqe->opcode = IORING_OP_READ;
+            sqe->fd = fileDescriptor;
+            sqe->addr = reinterpret_cast<u64>(output);
+            sqe->len = size;
+            sqe->off = offset;
+            sqe->user_data = userData;
+            return true;
+        }
+
+        bool QueueCancel(u64 targetUserData)
+        {
+            io_uring_sqe* sqe = GetNextSqe();
+            if (!sqe)
+            {
+                return false;
+            }
+            sqe->opcode = IORING_OP_ASYNC_CANCEL;
+            sqe->fd = -1;
+            sqe->addr = targetUserData;
+            sqe->user_data = targetUserData | CancelUserDataFlag;
+            return true;
+        }
+
+        //! Hands all queued entries to the kernel. Returns the number of entries that the kernel rejected. Rejected entries
+        //! are removed from the submission queue, which is always the tail end of the queued entries.
+        u32 Submit()
+        {
+            while (m_queuedSubmissions > 0)
+            {
+                int result = aznumeric_cast<int>(::syscall(__NR_io_uring_enter, m_ringFd, m_queuedSubmissions, 0, 0, nullptr, 0));
+                if (result < 0)
+                {
+                    if (errno == EINTR || errno == EAGAIN || errno == EBUSY)
+                    {
+                        continue;
+                    }
+                    AZ_Error("StorageDriveLinux", false, "io_uring_enter failed to submit %u entries (errno: %i).\n",
+                        m_queuedSubmissions, errno);
+                    // The kernel only reads the submission queue during io_uring_enter so the remaining entries can be
+                    // safely taken back.
+                    __atomic_store_n(m_sqTail, *m_sqTail - m_queuedSubmissions, __ATOMIC_RELEASE);
+                    u32 rejected = m_queuedSubmissions;
+                    m_queuedSubmissions = 0;
+                    return rejected;
+                }
+                m_queuedSubmissions -= aznumeric_cast<u32>(result);
+            }
+            return 0;
+        }
+
+        void Shutdown()
+        {
+            if (m_reaperThread.joinable())
+            {
+                // The reaper thread is blocked waiting for completions, so post a no-op to wake it up. The last entry in the
+                // submission queue is kept free for this, so it's always available. If the no-op can't be submitted, the
+                // reaper thread still stops after its next completion or, if supported, when its wait times out.
+                m_isRunning = false;
+                if (io_uring_sqe* sqe = GetNextSqe(true); sqe)
+                {
+                    sqe->opcode = IORING_OP_NOP;
+                    sqe->user_data = ShutdownUserData;
+                    Submit();
+                }
+                else
+                {
+                    AZ_Error("StorageDriveLinux", false, "No io_uring submission entry available to stop the completion thread.\n");
+                }
+                m_reaperThread.join();
+            }
+
+            if (m_sqes)
+            {
+                ::munmap(m_sqes, m_sqesSize);
+                m_sqes = nullptr;
+            }
+            if (m_cqRing && m_cqRing != m_sqRing)
+            {
+                ::munmap(m_cqRing, m_cqRingSize);
+            }
+            m_cqRing = nullptr;
+            if (m_sqRing)
+            {
+                ::munmap(m_sqRing, m_sqRingSize);
+                m_sqRing = nullptr;
+            }
+            if (m_ringFd >= 0)
+            {
+                ::close(m_ringFd);
+                m_ringFd = -1;
+            }
+        }
+
+    private:
+        //! Returns the next free submission queue entry. Regular submissions leave the last entry free so the shutdown message
+        //! can always be posted, which is done by setting useReserved to true.
+        io_uring_sqe* GetNextSqe(bool useReserved = false)
+        {
+            if (!m_sqes)
+            {
+                return nullptr;
+            }
+            u32 head = __atomic_load_n(m_sqHead, __ATOMIC_ACQUIRE);
+            u32 tail = *m_sqTail;
+            if (tail - head >= (useReserved ? m_sqEntries : m_sqEntries - 1))
+            {
+                return nullptr;
+            }
+            u32 index = tail & m_sqMask;
+            io_uring_sqe* sqe = &m_sqes[index];
+            ::memset(sqe, 0, sizeof(io_uring_sqe));
+            m_sqArray[index] = index;
+            // Publish the entry to the kernel. It won't be picked up until io_uring_enter is called.
+            __atomic_store_n(m_sqTail, tail + 1, __ATOMIC_RELEASE);
+            m_queuedSubmissions++;
+            return sqe;
+        }
+
+        void ReapCompletions()
+        {
+            while (m_isRunning)
+            {
+                u32 head = *m_cqHead;
+                u32 tail = __atomic_load_n(m_cqTail, __ATOMIC_ACQUIRE);
+                if (head == tail)
+                {
+                    int result;
+                    if (m_hasTimedWait)
+                    {
+                        __kernel_timespec timeout{};
+                        timeout.tv_nsec = ReaperWaitTimeoutNs;
+                        io_uring_getevents_arg waitArgs{};
+                        waitArgs.ts = reinterpret_cast<u64>(&timeout);
+                        result = aznumeric_cast<int>(::syscall(__NR_io_uring_enter, m_ringFd, 0, 1,
+                            IORING_ENTER_GETEVENTS | IORING_ENTER_EXT_ARG, &waitArgs, sizeof(waitArgs)));
+                    }
+                    else
+                    {
+                        result = aznumeric_cast<int>(
+                            ::syscall(__NR_io_uring_enter, m_ringFd, 0, 1, IORING_ENTER_GETEVENTS, nullptr, 0));
+                    }
+                    if (result < 0 && errno != EINTR && errno != EAGAIN && errno != ETIME)
+                    {
+                        AZ_Error("StorageDriveLinux", false, "io_uring_enter failed while waiting for completions (errno: %i).\n", errno);
+                        m_isRunning = false;
+                    }
+                    continue;
+                }
+
+                while (head != tail)
+                {
+                    const io_uring_cqe& cqe = m_cqes[head & m_cqMask];
+                    if (cqe.user_data == ShutdownUserData)
+                    {
+                        m_isRunning = false;
+                    }
+                    else if ((cqe.user_data & CancelUserDataFlag) == 0)
+                    {
+                        m_completionCallback(cqe.user_data, cqe.res);
+                    }
+                    ++head;
+                }
+                __atomic_store_n(m_cqHead, head, __ATOMIC_RELEASE);
+            }
+        }
+
+        CompletionCallback m_completionCallback;
+        AZStd::thread m_reaperThread;
+
+        void* m_sqRing{ nullptr };
+        void* m_cqRing{ nullptr };
+        io_uring_sqe* m_sqes{ nullptr };
+        io_uring_cqe* m_cqes{ nullptr };
+        size_t m_sqRingSize{ 0 };
+        size_t m_cqRingSize{ 0 };
+        size_t m_sqesSize{ 0 };
+
+        u32* m_sqHead{ nullptr };
+        u32* m_sqTail{ nullptr };
+        u32* m_sqArray{ nullptr };
+        u32* m_cqHead{ nullptr };
+        u32* m_cqTail{ nullptr };
+        u32 m_sqMask{ 0 };
+        u32 m_cqMask{ 0 };
+        u32 m_sqEntries{ 0 };
+        u32 m_queuedSubmissions{ 0 };
+
+        int m_ringFd{ -1 };
+        AZStd::atomic_bool m_isRunning{ false };
+        bool m_hasTimedWait{ false };
+    };
+
+    //
+    // ConstructionOptions
+    //
+
+    StorageDriveLinux::ConstructionOptions::ConstructionOptions()
+        : m_hasSeekPenalty(true)
+        , m_enableUnbufferedReads(false)
+        , m_enableIoUring(true)
+        , m_minimalReporting(false)
+    {}
+
+    //
+    // FileReadInformation
+    //
+
+    void StorageDriveLinux::FileReadInformation::AllocateAlignedBuffer(size_t size, size_t sectorSize)
+    {
+        AZ_Assert(m_sectorAlignedOutput == nullptr, "Assign a sector aligned buffer when one is already assigned.");
+        m_sectorAlignedOutput = azmalloc(size, sectorSize, AZ::SystemAllocator);
+    }
+
+    void StorageDriveLinux::FileReadInformation::Clear()
+    {
+        if (m_sectorAlignedOutput)
+        {
+            azfree(m_sectorAlignedOutput, AZ::SystemAllocator);
+        }
+        *this = FileReadInformation{};
+    }
+
+    //
+    // StorageDriveLinux
+    //
+
+    StorageDriveLinux::StorageDriveLinux(u32 maxFileHandles, u32 maxMetaDataCacheEntries, size_t physicalSectorSize,
+        size_t logicalSectorSize, u32 ioChannelCount, s32 overCommit, ConstructionOptions options)
+        : StreamStackEntry("Storage drive (Linux)")
+        , m_metaDataCache_recentlyUsed(maxMetaDataCacheEntries)
+        , m_taskExecutor(AZ::TaskExecutor::Instance())
+        , m_physicalSectorSize(physicalSectorSize)
+        , m_logicalSectorSize(logicalSectorSize)
+        , m_maxFileHandles(maxFileHandles)
+        , m_ioChannelCount(ioChannelCount)
+        , m_overCommit(overCommit)
+        , m_constructionOptions(options)
+    {
+        if (m_physicalSectorSize == 0)
+        {
+            m_physicalSectorSize = 4_kib;
+            AZ_Error("StorageDriveLinux", false,
+                "Received physical sector size of 0 for %s. Picking a sector size of %zu instead.\n", m_name.c_str(), m_physicalSectorSize);
+        }
+        if (m_logicalSectorSize == 0)
+        {
+            m_logicalSectorSize = 512;
+            AZ_Error("StorageDriveLinux", false,
+                "Received logical sector size of 0 for %s. Picking a sector size of %zu instead.\n", m_name.c_str(), m_logicalSectorSize);
+        }
+        AZ_Error("StorageDriveLinux", IStreamerTypes::IsPowerOf2(m_physicalSectorSize) && IStreamerTypes::IsPowerOf2(m_logicalSectorSize),
+            "StorageDriveLinux requires power-of-2 sector sizes. Received physical: %zu and logical: %zu",
+            m_physicalSectorSize, m_logicalSectorSize);
+
+        if (m_ioChannelCount == 0)
+        {
+            m_ioChannelCount = 1;
+            AZ_Warning("StorageDriveLinux", false, "Received io channel count of 0 for %s. Picking a count of 1 instead.\n",
+                m_name.c_str());
+        }
+        // Make sure that the overCommit isn't so small that no slots are ever reported.
+        if (aznumeric_cast<s32>(m_ioChannelCount) + m_overCommit <= 0)
+        {
+            AZ_Error("StorageDriveLinux", false,
+                "Received overcommit (%i) for %s that subtracts more than the number of IO channels (%u). Setting combined count to 1.\n",
+                m_overCommit, m_name.c_str(), m_ioChannelCount);
+            m_overCommit = 1 - aznumeric_cast<s32>(m_ioChannelCount);
+        }
+
+        // Add initial dummy values to the stats to avoid division by zero later on and avoid needing branches.
+        m_readSizeAverage.PushEntry(1);
+        m_readTimeAverage.PushEntry(AZStd::chrono::microseconds(1));
+
+        m_metaDataCache_paths.resize(maxMetaDataCacheEntries);
+        m_metaDataCache_fileSize.resize(maxMetaDataCacheEntries);
+
+        m_readTaskDescriptor.taskName = "Linux pread";
+        m_readTaskDescriptor.taskGroup = "AZ::IO:Streamer";
+
+        if (m_constructionOptions.m_enableIoUring)
+        {
+            m_ioUring = AZStd::make_unique<IoUring>();
+            // The completion callback runs on the reaper thread, so only the atomics in the status are touched.
+            auto onCompletion = [this](u64 userData, s32 result)
+            {
+                FileReadStatus& status = m_readSlots_statusInfo[userData];
+                status.m_result = result;
+                status.m_requestState = FileReadStatus::RequestState::Completed;
+                m_context->WakeUpSchedulingThread();
+            };
+            // Reserve additional entries for cancellations and the shutdown message. Resubmitted short reads reuse the entry
+            // of the read they continue, as that has already been consumed by the kernel.
+            if (!m_ioUring->Initialize(m_ioChannelCount * 2 + 1, AZStd::move(onCompletion)))
+            {
+                AZ_Warning("StorageDriveLinux", m_constructionOptions.m_minimalReporting,
+                    "io_uring is not available (errno: %i). %s will fall back to pread on the task executor.\n", errno, m_name.c_str());
+                m_ioUring.reset();
+            }
+        }
+
+        if (!m_constructionOptions.m_minimalReporting)
+        {
+            AZ_Printf("Streamer", "%s created using %s.\n", m_name.c_str(), m_ioUring ? "io_uring" : "pread");
+        }
+    }
+
+    StorageDriveLinux::~StorageDriveLinux()
+    {
+        // Stop the reaper thread before the read slots it writes to are released.
+        m_ioUring.reset();
+        // Reads on the task executor can't be canceled, so wait for them to finish as they write to the read slots and
+        // wake up the scheduling thread through the context.
+        while (m_pendingReadTasks > 0)
+        {
+            AZStd::this_thread::sleep_for(AZStd::chrono::milliseconds(1));
+        }
+
+        for (int file : m_fileCache_handles)
+        {
+            if (file != InvalidFileDescriptor)
+            {
+                ::close(file);
+            }
+        }
+        if (!m_constructionOptions.m_minimalReporting)
+        {
+            AZ_Printf("Streamer", "%s destroyed.\n", m_name.c_str());
+        }
+    }
+
+    bool StorageDriveLinux::IsUsingIoUring() const
+    {
+        return m_ioUring != nullptr;
+    }
+
+    void StorageDriveLinux::PrepareRequest(FileRequest* request)
+    {
+        AZ_PROFILE_FUNCTION(AzCore);
+        AZ_Assert(request, "PrepareRequest was provided a null request.");
+
+        if (AZStd::holds_alternative<Requests::ReadRequestData>(request->GetCommand()))
+        {
+            auto& readRequest = AZStd::get<Requests::ReadRequestData>(request->GetCommand());
+            FileRequest* read = m_context->GetNewInternalRequest();
+            read->CreateRead(request, readRequest.m_output, readRequest.m_outputSize, readRequest.m_path,
+                readRequest.m_offset, readRequest.m_size);
+            m_context->PushPreparedRequest(read);
+            return;
+        }
+        StreamStackEntry::PrepareRequest(request);
+    }
+
+    void StorageDriveLinux::QueueRequest(FileRequest* request)
+    {
+        AZ_PROFILE_FUNCTION(AzCore);
+        AZ_Assert(request, "QueueRequest was provided a null request.");
+
+        AZStd::visit([this, request](auto&& args)
+        {
+            using Command = AZStd::decay_t<decltype(args)>;
+            if constexpr (AZStd::is_same_v<Command, Requests::ReadData>)
+            {
+                m_pendingReadRequests.push_back(request);
+                return;
+            }
+            else if constexpr (AZStd::is_same_v<Command, Requests::FileExistsCheckData> ||
+                AZStd::is_same_v<Command, Requests::FileMetaDataRetrievalData>)
+            {
+                m_pendingRequests.push_back(request);
+                return;
+            }
+            else if constexpr (AZStd::is_same_v<Command, Requests::CancelData>)
+            {
+                if (CancelRequest(request, args.m_target))
+                {
+                    // Only forward if this isn't part of the request chain, otherwise the storage device should
+                    // be the last step as it doesn't forward any (sub)requests.
+                    return;
+                }
+            }
+            else if constexpr (AZStd::is_same_v<Command, Requests::FlushData>)
+            {
+                FlushCache(args.m_path);
+            }
+            else if constexpr (AZStd::is_same_v<Command, Requests::FlushAllData>)
+            {
+                FlushEntireCache();
+            }
+            else if constexpr (AZStd::is_same_v<Command, Requests::ReportData>)
+            {
+                Report(args);
+            }
+            StreamStackEntry::QueueRequest(request);
+        }, request->GetCommand());
+    }
+
+    bool StorageDriveLinux::ExecuteRequests()
+    {
+        bool hasFinalizedReads = FinalizeReads();
+
+        TaskGraph readTasks("ExecuteRequests");
+
+        // Queue as many read requests as possible in order to maximize the queue depth.
+        bool hasIssuedReads = false;
+        while (!m_pendingReadRequests.empty())
+        {
+            FileRequest* request = m_pendingReadRequests.front();
+            if (ReadRequest(request, readTasks))
+            {
+                m_pendingReadRequests.pop_front();
+                hasIssuedReads = true;
+            }
+            else
+            {
+                break;
+            }
+        }
+
+        if (hasIssuedReads)
+        {
+            if (m_ioUring)
+            {
+                SubmitIoUringBatch();
+            }
+            else if (!readTasks.IsEmpty())
+            {
+                readTasks.Detach();
+                readTasks.SubmitOnExecutor(m_taskExecutor);
+            }
+
+            StreamStackEntry::ExecuteRequests();
+            return true;
+        }
+        else
+        {
+            // Pick up one other synchronous request if no read requests were issued.
+            if (!m_pendingRequests.empty())
+            {
+                FileRequest* request = m_pendingRequests.front();
+                m_pendingRequests.pop_front();
+                AZStd::visit(
+                    [this, request](auto&& args)
+                    {
+                        using Command = AZStd::decay_t<decltype(args)>;
+                        if constexpr (AZStd::is_same_v<Command, Requests::FileExistsCheckData>)
+                        {
+                            FileExistsRequest(request);
+                        }
+                        else if constexpr (AZStd::is_same_v<Command, Requests::FileMetaDataRetrievalData>)
+                        {
+                            FileMetaDataRetrievalRequest(request);
+                        }
+                        else
+                        {
+                            AZ_Assert(false, "A request was added to StorageDriveLinux's pending queue that isn't supported.");
+                        }
+                    },
+                    request->GetCommand());
+
+                StreamStackEntry::ExecuteRequests();
+                return true;
+            }
+            else
+            {
+                return StreamStackEntry::ExecuteRequests() || hasFinalizedReads;
+            }
+        }
+    }
+
+    void StorageDriveLinux::UpdateStatus(Status& status) const
+    {
+        StreamStackEntry::UpdateStatus(status);
+        status.m_numAvailableSlots = AZStd::min(status.m_numAvailableSlots, CalculateNumAvailableSlots());
+        status.m_isIdle = status.m_isIdle && m_pendingReadRequests.empty() && m_pendingRequests.empty() && (m_activeReads_Count == 0);
+    }
+
+    void StorageDriveLinux::UpdateCompletionEstimates(AZStd::chrono::steady_clock::time_point now,
+        AZStd::vector<FileRequest*>& internalPending, StreamerContext::PreparedQueue::iterator pendingBegin,
+        StreamerContext::PreparedQueue::iterator pendingEnd)
+    {
+        StreamStackEntry::UpdateCompletionEstimates(now, internalPending, pendingBegin, pendingEnd);
+
+        const RequestPath* activeFile = nullptr;
+        if (m_activeCacheSlot != InvalidFileCacheIndex)
+        {
+            activeFile = &m_fileCache_paths[m_activeCacheSlot];
+        }
+        u64 activeOffset = m_activeOffset;
+
+        // Determine the time of the first available slot.
+        AZStd::chrono::steady_clock::time_point earliestSlot = AZStd::chrono::steady_clock::time_point::max();
+        for (size_t i = 0; i < m_readSlots_readInfo.size(); ++i)
+        {
+            if (m_readSlots_active[i])
+            {
+                const FileReadInformation& read = m_readSlots_readInfo[i];
+                u64 totalBytesRead = m_readSizeAverage.GetTotal();
+                double totalReadTime = aznumeric_caster(m_readTimeAverage.GetTotal().count());
+                auto readCommand = AZStd::get_if<Requests::ReadData>(&read.m_request->GetCommand());
+                AZ_Assert(readCommand, "Request currently reading doesn't contain a read command.");
+                AZStd::chrono::steady_clock::time_point endTime =
+                    read.m_startTime + Statistic::TimeValue(aznumeric_cast<u64>((readCommand->m_size * totalReadTime) / totalBytesRead));
+                earliestSlot = AZStd::min(earliestSlot, endTime);
+                read.m_request->SetEstimatedCompletion(endTime);
+            }
+        }
+        if (earliestSlot != AZStd::chrono::steady_clock::time_point::max())
+        {
+            now = earliestSlot;
+        }
+
+        // Estimate requests in this stack entry.
+        for (FileRequest* request : m_pendingReadRequests)
+        {
+            EstimateCompletionTimeForRequest(request, now, activeFile, activeOffset);
+        }
+        for (FileRequest* request : m_pendingRequests)
+        {
+            EstimateCompletionTimeForRequest(request, now, activeFile, activeOffset);
+        }
+
+        // Estimate internally pending requests. Because this call will go from the top of the stack to the bottom,
+        // but estimation is calculated from the bottom to the top, this list should be processed in reverse order.
+        for (auto requestIt = internalPending.rbegin(); requestIt != internalPending.rend(); ++requestIt)
+        {
+            EstimateCompletionTimeForRequest(*requestIt, now, activeFile, activeOffset);
+        }
+
+        // Estimate pending requests that have not been queued yet.
+        for (auto requestIt = pendingBegin; requestIt != pendingEnd; ++requestIt)
+        {
+            EstimateCompletionTimeForRequest(*requestIt, now, activeFile, activeOffset);
+        }
+    }
+
+    void StorageDriveLinux::EstimateCompletionTimeForRequest(FileRequest* request, AZStd::chrono::steady_clock::time_point& startTime,
+        const RequestPath*& activeFile, u64& activeOffset) const
+    {
+        u64 readSize = 0;
+        u64 offset = 0;
+        const RequestPath* targetFile = nullptr;
+
+        AZStd::visit([&](auto&& args)
+        {
+            using Command = AZStd::decay_t<decltype(args)>;
+            if constexpr (AZStd::is_same_v<Command, Requests::ReadData>)
+            {
+                targetFile = &args.m_path;
+                readSize = args.m_size;
+                offset = args.m_offset;
+            }
+            else if constexpr (AZStd::is_same_v<Command, Requests::CompressedReadData>)
+            {
+                targetFile = &args.m_compressionInfo.m_archiveFilename;
+                readSize = args.m_compressionInfo.m_compressedSize;
+                offset = args.m_compressionInfo.m_offset;
+            }
+            else if constexpr (AZStd::is_same_v<Command, Requests::FileExistsCheckData>)
+            {
+                readSize = 0;
+                startTime += m_getFileExistsTimeAverage.CalculateAverage();
+            }
+            else if constexpr (AZStd::is_same_v<Command, Requests::FileMetaDataRetrievalData>)
+            {
+                readSize = 0;
+                startTime += m_getFileMetaDataRetrievalTimeAverage.CalculateAverage();
+            }
+        }, request->GetCommand());
+
+        if (readSize > 0)
+        {
+            if (activeFile && activeFile != targetFile)
+            {
+                if (FindInFileHandleCache(*targetFile) == InvalidFileCacheIndex)
+                {
+                    startTime += m_fileOpenCloseTimeAverage.CalculateAverage();
+                }
+                activeOffset = std::numeric_limits<u64>::max();
+            }
+
+            if (activeOffset != offset && m_constructionOptions.m_hasSeekPenalty)
+            {
+                startTime += s_averageSeekTime;
+            }
+
+            u64 totalBytesRead = m_readSizeAverage.GetTotal();
+            double totalReadTime = aznumeric_caster(m_readTimeAverage.GetTotal().count());
+            startTime += Statistic::TimeValue(aznumeric_cast<u64>((readSize * totalReadTime) / totalBytesRead));
+            activeOffset = offset + readSize;
+        }
+        request->SetEstimatedCompletion(startTime);
+    }
+
+    s32 StorageDriveLinux::CalculateNumAvailableSlots() const
+    {
+        return (m_overCommit + aznumeric_cast<s32>(m_ioChannelCount)) - aznumeric_cast<s32>(m_pendingReadRequests.size()) -
+            aznumeric_cast<s32>(m_pendingRequests.size()) - m_activeReads_Count;
+    }
+
+    void StorageDriveLinux::InitializeCaches()
+    {
+        m_fileCache_recentlyUsed = RecentlyUsedFileIndex(m_maxFileHandles);
+        m_fileCache_paths.resize(m_maxFileHandles);
+        m_fileCache_handles.resize(m_maxFileHandles, InvalidFileDescriptor);
+        m_fileCache_activeReads.resize(m_maxFileHandles, 0);
+
+        m_readSlots_readInfo.resize(m_ioChannelCount);
+        m_readSlots_statusInfo = AZStd::make_unique<FileReadStatus[]>(m_ioChannelCount);
+        m_readSlots_active.resize(m_ioChannelCount);
+
+        m_cachesInitialized = true;
+    }
+
+    auto StorageDriveLinux::OpenFile(int& fileDescriptor, u32& cacheSlot, FileRequest* request, const Requests::ReadData& data)
+        -> OpenFileResult
+    {
+        int file = InvalidFileDescriptor;
+
+        // If the file is already opened for use, use that file handle and update it's last touched time.
+        u32 cacheIndex = FindInFileHandleCache(data.m_path);
+        if (cacheIndex != InvalidFileCacheIndex)
+        {
+            file = m_fileCache_handles[cacheIndex];
+            AZ_Assert(file != InvalidFileDescriptor, "Found the file '%s' in cache, but file handle is invalid.\n",
+                data.m_path.GetRelativePathCStr());
+            m_fileCache_recentlyUsed.Touch(cacheIndex);
+        }
+        else
+        {
+            // If the file is not already found in the cache, attempt to claim an available cache entry.
+            cacheIndex = FindAvailableFileHandleCacheIndex();
+            if (cacheIndex == InvalidFileCacheIndex)
+            {
+                // No files ready to be evicted.
+                return OpenFileResult::CacheFull;
+            }
+
+            {
+                AZ_PROFILE_SCOPE(AzCore, "StorageDriveLinux::ReadRequest OpenFile %s", m_name.c_str());
+                TIMED_AVERAGE_WINDOW_SCOPE(m_fileOpenCloseTimeAverage);
+
+                int flags = O_RDONLY | O_CLOEXEC;
+                if (m_constructionOptions.m_enableUnbufferedReads)
+                {
+                    flags |= O_DIRECT;
+                }
+                file = ::open(data.m_path.GetAbsolutePathCStr(), flags);
+                if (file == InvalidFileDescriptor && m_constructionOptions.m_enableUnbufferedReads && errno == EINVAL)
+                {
+                    // Not all file systems support O_DIRECT, such as tmpfs, so try again with buffered reads.
+                    file = ::open(data.m_path.GetAbsolutePathCStr(), O_RDONLY | O_CLOEXEC);
+                }
+                if (file == InvalidFileDescriptor)
+                {
+                    // Failed to open the file, so let the next entry in the stack try.
+                    StreamStackEntry::QueueRequest(request);
+                    return OpenFileResult::RequestForwarded;
+                }
+
+                if (m_fileCache_handles[cacheIndex] != InvalidFileDescriptor)
+                {
+                    ::close(m_fileCache_handles[cacheIndex]);
+                }
+            }
+
+            m_fileCache_recentlyUsed.TouchLeastRecentlyUsed();
+
+            // Fill the cache entry with data about the new file.
+            m_fileCache_handles[cacheIndex] = file;
+            m_fileCache_activeReads[cacheIndex] = 0;
+            m_fileCache_paths[cacheIndex] = data.m_path;
+        }
+
+        fileDescriptor = file;
+        cacheSlot = cacheIndex;
+        return OpenFileResult::FileOpened;
+    }
+
+    bool StorageDriveLinux::ReadRequest(FileRequest* request, TaskGraph& tasks)
+    {
+        AZ_PROFILE_SCOPE(AzCore, "StorageDriveLinux::ReadRequest %s", m_name.c_str());
+
+        if (!m_cachesInitialized)
+        {
+            InitializeCaches();
+        }
+
+        if (m_activeReads_Count >= m_ioChannelCount)
+        {
+            return false;
+        }
+
+        size_t readSlot = FindAvailableReadSlot();
+        AZ_Assert(readSlot != InvalidReadSlotIndex, "Active read slot count indicates there's a read slot available, but no read slot was found.");
+
+        auto data = AZStd::get_if<Requests::ReadData>(&request->GetCommand());
+        AZ_Assert(data, "Read request in StorageDriveLinux doesn't contain read data.");
+
+        int file = InvalidFileDescriptor;
+        u32 fileCacheSlot = InvalidFileCacheIndex;
+        switch (OpenFile(file, fileCacheSlot, request, *data))
+        {
+        case OpenFileResult::FileOpened:
+            break;
+        case OpenFileResult::RequestForwarded:
+            return true;
+        case OpenFileResult::CacheFull:
+            return false;
+        default:
+            AZ_Assert(false, "Unsupported OpenFileRequest returned.");
+        }
+
+        u64 readSize = data->m_size;
+        u64 readOffs = data->m_offset;
+        void* output = data->m_output;
+
+        FileReadInformation& readInfo = m_readSlots_readInfo[readSlot];
+        readInfo.m_request = request;
+
+        if (m_constructionOptions.m_enableUnbufferedReads)
+        {
+            // O_DIRECT requires the same alignment as unbuffered reads on Windows. The offset is aligned down and the size
+            // aligned up to the logical sector size. If the provided buffer can't hold the aligned read, or isn't aligned
+            // itself, an intermediate buffer is used and only the requested section is copied back once the read completes.
+            const bool alignedAddr = IStreamerTypes::IsAlignedTo(data->m_output, aznumeric_caster(m_physicalSectorSize));
+            const bool alignedOffs = IStreamerTypes::IsAlignedTo(data->m_offset, aznumeric_caster(m_logicalSectorSize));
+            if (!alignedOffs)
+            {
+                readOffs = AZ_SIZE_ALIGN_DOWN(readOffs, m_logicalSectorSize);
+                u64 offsetCorrection = data->m_offset - readOffs;
+                readInfo.m_copyBackOffset = offsetCorrection;
+                readSize = data->m_size + offsetCorrection;
+            }
+
+            bool alignedSize = IStreamerTypes::IsAlignedTo(readSize, aznumeric_caster(m_logicalSectorSize));
+            if (!alignedSize)
+            {
+                u64 alignedReadSize = AZ_SIZE_ALIGN_UP(readSize, m_logicalSectorSize);
+                if (alignedReadSize <= data->m_outputSize)
+                {
+                    alignedSize = true;
+                    readSize = alignedReadSize;
+                }
+            }
+
+            const bool isAligned = (alignedAddr && alignedSize && alignedOffs);
+            if (!isAligned)
+            {
+                readSize = AZ_SIZE_ALIGN_UP(readSize, m_logicalSectorSize);
+                readInfo.AllocateAlignedBuffer(readSize, m_physicalSectorSize);
+                output = readInfo.m_sectorAlignedOutput;
+            }
+#if AZ_STREAMER_ADD_EXTRA_PROFILING_INFO
+            m_directReadsPercentageStat.PushSample(isAligned ? 1.0 : 0.0);
+            Statistic::PlotImmediate(m_name, DirectReadsName, m_directReadsPercentageStat.GetMostRecentSample());
+#endif // AZ_STREAMER_ADD_EXTRA_PROFILING_INFO
+        }
+
+        FileReadStatus& readStatus = m_readSlots_statusInfo[readSlot];
+        readStatus.m_fileHandleIndex = fileCacheSlot;
+        readStatus.m_result = 0;
+        readStatus.m_requestState = FileReadStatus::RequestState::Pending;
+
+        if (m_ioUring)
+        {
+            if (!m_ioUring->QueueRead(file, output, aznumeric_cast<u32>(readSize), readOffs, readSlot))
+            {
+                // The submission queue is sized to the number of read slots so this should never happen.
+                AZ_Assert(false, "io_uring submission queue is full even though a read slot was available.");
+                readStatus.m_requestState = FileReadStatus::RequestState::NotStarted;
+                readInfo.Clear();
+                return false;
+            }
+            m_ioUringBatch.push_back(readSlot);
+            readInfo.m_fileDescriptor = file;
+            readInfo.m_readOutput = reinterpret_cast<u8*>(output);
+            readInfo.m_readSize = readSize;
+            readInfo.m_readOffset = readOffs;
+        }
+        else
+        {
+            m_pendingReadTasks++;
+            tasks.AddTask(
+                m_readTaskDescriptor,
+                [this, file, output, readSize, readOffs, status = &readStatus]()
+                {
+                    AZ_PROFILE_SCOPE(AzCore, "pread");
+                    u8* buffer = reinterpret_cast<u8*>(output);
+                    u64 bytesRead = 0;
+                    s64 result = 0;
+                    while (bytesRead < readSize)
+                    {
+                        ssize_t count = ::pread(file, buffer + bytesRead, readSize - bytesRead, readOffs + bytesRead);
+                        if (count < 0)
+                        {
+                            if (errno == EINTR)
+                            {
+                                continue;
+                            }
+                            result = -errno;
+                            break;
+                        }
+                        if (count == 0)
+                        {
+                            break; // End of file.
+                        }
+                        bytesRead += count;
+                    }
+                    status->m_result = result < 0 ? result : aznumeric_cast<s64>(bytesRead);
+                    status->m_requestState = FileReadStatus::RequestState::Completed;
+                    m_context->WakeUpSchedulingThread();
+                    // This has to be the last access to the drive as the destructor waits for this count to drop to zero.
+                    m_pendingReadTasks--;
+                });
+        }
+
+        auto now = AZStd::chrono::steady_clock::now();
+        if (m_activeReads_Count++ == 0)
+        {
+            m_activeReads_startTime = now;
+        }
+        m_queueDepthAverage.PushEntry(m_activeReads_Count);
+        readInfo.m_startTime = now;
+        m_readSlots_active[readSlot] = true;
+
+#if AZ_STREAMER_ADD_EXTRA_PROFILING_INFO
+        if (m_activeCacheSlot == fileCacheSlot)
+        {
+            m_fileSwitchPercentageStat.PushSample(0.0);
+            m_seekPercentageStat.PushSample(m_activeOffset == data->m_offset ? 0.0 : 1.0);
+        }
+        else
+        {
+            m_fileSwitchPercentageStat.PushSample(1.0);
+            m_seekPercentageStat.PushSample(0.0);
+        }
+
+        Statistic::PlotImmediate(m_name, FileSwitchesName, m_fileSwitchPercentageStat.GetMostRecentSample());
+        Statistic::PlotImmediate(m_name, SeeksName, m_seekPercentageStat.GetMostRecentSample());
+        Statistic::PlotImmediate(m_name, QueueDepthName, aznumeric_cast<double>(m_activeReads_Count));
+#endif // AZ_STREAMER_ADD_EXTRA_PROFILING_INFO
+
+        m_fileCache_activeReads[fileCacheSlot]++;
+        m_activeCacheSlot = fileCacheSlot;
+        m_activeOffset = readOffs + readSize;
+
+        return true;
+    }
+
+    bool StorageDriveLinux::CancelRequest(FileRequest* cancelRequest, FileRequestPtr& target)
+    {
+        bool ownsRequestChain = false;
+        for (auto it = m_pendingReadRequests.begin(); it != m_pendingReadRequests.end();)
+        {
+            if ((*it)->WorksOn(target))
+            {
+                (*it)->SetStatus(IStreamerTypes::RequestStatus::Canceled);
+                m_context->MarkRequestAsCompleted(*it);
+                it = m_pendingReadRequests.erase(it);
+                ownsRequestChain = true;
+            }
+            else
+            {
+                ++it;
+            }
+        }
+
+        // Pending requests have been accounted for, now address any active reads. Reads issued through io_uring can be
+        // canceled by the kernel, in which case they'll complete with ECANCELED. Reads on the task executor will run to completion.
+        bool hasQueuedCancels = false;
+        for (size_t readSlot = 0; readSlot < m_readSlots_active.size(); ++readSlot)
+        {
+            if (m_readSlots_active[readSlot] && m_readSlots_readInfo[readSlot].m_request->WorksOn(target))
+            {
+                ownsRequestChain = true;
+                if (m_ioUring)
+                {
+                    hasQueuedCancels = m_ioUring->QueueCancel(readSlot) || hasQueuedCancels;
+                }
+            }
+        }
+        if (hasQueuedCancels)
+        {
+            // If the cancel requests are rejected the reads will run to completion, which is still correct.
+            m_ioUring->Submit();
+        }
+
+        if (ownsRequestChain)
+        {
+            cancelRequest->SetStatus(IStreamerTypes::RequestStatus::Completed);
+            m_context->MarkRequestAsCompleted(cancelRequest);
+        }
+
+        return ownsRequestChain;
+    }
+
+    void StorageDriveLinux::FileExistsRequest(FileRequest* request)
+    {
+        auto& fileExists = AZStd::get<Requests::FileExistsCheckData>(request->GetCommand());
+
+        AZ_PROFILE_SCOPE(AzCore, "StorageDriveLinux::FileExistsRequest %s : %s",
+            m_name.c_str(), fileExists.m_path.GetRelativePathCStr());
+        TIMED_AVERAGE_WINDOW_SCOPE(m_getFileExistsTimeAverage);
+
+        u32 cacheIndex = FindInFileHandleCache(fileExists.m_path);
+        if (cacheIndex != InvalidFileCacheIndex)
+        {
+            fileExists.m_found = true;
+            request->SetStatus(IStreamerTypes::RequestStatus::Completed);
+            m_context->MarkRequestAsCompleted(request);
+            return;
+        }
+
+        cacheIndex = FindInMetaDataCache(fileExists.m_path);
+        if (cacheIndex != InvalidMetaDataCacheIndex)
+        {
+            fileExists.m_found = true;
+            request->SetStatus(IStreamerTypes::RequestStatus::Completed);
+            m_context->MarkRequestAsCompleted(request);
+            m_metaDataCache_recentlyUsed.Touch(cacheIndex);
+            return;
+        }
+
+        struct stat fileStat;
+        if (::stat(fileExists.m_path.GetAbsolutePathCStr(), &fileStat) == 0 && S_ISREG(fileStat.st_mode))
+        {
+            cacheIndex = m_metaDataCache_recentlyUsed.TouchLeastRecentlyUsed();
+            m_metaDataCache_paths[cacheIndex] = fileExists.m_path;
+            m_metaDataCache_fileSize[cacheIndex] = aznumeric_caster(fileStat.st_size);
+            fileExists.m_found = true;
+
+            request->SetStatus(IStreamerTypes::RequestStatus::Completed);
+            m_context->MarkRequestAsCompleted(request);
+            return;
+        }
+
+        StreamStackEntry::QueueRequest(request);
+    }
+
+    void StorageDriveLinux::FileMetaDataRetrievalRequest(FileRequest* request)
+    {
+        auto& command = AZStd::get<Requests::FileMetaDataRetrievalData>(request->GetCommand());
+
+        AZ_PROFILE_SCOPE(AzCore, "StorageDriveLinux::FileMetaDataRetrievalRequest %s : %s",
+            m_name.c_str(), command.m_path.GetRelativePathCStr());
+        TIMED_AVERAGE_WINDOW_SCOPE(m_getFileMetaDataRetrievalTimeAverage);
+
+        u32 cacheIndex = FindInMetaDataCache(command.m_path);
+        if (cacheIndex != InvalidMetaDataCacheIndex)
+        {
+            command.m_fileSize = m_metaDataCache_fileSize[cacheIndex];
+            command.m_found = true;
+            request->SetStatus(IStreamerTypes::RequestStatus::Completed);
+            m_context->MarkRequestAsCompleted(request);
+            m_metaDataCache_recentlyUsed.Touch(cacheIndex);
+            return;
+        }
+
+        struct stat fileStat;
+        cacheIndex = FindInFileHandleCache(command.m_path);
+        if (cacheIndex != InvalidFileCacheIndex)
+        {
+            AZ_Assert(m_fileCache_handles[cacheIndex] != InvalidFileDescriptor,
+                "File path '%s' doesn't have an associated file handle.", m_fileCache_paths[cacheIndex].GetRelativePathCStr());
+            if (::fstat(m_fileCache_handles[cacheIndex], &fileStat) != 0)
+            {
+                StreamStackEntry::QueueRequest(request);
+                return;
+            }
+        }
+        else if (::stat(command.m_path.GetAbsolutePathCStr(), &fileStat) != 0 || !S_ISREG(fileStat.st_mode))
+        {
+            StreamStackEntry::QueueRequest(request);
+            return;
+        }
+
+        command.m_fileSize = aznumeric_caster(fileStat.st_size);
+        command.m_found = true;
+
+        cacheIndex = m_metaDataCache_recentlyUsed.TouchLeastRecentlyUsed();
+        m_metaDataCache_paths[cacheIndex] = command.m_path;
+        m_metaDataCache_fileSize[cacheIndex] = aznumeric_caster(fileStat.st_size);
+
+        request->SetStatus(IStreamerTypes::RequestStatus::Completed);
+        m_context->MarkRequestAsCompleted(request);
+    }
+
+    void StorageDriveLinux::FlushCache(const RequestPath& filePath)
+    {
+        if (m_cachesInitialized)
+        {
+            // Clear file handle from cache.
+            {
+                u32 cacheIndex = FindInFileHandleCache(filePath);
+                if (cacheIndex != InvalidFileCacheIndex)
+                {
+                    if (m_fileCache_handles[cacheIndex] != InvalidFileDescriptor)
+                    {
+                        AZ_Assert(
+                            m_fileCache_activeReads[cacheIndex] == 0, "Flushing '%s' but it has %u active reads\n",
+                            filePath.GetRelativePathCStr(), m_fileCache_activeReads[cacheIndex]);
+                        ::close(m_fileCache_handles[cacheIndex]);
+                        m_fileCache_handles[cacheIndex] = InvalidFileDescriptor;
+                    }
+                    m_fileCache_activeReads[cacheIndex] = 0;
+                    m_fileCache_recentlyUsed.Flush(cacheIndex);
+                    m_fileCache_paths[cacheIndex].Clear();
+                }
+            }
+
+            // Clear file meta data from cache.
+            {
+                u32 cacheIndex = FindInMetaDataCache(filePath);
+                if (cacheIndex != InvalidMetaDataCacheIndex)
+                {
+                    m_metaDataCache_paths[cacheIndex].Clear();
+                    m_metaDataCache_fileSize[cacheIndex] = 0;
+                    m_metaDataCache_recentlyUsed.Flush(cacheIndex);
+                }
+            }
+        }
+    }
+
+    void StorageDriveLinux::FlushEntireCache()
+    {
+        if (m_cachesInitialized)
+        {
+            // Clear file handle cache
+            for (size_t cacheIndex = 0; cacheIndex < m_maxFileHandles; ++cacheIndex)
+            {
+                if (m_fileCache_handles[cacheIndex] != InvalidFileDescriptor)
+                {
+                    AZ_Assert(m_fileCache_activeReads[cacheIndex] == 0, "Flushing '%s' but it has %u active reads\n",
+                        m_fileCache_paths[cacheIndex].GetRelativePathCStr(), m_fileCache_activeReads[cacheIndex]);
+                    ::close(m_fileCache_handles[cacheIndex]);
+                    m_fileCache_handles[cacheIndex] = InvalidFileDescriptor;
+                }
+                m_fileCache_activeReads[cacheIndex] = 0;
+                m_fileCache_paths[cacheIndex].Clear();
+            }
+            m_fileCache_recentlyUsed.FlushAll();
+
+            // Clear meta data cache
+            m_metaDataCache_recentlyUsed.FlushAll();
+            auto metaDataCacheSize = m_metaDataCache_paths.size();
+            m_metaDataCache_paths.clear();
+            m_metaDataCache_fileSize.clear();
+            m_metaDataCache_paths.resize(metaDataCacheSize);
+            m_metaDataCache_fileSize.resize(metaDataCacheSize);
+        }
+    }
+
+    bool StorageDriveLinux::FinalizeReads()
+    {
+        AZ_PROFILE_FUNCTION(AzCore);
+
+        bool hasWorked = false;
+        for (size_t readSlot = 0; readSlot < m_readSlots_active.size(); ++readSlot)
+        {
+            if (m_readSlots_active[readSlot])
+            {
+                FileReadStatus& status = m_readSlots_statusInfo[readSlot];
+                if (status.m_requestState == FileReadStatus::RequestState::Completed)
+                {
+                    if (!ContinuePartialRead(status, readSlot))
+                    {
+                        FinalizeSingleRequest(status, readSlot);
+                    }
+                    hasWorked = true;
+                }
+            }
+        }
+        if (!m_ioUringBatch.empty())
+        {
+            SubmitIoUringBatch();
+        }
+        return hasWorked;
+    }
+
+    bool StorageDriveLinux::ContinuePartialRead(FileReadStatus& status, size_t readSlot)
+    {
+        // The pread fallback already loops until all data is read, so only reads through io_uring can be partially completed.
+        const s64 result = status.m_result;
+        if (!m_ioUring || result <= 0)
+        {
+            // Errors, cancellations and reaching the end of the file end the read.
+            return false;
+        }
+
+        FileReadInformation& readInfo = m_readSlots_readInfo[readSlot];
+        auto readCommand = AZStd::get_if<Requests::ReadData>(&readInfo.m_request->GetCommand());
+        AZ_Assert(readCommand != nullptr, "Request stored with the read slot did not contain a read request.");
+        // Only the requested data is needed, so a read that's short because the aligned size goes past the end of the file
+        // doesn't need to be continued.
+        const u64 bytesRead = readInfo.m_bytesRead + aznumeric_cast<u64>(result);
+        if (bytesRead >= readCommand->m_size + readInfo.m_copyBackOffset || bytesRead >= readInfo.m_readSize)
+        {
+            return false;
+        }
+
+        if (!m_ioUring->QueueRead(readInfo.m_fileDescriptor, readInfo.m_readOutput + bytesRead,
+            aznumeric_cast<u32>(readInfo.m_readSize - bytesRead), readInfo.m_readOffset + bytesRead, readSlot))
+        {
+            AZ_Assert(false, "io_uring submission queue is full while continuing a partial read.");
+            return false;
+        }
+        readInfo.m_bytesRead = bytesRead;
+        status.m_result = 0;
+        status.m_requestState = FileReadStatus::RequestState::Pending;
+        m_ioUringBatch.push_back(readSlot);
+        return true;
+    }
+
+    void StorageDriveLinux::SubmitIoUringBatch()
+    {
+        AZ_PROFILE_SCOPE(AzCore, "StorageDriveLinux::SubmitIoUringBatch io_uring_enter");
+        u32 rejectedCount = m_ioUring->Submit();
+        if (rejectedCount > 0)
+        {
+            // The kernel didn't accept the tail end of the batch, so fail those reads. They'll be finalized on
+            // the next update.
+            AZ_Assert(rejectedCount <= m_ioUringBatch.size(), "io_uring rejected more reads than were queued.");
+            for (size_t i = m_ioUringBatch.size() - rejectedCount; i < m_ioUringBatch.size(); ++i)
+            {
+                FileReadStatus& status = m_readSlots_statusInfo[m_ioUringBatch[i]];
+                status.m_result = -EIO;
+                status.m_requestState = FileReadStatus::RequestState::Completed;
+            }
+            m_context->WakeUpSchedulingThread();
+        }
+        m_ioUringBatch.clear();
+    }
+
+    void StorageDriveLinux::FinalizeSingleRequest(FileReadStatus& status, size_t readSlot)
+    {
+        const s64 result = status.m_result;
+        const bool isCanceled = (result == -ECANCELED || result == -EINTR);
+        const bool encounteredError = result < 0 && !isCanceled;
+        auto now = AZStd::chrono::steady_clock::now();
+        FileReadInformation& fileReadInfo = m_readSlots_readInfo[readSlot];
+        // Include the data from earlier parts of a read that was continued after the kernel returned less than requested.
+        const u64 numBytesTransferred = fileReadInfo.m_bytesRead + (result > 0 ? aznumeric_cast<u64>(result) : 0);
+        m_readLatencyAverage.PushEntry(AZStd::chrono::duration_cast<Statistic::TimeValue>(now - fileReadInfo.m_startTime));
+
+        m_activeReads_ByteCount += numBytesTransferred;
+        if (--m_activeReads_Count == 0)
+        {
+            // Update read stats now that the operation is done.
+            m_readSizeAverage.PushEntry(m_activeReads_ByteCount);
+            m_readTimeAverage.PushEntry(AZStd::chrono::duration_cast<AZStd::chrono::microseconds>(now - m_activeReads_startTime));
+
+            m_activeReads_ByteCount = 0;
+        }
+
+        auto readCommand = AZStd::get_if<Requests::ReadData>(&fileReadInfo.m_request->GetCommand());
+        AZ_Assert(readCommand != nullptr, "Request stored with the read slot did not contain a read request.");
+        AZ_Error("StorageDriveLinux", !encounteredError, "Read from '%s' failed with errno %lli.\n",
+            readCommand->m_path.GetRelativePathCStr(), static_cast<long long>(-result));
+
+        // The request could be reading more due to alignment requirements. It should however never read less that the amount of
+        // requested data.
+        const bool isSuccess = !encounteredError && !isCanceled &&
+            (readCommand->m_size + fileReadInfo.m_copyBackOffset <= numBytesTransferred);
+
+        if (fileReadInfo.m_sectorAlignedOutput && isSuccess)
+        {
+            auto offsetAddress = reinterpret_cast<u8*>(fileReadInfo.m_sectorAlignedOutput) + fileReadInfo.m_copyBackOffset;
+            ::memcpy(readCommand->m_output, offsetAddress, readCommand->m_size);
+        }
+
+        fileReadInfo.m_request->SetStatus(
+            isCanceled
+                ? IStreamerTypes::RequestStatus::Canceled
+                : isSuccess
+                    ? IStreamerTypes::RequestStatus::Completed
+                    : IStreamerTypes::RequestStatus::Failed
+        );
+        m_context->MarkRequestAsCompleted(fileReadInfo.m_request);
+
+        m_fileCache_activeReads[status.m_fileHandleIndex]--;
+        m_readSlots_active[readSlot] = false;
+        status.m_requestState = FileReadStatus::RequestState::NotStarted;
+        fileReadInfo.Clear();
+    }
+
+    u32 StorageDriveLinux::FindInFileHandleCache(const RequestPath& filePath) const
+    {
+        size_t numFiles = m_fileCache_paths.size();
+        for (size_t i = 0; i < numFiles; ++i)
+        {
+            if (m_fileCache_paths[i] == filePath)
+            {
+                return aznumeric_caster(i);
+            }
+        }
+        return InvalidFileCacheIndex;
+    }
+
+    u32 StorageDriveLinux::FindAvailableFileHandleCacheIndex()
+    {
+        AZ_Assert(m_cachesInitialized, "Using file cache before it has been (lazily) initialized\n");
+
+        u32 cacheIndex = m_fileCache_recentlyUsed.GetLeastRecentlyUsed();
+        if (m_fileCache_activeReads[cacheIndex] == 0)
+        {
+            return cacheIndex;
+        }
+        return InvalidFileCacheIndex;
+    }
+
+    size_t StorageDriveLinux::FindAvailableReadSlot()
+    {
+        for (size_t i = 0; i < m_readSlots_active.size(); ++i)
+        {
+            if (!m_readSlots_active[i])
+            {
+                return i;
+            }
+        }
+        return InvalidReadSlotIndex;
+    }
+
+    u32 StorageDriveLinux::FindInMetaDataCache(const RequestPath& filePath) const
+    {
+        size_t numFiles = m_metaDataCache_paths.size();
+        for (size_t i = 0; i < numFiles; ++i)
+        {
+            if (m_metaDataCache_paths[i] == filePath)
+            {
+                return aznumeric_caster(i);
+            }
+        }
+        return InvalidMetaDataCacheIndex;
+    }
+
+    void StorageDriveLinux::CollectStatistics(AZStd::vector<Statistic>& statistics) const
+    {
+        if (m_cachesInitialized)
+        {
+            using DoubleSeconds = AZStd::chrono::duration<double>;
+
+            u64 totalBytesRead = m_readSizeAverage.GetTotal();
+            double totalReadTimeSec = AZStd::chrono::duration_cast<DoubleSeconds>(m_readTimeAverage.GetTotal()).count();
+            statistics.push_back(Statistic::CreateBytesPerSecond(m_name, "Read Speed", totalBytesRead / totalReadTimeSec,
+                "The average read speed this drive achieved while reads were in flight. If this is lower than expected it may indicate "
+                "that the queue depth is too low to saturate the drive, other applications are using the same drive or reads are "
+                "too small. Enabling unbuffered reads bypasses the page cache, which is typically faster for the first read of a file "
+                "but slower for files that are read repeatedly."));
+            statistics.push_back(Statistic::CreateFloatRange(
+                m_name, "Queue depth", m_queueDepthAverage.CalculateAverage(), aznumeric_cast<double>(m_queueDepthAverage.GetMinimum()),
+                aznumeric_cast<double>(m_queueDepthAverage.GetMaximum()),
+                "The number of reads that were in flight when a new read was issued. If this is often close to 1 the scheduler isn't "
+                "providing enough requests to keep the drive busy. Increasing the over-commit value can help. If this is often at the "
+                "IO channel count, increasing the number of IO channels may improve throughput."));
+            statistics.push_back(Statistic::CreateTimeRange(
+                m_name, "Read latency", m_readLatencyAverage.CalculateAverage(), m_readLatencyAverage.GetMinimum(),
+                m_readLatencyAverage.GetMaximum(),
+                "The time between a read being issued and it being finalized. This includes time spent waiting in the kernel's queue, "
+                "so it will go up with the queue depth even if the drive is performing well."));
+            statistics.push_back(Statistic::CreateTimeRange(
+                m_name, "File Open & Close", m_fileOpenCloseTimeAverage.CalculateAverage(), m_fileOpenCloseTimeAverage.GetMinimum(),
+                m_fileOpenCloseTimeAverage.GetMaximum(),
+                "The average amount of time needed to open and close file handles. This is a fixed cost from the operating "
+                "system. This can be mitigated running from archives."));
+            statistics.push_back(Statistic::CreateTimeRange(
+                m_name, "Get file exists", m_getFileExistsTimeAverage.CalculateAverage(),
+                m_getFileExistsTimeAverage.GetMinimum(), m_getFileExistsTimeAverage.GetMaximum(),
+                "The average amount of time needed to check if a file exists. This is a fixed cost from the operating "
+                "system. This can be mitigated running from archives."));
+            statistics.push_back(Statistic::CreateTimeRange(
+                m_name, "Get file meta data", m_getFileMetaDataRetrievalTimeAverage.CalculateAverage(),
+                m_getFileMetaDataRetrievalTimeAverage.GetMinimum(), m_getFileMetaDataRetrievalTimeAverage.GetMaximum(),
+                "The average amount of time in microseconds needed to retrieve file information. This is a fixed cost from the operating "
+                "system. This can be mitigated running from archives."));
+            statistics.push_back(Statistic::CreateInteger(m_name, "Available slots", CalculateNumAvailableSlots(),
+                "The total number of available slots to queue requests on. The lower this number, the more active this node is. A small "
+                "number is ideal as it means there are a few requests available for immediate processing next once a request "
+                "completes. If this is value is often negative then increasing the over-commit value, but keep in mind that too many "
+                "over-committed reduces the ability of scheduler to order requests."));
+
+#if AZ_STREAMER_ADD_EXTRA_PROFILING_INFO
+            statistics.push_back(Statistic::CreatePercentageRange(
+                m_name, FileSwitchesName, m_fileSwitchPercentageStat.GetAverage(), m_fileSwitchPercentageStat.GetMinimum(),
+                m_fileSwitchPercentageStat.GetMaximum(),
+                "The percentage of file requests that required switching to a different file. When running from loose file this should be "
+                "close to 100% as that would indicate mostly full file reads. When running from archives this should be as close to 0 as "
+                "possible as that would indicate efficiently running from archives."));
+            statistics.push_back(Statistic::CreatePercentageRange(
+                m_name, SeeksName, m_seekPercentageStat.GetAverage(), m_seekPercentageStat.GetMinimum(), m_seekPercentageStat.GetMaximum(),
+                "The percentage of file reads that required seeking within a file. For loose files this should be lose to zero to indicate "
+                "no partial file reads. For archives this value is typically high, which is not a problem, but lower values indicate more "
+                "efficient scheduling and archive layout which will result in better hardware cache utilization."));
+            if (m_constructionOptions.m_enableUnbufferedReads)
+            {
+                statistics.push_back(Statistic::CreatePercentageRange(
+                    m_name, DirectReadsName, m_directReadsPercentageStat.GetAverage(), m_directReadsPercentageStat.GetMinimum(),
+                    m_directReadsPercentageStat.GetMaximum(),
+                    "The percentage of reads that did not require any additional aligning. If this number isn't close to 100 percent "
+                    "performance will suffer as temporary buffers need to be allocated and freed. The best way to avoid this is by adding a "
+                    "block cache and/or read splitter in front of this node."));
+            }
+#endif
+        }
+        StreamStackEntry::CollectStatistics(statistics);
+    }
+
+    void StorageDriveLinux::Report(const Requests::ReportData& data) const
+    {
+        switch (data.m_reportType)
+        {
+        case IStreamerTypes::ReportType::Config:
+            data.m_output.push_back(Statistic::CreateReferenceString(
+                m_name, "Read path", m_ioUring ? AZStd::string_view("io_uring") : AZStd::string_view("pread"),
+                "Whether reads are submitted through io_uring or as pread calls on the task executor. The pread path is used when "
+                "io_uring is disabled or not supported by the kernel."));
+            data.m_output.push_back(Statistic::CreateInteger(
+                m_name, "Max file handles", m_maxFileHandles,
+                "The maximum number of file handles this drive node will cache. Increasing this will allow files that are read "
+                "multiple times to be processed faster. It's recommended to have this set to at least the largest number of archives "
+                "that can be in use at the same time."));
+            data.m_output.push_back(Statistic::CreateInteger(
+                m_name, "Max meta data cache", m_metaDataCache_paths.size(),
+                "The maximum number of meta data like file sizes this drive node will cache."));
+            data.m_output.push_back(Statistic::CreateByteSize(
+                m_name, "Physical sector size", m_physicalSectorSize,
+                "The sector size used by the hardware. For optimal performance memory alignment and read sizes need to be multiples of "
+                "this value."));
+            data.m_output.push_back(Statistic::CreateByteSize(
+                m_name, "Logical sector size", m_logicalSectorSize,
+                "The sector size used by the operating system. This is typically the same or smaller than the physical sector size. If "
+                "the physical sector size alignment can't be met, this is the next best size to align to."));
+            data.m_output.push_back(Statistic::CreateInteger(
+                m_name, "IO channel count", m_ioChannelCount, "The maximum number of reads this node keeps in flight."));
+            data.m_output.push_back(Statistic::CreateInteger(
+                m_name, "Overcommit", m_overCommit,
+                "The number of additional requests this node will accept. Higher numbers means that drives don't have to wait for the "
+                "scheduler to provide new request to process and the next request can immediately start reading. If this value is too "
+                "high though it will negatively impact the scheduler's ability to order and prioritize requests."));
+            data.m_output.push_back(Statistic::CreateBoolean(
+                m_name, "Has seek penalty", m_constructionOptions.m_hasSeekPenalty,
+                "Whether or not the hardware has a penalty for seeking. This refers to drives that need to physically position a read "
+                "head to retrieve data, which can cause additional seek times for non-consecutive reads."));
+            data.m_output.push_back(Statistic::CreateBoolean(
+                m_name, "Unbuffered reads enabled", m_constructionOptions.m_enableUnbufferedReads,
+                "Whether or not this drive will bypass the page cache with O_DIRECT. Unbuffered reads are typically faster for the "
+                "first read of a file, but repeated reads of the same file will be slower."));
+            data.m_output.push_back(Statistic::CreateBoolean(
+                m_name, "Minimal reporting", m_constructionOptions.m_minimalReporting,
+                "Whether or not this node only reports issues or reports all information."));
+            data.m_output.push_back(Statistic::CreateReferenceString(
+                m_name, "Next node", m_next ? AZStd::string_view(m_next->GetName()) : AZStd::string_view("<None>"),
+                "The name of the node that follows this node or none."));
+            break;
+        case IStreamerTypes::ReportType::FileLocks:
+            if (m_cachesInitialized)
+            {
+                for (u32 i = 0; i < m_maxFileHandles; ++i)
+                {
+                    if (m_fileCache_handles[i] != InvalidFileDescriptor)
+                    {
+                        data.m_output.push_back(
+                            Statistic::CreatePersistentString(m_name, "File lock", m_fileCache_paths[i].GetRelativePath().Native()));
+                    }
+                }
+            }
+            break;
+        default:
+            break;
+        }
+    }
+} // namespace AZ::IO
@@ -0,0 +1,227 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Task/TaskDescriptor.h>
+#include <AzCore/IO/Streamer/RecentlyUsedIndex.h>
+#include <AzCore/IO/Streamer/RequestPath.h>
+#include <AzCore/IO/Streamer/Statistics.h>
+#include <AzCore/IO/Streamer/StreamerConfiguration.h>
+#include <AzCore/IO/Streamer/StreamStackEntry.h>
+#include <AzCore/std/containers/deque.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/chrono/chrono.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+#include <AzCore/Statistics/RunningStatistic.h>
+
+namespace AZ
+{
+    class TaskExecutor;
+    class TaskGraph;
+}
+
+namespace AZ::IO::Requests
+{
+    struct ReadData;
+    struct ReportData;
+}
+
+namespace AZ::IO
+{
+    //! Storage drive optimized for Linux. Unlike the generic StorageDrive, which services one read at a time, this
+    //! drive keeps multiple reads in flight. Reads are submitted through io_uring when the kernel supports it. If
+    //! io_uring isn't available reads are issued as pread calls on the task executor instead.
+    class AZCORE_API StorageDriveLinux
+        : public StreamStackEntry
+    {
+    public:
+        struct AZCORE_API ConstructionOptions
+        {
+            ConstructionOptions();
+
+            //! Whether or not the device has a cost for seeking, such as happens on platter disks. This
+            //! will be accounted for when predicting file reads.
+            u8 m_hasSeekPenalty : 1;
+            //! Use unbuffered (O_DIRECT) reads to bypass the page cache. This results in a faster read the first time a file is
+            //! read, but subsequent reads will possibly be slower as those could have been serviced from the page cache.
+            //! Unbuffered reads have alignment restrictions. For the most optimal performance align read buffers to the
+            //! physicalSectorSize and use a block cache and/or read splitter in front of this node.
+            u8 m_enableUnbufferedReads : 1;
+            //! Submit reads through io_uring if the kernel supports it. If disabled or unavailable, reads are issued as
+            //! pread calls on the task executor.
+            u8 m_enableIoUring : 1;
+            //! If true, only information that's explicitly requested or issues are reported. If false, status information
+            //! such as when drives are created and destroyed is reported as well.
+            u8 m_minimalReporting : 1;
+        };
+
+        //! Creates an instance of a storage device that's optimized for use on Linux.
+        //! @param maxFileHandles The maximum number of file handles that are cached. Only a small number are needed when
+        //!     running from archives, but it's recommended that a larger number are kept open when reading from loose files.
+        //! @param maxMetaDataCacheEntries The maximum number of files to keep meta data, such as the file size, to cache.
+        //! @param physicalSectorSize The minimal sector size as instructed by the device. When unbuffered reads are used the output
+        //!     buffer needs to be aligned to this value.
+        //! @param logicalSectorSize The minimal sector size as instructed by the device. When unbuffered reads are used the
+        //!     file size and read offset need to be aligned to this value.
+        //! @param ioChannelCount The maximum number of reads that will be kept in flight at the same time.
+        //! @param overCommit The number of additional slots that will be reported as available. This makes sure that there are
+        //!     always a few requests pending to avoid starvation. An over-commit that is too large can negatively impact the
+        //!     scheduler's ability to re-order requests for optimal read order.
+        //! @param options Additional configuration options. See ConstructionOptions for more details.
+        StorageDriveLinux(u32 maxFileHandles, u32 maxMetaDataCacheEntries, size_t physicalSectorSize, size_t logicalSectorSize,
+            u32 ioChannelCount, s32 overCommit, ConstructionOptions options);
+        ~StorageDriveLinux() override;
+
+        void PrepareRequest(FileRequest* request) override;
+        void QueueRequest(FileRequest* request) override;
+        bool ExecuteRequests() override;
+
+        void UpdateStatus(Status& status) const override;
+        void UpdateCompletionEstimates(AZStd::chrono::steady_clock::time_point now, AZStd::vector<FileRequest*>& internalPending,
+            StreamerContext::PreparedQueue::iterator pendingBegin, StreamerContext::PreparedQueue::iterator pendingEnd) override;
+
+        void CollectStatistics(AZStd::vector<Statistic>& statistics) const override;
+
+        //! Returns true if reads are submitted through io_uring, false if the pread fallback is used.
+        bool IsUsingIoUring() const;
+
+    protected:
+        class IoUring;
+
+        using RecentlyUsedFileIndex = RecentlyUsedIndex<u32>;
+        using RecentlyUsedMetaIndex = RecentlyUsedIndex<u32>;
+        static const AZStd::chrono::microseconds s_averageSeekTime;
+
+        inline static constexpr u32 InvalidFileCacheIndex = AZStd::numeric_limits<u32>::max();
+        inline static constexpr size_t InvalidReadSlotIndex = AZStd::numeric_limits<size_t>::max();
+        inline static constexpr u32 InvalidMetaDataCacheIndex = AZStd::numeric_limits<u32>::max();
+        inline static constexpr int InvalidFileDescriptor = -1;
+
+        struct FileReadStatus
+        {
+            enum class RequestState : u8
+            {
+                NotStarted,
+                Pending,
+                Completed
+            };
+            //! The number of bytes read or a negated errno value if the read failed.
+            AZStd::atomic<s64> m_result{ 0 };
+            AZStd::atomic<RequestState> m_requestState{ RequestState::NotStarted };
+            u32 m_fileHandleIndex{ InvalidFileCacheIndex };
+        };
+
+        struct AZCORE_API FileReadInformation
+        {
+            AZStd::chrono::steady_clock::time_point m_startTime;
+            FileRequest* m_request{ nullptr };
+            void* m_sectorAlignedOutput{ nullptr };    // Internally allocated buffer that is sector aligned.
+            size_t m_copyBackOffset{ 0 };
+            // The read as it's issued to io_uring, so it can be continued if the kernel returns less data than requested.
+            u8* m_readOutput{ nullptr };
+            u64 m_readSize{ 0 };
+            u64 m_readOffset{ 0 };
+            u64 m_bytesRead{ 0 };   // Bytes read by earlier parts of a continued read.
+            int m_fileDescriptor{ InvalidFileDescriptor };
+
+            void AllocateAlignedBuffer(size_t size, size_t sectorSize);
+            void Clear();
+        };
+
+        enum class OpenFileResult
+        {
+            FileOpened,
+            RequestForwarded,
+            CacheFull
+        };
+
+        OpenFileResult OpenFile(int& fileDescriptor, u32& cacheSlot, FileRequest* request, const Requests::ReadData& data);
+        bool ReadRequest(FileRequest* request, TaskGraph& tasks);
+        bool CancelRequest(FileRequest* cancelRequest, FileRequestPtr& target);
+        void FileExistsRequest(FileRequest* request);
+        void FileMetaDataRetrievalRequest(FileRequest* request);
+        u32 FindInFileHandleCache(const RequestPath& filePath) const;
+        u32 FindAvailableFileHandleCacheIndex();
+        size_t FindAvailableReadSlot();
+        u32 FindInMetaDataCache(const RequestPath& filePath) const;
+        void InitializeCaches();
+
+        void EstimateCompletionTimeForRequest(FileRequest* request, AZStd::chrono::steady_clock::time_point& startTime,
+            const RequestPath*& activeFile, u64& activeOffset) const;
+        s32 CalculateNumAvailableSlots() const;
+
+        void FlushCache(const RequestPath& filePath);
+        void FlushEntireCache();
+
+        bool FinalizeReads();
+        //! Queues the remainder of an io_uring read that returned less data than requested. Returns false if the read is done.
+        bool ContinuePartialRead(FileReadStatus& status, size_t readSlot);
+        void FinalizeSingleRequest(FileReadStatus& status, size_t readSlot);
+        void SubmitIoUringBatch();
+
+        void Report(const Requests::ReportData& data) const;
+
+        TimedAverageWindow<s_statisticsWindowSize> m_fileOpenCloseTimeAverage;
+        TimedAverageWindow<s_statisticsWindowSize> m_getFileExistsTimeAverage;
+        TimedAverageWindow<s_statisticsWindowSize> m_getFileMetaDataRetrievalTimeAverage;
+        TimedAverageWindow<s_statisticsWindowSize> m_readTimeAverage;
+        //! The time between a read being issued to the kernel and it being finalized.
+        TimedAverageWindow<s_statisticsWindowSize> m_readLatencyAverage;
+        AverageWindow<u64, float, s_statisticsWindowSize> m_readSizeAverage;
+        //! The number of reads in flight at the time a new read is issued.
+        AverageWindow<u64, double, s_statisticsWindowSize> m_queueDepthAverage;
+#if AZ_STREAMER_ADD_EXTRA_PROFILING_INFO
+        AZ::Statistics::RunningStatistic m_fileSwitchPercentageStat;
+        AZ::Statistics::RunningStatistic m_seekPercentageStat;
+        AZ::Statistics::RunningStatistic m_directReadsPercentageStat;
+#endif
+        AZStd::chrono::steady_clock::time_point m_activeReads_startTime;
+
+        AZStd::deque<FileRequest*> m_pendingReadRequests;
+        AZStd::deque<FileRequest*> m_pendingRequests;
+
+        AZStd::vector<FileReadInformation> m_readSlots_readInfo;
+        AZStd::unique_ptr<FileReadStatus[]> m_readSlots_statusInfo;
+        AZStd::vector<bool> m_readSlots_active;
+
+        RecentlyUsedFileIndex m_fileCache_recentlyUsed;
+        AZStd::vector<RequestPath> m_fileCache_paths;
+        AZStd::vector<int> m_fileCache_handles;
+        AZStd::vector<u16> m_fileCache_activeReads;
+
+        RecentlyUsedMetaIndex m_metaDataCache_recentlyUsed;
+        AZStd::vector<RequestPath> m_metaDataCache_paths;
+        AZStd::vector<u64> m_metaDataCache_fileSize;
+
+        AZStd::unique_ptr<IoUring> m_ioUring;
+        //! Read slots that were queued on io_uring since the last submission.
+        AZStd::vector<size_t> m_ioUringBatch;
+        //! The number of pread tasks that have been submitted to the task executor and haven't finished yet.
+        AZStd::atomic<u32> m_pendingReadTasks{ 0 };
+
+        AZ::TaskDescriptor m_readTaskDescriptor;
+        AZ::TaskExecutor& m_taskExecutor;
+
+        size_t m_activeReads_ByteCount{ 0 };
+
+        size_t m_physicalSectorSize{ 0 };
+        size_t m_logicalSectorSize{ 0 };
+        u64 m_activeOffset{ 0 };
+        u32 m_activeCacheSlot{ InvalidFileCacheIndex };
+        u32 m_maxFileHandles{ 1 };
+        u32 m_ioChannelCount{ 1 };
+        s32 m_overCommit{ 0 };
+
+        u16 m_activeReads_Count{ 0 };
+
+        ConstructionOptions m_constructionOptions;
+        bool m_cachesInitialized{ false };
+    };
+} // namespace AZ::IO
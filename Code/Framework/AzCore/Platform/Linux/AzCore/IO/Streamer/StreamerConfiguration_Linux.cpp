@@ -0,0 +1,150 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <stdio.h>
+#include <sys/stat.h>
+#include <sys/sysmacros.h>
+
+#include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/IO/IStreamerTypes.h>
+#include <AzCore/IO/Path/Path.h>
+#include <AzCore/IO/Streamer/StorageDriveConfig_Linux.h>
+#include <AzCore/IO/Streamer/StreamerConfiguration_Linux.h>
+#include <AzCore/Settings/SettingsRegistry.h>
+#include <AzCore/Settings/SettingsRegistryMergeUtils.h>
+#include <AzCore/Settings/SettingsRegistryVisitorUtils.h>
+#include <AzCore/std/containers/unordered_set.h>
+#include <AzCore/std/string/string.h>
+
+namespace AZ::IO
+{
+    static bool ReadSysFsValue(const AZStd::string& path, u64& value)
+    {
+        FILE* file = fopen(path.c_str(), "r");
+        if (!file)
+        {
+            return false;
+        }
+        unsigned long long result = 0;
+        bool success = fscanf(file, "%llu", &result) == 1;
+        fclose(file);
+        if (success)
+        {
+            value = result;
+        }
+        return success;
+    }
+
+    static bool CollectDeviceInfo(dev_t device, LinuxDriveInformation& information, [[maybe_unused]] const char* path, bool reportHardware)
+    {
+        // Partitions don't have a queue folder, but their parent device does.
+        AZStd::string devicePath = AZStd::string::format("/sys/dev/block/%u:%u/", major(device), minor(device));
+        AZStd::string queuePath = devicePath + "queue/";
+        u64 value = 0;
+        if (!ReadSysFsValue(queuePath + "logical_block_size", value))
+        {
+            queuePath = devicePath + "../queue/";
+            if (!ReadSysFsValue(queuePath + "logical_block_size", value))
+            {
+                if (reportHardware)
+                {
+                    AZ_Trace("Streamer", "Skipping '%s' because it's not backed by a block device.\n", path);
+                }
+                return false;
+            }
+        }
+        size_t logicalSectorSize = aznumeric_caster(value);
+        size_t physicalSectorSize = logicalSectorSize;
+        if (ReadSysFsValue(queuePath + "physical_block_size", value))
+        {
+            physicalSectorSize = aznumeric_caster(value);
+        }
+        u32 ioChannelCount = 0;
+        if (ReadSysFsValue(queuePath + "nr_requests", value))
+        {
+            ioChannelCount = aznumeric_caster(value);
+        }
+        bool hasSeekPenalty = ReadSysFsValue(queuePath + "rotational", value) && value != 0;
+
+        if (reportHardware)
+        {
+            AZ_Trace(
+                "Streamer",
+                "Block device %u:%u for '%s':\n"
+                "    Physical sector size: %zu bytes\n"
+                "    Logical sector size: %zu bytes\n"
+                "    Queue depth: %u\n"
+                "    Has seek penalty: %s\n",
+                major(device), minor(device), path, physicalSectorSize, logicalSectorSize, ioChannelCount,
+                hasSeekPenalty ? "Yes" : "No");
+        }
+
+        // A single drive entry serves all devices so use the strictest requirements.
+        information.m_physicalSectorSize = AZStd::max(information.m_physicalSectorSize, physicalSectorSize);
+        information.m_logicalSectorSize = AZStd::max(information.m_logicalSectorSize, logicalSectorSize);
+        information.m_ioChannelCount = information.m_ioChannelCount == 0 ? ioChannelCount
+            : AZStd::min(information.m_ioChannelCount, ioChannelCount);
+        information.m_hasSeekPenalty = information.m_hasSeekPenalty || hasSeekPenalty;
+        return true;
+    }
+
+    static bool CollectHardwareInfo(HardwareInformation& hardwareInfo, bool reportHardware)
+    {
+        auto settingsRegistry = SettingsRegistry::Get();
+        if (!settingsRegistry)
+        {
+            return false;
+        }
+
+        LinuxDriveInformation driveInformation;
+        AZStd::unordered_set<dev_t> visitedDevices;
+        bool foundDevice = false;
+        auto CollectDevice = [&](const AZ::SettingsRegistryInterface::VisitArgs& visitArgs)
+        {
+            AZ::IO::FixedMaxPath runtimePath;
+            struct stat pathStat;
+            if (visitArgs.m_registry.Get(runtimePath.Native(), visitArgs.m_jsonKeyPath) &&
+                ::stat(runtimePath.c_str(), &pathStat) == 0 && visitedDevices.insert(pathStat.st_dev).second)
+            {
+                foundDevice = CollectDeviceInfo(pathStat.st_dev, driveInformation, runtimePath.c_str(), reportHardware) || foundDevice;
+            }
+            return AZ::SettingsRegistryInterface::VisitResponse::Skip;
+        };
+        AZ::SettingsRegistryVisitorUtils::VisitObject(*settingsRegistry, CollectDevice, SettingsRegistryMergeUtils::FilePathsRootKey);
+
+        if (foundDevice)
+        {
+            hardwareInfo.m_maxPhysicalSectorSize = AZStd::max(hardwareInfo.m_maxPhysicalSectorSize, driveInformation.m_physicalSectorSize);
+            hardwareInfo.m_maxLogicalSectorSize = AZStd::max(hardwareInfo.m_maxLogicalSectorSize, driveInformation.m_logicalSectorSize);
+            hardwareInfo.m_maxPageSize = 4096;
+            hardwareInfo.m_maxTransfer = 512_kib;
+            hardwareInfo.m_profile = "Generic";
+            hardwareInfo.m_platformData = AZStd::make_any<LinuxDriveInformation>(driveInformation);
+        }
+        return foundDevice;
+    }
+
+    bool CollectIoHardwareInformation(HardwareInformation& info, [[maybe_unused]] bool includeAllHardware, bool reportHardware)
+    {
+        if (!CollectHardwareInfo(info, reportHardware))
+        {
+            // The numbers below are based on common defaults from a local hardware survey.
+            info.m_maxPageSize = 4096;
+            info.m_maxTransfer = 512_kib;
+            info.m_maxPhysicalSectorSize = 4096;
+            info.m_maxLogicalSectorSize = 512;
+            info.m_profile = "Generic";
+        }
+        return true;
+    }
+
+    void ReflectNative(ReflectContext* context)
+    {
+        LinuxStorageDriveConfig::Reflect(context);
+    }
+} // namespace AZ::IO
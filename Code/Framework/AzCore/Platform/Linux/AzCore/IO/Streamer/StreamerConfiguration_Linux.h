@@ -0,0 +1,26 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/base.h>
+#include <AzCore/Memory/Memory.h>
+
+namespace AZ::IO
+{
+    //! Combined information about the block devices that back the paths used by the engine.
+    struct AZCORE_API LinuxDriveInformation
+    {
+        AZ_TYPE_INFO(AZ::IO::LinuxDriveInformation, "{5C7A4E0B-8F62-4B0E-9E0C-7D2F58C1A3E6}");
+
+        size_t m_physicalSectorSize{ AZCORE_GLOBAL_NEW_ALIGNMENT };
+        size_t m_logicalSectorSize{ AZCORE_GLOBAL_NEW_ALIGNMENT };
+        u32 m_ioChannelCount{ 0 };
+        bool m_hasSeekPenalty{ false };
+    };
+} // namespace AZ::IO
@@ -0,0 +1,151 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Compression/SeekableZStd.h>
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Jobs/JobManager.h>
+#include <AzCore/Jobs/JobManagerDesc.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/std/containers/vector.h>
+
+#include <zstd.h>
+
+namespace UnitTest
+{
+    class SeekableZStdTests
+        : public LeakDetectionFixture
+    {
+    public:
+        static constexpr size_t FrameSize = 1024;
+
+        void SetUp() override
+        {
+            LeakDetectionFixture::SetUp();
+
+            // Data that compresses well, but where every frame is different.
+            m_uncompressed.resize(FrameSize * 10 + 123);
+            for (size_t i = 0; i < m_uncompressed.size(); ++i)
+            {
+                m_uncompressed[i] = static_cast<AZ::u8>((i / 7) ^ (i >> 10));
+            }
+
+            m_compressed.resize(AZ::SeekableZStd::CompressBound(m_uncompressed.size(), FrameSize));
+            size_t compressedSize = AZ::SeekableZStd::Compress(
+                m_compressed.data(), m_compressed.size(), m_uncompressed.data(), m_uncompressed.size(), 1, FrameSize);
+            ASSERT_NE(0u, compressedSize);
+            m_compressed.resize(compressedSize);
+
+            const AZ::u8* footer = m_compressed.data() + m_compressed.size() - AZ::SeekableZStd::SeekTableFooterSize;
+            size_t seekTableSize = AZ::SeekableZStd::SeekTable::GetSeekTableSize(footer);
+            ASSERT_NE(0u, seekTableSize);
+            ASSERT_TRUE(m_seekTable.Load(m_compressed.data() + m_compressed.size() - seekTableSize, seekTableSize));
+        }
+
+        void TearDown() override
+        {
+            m_uncompressed = {};
+            m_compressed = {};
+            m_seekTable = {};
+
+            LeakDetectionFixture::TearDown();
+        }
+
+        void DecompressAndVerify(AZ::u64 offset, AZ::u64 size, AZ::JobContext* jobContext = nullptr)
+        {
+            const AZStd::vector<AZ::SeekableZStd::Frame>& frames = m_seekTable.GetFrames();
+            auto [first, last] = m_seekTable.FindFrames(offset, size);
+            const AZ::u8* compressedFrames = m_compressed.data() + frames[first].m_compressedOffset;
+            size_t compressedSize = frames[last].m_compressedOffset + frames[last].m_compressedSize - frames[first].m_compressedOffset;
+
+            AZStd::vector<AZ::u8> output(size);
+            ASSERT_TRUE(AZ::SeekableZStd::DecompressRange(
+                m_seekTable, compressedFrames, compressedSize, offset, size, output.data(), jobContext));
+            EXPECT_EQ(0, memcmp(output.data(), m_uncompressed.data() + offset, size));
+        }
+
+    protected:
+        AZStd::vector<AZ::u8> m_uncompressed;
+        AZStd::vector<AZ::u8> m_compressed;
+        AZ::SeekableZStd::SeekTable m_seekTable;
+    };
+
+    TEST_F(SeekableZStdTests, Load_CompressedData_SeekTableMatchesData)
+    {
+        EXPECT_EQ(11u, m_seekTable.GetFrames().size());
+        EXPECT_EQ(m_uncompressed.size(), m_seekTable.GetDecompressedSize());
+        EXPECT_TRUE(AZ::SeekableZStd::IsSeekable(m_compressed.data(), m_compressed.size()));
+    }
+
+    TEST_F(SeekableZStdTests, IsSeekable_RegularZStdData_ReturnsFalse)
+    {
+        AZStd::vector<AZ::u8> compressed(ZSTD_compressBound(m_uncompressed.size()));
+        size_t compressedSize = ZSTD_compress(compressed.data(), compressed.size(), m_uncompressed.data(), m_uncompressed.size(), 1);
+        ASSERT_FALSE(ZSTD_isError(compressedSize));
+        EXPECT_FALSE(AZ::SeekableZStd::IsSeekable(compressed.data(), compressedSize));
+    }
+
+    TEST_F(SeekableZStdTests, Decompress_RegularZStdDecoder_DecompressesAllFrames)
+    {
+        // The seek table is stored in a skippable frame, so a regular decoder can still decompress the whole container.
+        AZStd::vector<AZ::u8> output(m_uncompressed.size());
+        size_t result = ZSTD_decompress(output.data(), output.size(), m_compressed.data(), m_compressed.size());
+        ASSERT_FALSE(ZSTD_isError(result));
+        EXPECT_EQ(m_uncompressed.size(), result);
+        EXPECT_EQ(0, memcmp(output.data(), m_uncompressed.data(), output.size()));
+    }
+
+    TEST_F(SeekableZStdTests, FindFrames_RangeWithinOneFrame_ReturnsSingleFrame)
+    {
+        auto [first, last] = m_seekTable.FindFrames(FrameSize * 2 + 10, 100);
+        EXPECT_EQ(2u, first);
+        EXPECT_EQ(2u, last);
+    }
+
+    TEST_F(SeekableZStdTests, FindFrames_RangeAcrossFrames_ReturnsOverlappingFrames)
+    {
+        auto [first, last] = m_seekTable.FindFrames(FrameSize - 1, FrameSize * 2 + 2);
+        EXPECT_EQ(0u, first);
+        EXPECT_EQ(3u, last);
+    }
+
+    TEST_F(SeekableZStdTests, DecompressRange_FullRange_MatchesUncompressedData)
+    {
+        DecompressAndVerify(0, m_uncompressed.size());
+    }
+
+    TEST_F(SeekableZStdTests, DecompressRange_PartialFrames_MatchesUncompressedData)
+    {
+        DecompressAndVerify(FrameSize / 2, FrameSize * 3);
+        DecompressAndVerify(FrameSize * 4 + 1, 10);
+        DecompressAndVerify(m_uncompressed.size() - 50, 50);
+    }
+
+    TEST_F(SeekableZStdTests, DecompressRange_MissingFrames_Fails)
+    {
+        AZStd::vector<AZ::u8> output(FrameSize * 2);
+        AZ_TEST_START_TRACE_SUPPRESSION;
+        EXPECT_FALSE(AZ::SeekableZStd::DecompressRange(
+            m_seekTable, m_compressed.data(), m_seekTable.GetFrames()[0].m_compressedSize, 0, output.size(), output.data()));
+        AZ_TEST_STOP_TRACE_SUPPRESSION(1);
+    }
+
+    TEST_F(SeekableZStdTests, DecompressRange_OnJobContext_MatchesUncompressedData)
+    {
+        AZ::JobManagerDesc desc;
+        AZ::JobManagerThreadDesc threadDesc;
+        for (int i = 0; i < 4; ++i)
+        {
+            desc.m_workerThreads.push_back(threadDesc);
+        }
+        AZ::JobManager jobManager(desc);
+        AZ::JobContext jobContext(jobManager);
+
+        DecompressAndVerify(0, m_uncompressed.size(), &jobContext);
+        DecompressAndVerify(FrameSize / 2, FrameSize * 7, &jobContext);
+    }
+} // namespace UnitTest
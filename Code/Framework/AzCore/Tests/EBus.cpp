@@ -1844,6 +1844,188 @@ namespace UnitTest
 
     }
 
+    namespace LockFreeQueueTest
+    {
+        class LockFreeQueueEvents
+            : public EBusTraits
+        {
+        public:
+            //////////////////////////////////////////////////////////////////////////
+            // EBusTraits overrides
+            using MutexType = AZStd::mutex;
+            static const bool EnableEventQueue = true;
+            static const bool EnableLockFreeEventQueue = true;
+            // Keep the ring small so the tests also go through the overflow queue.
+            static const size_t LockFreeEventQueueCapacity = 16;
+            //////////////////////////////////////////////////////////////////////////
+            virtual ~LockFreeQueueEvents() = default;
+            virtual void OnValue(int thread, int value) = 0;
+            virtual void OnString(const AZStd::string& value) = 0;
+        };
+        using LockFreeQueueBus = AZ::EBus<LockFreeQueueEvents>;
+
+        class LockFreeQueueHandler
+            : public LockFreeQueueBus::Handler
+        {
+        public:
+            static constexpr int NumThreads = 4;
+
+            LockFreeQueueHandler()
+            {
+                BusConnect();
+            }
+
+            ~LockFreeQueueHandler() override
+            {
+                BusDisconnect();
+            }
+
+            void OnValue(int thread, int value) override
+            {
+                if (value != m_nextValue[thread])
+                {
+                    m_inOrder = false;
+                }
+                m_nextValue[thread] = value + 1;
+                ++m_callCount;
+            }
+
+            void OnString(const AZStd::string& value) override
+            {
+                m_strings.push_back(value);
+            }
+
+            int m_nextValue[NumThreads] = {};
+            int m_callCount = 0;
+            bool m_inOrder = true;
+            AZStd::vector<AZStd::string> m_strings;
+        };
+    }
+
+    class LockFreeQueueEbusTest
+        : public LeakDetectionFixture
+    {
+    };
+
+    TEST_F(LockFreeQueueEbusTest, QueueBroadcast_MultipleThreads_AllEventsExecutedInOrderPerThread)
+    {
+        using namespace LockFreeQueueTest;
+        constexpr int NumEvents = 10000;
+
+        LockFreeQueueHandler handler;
+        AZStd::atomic_int finishedThreads{ 0 };
+        AZStd::thread threads[LockFreeQueueHandler::NumThreads];
+        for (int i = 0; i < LockFreeQueueHandler::NumThreads; ++i)
+        {
+            threads[i] = AZStd::thread([i, &finishedThreads]()
+            {
+                for (int value = 0; value < NumEvents; ++value)
+                {
+                    LockFreeQueueBus::QueueBroadcast(&LockFreeQueueBus::Events::OnValue, i, value);
+                }
+                ++finishedThreads;
+            });
+        }
+
+        while (finishedThreads < LockFreeQueueHandler::NumThreads)
+        {
+            LockFreeQueueBus::ExecuteQueuedEvents();
+            AZStd::this_thread::yield();
+        }
+        for (AZStd::thread& thread : threads)
+        {
+            thread.join();
+        }
+        LockFreeQueueBus::ExecuteQueuedEvents();
+
+        EXPECT_EQ(NumEvents * LockFreeQueueHandler::NumThreads, handler.m_callCount);
+        EXPECT_TRUE(handler.m_inOrder);
+        EXPECT_EQ(0u, LockFreeQueueBus::QueuedEventCount());
+    }
+
+    TEST_F(LockFreeQueueEbusTest, QueueBroadcast_OneThreadAcrossOverflow_ExecutedInOrder)
+    {
+        using namespace LockFreeQueueTest;
+        constexpr int NumRounds = 50;
+        constexpr int NumEvents = 20000;
+
+        // A single thread queues while the queue is executed, so it keeps moving between the ring and the overflow queue. Executing
+        // the queue must never run a call from the ring that was queued after a call in the overflow queue. The window for that is
+        // small, so it's repeated a number of times.
+        for (int round = 0; round < NumRounds; ++round)
+        {
+            LockFreeQueueHandler handler;
+            AZStd::atomic_bool finished{ false };
+            AZStd::thread thread([&finished]()
+            {
+                for (int value = 0; value < NumEvents; ++value)
+                {
+                    LockFreeQueueBus::QueueBroadcast(&LockFreeQueueBus::Events::OnValue, 0, value);
+                }
+                finished = true;
+            });
+
+            while (!finished)
+            {
+                LockFreeQueueBus::ExecuteQueuedEvents();
+            }
+            thread.join();
+            LockFreeQueueBus::ExecuteQueuedEvents();
+
+            EXPECT_EQ(NumEvents, handler.m_callCount);
+            ASSERT_TRUE(handler.m_inOrder);
+            EXPECT_EQ(0u, LockFreeQueueBus::QueuedEventCount());
+        }
+    }
+
+    TEST_F(LockFreeQueueEbusTest, QueueBroadcast_ArgumentsLargerThanCell_ExecutedAndReleased)
+    {
+        using namespace LockFreeQueueTest;
+
+        LockFreeQueueHandler handler;
+        const AZStd::string longString(256, 'x');
+        LockFreeQueueBus::QueueBroadcast(&LockFreeQueueBus::Events::OnString, longString);
+        LockFreeQueueBus::QueueFunction([longString, &handler]()
+        {
+            handler.m_strings.push_back(longString + longString);
+        });
+        EXPECT_EQ(2u, LockFreeQueueBus::QueuedEventCount());
+
+        LockFreeQueueBus::ExecuteQueuedEvents();
+        ASSERT_EQ(2u, handler.m_strings.size());
+        EXPECT_EQ(longString, handler.m_strings[0]);
+        EXPECT_EQ(longString.size() * 2, handler.m_strings[1].size());
+
+        // Events that are cleared are destroyed without being executed.
+        LockFreeQueueBus::QueueBroadcast(&LockFreeQueueBus::Events::OnString, longString);
+        LockFreeQueueBus::ClearQueuedEvents();
+        LockFreeQueueBus::ExecuteQueuedEvents();
+        EXPECT_EQ(2u, handler.m_strings.size());
+    }
+
+    TEST_F(LockFreeQueueEbusTest, QueueFunction_QueuedWhileExecuting_ExecutedOnNextExecute)
+    {
+        using namespace LockFreeQueueTest;
+
+        LockFreeQueueHandler handler;
+        // Queue more events than fit in the ring from inside a queued function.
+        LockFreeQueueBus::QueueFunction([]()
+        {
+            for (int value = 0; value < 40; ++value)
+            {
+                LockFreeQueueBus::QueueBroadcast(&LockFreeQueueBus::Events::OnValue, 0, value);
+            }
+        });
+
+        LockFreeQueueBus::ExecuteQueuedEvents();
+        EXPECT_EQ(0, handler.m_callCount);
+        EXPECT_EQ(40u, LockFreeQueueBus::QueuedEventCount());
+
+        LockFreeQueueBus::ExecuteQueuedEvents();
+        EXPECT_EQ(40, handler.m_callCount);
+        EXPECT_TRUE(handler.m_inOrder);
+    }
+
     class ConnectDisconnectInterface
         : public EBusTraits
     {
@@ -4805,6 +4987,67 @@ namespace Benchmark
         }
     }
     BENCHMARK(BM_EBus_Multithreaded_Lockless)->Apply(&BenchmarkSettings::OneToMany)->Apply(&BenchmarkSettings::Multithreaded);
+
+    //////////////////////////////////////////////////////////////////////////
+    // Multithreaded Queuing
+    //////////////////////////////////////////////////////////////////////////
+
+    namespace QueueContention
+    {
+        template <bool lockFree>
+        class QueueEvents
+            : public AZ::EBusTraits
+        {
+        public:
+            using MutexType = AZStd::mutex;
+            static const bool EnableEventQueue = true;
+            static const bool EnableLockFreeEventQueue = lockFree;
+            static const size_t LockFreeEventQueueCapacity = 4096;
+
+            virtual ~QueueEvents() = default;
+            virtual void OnValue(int value) = 0;
+        };
+
+        template <bool lockFree>
+        using QueueBus = AZ::EBus<QueueEvents<lockFree>>;
+
+        // All threads queue events at the same time while the first thread also executes the queue, which is how a bus that
+        // worker threads report to is typically used.
+        template <bool lockFree>
+        void QueueBroadcast(::benchmark::State& state)
+        {
+            using Bus = QueueBus<lockFree>;
+            constexpr int ExecuteInterval = 256;
+
+            int queued = 0;
+            while (state.KeepRunning())
+            {
+                Bus::QueueBroadcast(&Bus::Events::OnValue, queued++);
+                if (state.thread_index() == 0 && (queued % ExecuteInterval) == 0)
+                {
+                    Bus::ExecuteQueuedEvents();
+                }
+            }
+
+            if (state.thread_index() == 0)
+            {
+                Bus::ClearQueuedEvents();
+            }
+            state.SetItemsProcessed(state.iterations());
+        }
+    }
+
+    static void BM_EBus_Multithreaded_QueueBroadcast(::benchmark::State& state)
+    {
+        QueueContention::QueueBroadcast<false>(state);
+    }
+    BENCHMARK(BM_EBus_Multithreaded_QueueBroadcast)->Apply(&BenchmarkSettings::Common)->Apply(&BenchmarkSettings::Multithreaded);
+
+    static void BM_EBus_Multithreaded_LockFreeQueueBroadcast(::benchmark::State& state)
+    {
+        QueueContention::QueueBroadcast<true>(state);
+    }
+    BENCHMARK(BM_EBus_Multithreaded_LockFreeQueueBroadcast)->Apply(&BenchmarkSettings::Common)->Apply(&BenchmarkSettings::Multithreaded);
 }
 
 #endif // HAVE_BENCHMARK
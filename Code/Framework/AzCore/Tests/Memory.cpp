@@ -9,6 +9,7 @@
 #include <AzCore/Memory/SystemAllocator.h>
 #include <AzCore/Memory/PoolAllocator.h>
 #include <AzCore/Memory/HphaAllocator.h>
+#include <AzCore/Memory/FrameArenaAllocator.h>
 
 #include <AzCore/Memory/AllocationRecords.h>
 #include <AzCore/Debug/StackTracer.h>
@@ -719,6 +720,205 @@ namespace UnitTest
         run();
     }
 
+    /**
+     * Tests FrameArenaAllocator
+     */
+    class FrameArenaAllocatorTest
+        : public LeakDetectionFixture
+    {
+    public:
+        static constexpr size_t BufferSize = 4 * 1024;
+    };
+
+    TEST_F(FrameArenaAllocatorTest, Allocate_RespectsAlignmentAndKeepsSize)
+    {
+        AZ::FrameArenaAllocator allocator(BufferSize);
+        void* first = allocator.allocate(24, 8);
+        void* second = allocator.allocate(100, 64);
+        ASSERT_NE(nullptr, first);
+        ASSERT_NE(nullptr, second);
+        EXPECT_EQ(0, reinterpret_cast<size_t>(second) & 63);
+        EXPECT_EQ(24, allocator.get_allocated_size(first));
+        EXPECT_EQ(100, allocator.get_allocated_size(second));
+        EXPECT_EQ(124, allocator.NumAllocatedBytes());
+    }
+
+    TEST_F(FrameArenaAllocatorTest, AdvanceFrame_KeepsPreviousFrameAndReusesOlderFrames)
+    {
+        AZ::FrameArenaAllocator allocator(BufferSize);
+        void* frame0 = allocator.allocate(64, 16);
+        memset(frame0, 0xAB, 64);
+
+        allocator.AdvanceFrame();
+        void* frame1 = allocator.allocate(64, 16);
+        // Memory of the previous frame is still valid and isn't handed out again.
+        EXPECT_NE(frame0, frame1);
+        EXPECT_EQ(0xAB, static_cast<AZ::u8*>(frame0)[63]);
+        EXPECT_EQ(128, allocator.NumAllocatedBytes());
+
+        allocator.AdvanceFrame();
+        void* frame2 = allocator.allocate(64, 16);
+        // The buffer of frame 0 is reused.
+        EXPECT_EQ(frame0, frame2);
+        EXPECT_EQ(128, allocator.NumAllocatedBytes());
+    }
+
+    TEST_F(FrameArenaAllocatorTest, Deallocate_LastAllocation_IsReused)
+    {
+        AZ::FrameArenaAllocator allocator(BufferSize);
+        void* first = allocator.allocate(32, 16);
+        void* second = allocator.allocate(32, 16);
+        allocator.deallocate(second);
+        EXPECT_EQ(second, allocator.allocate(32, 16));
+
+        // Deallocating anything but the last allocation is ignored.
+        allocator.deallocate(first);
+        EXPECT_NE(first, allocator.allocate(32, 16));
+    }
+
+    TEST_F(FrameArenaAllocatorTest, Reallocate_LastAllocation_GrowsInPlace)
+    {
+        AZ::FrameArenaAllocator allocator(BufferSize);
+        void* first = allocator.allocate(16, 16);
+        memset(first, 0x5A, 16);
+        void* grown = allocator.reallocate(first, 256, 16);
+        EXPECT_EQ(first, grown);
+        EXPECT_EQ(256, allocator.get_allocated_size(grown));
+
+        [[maybe_unused]] void* other = allocator.allocate(16, 16);
+        void* moved = allocator.reallocate(grown, 512, 16);
+        EXPECT_NE(grown, moved);
+        EXPECT_EQ(0x5A, static_cast<AZ::u8*>(moved)[15]);
+    }
+
+    TEST_F(FrameArenaAllocatorTest, Allocate_MoreThanBuffer_ReportsOverflowAndGrowsBuffer)
+    {
+        AZ::FrameArenaAllocator allocator(BufferSize);
+        for (int i = 0; i < 4; ++i)
+        {
+            EXPECT_NE(nullptr, allocator.allocate(BufferSize / 2, 16));
+        }
+        AZ::FrameArenaAllocator::Statistics stats = allocator.GetStatistics();
+        EXPECT_GT(stats.m_overflowCount, 0);
+        EXPECT_GE(stats.m_overflowBytes, BufferSize / 2);
+
+        // Once the buffer is reused it's big enough for the whole frame.
+        allocator.AdvanceFrame();
+        allocator.AdvanceFrame();
+        for (int i = 0; i < 4; ++i)
+        {
+            EXPECT_NE(nullptr, allocator.allocate(BufferSize / 2, 16));
+        }
+        EXPECT_EQ(stats.m_overflowCount, allocator.GetStatistics().m_overflowCount);
+        EXPECT_GE(allocator.GetStatistics().m_peakFrameBytes, 2 * BufferSize);
+    }
+
+    TEST_F(FrameArenaAllocatorTest, Allocate_FromMultipleThreads_UsesSeparateBuffers)
+    {
+        AZ::FrameArenaAllocator allocator(BufferSize);
+        constexpr int ThreadCount = 4;
+        constexpr int AllocationCount = 1000;
+        AZStd::atomic<int> allocatedThreads{ 0 };
+        AZStd::vector<AZStd::thread> threads;
+        for (int i = 0; i < ThreadCount; ++i)
+        {
+            threads.emplace_back([&allocator, &allocatedThreads, i]()
+            {
+                for (int j = 0; j < AllocationCount; ++j)
+                {
+                    int* value = static_cast<int*>(allocator.allocate(sizeof(int), alignof(int)));
+                    *value = i;
+                    EXPECT_EQ(i, *value);
+                }
+                // Keep every thread alive until all of them allocated, so none of them takes over the buffers of
+                // a thread that already exited.
+                ++allocatedThreads;
+                while (allocatedThreads < ThreadCount)
+                {
+                    AZStd::this_thread::yield();
+                }
+            });
+        }
+        for (AZStd::thread& thread : threads)
+        {
+            thread.join();
+        }
+        EXPECT_EQ(ThreadCount, allocator.GetStatistics().m_threadCount);
+        EXPECT_EQ(ThreadCount * AllocationCount * sizeof(int), allocator.NumAllocatedBytes());
+    }
+
+    TEST_F(FrameArenaAllocatorTest, Allocate_FromShortLivedThreads_ReusesAndReleasesThreadData)
+    {
+        AZ::FrameArenaAllocator allocator(BufferSize);
+        constexpr int ThreadCount = 8;
+        AZStd::vector<int*> values;
+        for (int i = 0; i < ThreadCount; ++i)
+        {
+            AZStd::thread thread([&allocator, &values, i]()
+            {
+                int* value = static_cast<int*>(allocator.allocate(sizeof(int), alignof(int)));
+                *value = i;
+                values.push_back(value);
+            });
+            thread.join();
+        }
+
+        // Every thread took over the buffers of the thread before it, without touching its allocations.
+        EXPECT_EQ(1, allocator.GetStatistics().m_threadCount);
+        for (int i = 0; i < ThreadCount; ++i)
+        {
+            EXPECT_EQ(i, *values[i]);
+        }
+        EXPECT_EQ(ThreadCount * sizeof(int), allocator.NumAllocatedBytes());
+
+        // The buffers are released once they no longer contain memory of the current or the previous frame.
+        allocator.AdvanceFrame();
+        EXPECT_EQ(1, allocator.GetStatistics().m_threadCount);
+        allocator.AdvanceFrame();
+        EXPECT_EQ(0, allocator.GetStatistics().m_threadCount);
+        EXPECT_EQ(0, allocator.GetStatistics().m_reservedBytes);
+    }
+
+    TEST_F(FrameArenaAllocatorTest, Destroy_WhileThreadIsAlive_ThreadReleasesItsDataOnExit)
+    {
+        AZStd::atomic<bool> allocated{ false };
+        AZStd::atomic<bool> destroyed{ false };
+        auto allocator = AZStd::make_unique<AZ::FrameArenaAllocator>(BufferSize);
+        AZStd::thread thread([&allocator, &allocated, &destroyed]()
+        {
+            EXPECT_NE(nullptr, allocator->allocate(64, 16));
+            allocated = true;
+            while (!destroyed)
+            {
+                AZStd::this_thread::yield();
+            }
+            // The thread gets new data from an allocator that's created after the old one was destroyed.
+            allocator = AZStd::make_unique<AZ::FrameArenaAllocator>(BufferSize);
+            EXPECT_NE(nullptr, allocator->allocate(64, 16));
+            EXPECT_EQ(64, allocator->NumAllocatedBytes());
+        });
+        while (!allocated)
+        {
+            AZStd::this_thread::yield();
+        }
+        allocator.reset();
+        destroyed = true;
+        thread.join();
+        EXPECT_EQ(1, allocator->GetStatistics().m_threadCount);
+        EXPECT_EQ(64, allocator->NumAllocatedBytes());
+    }
+
+    TEST_F(FrameArenaAllocatorTest, StdContainer_UsesGlobalFrameArena)
+    {
+        AZStd::vector<int, AZ::FrameArenaStdAllocator> values;
+        for (int i = 0; i < 1000; ++i)
+        {
+            values.push_back(i);
+        }
+        EXPECT_EQ(999, values.back());
+        EXPECT_GT(AZ::AllocatorInstance<AZ::FrameArenaAllocator>::Get().NumAllocatedBytes(), 0);
+    }
+
     /**
      * Tests azmalloc,azmallocex/azfree.
      */
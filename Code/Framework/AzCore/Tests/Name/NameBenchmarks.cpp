@@ -193,4 +193,89 @@ namespace AZ::NameBenchmarks
         state.SetItemsProcessed(state.iterations() * state.range(0));
     }
     BENCHMARK_REGISTER_F(NameBenchmarkFixture, NameLiteralCreateAndDestroy)->Arg(10)->Arg(100)->Arg(1000);
+
+    //! Fixture for measuring lookups of existing names from several threads at once.
+    //! The names are created by the first thread before any thread starts iterating and are kept alive by the fixture.
+    class NameContentionBenchmarkFixture : public NameBenchmarkFixture
+    {
+    public:
+        static constexpr size_t PoolSize = 256;
+
+        void SetUp(const ::benchmark::State& st) override
+        {
+            NameBenchmarkFixture::SetUp(st);
+            CreateSharedNames(st);
+        }
+
+        void SetUp(::benchmark::State& st) override
+        {
+            NameBenchmarkFixture::SetUp(st);
+            CreateSharedNames(st);
+        }
+
+        void TearDown(::benchmark::State& st) override
+        {
+            ReleaseSharedNames(st);
+            NameBenchmarkFixture::TearDown(st);
+        }
+
+        void TearDown(const ::benchmark::State& st) override
+        {
+            ReleaseSharedNames(st);
+            NameBenchmarkFixture::TearDown(st);
+        }
+
+    protected:
+        void CreateSharedNames(const ::benchmark::State& st)
+        {
+            if (st.thread_index() == 0)
+            {
+                for (size_t i = 0; i < PoolSize; ++i)
+                {
+                    m_nameStrings.emplace_back(AZStd::string::format("contended_name%zu", i));
+                    m_sharedNames.emplace_back(m_nameStrings.back());
+                }
+            }
+        }
+
+        void ReleaseSharedNames(const ::benchmark::State& st)
+        {
+            if (st.thread_index() == 0)
+            {
+                m_sharedNames = {};
+                m_nameStrings = {};
+            }
+        }
+
+        AZStd::vector<AZStd::string> m_nameStrings;
+        AZStd::vector<AZ::Name> m_sharedNames;
+    };
+
+    BENCHMARK_DEFINE_F(NameContentionBenchmarkFixture, MakeExistingName)(::benchmark::State& state)
+    {
+        for ([[maybe_unused]] auto var_ : state)
+        {
+            for (const AZStd::string& nameString : m_nameStrings)
+            {
+                benchmark::DoNotOptimize(AZ::Name(nameString));
+            }
+        }
+
+        state.SetItemsProcessed(state.iterations() * PoolSize);
+    }
+    BENCHMARK_REGISTER_F(NameContentionBenchmarkFixture, MakeExistingName)->ThreadRange(1, 16)->UseRealTime();
+
+    BENCHMARK_DEFINE_F(NameContentionBenchmarkFixture, FindNameByHash)(::benchmark::State& state)
+    {
+        for ([[maybe_unused]] auto var_ : state)
+        {
+            for (const AZ::Name& sharedName : m_sharedNames)
+            {
+                benchmark::DoNotOptimize(AZ::Name(sharedName.GetHash()));
+            }
+        }
+
+        state.SetItemsProcessed(state.iterations() * PoolSize);
+    }
+    BENCHMARK_REGISTER_F(NameContentionBenchmarkFixture, FindNameByHash)->ThreadRange(1, 16)->UseRealTime();
 } // namespace AZ::NameBenchmarks
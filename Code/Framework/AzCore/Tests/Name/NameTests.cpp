@@ -19,6 +19,7 @@
 #include <AzCore/Name/NameDictionary.h>
 #include <AzCore/Name/Name.h>
 #include <AzCore/Name/Internal/NameData.h>
+#include <AzCore/Name/Internal/NameDataIndex.h>
 #include <AzCore/Component/ComponentApplication.h>
 #include <AzCore/EBus/EBus.h>
 #include <AzCore/Serialization/ObjectStream.h>
@@ -54,6 +55,11 @@ namespace UnitTest
         {
             return AZ::NameDictionary::Instance().m_dictionary;
         }
+
+        static const AZ::Internal::NameDataIndex& GetIndex()
+        {
+            return *AZ::NameDictionary::Instance().m_index;
+        }
         
         static size_t GetEntryCount()
         {
@@ -673,6 +679,134 @@ namespace UnitTest
         RunConcurrencyTest<ThreadRepeatedlyCreatesAndReleasesOneName<100>>(1, 2);
     }
 
+    TEST_F(NameTest, ConcurrentMakeAndFindName_SameAndCollidingHashes_AllThreadsResolveTheSameNames)
+    {
+        AZ::NameDictionary::Destroy();
+
+        // Only a few hash slots, so most names collide with each other and need their hash to be resolved.
+        ASSERT_EQ(nullptr, AZ::Interface<AZ::NameDictionary>::Get());
+        constexpr AZ::u64 maxHashSlots = 4;
+        AZStd::unique_ptr<AZ::NameDictionary> nameDictionary = AZStd::make_unique<AZ::NameDictionary>(maxHashSlots);
+        AZ::Interface<AZ::NameDictionary>::Register(nameDictionary.get());
+
+        constexpr size_t nameCount = 16;
+        constexpr uint32_t threadCount = 8;
+        constexpr size_t iterationCount = 500;
+
+        AZStd::vector<AZStd::string> nameStrings;
+        for (size_t i = 0; i < nameCount; ++i)
+        {
+            nameStrings.push_back(AZStd::string::format("name%zu", i));
+        }
+
+        AZStd::atomic<uint32_t> readyCount{ 0 };
+        AZStd::atomic<uint32_t> failureCount{ 0 };
+        AZStd::vector<AZStd::thread> threads;
+        for (uint32_t threadIndex = 0; threadIndex < threadCount; ++threadIndex)
+        {
+            threads.emplace_back([&, threadIndex]()
+            {
+                // Start all threads at the same time so they make, find and release the same names concurrently.
+                readyCount.fetch_add(1);
+                while (readyCount.load() < threadCount)
+                {
+                    AZStd::this_thread::yield();
+                }
+
+                for (size_t iteration = 0; iteration < iterationCount; ++iteration)
+                {
+                    const AZStd::string& nameString = nameStrings[(iteration + threadIndex) % nameCount];
+                    AZ::Name name = nameDictionary->MakeName(nameString);
+                    AZ::Name foundName = nameDictionary->FindName(name.GetHash());
+                    if (name.GetStringView() != nameString || foundName != name || foundName.GetStringView() != nameString)
+                    {
+                        failureCount.fetch_add(1);
+                    }
+                }
+            });
+        }
+
+        for (AZStd::thread& thread : threads)
+        {
+            thread.join();
+        }
+
+        EXPECT_EQ(0, failureCount.load());
+
+        // Colliding names are never removed, so their resolved hashes have to be the same for every thread.
+        for (const AZStd::string& nameString : nameStrings)
+        {
+            AZ::Name name = nameDictionary->MakeName(nameString);
+            EXPECT_EQ(nameString, name.GetStringView());
+            EXPECT_EQ(name, nameDictionary->FindName(name.GetHash()));
+        }
+
+        AZ::Interface<AZ::NameDictionary>::Unregister(nameDictionary.get());
+    }
+
+    TEST_F(NameTest, ReleasedName_IsReclaimed_CanBeMadeAndFoundAgain)
+    {
+        const AZ::Internal::NameDataIndex& index = NameDictionaryTester::GetIndex();
+
+        AZ::Name name("reclaimed");
+        const AZ::Name::Hash hash = name.GetHash();
+        EXPECT_EQ(name, AZ::NameDictionary::Instance().FindName(hash));
+
+        // Releasing the last reference removes the name, but the name data is only retired because lock-free readers
+        // could still be looking at it.
+        name = AZ::Name();
+        EXPECT_TRUE(AZ::NameDictionary::Instance().FindName(hash).IsEmpty());
+        EXPECT_EQ(0, NameDictionaryTester::GetEntryCount());
+        EXPECT_GE(index.GetRetiredCount(), 1);
+
+        // No reader is active, so the next modification of the dictionary deletes the retired name data.
+        AZ::Name other("other");
+        EXPECT_EQ(0, index.GetRetiredCount());
+
+        AZ::Name recreated("reclaimed");
+        EXPECT_EQ("reclaimed", recreated.GetStringView());
+        EXPECT_EQ(hash, recreated.GetHash());
+
+        AZ::Name found = AZ::NameDictionary::Instance().FindName(hash);
+        EXPECT_EQ(recreated, found);
+        EXPECT_EQ("reclaimed", found.GetStringView());
+        EXPECT_EQ(2, NameDictionaryTester::GetEntryCount());
+    }
+
+    TEST_F(NameTest, RecentNameCache_HashRemoved_EntryIsInvalidated)
+    {
+        const AZ::Internal::NameDataIndex& index = NameDictionaryTester::GetIndex();
+
+        // Recently made names are cached by the address of the source string, so always make the name from the same buffer.
+        constexpr AZStd::string_view source = "recent";
+        AZ::Name name = AZ::NameDictionary::Instance().MakeName(source);
+        const AZ::Name::Hash hash = name.GetHash();
+        AZ::Internal::NameData* nameData = GetNameData(name);
+
+        // The second time the name is served from the cache.
+        AZ::Name cachedName = AZ::NameDictionary::Instance().MakeName(source);
+        EXPECT_EQ(nameData, GetNameData(cachedName));
+
+        // Removing the name bumps the removal count of its hash, which invalidates the cached entry. Making another name
+        // reclaims the removed name data, so a cache hit on the stale entry would access deleted memory.
+        const uint64_t removalCount = index.GetRemovalCount(hash);
+        name = AZ::Name();
+        cachedName = AZ::Name();
+        EXPECT_EQ(removalCount + 1, index.GetRemovalCount(hash));
+        AZ::Name other("other");
+        EXPECT_EQ(0, index.GetRetiredCount());
+
+        AZ::Name recreated = AZ::NameDictionary::Instance().MakeName(source);
+        EXPECT_EQ(source, recreated.GetStringView());
+        EXPECT_EQ(hash, recreated.GetHash());
+        EXPECT_EQ(recreated, AZ::NameDictionary::Instance().FindName(hash));
+        EXPECT_EQ(2, NameDictionaryTester::GetEntryCount());
+
+        // The recreated name is cached again.
+        AZ::Name cachedRecreated = AZ::NameDictionary::Instance().MakeName(source);
+        EXPECT_EQ(GetNameData(recreated), GetNameData(cachedRecreated));
+    }
+
     TEST_F(NameTest, NameRef)
     {
         AZ::NameRef fromRValue = AZ::Name("test");
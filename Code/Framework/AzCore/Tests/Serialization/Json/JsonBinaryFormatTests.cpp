@@ -0,0 +1,430 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/IO/ByteContainerStream.h>
+#include <AzCore/Serialization/Json/JsonBinaryFormat.h>
+#include <AzCore/Serialization/Json/JsonUtils.h>
+#include <AzCore/UnitTest/TestTypes.h>
+
+#include <AzTest/AzTest.h>
+
+namespace UnitTest
+{
+    using namespace AZ;
+
+    namespace JsonBinaryFormatTestsInternal
+    {
+        static constexpr const char* AllValueTypes = R"({
+            "$type": "{5A6E3C1B-4A0E-4D0F-9B4F-1C0D2E3F4A5B} TestType",
+            "null": null,
+            "true": true,
+            "false": false,
+            "zero": 0,
+            "small": 42,
+            "negative": -1234567,
+            "int64": -9223372036854775807,
+            "uint64": 18446744073709551615,
+            "double": 3.25,
+            "negativeDouble": -0.001,
+            "string": "Hello world",
+            "emptyString": "",
+            "emptyArray": [],
+            "emptyObject": {},
+            "array": [ 1, "two", 3.0, [ 4 ], { "five": 5 } ],
+            "components": [
+                { "$type": "ComponentA", "id": 1, "string": "a" },
+                { "$type": "ComponentB", "id": 2, "string": "b" },
+                { "$type": "ComponentA", "id": 3, "string": "c" }
+            ]
+        })";
+
+        static rapidjson::Document Parse(const char* text)
+        {
+            rapidjson::Document document;
+            document.Parse(text);
+            EXPECT_FALSE(document.HasParseError());
+            return document;
+        }
+
+        static AZStd::vector<u8> Encode(const rapidjson::Value& value)
+        {
+            AZStd::vector<u8> binary;
+            auto result = JsonBinaryFormat::Write(value, binary);
+            EXPECT_TRUE(result.IsSuccess());
+            return binary;
+        }
+    } // namespace JsonBinaryFormatTestsInternal
+
+    class JsonBinaryFormatTests
+        : public LeakDetectionFixture
+    {
+    };
+
+    TEST_F(JsonBinaryFormatTests, WriteRead_AllValueTypes_DocumentIsIdentical)
+    {
+        using namespace JsonBinaryFormatTestsInternal;
+
+        rapidjson::Document original = Parse(AllValueTypes);
+        AZStd::vector<u8> binary = Encode(original);
+        EXPECT_TRUE(JsonBinaryFormat::IsBinaryJson(binary));
+
+        auto result = JsonBinaryFormat::Read(binary);
+        ASSERT_TRUE(result.IsSuccess()) << result.GetError().c_str();
+        const rapidjson::Document& decoded = result.GetValue();
+        EXPECT_TRUE(original == decoded);
+
+        // Member order and number types have to be kept so the text form is the same as well.
+        AZStd::string originalText;
+        AZStd::string decodedText;
+        EXPECT_TRUE(JsonSerializationUtils::WriteJsonString(original, originalText).IsSuccess());
+        EXPECT_TRUE(JsonSerializationUtils::WriteJsonString(decoded, decodedText).IsSuccess());
+        EXPECT_STREQ(originalText.c_str(), decodedText.c_str());
+
+        EXPECT_TRUE(decoded["int64"].IsInt64());
+        EXPECT_TRUE(decoded["uint64"].IsUint64());
+        EXPECT_EQ(18446744073709551615ull, decoded["uint64"].GetUint64());
+        EXPECT_TRUE(decoded["double"].IsDouble());
+    }
+
+    TEST_F(JsonBinaryFormatTests, WriteRead_RootIsNotAnObject_DocumentIsIdentical)
+    {
+        using namespace JsonBinaryFormatTestsInternal;
+
+        for (const char* text : { "[ 1, 2, 3 ]", "\"string\"", "12", "null" })
+        {
+            rapidjson::Document original = Parse(text);
+            auto result = JsonBinaryFormat::Read(Encode(original));
+            ASSERT_TRUE(result.IsSuccess()) << result.GetError().c_str();
+            EXPECT_TRUE(original == result.GetValue()) << text;
+        }
+    }
+
+    TEST_F(JsonBinaryFormatTests, Write_RepeatedKeysAndTypes_StoredOnce)
+    {
+        using namespace JsonBinaryFormatTestsInternal;
+
+        AZStd::string text = "[";
+        for (int i = 0; i < 100; ++i)
+        {
+            text += R"({ "$type": "{5A6E3C1B-4A0E-4D0F-9B4F-1C0D2E3F4A5B} TransformComponent", "Parent Entity": ""})";
+            text += (i < 99) ? "," : "]";
+        }
+        rapidjson::Document original = Parse(text.c_str());
+        AZStd::vector<u8> binary = Encode(original);
+
+        // Each element only needs a few bytes for the key and type index, so the binary form is much smaller than one
+        // copy of the type name per element.
+        EXPECT_LT(binary.size(), text.size() / 10);
+
+        auto result = JsonBinaryFormat::Read(binary);
+        ASSERT_TRUE(result.IsSuccess());
+        EXPECT_TRUE(original == result.GetValue());
+    }
+
+    TEST_F(JsonBinaryFormatTests, Read_ValuesCopiedIntoOtherDocument_OutliveDecodedDocument)
+    {
+        using namespace JsonBinaryFormatTestsInternal;
+
+        rapidjson::Document target(rapidjson::kObjectType);
+        {
+            auto result = JsonBinaryFormat::Read(Encode(Parse(AllValueTypes)));
+            ASSERT_TRUE(result.IsSuccess()) << result.GetError().c_str();
+            // Copying values into another document, as merging and patching do, keeps constant strings by pointer.
+            rapidjson::Value components;
+            components.CopyFrom(result.GetValue()["components"], target.GetAllocator());
+            target.AddMember("components", components, target.GetAllocator());
+        }
+
+        rapidjson::Document expected = Parse(AllValueTypes);
+        EXPECT_TRUE(expected["components"] == target["components"]);
+    }
+
+    TEST_F(JsonBinaryFormatTests, Read_TruncatedData_FailsWithoutCrashing)
+    {
+        using namespace JsonBinaryFormatTestsInternal;
+
+        rapidjson::Document original = Parse(AllValueTypes);
+        AZStd::vector<u8> binary = Encode(original);
+        for (size_t size = 0; size < binary.size(); ++size)
+        {
+            auto result = JsonBinaryFormat::Read(AZStd::span<const u8>(binary.data(), size));
+            EXPECT_FALSE(result.IsSuccess()) << "Truncated data of " << size << " bytes was accepted.";
+        }
+    }
+
+    TEST_F(JsonBinaryFormatTests, Read_UnsupportedVersion_Fails)
+    {
+        using namespace JsonBinaryFormatTestsInternal;
+
+        AZStd::vector<u8> binary = Encode(Parse(AllValueTypes));
+        binary[AZ_ARRAY_SIZE(JsonBinaryFormat::Signature)] = static_cast<u8>(JsonBinaryFormat::Version + 1);
+        EXPECT_FALSE(JsonBinaryFormat::Read(binary).IsSuccess());
+    }
+
+    TEST_F(JsonBinaryFormatTests, IsBinaryJson_TextJson_ReturnsFalse)
+    {
+        AZStd::string_view text = R"({ "AZJB": 1 })";
+        EXPECT_FALSE(JsonBinaryFormat::IsBinaryJson(AZStd::span<const u8>(reinterpret_cast<const u8*>(text.data()), text.size())));
+        EXPECT_FALSE(JsonBinaryFormat::IsBinaryJson(AZStd::span<const u8>()));
+    }
+
+    TEST_F(JsonBinaryFormatTests, WriteJsonStream_BinaryFormat_ReadBackWithJsonUtils)
+    {
+        using namespace JsonBinaryFormatTestsInternal;
+
+        rapidjson::Document original = Parse(AllValueTypes);
+
+        JsonSerializationUtils::WriteJsonSettings settings;
+        settings.m_binaryFormat = true;
+        AZStd::string binaryText;
+        ASSERT_TRUE(JsonSerializationUtils::WriteJsonString(original, binaryText, settings).IsSuccess());
+
+        auto stringResult = JsonSerializationUtils::ReadJsonString(binaryText);
+        ASSERT_TRUE(stringResult.IsSuccess()) << stringResult.GetError().c_str();
+        EXPECT_TRUE(original == stringResult.GetValue());
+
+        IO::ByteContainerStream<AZStd::string> stream(&binaryText);
+        auto streamResult = JsonSerializationUtils::ReadJsonStream(stream);
+        ASSERT_TRUE(streamResult.IsSuccess()) << streamResult.GetError().c_str();
+        EXPECT_TRUE(original == streamResult.GetValue());
+    }
+} // namespace UnitTest
+
+#if defined(HAVE_BENCHMARK)
+#include <AzCore/Serialization/Json/JsonSerialization.h>
+#include <AzCore/Serialization/Json/JsonSystemComponent.h>
+#include <AzCore/Serialization/Json/RegistrationContext.h>
+#include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
+#include <benchmark/benchmark.h>
+
+namespace Benchmark
+{
+    namespace JsonBinaryFormatBenchmarkInternal
+    {
+        // Reflected types shaped like a prefab: many entities with a handful of polymorphic components, so every
+        // component is stored with a "$type".
+        struct Component
+        {
+            AZ_CLASS_ALLOCATOR(Component, AZ::SystemAllocator);
+            AZ_RTTI(Component, "{6B0C7E55-2E4F-4C1B-9D3A-8F1E6A2B4C71}");
+            virtual ~Component() = default;
+
+            AZ::u64 m_id = 0;
+            bool m_enabled = true;
+        };
+
+        struct TransformComponent
+            : public Component
+        {
+            AZ_CLASS_ALLOCATOR(TransformComponent, AZ::SystemAllocator);
+            AZ_RTTI(TransformComponent, "{0E5B2A9C-7D31-4F6A-A8C2-3B9D1E4F5A60}", Component);
+
+            AZStd::vector<double> m_translate;
+            AZ::u64 m_parentId = 0;
+        };
+
+        struct MeshComponent
+            : public Component
+        {
+            AZ_CLASS_ALLOCATOR(MeshComponent, AZ::SystemAllocator);
+            AZ_RTTI(MeshComponent, "{C4D8A1F2-5B6E-4A3C-9E7D-1F2A3B4C5D6E}", Component);
+
+            AZStd::string m_meshAsset;
+            bool m_castShadows = true;
+        };
+
+        struct LockComponent
+            : public Component
+        {
+            AZ_CLASS_ALLOCATOR(LockComponent, AZ::SystemAllocator);
+            AZ_RTTI(LockComponent, "{9A7B6C5D-4E3F-4A2B-8C1D-0E9F8A7B6C5D}", Component);
+
+            bool m_locked = false;
+        };
+
+        struct Entity
+        {
+            AZ_TYPE_INFO(Entity, "{3F2E1D0C-9B8A-4765-A4B3-C2D1E0F9A8B7}");
+
+            AZStd::string m_name;
+            AZStd::vector<AZStd::shared_ptr<Component>> m_components;
+        };
+
+        struct Prefab
+        {
+            AZ_TYPE_INFO(Prefab, "{7D6C5B4A-3F2E-4D1C-B0A9-8E7F6D5C4B3A}");
+
+            AZStd::vector<Entity> m_entities;
+        };
+
+        static void Reflect(AZ::SerializeContext& context)
+        {
+            context.Class<Component>()
+                ->Field("Id", &Component::m_id)
+                ->Field("Enabled", &Component::m_enabled);
+            context.Class<TransformComponent, Component>()
+                ->Field("Translate", &TransformComponent::m_translate)
+                ->Field("Parent Id", &TransformComponent::m_parentId);
+            context.Class<MeshComponent, Component>()
+                ->Field("Mesh Asset", &MeshComponent::m_meshAsset)
+                ->Field("Cast Shadows", &MeshComponent::m_castShadows);
+            context.Class<LockComponent, Component>()
+                ->Field("Locked", &LockComponent::m_locked);
+            context.Class<Entity>()
+                ->Field("Name", &Entity::m_name)
+                ->Field("Components", &Entity::m_components);
+            context.Class<Prefab>()
+                ->Field("Entities", &Prefab::m_entities);
+        }
+    } // namespace JsonBinaryFormatBenchmarkInternal
+
+    class JsonBinaryFormatBenchmarkFixture
+        : public UnitTest::AllocatorsBenchmarkFixture
+    {
+    public:
+        void SetUp(const ::benchmark::State& state) override
+        {
+            using namespace JsonBinaryFormatBenchmarkInternal;
+
+            UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+
+            m_serializeContext = AZStd::make_unique<AZ::SerializeContext>();
+            m_jsonRegistrationContext = AZStd::make_unique<AZ::JsonRegistrationContext>();
+            m_jsonSystemComponent = AZ::JsonSystemComponent::CreateDescriptor();
+            m_jsonSystemComponent->Reflect(m_serializeContext.get());
+            m_jsonSystemComponent->Reflect(m_jsonRegistrationContext.get());
+            Reflect(*m_serializeContext);
+
+            m_deserializerSettings.m_serializeContext = m_serializeContext.get();
+            m_deserializerSettings.m_registrationContext = m_jsonRegistrationContext.get();
+
+            Prefab prefab;
+            prefab.m_entities.resize(EntityCount);
+            for (int entityIndex = 0; entityIndex < EntityCount; ++entityIndex)
+            {
+                Entity& entity = prefab.m_entities[entityIndex];
+                entity.m_name = AZStd::string::format("Entity_%d", entityIndex);
+
+                auto transform = AZStd::make_shared<TransformComponent>();
+                transform->m_id = entityIndex * 16;
+                transform->m_translate = { entityIndex * 0.5, 0.25, 1.0 };
+                transform->m_parentId = entityIndex / 8;
+                entity.m_components.push_back(transform);
+
+                auto mesh = AZStd::make_shared<MeshComponent>();
+                mesh->m_id = entityIndex * 16 + 1;
+                mesh->m_meshAsset = AZStd::string::format("objects/mesh_%d.azmodel", entityIndex % 32);
+                entity.m_components.push_back(mesh);
+
+                auto lock = AZStd::make_shared<LockComponent>();
+                lock->m_id = entityIndex * 16 + 2;
+                entity.m_components.push_back(lock);
+            }
+
+            // Keep the defaults so every component carries all of its fields, as an unmodified prefab would.
+            AZ::JsonSerializerSettings serializerSettings;
+            serializerSettings.m_serializeContext = m_serializeContext.get();
+            serializerSettings.m_registrationContext = m_jsonRegistrationContext.get();
+            serializerSettings.m_keepDefaults = true;
+
+            rapidjson::Document document;
+            AZ::JsonSerialization::Store(document, document.GetAllocator(), prefab, serializerSettings);
+            AZ::JsonSerializationUtils::WriteJsonString(document, m_text);
+            AZ::JsonBinaryFormat::Write(document, m_binary);
+        }
+
+        void TearDown(const ::benchmark::State& state) override
+        {
+            using namespace JsonBinaryFormatBenchmarkInternal;
+
+            m_text = {};
+            m_binary = {};
+            m_deserializerSettings = {};
+
+            m_serializeContext->EnableRemoveReflection();
+            m_jsonRegistrationContext->EnableRemoveReflection();
+            Reflect(*m_serializeContext);
+            m_jsonSystemComponent->Reflect(m_serializeContext.get());
+            m_jsonSystemComponent->Reflect(m_jsonRegistrationContext.get());
+            m_serializeContext->DisableRemoveReflection();
+            m_jsonRegistrationContext->DisableRemoveReflection();
+            delete m_jsonSystemComponent;
+            m_jsonSystemComponent = nullptr;
+
+            m_jsonRegistrationContext.reset();
+            m_serializeContext.reset();
+
+            UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+        }
+
+    protected:
+        static constexpr int EntityCount = 5000;
+
+        AZStd::unique_ptr<AZ::SerializeContext> m_serializeContext;
+        AZStd::unique_ptr<AZ::JsonRegistrationContext> m_jsonRegistrationContext;
+        AZ::ComponentDescriptor* m_jsonSystemComponent = nullptr;
+        AZ::JsonDeserializerSettings m_deserializerSettings;
+
+        AZStd::string m_text;
+        AZStd::vector<AZ::u8> m_binary;
+    };
+
+    // Parsing only, to show how much of the load time is spent on the text.
+    BENCHMARK_DEFINE_F(JsonBinaryFormatBenchmarkFixture, BM_JsonBinaryFormat_ReadText)(benchmark::State& state)
+    {
+        for ([[maybe_unused]] auto _ : state)
+        {
+            auto result = AZ::JsonSerializationUtils::ReadJsonString(m_text);
+            benchmark::DoNotOptimize(result);
+        }
+        state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * m_text.size()));
+    }
+    BENCHMARK_REGISTER_F(JsonBinaryFormatBenchmarkFixture, BM_JsonBinaryFormat_ReadText)->Unit(benchmark::kMillisecond);
+
+    BENCHMARK_DEFINE_F(JsonBinaryFormatBenchmarkFixture, BM_JsonBinaryFormat_ReadBinary)(benchmark::State& state)
+    {
+        for ([[maybe_unused]] auto _ : state)
+        {
+            auto result = AZ::JsonBinaryFormat::Read(m_binary);
+            benchmark::DoNotOptimize(result);
+        }
+        state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * m_binary.size()));
+    }
+    BENCHMARK_REGISTER_F(JsonBinaryFormatBenchmarkFixture, BM_JsonBinaryFormat_ReadBinary)->Unit(benchmark::kMillisecond);
+
+    // Reading the document and loading the prefab from it, as a runtime load of the product does.
+    BENCHMARK_DEFINE_F(JsonBinaryFormatBenchmarkFixture, BM_JsonBinaryFormat_LoadPrefabFromText)(benchmark::State& state)
+    {
+        for ([[maybe_unused]] auto _ : state)
+        {
+            auto document = AZ::JsonSerializationUtils::ReadJsonString(m_text);
+            JsonBinaryFormatBenchmarkInternal::Prefab prefab;
+            auto result = AZ::JsonSerialization::Load(prefab, document.GetValue(), m_deserializerSettings);
+            benchmark::DoNotOptimize(result);
+            benchmark::DoNotOptimize(prefab);
+        }
+        state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * m_text.size()));
+    }
+    BENCHMARK_REGISTER_F(JsonBinaryFormatBenchmarkFixture, BM_JsonBinaryFormat_LoadPrefabFromText)->Unit(benchmark::kMillisecond);
+
+    BENCHMARK_DEFINE_F(JsonBinaryFormatBenchmarkFixture, BM_JsonBinaryFormat_LoadPrefabFromBinary)(benchmark::State& state)
+    {
+        for ([[maybe_unused]] auto _ : state)
+        {
+            auto document = AZ::JsonBinaryFormat::Read(m_binary);
+            JsonBinaryFormatBenchmarkInternal::Prefab prefab;
+            auto result = AZ::JsonSerialization::Load(prefab, document.GetValue(), m_deserializerSettings);
+            benchmark::DoNotOptimize(result);
+            benchmark::DoNotOptimize(prefab);
+        }
+        state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * m_binary.size()));
+    }
+    BENCHMARK_REGISTER_F(JsonBinaryFormatBenchmarkFixture, BM_JsonBinaryFormat_LoadPrefabFromBinary)->Unit(benchmark::kMillisecond);
+} // namespace Benchmark
+#endif
@@ -8,7 +8,12 @@
 
 #include <AzCore/PlatformDef.h>
 
+#include <AzCore/IO/ByteContainerStream.h>
+#include <AzCore/IO/GenericStreams.h>
 #include <AzCore/JSON/pointer.h>
+#include <AzCore/JSON/stringbuffer.h>
+#include <AzCore/JSON/writer.h>
+#include <AzCore/Serialization/Json/JsonBinaryFormat.h>
 #include <AzCore/std/smart_ptr/make_shared.h>
 #include <AzCore/std/smart_ptr/shared_ptr.h>
 
@@ -39,6 +44,21 @@ namespace JsonSerializationTests
 
     TYPED_TEST_SUITE(TypedJsonSerializationTests, JsonSerializationTestCases);
 
+    template<typename T>
+    AZ::JsonSerializationResult::ResultCode LoadFromText(T& object, AZStd::string_view json, AZ::JsonDeserializerSettings& settings)
+    {
+        AZ::IO::MemoryStream stream(json.data(), json.size());
+        return AZ::JsonSerialization::LoadFromStream(object, stream, settings);
+    }
+
+    AZStd::string DocumentToText(const rapidjson::Value& value)
+    {
+        rapidjson::StringBuffer buffer;
+        rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
+        value.Accept(writer);
+        return AZStd::string(buffer.GetString(), buffer.GetSize());
+    }
+
     TYPED_TEST(TypedJsonSerializationTests, Store_SerializedDefaultInstance_EmptyJsonReturned)
     {
         using namespace AZ::JsonSerializationResult;
@@ -205,6 +225,61 @@ namespace JsonSerializationTests
         EXPECT_TRUE(loadInstance.Equals(*description.m_instance, this->m_fullyReflected));
     }
 
+    TYPED_TEST(TypedJsonSerializationTests, LoadFromStream_JsonWithoutDefaults_SameResultAsLoad)
+    {
+        using namespace AZ::JsonSerializationResult;
+
+        this->Reflect(true);
+        auto description = TypeParam::GetInstanceWithoutDefaults();
+        this->m_jsonDocument->Parse(description.m_jsonWithStrippedDefaults);
+
+        TypeParam loadInstance;
+        ResultCode loadResult = AZ::JsonSerialization::Load(loadInstance, *this->m_jsonDocument, *this->m_deserializationSettings);
+
+        TypeParam streamInstance;
+        ResultCode streamResult = LoadFromText(streamInstance, description.m_jsonWithStrippedDefaults, *this->m_deserializationSettings);
+        EXPECT_EQ(loadResult.GetOutcome(), streamResult.GetOutcome());
+        EXPECT_EQ(loadResult.GetProcessing(), streamResult.GetProcessing());
+        EXPECT_TRUE(streamInstance.Equals(*description.m_instance, this->m_fullyReflected));
+    }
+
+    TYPED_TEST(TypedJsonSerializationTests, LoadFromStream_JsonWithSomeDefaults_SameResultAsLoad)
+    {
+        using namespace AZ::JsonSerializationResult;
+
+        this->Reflect(true);
+        auto description = TypeParam::GetInstanceWithSomeDefaults();
+        this->m_jsonDocument->Parse(description.m_jsonWithStrippedDefaults);
+
+        TypeParam loadInstance;
+        ResultCode loadResult = AZ::JsonSerialization::Load(loadInstance, *this->m_jsonDocument, *this->m_deserializationSettings);
+
+        TypeParam streamInstance;
+        ResultCode streamResult = LoadFromText(streamInstance, description.m_jsonWithStrippedDefaults, *this->m_deserializationSettings);
+        EXPECT_EQ(loadResult.GetOutcome(), streamResult.GetOutcome());
+        EXPECT_EQ(loadResult.GetProcessing(), streamResult.GetProcessing());
+        EXPECT_TRUE(streamInstance.Equals(*description.m_instance, this->m_fullyReflected));
+    }
+
+    TYPED_TEST(TypedJsonSerializationTests, LoadFromStream_JsonAdditionalFields_SameResultAsLoad)
+    {
+        using namespace AZ::JsonSerializationResult;
+
+        this->Reflect(true);
+        auto description = TypeParam::GetInstanceWithoutDefaults();
+        this->m_jsonDocument->Parse(description.m_jsonWithStrippedDefaults);
+        this->InjectAdditionalFields(*this->m_jsonDocument, rapidjson::kStringType, this->m_jsonDocument->GetAllocator());
+
+        TypeParam loadInstance;
+        ResultCode loadResult = AZ::JsonSerialization::Load(loadInstance, *this->m_jsonDocument, *this->m_deserializationSettings);
+
+        TypeParam streamInstance;
+        ResultCode streamResult = LoadFromText(streamInstance, DocumentToText(*this->m_jsonDocument), *this->m_deserializationSettings);
+        EXPECT_EQ(loadResult.GetOutcome(), streamResult.GetOutcome());
+        EXPECT_EQ(loadResult.GetProcessing(), streamResult.GetProcessing());
+        EXPECT_TRUE(streamInstance.Equals(*description.m_instance, this->m_fullyReflected));
+    }
+
     // Load
 
     TEST_F(JsonSerializationTests, Load_PrimitiveAtTheRoot_SucceedsAndObjectMatches)
@@ -334,6 +409,110 @@ namespace JsonSerializationTests
         EXPECT_EQ(Processing::Halted, loadResult.GetProcessing());
     }
 
+    TEST_F(JsonSerializationTests, LoadFromStream_ArrayAtTheRoot_SucceedsAndObjectMatches)
+    {
+        using namespace AZ::JsonSerializationResult;
+
+        auto genericInfo = AZ::SerializeGenericTypeInfo<AZStd::vector<int>>::GetGenericInfo();
+        ASSERT_NE(nullptr, genericInfo);
+        genericInfo->Reflect(m_serializeContext.get());
+
+        AZStd::vector<int> loadValues;
+        ResultCode loadResult = LoadFromText(loadValues, "[13,42,88]", *m_deserializationSettings);
+        ASSERT_EQ(Outcomes::Success, loadResult.GetOutcome());
+        EXPECT_EQ(loadValues, AZStd::vector<int>({ 13, 42, 88 }));
+    }
+
+    TEST_F(JsonSerializationTests, LoadFromStream_PointerToSameClass_SucceedsAndObjectMatches)
+    {
+        using namespace AZ::JsonSerializationResult;
+
+        ComplexNullInheritedPointer::Reflect(m_serializeContext, true);
+
+        ComplexNullInheritedPointer instance;
+        ResultCode loadResult = LoadFromText(instance, R"({ "pointer": { "$type": "BaseClass" } })", *m_deserializationSettings);
+        ASSERT_EQ(Outcomes::DefaultsUsed, loadResult.GetOutcome());
+
+        ASSERT_NE(nullptr, instance.m_pointer);
+        EXPECT_EQ(azrtti_typeid(instance.m_pointer), azrtti_typeid<BaseClass>());
+    }
+
+    TEST_F(JsonSerializationTests, LoadFromStream_InvalidPointerName_FailsToConvert)
+    {
+        using namespace AZ::JsonSerializationResult;
+
+        ComplexNullInheritedPointer::Reflect(m_serializeContext, true);
+
+        ComplexNullInheritedPointer instance;
+        ResultCode loadResult = LoadFromText(instance, R"({ "pointer": { "$type": "Invalid" } })", *m_deserializationSettings);
+        EXPECT_EQ(Outcomes::Unknown, loadResult.GetOutcome());
+        EXPECT_EQ(Processing::Halted, loadResult.GetProcessing());
+    }
+
+    TEST_F(JsonSerializationTests, LoadFromStream_UnknownFieldsWithNestedValues_FieldsSkipped)
+    {
+        using namespace AZ::JsonSerializationResult;
+
+        SimpleClass::Reflect(m_serializeContext, true);
+
+        SimpleClass instance;
+        ResultCode loadResult = LoadFromText(instance, R"(
+            {
+                "$type": "SimpleClass",
+                "unknown1": { "var1": 1, "nested": [ { "var2": 2.0 }, [ 3 ] ] },
+                "var1": 88,
+                "unknown2": [ { "var1": 4 } ],
+                "var2": 88.0
+            })", *m_deserializationSettings);
+        EXPECT_EQ(Processing::Completed, loadResult.GetProcessing());
+        EXPECT_EQ(88, instance.m_var1);
+        EXPECT_DOUBLE_EQ(88.0, instance.m_var2);
+    }
+
+    TEST_F(JsonSerializationTests, LoadFromStream_InvalidJson_ReturnsCatastrophic)
+    {
+        using namespace AZ::JsonSerializationResult;
+
+        SimpleClass::Reflect(m_serializeContext, true);
+
+        SimpleClass instance;
+        ResultCode loadResult = LoadFromText(instance, R"({ "var1": 88, "var2": 88.0, )", *m_deserializationSettings);
+        EXPECT_EQ(Outcomes::Catastrophic, loadResult.GetOutcome());
+        // The document is rejected before anything is loaded, so the object is left untouched.
+        EXPECT_EQ(42, instance.m_var1);
+        EXPECT_FLOAT_EQ(42.0f, instance.m_var2);
+    }
+
+    TEST_F(JsonSerializationTests, LoadFromStream_DataAfterDocument_ReturnsCatastrophic)
+    {
+        using namespace AZ::JsonSerializationResult;
+
+        SimpleClass::Reflect(m_serializeContext, true);
+
+        SimpleClass instance;
+        ResultCode loadResult = LoadFromText(instance, R"({ "var1": 88 } { "var1": 99 })", *m_deserializationSettings);
+        EXPECT_EQ(Outcomes::Catastrophic, loadResult.GetOutcome());
+        EXPECT_EQ(42, instance.m_var1);
+    }
+
+    TEST_F(JsonSerializationTests, LoadFromStream_BinaryJson_SucceedsAndObjectMatches)
+    {
+        using namespace AZ::JsonSerializationResult;
+
+        SimpleClass::Reflect(m_serializeContext, true);
+        auto description = SimpleClass::GetInstanceWithoutDefaults();
+        m_jsonDocument->Parse(description.m_jsonWithStrippedDefaults);
+
+        AZStd::vector<AZ::u8> binary;
+        ASSERT_TRUE(AZ::JsonBinaryFormat::Write(*m_jsonDocument, binary).IsSuccess());
+        AZ::IO::ByteContainerStream<AZStd::vector<AZ::u8>> stream(&binary);
+
+        SimpleClass instance;
+        ResultCode loadResult = AZ::JsonSerialization::LoadFromStream(instance, stream, *m_deserializationSettings);
+        EXPECT_EQ(Outcomes::Success, loadResult.GetOutcome());
+        EXPECT_TRUE(instance.Equals(*description.m_instance, true));
+    }
+
     // Store
 
     TEST_F(JsonSerializationTests, Store_PrimitiveAtTheRoot_ReturnsSuccessAndTheValueAtTheRoot)
@@ -0,0 +1,75 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/IO/Streamer/DeadlineStatistics.h>
+#include <AzCore/UnitTest/TestTypes.h>
+
+namespace AZ::IO
+{
+    class Streamer_DeadlineStatisticsTest
+        : public UnitTest::LeakDetectionFixture
+    {
+    protected:
+        DeadlineStatistics m_statistics;
+    };
+
+    TEST_F(Streamer_DeadlineStatisticsTest, GetBandIndex_PriorityBoundaries_MapToExpectedBands)
+    {
+        EXPECT_EQ(0u, DeadlineStatistics::GetBandIndex(IStreamerTypes::s_priorityLowest));
+        EXPECT_EQ(0u, DeadlineStatistics::GetBandIndex(IStreamerTypes::s_priorityLow));
+        EXPECT_EQ(1u, DeadlineStatistics::GetBandIndex(IStreamerTypes::s_priorityMedium));
+        EXPECT_EQ(2u, DeadlineStatistics::GetBandIndex(IStreamerTypes::s_priorityHigh));
+        EXPECT_EQ(3u, DeadlineStatistics::GetBandIndex(IStreamerTypes::s_priorityHighest));
+    }
+
+    TEST_F(Streamer_DeadlineStatisticsTest, RecordQueueTime_VariousTimes_AddedToMatchingHistogramBucket)
+    {
+        m_statistics.RecordQueueTime(IStreamerTypes::s_priorityMedium, Statistic::TimeValue(500));
+        m_statistics.RecordQueueTime(IStreamerTypes::s_priorityMedium, Statistic::TimeValue(1000));
+        m_statistics.RecordQueueTime(IStreamerTypes::s_priorityMedium, Statistic::TimeValue(300000));
+
+        const DeadlineStatistics::Band& band =
+            m_statistics.GetBand(DeadlineStatistics::GetBandIndex(IStreamerTypes::s_priorityMedium));
+        EXPECT_EQ(1u, band.m_queueTimeHistogram[0]);
+        EXPECT_EQ(1u, band.m_queueTimeHistogram[1]);
+        EXPECT_EQ(1u, band.m_queueTimeHistogram[DeadlineStatistics::QueueTimeBucketCount - 1]);
+        EXPECT_EQ(3u, band.m_queueTime.GetNumRecorded());
+
+        const DeadlineStatistics::Band& otherBand =
+            m_statistics.GetBand(DeadlineStatistics::GetBandIndex(IStreamerTypes::s_priorityHigh));
+        EXPECT_EQ(0u, otherBand.m_queueTime.GetNumRecorded());
+    }
+
+    TEST_F(Streamer_DeadlineStatisticsTest, RecordCompletion_LateAndOnTime_OnlyLateCountedAsMissed)
+    {
+        auto deadline = AZStd::chrono::steady_clock::now();
+        m_statistics.RecordCompletion(IStreamerTypes::s_priorityHigh, deadline, deadline - AZStd::chrono::milliseconds(1));
+        m_statistics.RecordCompletion(IStreamerTypes::s_priorityHigh, deadline, deadline + AZStd::chrono::milliseconds(5));
+
+        const DeadlineStatistics::Band& band =
+            m_statistics.GetBand(DeadlineStatistics::GetBandIndex(IStreamerTypes::s_priorityHigh));
+        EXPECT_EQ(2u, band.m_completedCount);
+        EXPECT_EQ(1u, band.m_missedDeadlineCount);
+        EXPECT_EQ(Statistic::TimeValue(5000), band.m_lateness.GetMaximum());
+    }
+
+    TEST_F(Streamer_DeadlineStatisticsTest, CollectStatistics_OnlyUsedBands_AreReported)
+    {
+        AZStd::vector<Statistic> statistics;
+        m_statistics.CollectStatistics(statistics);
+        EXPECT_TRUE(statistics.empty());
+
+        m_statistics.RecordShed(IStreamerTypes::s_priorityLow);
+        m_statistics.CollectStatistics(statistics);
+        ASSERT_FALSE(statistics.empty());
+        for (const Statistic& statistic : statistics)
+        {
+            EXPECT_EQ("Low priority reads", statistic.GetOwner());
+        }
+    }
+} // namespace AZ::IO
@@ -0,0 +1,262 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/IO/Path/Path.h>
+#include <AzCore/IO/Streamer/FileRequest.h>
+#include <AzCore/IO/Streamer/PersistentBlockCache.h>
+#include <AzCore/IO/Streamer/StreamerContext.h>
+#include <AzCore/IO/SystemFile.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+#include <AzCore/Task/TaskExecutor.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzTest/AzTest.h>
+#include <AzTest/Utils.h>
+#include <Tests/FileIOBaseTestTypes.h>
+#include <Tests/Streamer/StreamStackEntryMock.h>
+
+namespace AZ::IO
+{
+    class Streamer_PersistentBlockCacheTest
+        : public UnitTest::LeakDetectionFixture
+    {
+    public:
+        static constexpr u32 BlockSize = 64 * 1024;
+        static constexpr u64 CacheSize = 16 * BlockSize;
+        static constexpr u64 FileLength = 5 * BlockSize + 100;
+
+        void SetUp() override
+        {
+            using ::testing::_;
+
+            UnitTest::LeakDetectionFixture::SetUp();
+
+            m_taskExecutor = AZStd::make_unique<TaskExecutor>();
+            TaskExecutor::SetInstance(m_taskExecutor.get());
+
+            m_prevFileIO = FileIOBase::GetInstance();
+            FileIOBase::SetInstance(&m_fileIO);
+
+            AZ::IO::Path sourcePath = m_tempDirectory.GetDirectoryAsPath() / "Source.bin";
+            m_cachePath = m_tempDirectory.GetDirectoryAsPath() / "Cache" / "PersistentBlockCache.bin";
+
+            m_fileData.resize_no_construct(FileLength);
+            for (u64 i = 0; i < FileLength; ++i)
+            {
+                m_fileData[i] = static_cast<u8>((i * 7) ^ (i >> 12));
+            }
+            SystemFile sourceFile;
+            ASSERT_TRUE(sourceFile.Open(sourcePath.c_str(), SystemFile::SF_OPEN_WRITE_ONLY | SystemFile::SF_OPEN_CREATE));
+            ASSERT_EQ(FileLength, sourceFile.Write(m_fileData.data(), FileLength));
+            sourceFile.Close();
+
+            m_path = sourcePath;
+            m_context = new StreamerContext();
+
+            m_mock = AZStd::make_shared<testing::NiceMock<StreamStackEntryMock>>();
+            ON_CALL(*m_mock, QueueRequest(_)).WillByDefault([this](FileRequest* request) { QueueReadRequest(request); });
+        }
+
+        void TearDown() override
+        {
+            m_cache = nullptr;
+            m_mock = nullptr;
+
+            delete m_context;
+            m_context = nullptr;
+
+            m_fileData = {};
+            m_path = RequestPath();
+            m_cachePath = AZ::IO::Path();
+
+            FileIOBase::SetInstance(m_prevFileIO);
+            TaskExecutor::SetInstance(nullptr);
+            m_taskExecutor.reset();
+
+            UnitTest::LeakDetectionFixture::TearDown();
+        }
+
+        void CreateCache()
+        {
+            // Release the previous cache first so the cache file is closed before it's opened again.
+            m_cache = nullptr;
+            m_cache = AZStd::make_shared<PersistentBlockCache>(m_cachePath.Native(), CacheSize, BlockSize, AZCORE_GLOBAL_NEW_ALIGNMENT);
+            m_cache->SetNext(m_mock);
+            m_cache->SetContext(*m_context);
+            ASSERT_TRUE(m_cache->IsCacheFileOpen());
+        }
+
+        void QueueReadRequest(FileRequest* request)
+        {
+            if (auto data = AZStd::get_if<Requests::ReadData>(&request->GetCommand()); data != nullptr)
+            {
+                m_readOffsets.push_back(data->m_offset);
+                bool result = SystemFile::Read(data->m_path.GetAbsolutePathCStr(), data->m_output, data->m_size, data->m_offset) ==
+                    data->m_size;
+                request->SetStatus(result ? IStreamerTypes::RequestStatus::Completed : IStreamerTypes::RequestStatus::Failed);
+            }
+            else
+            {
+                request->SetStatus(IStreamerTypes::RequestStatus::Completed);
+            }
+            m_context->MarkRequestAsCompleted(request);
+        }
+
+        void ProcessRead(u64 offset, u64 size)
+        {
+            m_readOffsets.clear();
+            AZStd::vector<u8> output(size);
+
+            IStreamerTypes::RequestStatus result = IStreamerTypes::RequestStatus::Pending;
+            FileRequest* request = m_context->GetNewInternalRequest();
+            request->CreateRead(nullptr, output.data(), size, m_path, offset, size);
+            request->SetCompletionCallback([&result](const FileRequest& request)
+            {
+                // Capture result before internal request is recycled.
+                result = request.GetStatus();
+            });
+
+            m_cache->QueueRequest(request);
+            while (m_context->FinalizeCompletedRequests())
+            {
+            }
+
+            EXPECT_EQ(IStreamerTypes::RequestStatus::Completed, result);
+            EXPECT_EQ(0, memcmp(output.data(), m_fileData.data() + offset, size));
+        }
+
+    protected:
+        AZ::Test::ScopedAutoTempDirectory m_tempDirectory;
+        UnitTest::TestFileIOBase m_fileIO;
+        FileIOBase* m_prevFileIO{};
+        StreamerContext* m_context{};
+        AZStd::shared_ptr<PersistentBlockCache> m_cache;
+        AZStd::shared_ptr<testing::NiceMock<StreamStackEntryMock>> m_mock;
+        AZStd::unique_ptr<TaskExecutor> m_taskExecutor;
+        AZStd::vector<u8> m_fileData;
+        AZStd::vector<u64> m_readOffsets;
+        AZ::IO::Path m_cachePath;
+        RequestPath m_path;
+    };
+
+    TEST_F(Streamer_PersistentBlockCacheTest, ReadFile_EmptyCache_ReadFromNextAndStored)
+    {
+        CreateCache();
+        ProcessRead(0, FileLength);
+
+        ASSERT_EQ(1u, m_readOffsets.size());
+        EXPECT_EQ(0u, m_readOffsets[0]);
+        EXPECT_EQ(6u, m_cache->GetNumCachedBlocks());
+    }
+
+    TEST_F(Streamer_PersistentBlockCacheTest, ReadFile_PartiallyCached_OnlyMissingBlocksAreRead)
+    {
+        CreateCache();
+        ProcessRead(BlockSize + 10, 100);
+        ASSERT_EQ(1u, m_readOffsets.size());
+        EXPECT_EQ(BlockSize, m_readOffsets[0]);
+
+        ProcessRead(0, FileLength);
+        ASSERT_EQ(2u, m_readOffsets.size());
+        EXPECT_EQ(0u, m_readOffsets[0]);
+        EXPECT_EQ(2 * BlockSize, m_readOffsets[1]);
+    }
+
+    TEST_F(Streamer_PersistentBlockCacheTest, ReadFile_CacheReopened_ReadFromCacheFile)
+    {
+        CreateCache();
+        ProcessRead(0, FileLength);
+
+        CreateCache();
+        EXPECT_EQ(6u, m_cache->GetNumCachedBlocks());
+        ProcessRead(BlockSize / 2, 3 * BlockSize);
+        EXPECT_TRUE(m_readOffsets.empty());
+        ProcessRead(0, FileLength);
+        EXPECT_TRUE(m_readOffsets.empty());
+    }
+
+    TEST_F(Streamer_PersistentBlockCacheTest, ReadFile_CorruptedBlockAfterReopen_BlockIsReadAgain)
+    {
+        CreateCache();
+        ProcessRead(0, FileLength);
+        m_cache = nullptr;
+
+        // The last block is the last data in the cache file, so overwrite the end of the file.
+        SystemFile cacheFile;
+        ASSERT_TRUE(cacheFile.Open(m_cachePath.c_str(), SystemFile::SF_OPEN_READ_WRITE));
+        cacheFile.Seek(-10, SystemFile::SF_SEEK_END);
+        const u8 garbage[10] = { 0xde, 0xad, 0xbe, 0xef, 0xde, 0xad, 0xbe, 0xef, 0xde, 0xad };
+        cacheFile.Write(garbage, sizeof(garbage));
+        cacheFile.Close();
+
+        CreateCache();
+        ProcessRead(5 * BlockSize, 100);
+        ASSERT_EQ(1u, m_readOffsets.size());
+        EXPECT_EQ(5 * BlockSize, m_readOffsets[0]);
+    }
+
+    TEST_F(Streamer_PersistentBlockCacheTest, FlushCache_CachedFile_BlocksAreReadAgain)
+    {
+        CreateCache();
+        ProcessRead(0, FileLength);
+
+        m_cache->FlushCache(m_path);
+        EXPECT_EQ(0u, m_cache->GetNumCachedBlocks());
+
+        ProcessRead(0, FileLength);
+        EXPECT_EQ(1u, m_readOffsets.size());
+    }
+
+    TEST_F(Streamer_PersistentBlockCacheTest, ReadFile_FilesWithSameSizeAndTime_BlocksAreNotShared)
+    {
+        CreateCache();
+        ProcessRead(0, FileLength);
+
+        // Write a second file with the same size and modification time but different data.
+        AZ::IO::Path otherPath = m_tempDirectory.GetDirectoryAsPath() / "Other.bin";
+        const u64 modificationTime = SystemFile::ModificationTime(m_path.GetAbsolutePathCStr());
+        for (u8& value : m_fileData)
+        {
+            value = static_cast<u8>(~value);
+        }
+        {
+            SystemFile otherFile;
+            ASSERT_TRUE(otherFile.Open(otherPath.c_str(), SystemFile::SF_OPEN_WRITE_ONLY | SystemFile::SF_OPEN_CREATE));
+            ASSERT_EQ(FileLength, otherFile.Write(m_fileData.data(), FileLength));
+        }
+        if (SystemFile::ModificationTime(otherPath.c_str()) != modificationTime)
+        {
+            GTEST_SKIP() << "The second file couldn't be written with the same modification time.";
+        }
+
+        m_path = otherPath;
+        ProcessRead(0, FileLength);
+        ASSERT_EQ(1u, m_readOffsets.size());
+        EXPECT_EQ(12u, m_cache->GetNumCachedBlocks());
+    }
+
+    TEST_F(Streamer_PersistentBlockCacheTest, Open_CacheFileInUse_NumberedCacheFileIsUsed)
+    {
+        CreateCache();
+        ProcessRead(0, FileLength);
+
+        // A second cache with the same settings, as another process would create, can't use the locked cache file.
+        auto secondCache = AZStd::make_shared<PersistentBlockCache>(m_cachePath.Native(), CacheSize, BlockSize, AZCORE_GLOBAL_NEW_ALIGNMENT);
+        ASSERT_TRUE(secondCache->IsCacheFileOpen());
+        EXPECT_EQ(m_cachePath.Native(), m_cache->GetCacheFilePath());
+        EXPECT_EQ((m_tempDirectory.GetDirectoryAsPath() / "Cache" / "PersistentBlockCache.1.bin").Native(), secondCache->GetCacheFilePath());
+        EXPECT_EQ(0u, secondCache->GetNumCachedBlocks());
+        secondCache = nullptr;
+
+        // The blocks in the configured cache file are left untouched.
+        CreateCache();
+        EXPECT_EQ(m_cachePath.Native(), m_cache->GetCacheFilePath());
+        EXPECT_EQ(6u, m_cache->GetNumCachedBlocks());
+    }
+} // namespace AZ::IO
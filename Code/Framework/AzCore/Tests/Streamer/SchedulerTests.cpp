@@ -441,4 +441,41 @@ namespace AZ::IO
             m_streamer->m_streamStack->Thread_PrioritizeRequests(&sameFileRequest->m_request, &sameFileRequest2->m_request),
             Scheduler::Order::Equal);
     }
+
+    TEST_F(Streamer_SchedulerTest, RequestSortingWithDeadlines)
+    {
+        auto estimatedCompleteTime = AZStd::chrono::steady_clock::now();
+        char fakeBuffer[8];
+        FileRequestPtr urgentRequest = m_streamer->Read("Urgent", fakeBuffer, sizeof(fakeBuffer), 8,
+            AZStd::chrono::seconds(10), IStreamerTypes::s_priorityLow);
+        urgentRequest->m_request.SetEstimatedCompletion(estimatedCompleteTime);
+        FileRequestPtr relaxedRequest = m_streamer->Read("Relaxed", fakeBuffer, sizeof(fakeBuffer), 8,
+            AZStd::chrono::seconds(20), IStreamerTypes::s_priorityHigh);
+        relaxedRequest->m_request.SetEstimatedCompletion(estimatedCompleteTime);
+
+        Scheduler* scheduler = m_streamer->m_streamStack.get();
+
+        //////////////////////////////////////////////////////////////
+        // Test earliest deadline first ignores the priority unless deadlines are equal
+        //////////////////////////////////////////////////////////////
+        scheduler->m_threadData.m_earliestDeadlineFirst = true;
+        EXPECT_EQ(
+            scheduler->Thread_PrioritizeRequests(&urgentRequest->m_request, &relaxedRequest->m_request),
+            Scheduler::Order::FirstRequest);
+        EXPECT_EQ(
+            scheduler->Thread_PrioritizeRequests(&relaxedRequest->m_request, &urgentRequest->m_request),
+            Scheduler::Order::SecondRequest);
+
+        //////////////////////////////////////////////////////////////
+        // Test demoted prefetches are scheduled after all other reads, even with an earlier deadline
+        //////////////////////////////////////////////////////////////
+        scheduler->m_threadData.m_prefetchPriority = IStreamerTypes::s_priorityLow;
+        scheduler->m_threadData.m_demotePrefetches = true;
+        EXPECT_EQ(
+            scheduler->Thread_PrioritizeRequests(&urgentRequest->m_request, &relaxedRequest->m_request),
+            Scheduler::Order::SecondRequest);
+
+        scheduler->m_threadData.m_demotePrefetches = false;
+        scheduler->m_threadData.m_earliestDeadlineFirst = false;
+    }
 } // namespace AZ::IO
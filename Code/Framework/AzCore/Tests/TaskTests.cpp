@@ -9,6 +9,9 @@
 #include <AzCore/Task/TaskGraph.h>
 #include <AzCore/Task/TaskExecutor.h>
 #include <AzCore/Memory/PoolAllocator.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/parallel/scoped_lock.h>
+#include <AzCore/std/parallel/thread.h>
 
 #include <AzCore/UnitTest/TestTypes.h>
 
@@ -624,6 +627,138 @@ namespace UnitTest
 
         EXPECT_EQ(3 | 0b100000, x);
     }
+
+    TEST_F(TaskGraphTestFixture, CpuMask_SingleWorker_AllTasksRunOnSameThread)
+    {
+        TaskExecutor executor{ 4 };
+        TaskDescriptor maskedTD{ "TaskGraphTestTask", "TaskGraphTests" };
+        maskedTD.cpuMask = 0b10;
+
+        AZStd::mutex mutex;
+        AZStd::vector<AZStd::thread::id> threadIds;
+
+        TaskGraph graph{ "CpuMask" };
+        for (int i = 0; i < 32; ++i)
+        {
+            graph.AddTask(
+                maskedTD,
+                [&mutex, &threadIds]
+                {
+                    AZStd::scoped_lock<AZStd::mutex> lock(mutex);
+                    threadIds.push_back(AZStd::this_thread::get_id());
+                });
+        }
+
+        TaskGraphEvent ev{ "ev" };
+        graph.SubmitOnExecutor(executor, &ev);
+        ev.Wait();
+
+        ASSERT_EQ(32, threadIds.size());
+        for (const AZStd::thread::id& threadId : threadIds)
+        {
+            EXPECT_EQ(threadIds[0], threadId);
+        }
+    }
+
+    TEST_F(TaskGraphTestFixture, WorkStealing_BlockedWorker_QueuedTaskIsStolen)
+    {
+        // Successors are queued on the worker that unblocks them, so without work stealing "blocked" would prevent
+        // "unblocker" from ever running.
+        TaskExecutor executor{ 2, true };
+        AZStd::atomic<bool> unblocked = false;
+        AZStd::atomic<bool> timedOut = false;
+
+        TaskGraph graph{ "WorkStealing" };
+        auto root = graph.AddTask(
+            defaultTD,
+            []
+            {
+            });
+        auto blocked = graph.AddTask(
+            defaultTD,
+            [&unblocked, &timedOut]
+            {
+                auto start = AZStd::chrono::steady_clock::now();
+                while (!unblocked)
+                {
+                    if (AZStd::chrono::steady_clock::now() - start > AZStd::chrono::seconds(5))
+                    {
+                        timedOut = true;
+                        return;
+                    }
+                    AZStd::this_thread::yield();
+                }
+            });
+        auto unblocker = graph.AddTask(
+            defaultTD,
+            [&unblocked]
+            {
+                unblocked = true;
+            });
+        root.Precedes(blocked, unblocker);
+
+        TaskGraphEvent ev{ "ev" };
+        graph.SubmitOnExecutor(executor, &ev);
+        ev.Wait();
+
+        EXPECT_TRUE(unblocked);
+        EXPECT_FALSE(timedOut);
+    }
+
+    TEST_F(TaskGraphTestFixture, WorkStealing_PinnedTasksAtHead_TaskBehindThemIsStolen)
+    {
+        // All tasks are queued on the first worker. "blocked" and "pinned" can only run on that worker, so the second
+        // worker has to steal past them to reach "unblocker".
+        TaskExecutor executor{ 2, true };
+        TaskDescriptor pinnedTD{ "TaskGraphTestTask", "TaskGraphTests" };
+        pinnedTD.cpuMask = 0b1;
+        AZStd::atomic<bool> unblocked = false;
+        AZStd::atomic<bool> timedOut = false;
+        AZStd::atomic<bool> pinnedRan = false;
+
+        TaskGraph graph{ "WorkStealingPinned" };
+        auto root = graph.AddTask(
+            pinnedTD,
+            []
+            {
+            });
+        auto blocked = graph.AddTask(
+            pinnedTD,
+            [&unblocked, &timedOut]
+            {
+                auto start = AZStd::chrono::steady_clock::now();
+                while (!unblocked)
+                {
+                    if (AZStd::chrono::steady_clock::now() - start > AZStd::chrono::seconds(5))
+                    {
+                        timedOut = true;
+                        return;
+                    }
+                    AZStd::this_thread::yield();
+                }
+            });
+        auto pinned = graph.AddTask(
+            pinnedTD,
+            [&pinnedRan]
+            {
+                pinnedRan = true;
+            });
+        auto unblocker = graph.AddTask(
+            defaultTD,
+            [&unblocked]
+            {
+                unblocked = true;
+            });
+        root.Precedes(blocked, pinned, unblocker);
+
+        TaskGraphEvent ev{ "ev" };
+        graph.SubmitOnExecutor(executor, &ev);
+        ev.Wait();
+
+        EXPECT_TRUE(unblocked);
+        EXPECT_TRUE(pinnedRan);
+        EXPECT_FALSE(timedOut);
+    }
 } // namespace UnitTest
 
 #if defined(HAVE_BENCHMARK)
@@ -739,5 +874,110 @@ namespace Benchmark
             ev.Wait();
         }
     }
+
+    // Compares the round-robin scheduler (argument 0) with work stealing (argument 1) on a fan-out where the cost of
+    // the tasks is heavily skewed, such as with culling or animation where a few tasks do most of the work.
+    class TaskExecutorSkewedGraphBenchmarkFixture : public ::benchmark::Fixture
+    {
+    public:
+        static constexpr uint32_t ThreadCount = 4;
+        static constexpr uint32_t TaskCount = 256;
+
+        void SetUp(const benchmark::State& state) override
+        {
+            executor = new TaskExecutor(ThreadCount, state.range(0) != 0);
+            graph = new TaskGraph{ "SkewedGraph" };
+        }
+        void SetUp(benchmark::State& state) override
+        {
+            SetUp(static_cast<const benchmark::State&>(state));
+        }
+
+        void TearDown(const benchmark::State&) override
+        {
+            delete graph;
+            delete executor;
+        }
+        void TearDown(benchmark::State& state) override
+        {
+            TearDown(static_cast<const benchmark::State&>(state));
+        }
+
+        static void Spin(uint32_t iterations)
+        {
+            volatile uint32_t sink = 0;
+            for (uint32_t i = 0; i < iterations; ++i)
+            {
+                sink = sink + i;
+            }
+        }
+
+        TaskDescriptor descriptor{ "skewed", "benchmark" };
+        TaskGraph* graph;
+        TaskExecutor* executor;
+    };
+
+    BENCHMARK_DEFINE_F(TaskExecutorSkewedGraphBenchmarkFixture, FanOut)(benchmark::State& state)
+    {
+        auto root = graph->AddTask(
+            descriptor,
+            []
+            {
+            });
+        for (uint32_t i = 0; i < TaskCount; ++i)
+        {
+            // Every ThreadCount-th task is expensive, which lines the expensive tasks up on the same worker when tasks
+            // are handed out round-robin.
+            const uint32_t iterations = (i % ThreadCount) == 0 ? 20000 : 200;
+            auto task = graph->AddTask(
+                descriptor,
+                [iterations]
+                {
+                    Spin(iterations);
+                });
+            root.Precedes(task);
+        }
+
+        for ([[maybe_unused]] auto _ : state)
+        {
+            TaskGraphEvent ev{ "ev" };
+            graph->SubmitOnExecutor(*executor, &ev);
+            ev.Wait();
+        }
+    }
+    BENCHMARK_REGISTER_F(TaskExecutorSkewedGraphBenchmarkFixture, FanOut)->ArgName("WorkStealing")->Arg(0)->Arg(1);
+
+    BENCHMARK_DEFINE_F(TaskExecutorSkewedGraphBenchmarkFixture, UnevenChains)(benchmark::State& state)
+    {
+        // One long chain next to many short ones. The tasks following the long chain's head are queued behind it.
+        constexpr uint32_t ChainCount = 16;
+        for (uint32_t chain = 0; chain < ChainCount; ++chain)
+        {
+            const uint32_t length = chain == 0 ? 32 : 2;
+            AZStd::vector<AZ::TaskToken> tasks;
+            tasks.reserve(length);
+            for (uint32_t i = 0; i < length; ++i)
+            {
+                tasks.push_back(graph->AddTask(
+                    descriptor,
+                    []
+                    {
+                        Spin(2000);
+                    }));
+                if (i > 0)
+                {
+                    tasks[i - 1].Precedes(tasks[i]);
+                }
+            }
+        }
+
+        for ([[maybe_unused]] auto _ : state)
+        {
+            TaskGraphEvent ev{ "ev" };
+            graph->SubmitOnExecutor(*executor, &ev);
+            ev.Wait();
+        }
+    }
+    BENCHMARK_REGISTER_F(TaskExecutorSkewedGraphBenchmarkFixture, UnevenChains)->ArgName("WorkStealing")->Arg(0)->Arg(1);
 } // namespace Benchmark
 #endif
@@ -5,6 +5,7 @@
  * SPDX-License-Identifier: Apache-2.0 OR MIT
  *
  */
+#include <AzCore/Component/BatchTickHandler.h>
 #include <AzCore/Component/TickBus.h>
 #include <AzCore/Math/Random.h>
 #include <AzCore/std/sort.h>
@@ -65,3 +66,197 @@ TEST_F(OrderedTickBus, OnTick_HandlersFireInSortedOrder)
     // check the order they actually fired in
     EXPECT_EQ(actualTickOrder, sortedOrder);
 }
+
+// Batch ticked type that counts the ticks of each instance.
+// When the batch is ticked it pushes its tick-order into a list.
+struct BatchTicker : public BatchTickHandler<BatchTicker>
+{
+    int m_tickCount = 0;
+    BatchTicker* m_disconnectOnTick = nullptr; ///< OnTick, disconnect this instance
+
+    static void OnBatchTick(AZStd::span<BatchTicker* const> instances, float /*deltaTime*/, ScriptTimePoint /*time*/)
+    {
+        for (BatchTicker* instance : instances)
+        {
+            if (instance)
+            {
+                ++instance->m_tickCount;
+                if (instance->m_disconnectOnTick)
+                {
+                    instance->m_disconnectOnTick->BatchTickDisconnect();
+                }
+            }
+        }
+        if (s_targetList)
+        {
+            s_targetList->push_back(s_batchOrder);
+        }
+    }
+
+    static inline AZStd::vector<int>* s_targetList = nullptr;
+    static inline int s_batchOrder = 0;
+};
+
+class BatchTickBus : public UnitTest::LeakDetectionFixture
+{};
+
+TEST_F(BatchTickBus, OnTick_BatchTicksBetweenHandlersWithLowerAndHigherOrder)
+{
+    AZStd::vector<int> actualTickOrder;
+
+    AZStd::list<OrderedTicker> tickers;
+    for (int order : { 3, 1 })
+    {
+        OrderedTicker& ticker = tickers.emplace_back();
+        ticker.m_order = order;
+        ticker.m_targetList = &actualTickOrder;
+        ticker.TickBus::Handler::BusConnect();
+    }
+
+    BatchTicker::s_targetList = &actualTickOrder;
+    BatchTicker::s_batchOrder = 2;
+    AZStd::vector<BatchTicker> instances(100);
+    for (BatchTicker& instance : instances)
+    {
+        instance.BatchTickConnect(2);
+    }
+    EXPECT_EQ(1u, BatchTicker::GetNumBatches());
+
+    TickBus::Broadcast(&TickBus::Events::OnTick, 0.f, ScriptTimePoint{});
+
+    EXPECT_EQ(actualTickOrder, AZStd::vector<int>({ 1, 2, 3 }));
+    for (const BatchTicker& instance : instances)
+    {
+        EXPECT_EQ(1, instance.m_tickCount);
+    }
+
+    for (BatchTicker& instance : instances)
+    {
+        instance.BatchTickDisconnect();
+    }
+    EXPECT_EQ(0u, BatchTicker::GetNumBatches());
+    BatchTicker::s_targetList = nullptr;
+}
+
+TEST_F(BatchTickBus, OnTick_InstanceDisconnectedDuringTick_NotTickedAndRemoved)
+{
+    AZStd::vector<BatchTicker> instances(4);
+    for (BatchTicker& instance : instances)
+    {
+        instance.BatchTickConnect();
+    }
+    // The first connected instance is ticked first.
+    instances[0].m_disconnectOnTick = &instances[3];
+
+    TickBus::Broadcast(&TickBus::Events::OnTick, 0.f, ScriptTimePoint{});
+    EXPECT_EQ(1, instances[0].m_tickCount);
+    EXPECT_EQ(0, instances[3].m_tickCount);
+    EXPECT_FALSE(instances[3].BatchTickIsConnected());
+
+    instances[0].m_disconnectOnTick = nullptr;
+    TickBus::Broadcast(&TickBus::Events::OnTick, 0.f, ScriptTimePoint{});
+    EXPECT_EQ(2, instances[1].m_tickCount);
+    EXPECT_EQ(0, instances[3].m_tickCount);
+
+    // Disconnecting all instances while ticking removes the batch after the tick.
+    instances[0].m_disconnectOnTick = &instances[0];
+    instances[1].m_disconnectOnTick = &instances[1];
+    instances[2].m_disconnectOnTick = &instances[2];
+    TickBus::Broadcast(&TickBus::Events::OnTick, 0.f, ScriptTimePoint{});
+    EXPECT_EQ(0u, BatchTicker::GetNumBatches());
+}
+
+TEST_F(BatchTickBus, BatchTickConnect_DifferentTickOrders_OneBatchPerOrder)
+{
+    AZStd::vector<BatchTicker> instances(4);
+    instances[0].BatchTickConnect(TICK_FIRST);
+    instances[1].BatchTickConnect(TICK_DEFAULT);
+    instances[2].BatchTickConnect(TICK_DEFAULT);
+    instances[3].BatchTickConnect(TICK_LAST);
+    EXPECT_EQ(3u, BatchTicker::GetNumBatches());
+
+    instances[0].BatchTickConnect(TICK_DEFAULT);
+    EXPECT_EQ(2u, BatchTicker::GetNumBatches());
+
+    for (BatchTicker& instance : instances)
+    {
+        instance.BatchTickDisconnect();
+    }
+    EXPECT_EQ(0u, BatchTicker::GetNumBatches());
+}
+
+#if defined(HAVE_BENCHMARK)
+
+#include <benchmark/benchmark.h>
+
+namespace Benchmark
+{
+    constexpr size_t NumTickingInstances = 50000;
+
+    struct IndividualTicker : public TickBus::Handler
+    {
+        void OnTick(float deltaTime, ScriptTimePoint /*time*/) override
+        {
+            m_value += deltaTime;
+        }
+
+        float m_value = 0.0f;
+    };
+
+    struct BatchedTicker : public BatchTickHandler<BatchedTicker>
+    {
+        static void OnBatchTick(AZStd::span<BatchedTicker* const> instances, float deltaTime, ScriptTimePoint /*time*/)
+        {
+            for (BatchedTicker* instance : instances)
+            {
+                instance->m_value += deltaTime;
+            }
+        }
+
+        float m_value = 0.0f;
+    };
+
+    static void BM_TickBus_IndividualHandlers(::benchmark::State& state)
+    {
+        AZStd::vector<IndividualTicker> tickers(NumTickingInstances);
+        for (IndividualTicker& ticker : tickers)
+        {
+            ticker.BusConnect();
+        }
+
+        for ([[maybe_unused]] auto _ : state)
+        {
+            TickBus::Broadcast(&TickBus::Events::OnTick, 0.016f, ScriptTimePoint{});
+        }
+
+        for (IndividualTicker& ticker : tickers)
+        {
+            ticker.BusDisconnect();
+        }
+        state.SetItemsProcessed(state.iterations() * NumTickingInstances);
+    }
+    BENCHMARK(BM_TickBus_IndividualHandlers);
+
+    static void BM_TickBus_BatchHandler(::benchmark::State& state)
+    {
+        AZStd::vector<BatchedTicker> tickers(NumTickingInstances);
+        for (BatchedTicker& ticker : tickers)
+        {
+            ticker.BatchTickConnect();
+        }
+
+        for ([[maybe_unused]] auto _ : state)
+        {
+            TickBus::Broadcast(&TickBus::Events::OnTick, 0.016f, ScriptTimePoint{});
+        }
+
+        for (BatchedTicker& ticker : tickers)
+        {
+            ticker.BatchTickDisconnect();
+        }
+        state.SetItemsProcessed(state.iterations() * NumTickingInstances);
+    }
+    BENCHMARK(BM_TickBus_BatchHandler);
+} // namespace Benchmark
+
+#endif // HAVE_BENCHMARK
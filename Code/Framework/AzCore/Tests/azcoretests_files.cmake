@@ -72,6 +72,7 @@ set(FILES
     BehaviorContext.cpp
     BehaviorContextFixture.h
     Components.cpp
+    Compression/SeekableZStdTests.cpp
     Console/LoggerSystemComponentTests.cpp
     Console/ConsoleTests.cpp
     Date/DateFormatTests.cpp
@@ -198,6 +199,7 @@ set(FILES
     Serialization/Json/ColorSerializerTests.cpp
     Serialization/Json/DoubleSerializerTests.cpp
     Serialization/Json/IntSerializerTests.cpp
+    Serialization/Json/JsonBinaryFormatTests.cpp
     Serialization/Json/JsonRegistrationContextTests.cpp
     Serialization/Json/JsonSerializationMetadataTests.cpp
     Serialization/Json/JsonSerializationResultTests.cpp
@@ -249,10 +251,12 @@ set(FILES
     StatisticalProfilerHelpers.h
     StatisticalProfilerTests.cpp
     Streamer/BlockCacheTests.cpp
+    Streamer/DeadlineStatisticsTests.cpp
     Streamer/DedicatedCacheTests.cpp
     Streamer/FullDecompressorTests.cpp
     Streamer/IStreamerMock.h
     Streamer/IStreamerTypesMock.h
+    Streamer/PersistentBlockCacheTests.cpp
     Streamer/ReadSplitterTests.cpp
     Streamer/RecentlyUsedIndexTests.cpp
     Streamer/SchedulerTests.cpp
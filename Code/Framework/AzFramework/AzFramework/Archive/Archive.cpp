@@ -50,6 +50,9 @@ namespace AZ::IO
     AZ_CVAR(int32_t, az_archive_verbosity, 0, nullptr, AZ::ConsoleFunctorFlags::DontReplicate,
         "Sets the verbosity level for logging Archive operations\n"
         ">=1 - Turns on verbose logging of all operations");
+    AZ_CVAR(bool, sys_PakMemoryMap, false, nullptr, AZ::ConsoleFunctorFlags::DontReplicate,
+        "If set, archives opened as packs are memory mapped and stored (uncompressed) files are served from the mapping.\n"
+        "This lets multiple processes on the same host share the archive contents through the OS page cache.");
 }
 
 namespace AZ::IO::ArchiveInternal
@@ -903,6 +906,23 @@ namespace AZ::IO
         return bytesRead;
     }
 
+    //////////////////////////////////////////////////////////////////////////
+    const void* Archive::FGetMappedFileData(AZ::IO::HandleType fileHandle, size_t& nFileSize)
+    {
+        ArchiveInternal::CZipPseudoFile* pseudoFile = GetPseudoFile(fileHandle);
+        if (!pseudoFile || !pseudoFile->GetFile())
+        {
+            return nullptr;
+        }
+
+        const void* mappedData = pseudoFile->GetFile()->GetMappedData();
+        if (mappedData)
+        {
+            nFileSize = pseudoFile->GetFileSize();
+        }
+        return mappedData;
+    }
+
     //////////////////////////////////////////////////////////////////////////
     void* Archive::FGetCachedFileData(AZ::IO::HandleType fileHandle, size_t& nFileSize)
     {
@@ -1161,7 +1181,11 @@ namespace AZ::IO
             }
         }
 
-        const int flags = INestedArchive::FLAGS_OPTIMIZED_READ_ONLY | INestedArchive::FLAGS_ABSOLUTE_PATHS;
+        int flags = INestedArchive::FLAGS_OPTIMIZED_READ_ONLY | INestedArchive::FLAGS_ABSOLUTE_PATHS;
+        if (sys_PakMemoryMap && !pData)
+        {
+            flags |= INestedArchive::FLAGS_MEMORY_MAPPED;
+        }
 
         desc.pArchive = OpenArchive(szFullPath, szBindRoot, flags, pData);
         if (!desc.pArchive)
@@ -1500,7 +1524,11 @@ namespace AZ::IO
             return 0;
         }
 
-        if (m_pFileEntry->nMethod == ZipFile::METHOD_STORE) //Can't use this technique for METHOD_STORE_AND_STREAMCIPHER_KEYTABLE as seeking with encryption performs poorly
+        if (const uint8_t* pMappedData = reinterpret_cast<const uint8_t*>(GetMappedData()); pMappedData)
+        {
+            memcpy(pBuffer, pMappedData + nFileOffset, (size_t)nReadSize);
+        }
+        else if (m_pFileEntry->nMethod == ZipFile::METHOD_STORE) //Can't use this technique for METHOD_STORE_AND_STREAMCIPHER_KEYTABLE as seeking with encryption performs poorly
         {
             AZStd::scoped_lock lock(m_pFileEntry->m_readLock);
             // Uncompressed read.
@@ -1527,6 +1555,15 @@ namespace AZ::IO
         return nReadSize;
     }
 
+    const void* CCachedFileData::GetMappedData() const
+    {
+        if (!m_pZip || !m_pFileEntry || !m_pZip->IsMemoryMapped() || m_pFileEntry->nMethod != ZipFile::METHOD_STORE)
+        {
+            return nullptr;
+        }
+        return m_pZip->GetMappedFileData(m_pFileEntry);
+    }
+
     uint32_t CCachedFileData::GetFileDataOffset()
     {
         m_pZip->Refresh(m_pFileEntry);
@@ -1564,6 +1601,11 @@ namespace AZ::IO
             nFactoryFlags |= ZipDir::CacheFactory::FLAGS_READ_ONLY;
         }
 
+        if ((nFlags & INestedArchive::FLAGS_READ_ONLY) && (nFlags & INestedArchive::FLAGS_MEMORY_MAPPED))
+        {
+            nFactoryFlags |= ZipDir::CacheFactory::FLAGS_MEMORY_MAPPED;
+        }
+
 
         INestedArchive* pArchive = FindArchive(szFullPath->Native());
         if (pArchive)
@@ -1938,6 +1980,12 @@ namespace AZ::IO
                 info.m_uncompressedSize = entry->desc.lSizeUncompressed;
                 info.m_isCompressed = entry->IsCompressed();
                 info.m_isSharedPak = true;
+                if (const void* mappedData = pFileData->GetMappedData(); mappedData)
+                {
+                    // Share ownership of the mapping so it outlives the archive being closed while the request is in flight.
+                    info.m_mappedData = AZStd::shared_ptr<const void>(pFileData->GetZip()->GetMappedFile(), mappedData);
+                }
+                info.m_seekTable = archive->GetSeekTable(entry);
 
                 switch (GetPakPriority())
                 {
@@ -64,6 +64,10 @@ namespace AZ::IO
         // Return number of copied bytes, or -1 if did not read anything
         int64_t ReadData(void* pBuffer, int64_t nFileOffset, int64_t nReadSize);
 
+        // returns a read-only pointer to the file data inside the memory mapped archive, or nullptr if the archive
+        // isn't memory mapped or the file isn't stored uncompressed. GetData() always returns a writable copy instead
+        const void* GetMappedData() const;
+
         ZipDir::Cache* GetZip() { return m_pZip.get(); }
         ZipDir::FileEntry* GetFileEntry() { return m_pFileEntry; }
 
@@ -201,6 +205,7 @@ namespace AZ::IO
         AZ::IO::HandleType FOpen(AZStd::string_view pName, const char* mode) override;
         size_t FRead(void* data, size_t bytesToRead, AZ::IO::HandleType handle) override;
         void* FGetCachedFileData(AZ::IO::HandleType handle, size_t& nFileSize) override;
+        const void* FGetMappedFileData(AZ::IO::HandleType handle, size_t& nFileSize) override;
         size_t FWrite(const void* data, size_t bytesToWrite, AZ::IO::HandleType handle) override;
         size_t FSeek(AZ::IO::HandleType handle, uint64_t seek, int mode) override;
         uint64_t FTell(AZ::IO::HandleType handle) override;
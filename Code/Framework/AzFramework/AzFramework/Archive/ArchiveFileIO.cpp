@@ -175,6 +175,22 @@ namespace AZ::IO
         return IO::ResultCode::Success;
     }
 
+    const void* ArchiveFileIO::GetMappedData(IO::HandleType fileHandle, AZ::u64& size)
+    {
+        if (!m_archive)
+        {
+            return nullptr;
+        }
+
+        size_t fileSize = 0;
+        const void* mappedData = m_archive->FGetMappedFileData(fileHandle, fileSize);
+        if (mappedData)
+        {
+            size = static_cast<AZ::u64>(fileSize);
+        }
+        return mappedData;
+    }
+
     IO::Result ArchiveFileIO::Read(IO::HandleType fileHandle, void* buffer, AZ::u64 size, bool failOnFewerThanSizeBytesRead, AZ::u64* bytesRead)
     {
         if (!m_archive)
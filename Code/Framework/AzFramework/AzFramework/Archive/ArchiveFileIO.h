@@ -38,6 +38,12 @@ namespace AZ::IO
         void SetArchive(IArchive* archive);
         IArchive* GetArchive() const;
 
+        //! Returns a read-only view of the file's contents if the file is stored uncompressed in a memory mapped archive.
+        //! The view is shared with every other process that maps the same archive and avoids copying the data into a
+        //! separate buffer. Returns nullptr if the file isn't in a memory mapped archive, in which case Read should be used.
+        //! The view remains valid for as long as the archive stays open.
+        const void* GetMappedData(IO::HandleType fileHandle, AZ::u64& size);
+
         ////////////////////////////////////////////////////////////////////////////////////////
         //implementation of FileIOBase
 
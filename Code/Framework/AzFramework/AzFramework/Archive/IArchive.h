@@ -133,6 +133,12 @@ namespace AZ::IO
         // WARNING! The returned pointer is only valid while the fileHandle has not been closed.
         virtual void* FGetCachedFileData(AZ::IO::HandleType fileHandle, size_t& nFileSize) = 0;
 
+        // Get a read-only pointer to the file data inside a memory mapped archive without copying it.
+        // Returns nullptr if the file isn't in an archive that was opened with INestedArchive::FLAGS_MEMORY_MAPPED
+        // or if the file is compressed.
+        // WARNING! The returned pointer is only valid while the archive containing the file is open.
+        virtual const void* FGetMappedFileData(AZ::IO::HandleType fileHandle, size_t& nFileSize) = 0;
+
         // Read raw data from file, no endian conversion.
         virtual size_t FRead(void* data, size_t bytesToRead, AZ::IO::HandleType fileHandle) = 0;
 
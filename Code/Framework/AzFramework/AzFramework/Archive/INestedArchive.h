@@ -84,6 +84,11 @@ namespace AZ::IO
             // to ensure that specific paks stay in the position(to keep the same priority) but being disabled
             // when running multiplayer
             FLAGS_DISABLE_PAK = 1 << 11,
+
+            // Map the whole archive into memory and serve stored (uncompressed) files as views into the mapping.
+            // Only applies to read-only archives. The mapping is shared through the OS page cache with every other
+            // process that maps the same archive.
+            FLAGS_MEMORY_MAPPED = 1 << 12,
         };
 
         using Handle = void*;
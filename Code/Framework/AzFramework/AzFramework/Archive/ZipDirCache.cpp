@@ -10,8 +10,11 @@
 #include <AzCore/Console/Console.h>
 #include <AzCore/IO/FileIO.h>
 #include <AzCore/Math/Crc.h>
+#include <AzCore/std/parallel/scoped_lock.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
 #include <AzCore/std/string/conversions.h>
 
+#include <AzFramework/Archive/Codec.h>
 #include <AzFramework/Archive/ZipFileFormat.h>
 #include <AzFramework/Archive/ZipDirStructures.h>
 #include <AzFramework/Archive/ZipDirTree.h>
@@ -46,6 +49,27 @@ namespace AZ::IO::ZipDir
             return memoryBlock;
         }
 
+        // uncompresses the compressed data of the file entry and checks its CRC if the entry requested that
+        static ErrorEnum UncompressFileData(FileEntry* pFileEntry, const void* pCompressed, void* pUncompressed)
+        {
+            size_t nSizeUncompressed = pFileEntry->desc.lSizeUncompressed;
+            if (Z_OK != ZipRawUncompress(pUncompressed, &nSizeUncompressed, pCompressed, pFileEntry->desc.lSizeCompressed))
+            {
+                return ZD_ERROR_CORRUPTED_DATA;
+            }
+            if (pFileEntry->bCheckCRCNextRead)
+            {
+                pFileEntry->bCheckCRCNextRead = false;
+                uLong uCRC32 = AZ::Crc32((Bytef*)pUncompressed, nSizeUncompressed);
+                if (uCRC32 != pFileEntry->desc.lCRC32)
+                {
+                    AZ_Warning("Archive", false, "ZD_ERROR_CRC32_CHECK: Uncompressed stream CRC32 check failed");
+                    return ZD_ERROR_CRC32_CHECK;
+                }
+            }
+            return ZD_ERROR_SUCCESS;
+        }
+
         // generates random file name
         static AZStd::fixed_string<8> GetRandomName(int nAttempt)
         {
@@ -150,6 +174,8 @@ namespace AZ::IO::ZipDir
                 m_fileHandle = AZ::IO::InvalidHandle;
             }
         }
+        // requests that still reference the mapping keep it alive, it's released once they complete
+        m_mappedFile.reset();
         m_treeDir.Clear();
     }
 
@@ -213,7 +239,7 @@ namespace AZ::IO::ZipDir
         case CompressionCodec::Codec::ZLIB:
             return (uncompressedSize + (uncompressedSize >> 3) + 32);
         case CompressionCodec::Codec::ZSTD:
-            return ZSTD_compressBound(uncompressedSize);
+            return AZ::SeekableZStd::CompressBound(uncompressedSize);
         case CompressionCodec::Codec::LZ4:
             return LZ4F_compressFrameBound(uncompressedSize, nullptr);
         default:
@@ -666,6 +692,40 @@ namespace AZ::IO::ZipDir
             return nError;
         }
 
+        if (m_mappedFile)
+        {
+            const uint8_t* mappedData = GetMappedFileData(pFileEntry);
+            if (!mappedData)
+            {
+                return ZD_ERROR_IO_FAILED;
+            }
+
+            if (pFileEntry->nMethod == 0)
+            {
+                if (void* pTarget = pUncompressed ? pUncompressed : pCompressed; pTarget)
+                {
+                    memcpy(pTarget, mappedData, pFileEntry->desc.lSizeCompressed);
+                    return ZD_ERROR_SUCCESS;
+                }
+                return ZD_ERROR_INVALID_CALL;
+            }
+
+            if (pCompressed)
+            {
+                memcpy(pCompressed, mappedData, pFileEntry->desc.lSizeCompressed);
+            }
+            if (pUncompressed)
+            {
+                // decompress straight out of the mapping, there's no need for an intermediate buffer
+                return ZipDirCacheInternal::UncompressFileData(pFileEntry, mappedData, pUncompressed);
+            }
+            else if (!pCompressed)
+            {
+                return ZD_ERROR_INVALID_CALL;
+            }
+            return ZD_ERROR_SUCCESS;
+        }
+
         if (!AZ::IO::FileIOBase::GetDirectInstance()->Seek(m_fileHandle, pFileEntry->nFileDataOffset, AZ::IO::SeekType::SeekFromStart))
         {
             return ZD_ERROR_IO_FAILED;
@@ -707,21 +767,7 @@ namespace AZ::IO::ZipDir
             }
             else
             {
-                size_t nSizeUncompressed = pFileEntry->desc.lSizeUncompressed;
-                if (Z_OK != ZipRawUncompress(pUncompressed, &nSizeUncompressed, pBuffer, pFileEntry->desc.lSizeCompressed))
-                {
-                    return ZD_ERROR_CORRUPTED_DATA;
-                }
-                if (pFileEntry->bCheckCRCNextRead)
-                {
-                    pFileEntry->bCheckCRCNextRead = false;
-                    uLong uCRC32 = AZ::Crc32((Bytef*)pUncompressed, nSizeUncompressed);
-                    if (uCRC32 != pFileEntry->desc.lCRC32)
-                    {
-                        AZ_Warning("Archive", false, "ZD_ERROR_CRC32_CHECK: Uncompressed stream CRC32 check failed");
-                        return ZD_ERROR_CRC32_CHECK;
-                    }
-                }
+                return ZipDirCacheInternal::UncompressFileData(pFileEntry, pBuffer, pUncompressed);
             }
         }
 
@@ -729,6 +775,92 @@ namespace AZ::IO::ZipDir
     }
 
 
+    AZStd::shared_ptr<const AZ::SeekableZStd::SeekTable> Cache::GetSeekTable(FileEntry* pFileEntry)
+    {
+        // zstd data is stored with the deflate method, entries stored with any other method can't have a seek table
+        if (!pFileEntry || pFileEntry->nMethod != ZipFile::METHOD_DEFLATE)
+        {
+            return {};
+        }
+
+        AZStd::scoped_lock lock(pFileEntry->m_readLock);
+        if (pFileEntry->m_seekTableLoaded)
+        {
+            return pFileEntry->m_seekTable;
+        }
+        pFileEntry->m_seekTableLoaded = true;
+
+        const uint64_t nSizeCompressed = pFileEntry->desc.lSizeCompressed;
+        if (nSizeCompressed < AZ::SeekableZStd::SeekTableFooterSize || Refresh(pFileEntry) != ZD_ERROR_SUCCESS)
+        {
+            return {};
+        }
+
+        const uint8_t* mappedData = GetMappedFileData(pFileEntry);
+        auto readData = [this, pFileEntry, mappedData](void* target, uint64_t nOffset, uint64_t nSize)
+        {
+            if (mappedData)
+            {
+                memcpy(target, mappedData + nOffset, nSize);
+                return true;
+            }
+            AZ::IO::FileIOBase* fileIO = AZ::IO::FileIOBase::GetDirectInstance();
+            return fileIO->Seek(m_fileHandle, pFileEntry->nFileDataOffset + nOffset, AZ::IO::SeekType::SeekFromStart) &&
+                fileIO->Read(m_fileHandle, target, nSize, true);
+        };
+        auto readTail = [&readData, nSizeCompressed](void* target, uint64_t nSize)
+        {
+            return readData(target, nSizeCompressed - nSize, nSize);
+        };
+
+        // the codec of deflate entries is only known from the data, so skip zlib and lz4 data before looking for a footer
+        uint8_t magic[sizeof(uint32_t)];
+        if (!readData(magic, 0, sizeof(magic)) || !CompressionCodec::TestForZSTDMagic(magic))
+        {
+            return {};
+        }
+
+        // the seek table is stored at the end of the compressed data, and its footer tells how large it is
+        uint8_t footer[AZ::SeekableZStd::SeekTableFooterSize];
+        if (!readTail(footer, sizeof(footer)))
+        {
+            return {};
+        }
+        const size_t nSeekTableSize = AZ::SeekableZStd::SeekTable::GetSeekTableSize(footer);
+        if (nSeekTableSize == 0 || nSeekTableSize > nSizeCompressed)
+        {
+            return {};
+        }
+
+        AZStd::vector<uint8_t> seekTableData(nSeekTableSize);
+        auto seekTable = AZStd::make_shared<AZ::SeekableZStd::SeekTable>();
+        if (!readTail(seekTableData.data(), nSeekTableSize) || !seekTable->Load(seekTableData.data(), nSeekTableSize) ||
+            seekTable->GetFrames().empty() || seekTable->GetCompressedSize() + nSeekTableSize != nSizeCompressed ||
+            seekTable->GetDecompressedSize() != pFileEntry->desc.lSizeUncompressed)
+        {
+            AZ_Warning("Archive", false, "Ignoring invalid zstd seek table of a file in \"%s\"", m_strFilePath.c_str());
+            return {};
+        }
+
+        pFileEntry->m_seekTable = AZStd::move(seekTable);
+        return pFileEntry->m_seekTable;
+    }
+
+    const uint8_t* Cache::GetMappedFileData(FileEntry* pFileEntry)
+    {
+        if (!pFileEntry || !m_mappedFile || Refresh(pFileEntry) != ZD_ERROR_SUCCESS)
+        {
+            return nullptr;
+        }
+
+        if (static_cast<AZ::u64>(pFileEntry->nFileDataOffset) + pFileEntry->desc.lSizeCompressed > m_mappedFile->GetSize())
+        {
+            AZ_Warning("Archive", false, "ZD_ERROR_CORRUPTED_DATA: File entry in \"%s\" extends past the end of the mapped file", m_strFilePath.c_str());
+            return nullptr;
+        }
+        return m_mappedFile->GetData() + pFileEntry->nFileDataOffset;
+    }
+
     //////////////////////////////////////////////////////////////////////////
     // finds the file by exact path
     FileEntry* Cache::FindFile(AZStd::string_view szPathSrc, [[maybe_unused]] bool bFullInfo)
@@ -19,11 +19,13 @@
 #include <AzCore/IO/Path/Path.h>
 #include <AzCore/Memory/PoolAllocator.h>
 #include <AzCore/std/containers/unordered_set.h>
+#include <AzCore/std/smart_ptr/shared_ptr.h>
 #include <AzCore/std/smart_ptr/intrusive_base.h>
 #include <AzFramework/Archive/Codec.h>
 #include <AzFramework/Archive/ZipDirStructures.h>
 #include <AzFramework/Archive/ZipDirTree.h>
 #include <AzFramework/AzFrameworkAPI.h>
+#include <AzFramework/IO/MemoryMappedFile.h>
 
 namespace AZ::IO::ZipDir
 {
@@ -83,6 +85,29 @@ namespace AZ::IO::ZipDir
 
         ErrorEnum ReadFile(FileEntry* pFileEntry, void* pCompressed, void* pUncompressed);
 
+        // returns true if the whole zip file is mapped into memory. This is only done for read-only caches
+        // that were created with CacheFactory::FLAGS_MEMORY_MAPPED
+        bool IsMemoryMapped() const
+        {
+            return m_mappedFile != nullptr;
+        }
+
+        // returns the mapping of the whole zip file, or nullptr if the zip file isn't mapped. Holding on to the
+        // returned pointer keeps the mapping alive after the cache is closed
+        const AZStd::shared_ptr<const AZ::IO::MemoryMappedFile>& GetMappedFile() const
+        {
+            return m_mappedFile;
+        }
+
+        // returns a pointer to the raw (possibly compressed) data of the file entry inside the mapped zip file,
+        // or nullptr if the zip file isn't mapped. The pointer stays valid until the cache is closed, unless the
+        // mapping is kept alive through GetMappedFile()
+        const uint8_t* GetMappedFileData(FileEntry* pFileEntry);
+
+        // returns the seek table of a file that was compressed in zstd's seekable format, or nullptr if the file doesn't have one.
+        // The seek table is only read from the zip file the first time, after that it's kept on the file entry
+        AZStd::shared_ptr<const AZ::SeekableZStd::SeekTable> GetSeekTable(FileEntry* pFileEntry);
+
         void Free(void* ptr)
         {
             azfree(ptr);
@@ -134,6 +159,8 @@ namespace AZ::IO::ZipDir
         FileEntryTree m_treeDir;
         AZ::IO::HandleType m_fileHandle = AZ::IO::InvalidHandle;
         AZ::IO::Path m_strFilePath;
+        // read-only view of the whole zip file, shared through the OS page cache with other processes mapping the same file
+        AZStd::shared_ptr<const AZ::IO::MemoryMappedFile> m_mappedFile;
 
         // String Pool for persistently storing paths as long as they reside in the cache
         AZStd::unordered_set<AZ::IO::Path> m_relativePathPool;
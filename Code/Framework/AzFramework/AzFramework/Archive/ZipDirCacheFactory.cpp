@@ -10,6 +10,7 @@
 #include <AzCore/Console/Console.h>
 #include <AzCore/IO/SystemFile.h> // for AZ_MAX_PATH_LEN
 #include <AzCore/Interface/Interface.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
 #include <AzCore/std/sort.h>
 #include <AzFramework/Archive/Archive.h>
 #include <AzFramework/Archive/ZipDirStructures.h>
@@ -89,6 +90,21 @@ namespace AZ::IO::ZipDir
                 AZ_Warning("Archive", false, R"(ZD_ERROR_IO_FAILED: Could not read the CDR of the pack file "%s".)", pCache->m_strFilePath.c_str());
                 return {};
             }
+
+            if ((m_nFlags & FLAGS_MEMORY_MAPPED) && !(m_nFlags & FLAGS_READ_INSIDE_PAK))
+            {
+                // Failing to map isn't fatal, reads will go through the file handle instead.
+                AZ::IO::FixedMaxPath nativePath;
+                auto mappedFile = AZStd::make_shared<AZ::IO::MemoryMappedFile>();
+                if (AZ::IO::FileIOBase::GetDirectInstance()->ResolvePath(nativePath, szFileName) && mappedFile->Map(nativePath.c_str()))
+                {
+                    pCache->m_mappedFile = AZStd::move(mappedFile);
+                }
+                else
+                {
+                    AZ_Warning("Archive", false, R"(Unable to memory map pack file "%s", falling back to file reads.)", szFileName);
+                }
+            }
         }
         else
         {
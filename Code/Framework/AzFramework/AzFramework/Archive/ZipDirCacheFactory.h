@@ -36,6 +36,9 @@ namespace AZ::IO::ZipDir
 
             // if this is set, zip path will be searched inside other zips
             FLAGS_READ_INSIDE_PAK = 1 << 7,
+            // if this is set together with FLAGS_READ_ONLY, the whole zip file is mapped into memory and file data is
+            // served from the mapping. Ignored for zips that are read from inside other zips
+            FLAGS_MEMORY_MAPPED = 1 << 8,
         };
 
         // initializes the internal structures
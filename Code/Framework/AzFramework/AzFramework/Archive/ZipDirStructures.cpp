@@ -595,6 +595,19 @@ namespace AZ::IO::ZipDir
 
     int ZipRawCompressZSTD(const void* pUncompressed, size_t* pDestSize, void* pCompressed, size_t nSrcSize, [[maybe_unused]] int nLevel)
     {
+        if (nSrcSize > AZ::SeekableZStd::DefaultFrameSize)
+        {
+            // files that span multiple frames are written in the seekable format, so partial reads only need to read
+            // and decompress the frames that overlap the requested range
+            size_t nSizeCompressed = AZ::SeekableZStd::Compress(pCompressed, *pDestSize, pUncompressed, nSrcSize, 1);
+            if (nSizeCompressed == 0)
+            {
+                return Z_BUF_ERROR;
+            }
+            *pDestSize = nSizeCompressed;
+            return Z_OK;
+        }
+
         size_t result = ZSTD_compress(pCompressed, *pDestSize, pUncompressed, nSrcSize, 1);
 
         int err = Z_OK;
@@ -13,9 +13,11 @@
 #pragma once
 
 #include <AzCore/base.h>
+#include <AzCore/Compression/SeekableZStd.h>
 #include <AzCore/IO/FileIO.h>
 #include <AzCore/IO/SystemFile.h>
 #include <AzCore/std/smart_ptr/intrusive_ptr.h>
+#include <AzCore/std/smart_ptr/shared_ptr.h>
 #include <AzFramework/Archive/IArchive.h>
 #include <AzFramework/Archive/ZipFileFormat.h>
 #include <AzFramework/AzFrameworkAPI.h>
@@ -208,6 +210,10 @@ namespace AZ::IO::ZipDir
         // mutex that can be used to product reads for the current file entry
         AZStd::mutex m_readLock;
 
+        // seek table of a file that was compressed in zstd's seekable format, loaded by Cache::GetSeekTable on first use
+        AZStd::shared_ptr<const AZ::SeekableZStd::SeekTable> m_seekTable;
+        bool m_seekTableLoaded = false;
+
         using FileEntryBase::FileEntryBase;
 
         AZ_DISABLE_COPY_MOVE(FileEntry);
@@ -0,0 +1,41 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/base.h>
+#include <AzCore/IO/Path/Path_fwd.h>
+#include <AzFramework/AzFrameworkAPI.h>
+
+namespace AZ::IO
+{
+    //! Read-only view of an entire file mapped into the address space of the process.
+    //! Pages are backed by the OS page cache, so multiple processes mapping the same file share the same physical memory.
+    class AZF_API MemoryMappedFile
+    {
+    public:
+        MemoryMappedFile() = default;
+        ~MemoryMappedFile();
+
+        MemoryMappedFile(const MemoryMappedFile&) = delete;
+        MemoryMappedFile& operator=(const MemoryMappedFile&) = delete;
+
+        //! Maps the file at the given native path. Any previous mapping is released first.
+        //! @return True if the file was mapped, false if the file couldn't be opened, is empty or couldn't be mapped.
+        bool Map(const char* nativePath);
+        //! Releases the mapping. Pointers previously returned by GetData() become invalid.
+        void Unmap();
+
+        bool IsMapped() const { return m_data != nullptr; }
+        const uint8_t* GetData() const { return m_data; }
+        AZ::u64 GetSize() const { return m_size; }
+
+    private:
+        const uint8_t* m_data = nullptr;
+        AZ::u64 m_size = 0;
+    };
+} // namespace AZ::IO
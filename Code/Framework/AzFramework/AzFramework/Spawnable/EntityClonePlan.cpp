@@ -0,0 +1,225 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/Component/Component.h>
+#include <AzCore/Component/Entity.h>
+#include <AzCore/Serialization/IdUtils.h>
+#include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/std/algorithm.h>
+#include <AzFramework/Spawnable/EntityClonePlan.h>
+
+namespace AzFramework
+{
+    bool EntityClonePlan::Build(const AZ::Entity& prototype, AZ::SerializeContext& serializeContext)
+    {
+        m_objects.clear();
+        m_isValid = false;
+
+        const AZ::Entity::ComponentArrayType& components = prototype.GetComponents();
+        m_objects.resize(components.size() + 1);
+        m_objects[0].m_type = azrtti_typeid<AZ::Entity>();
+        for (size_t i = 0; i < components.size(); ++i)
+        {
+            m_objects[i + 1].m_type = components[i]->RTTI_GetType();
+        }
+
+        struct Frame
+        {
+            const AZ::u8* m_objectAddress; // Start of the entity or component this element belongs to.
+            size_t m_objectIndex;
+            bool m_isContainer; // The element is a container so its children don't have a fixed offset.
+            bool m_isIndirect; // The element is stored in a container or behind a pointer.
+        };
+        AZStd::vector<Frame> stack;
+        stack.reserve(32);
+
+        auto beginCB = [this, &stack, &components, &prototype](
+                           void* ptr, const AZ::SerializeContext::ClassData* classData,
+                           const AZ::SerializeContext::ClassElement* elementData) -> bool
+        {
+            Frame frame;
+            if (stack.empty())
+            {
+                frame = { static_cast<const AZ::u8*>(ptr), 0, false, false };
+            }
+            else
+            {
+                const Frame& parent = stack.back();
+                frame = parent;
+                frame.m_isIndirect = parent.m_isIndirect || parent.m_isContainer;
+                if (elementData && (elementData->m_flags & AZ::SerializeContext::ClassElement::FLG_POINTER))
+                {
+                    // For pointers the address of the pointer is provided. Components are the only pointers that start a new
+                    // object, everything else that's referenced by a pointer is stored separately from the object.
+                    const void* target = *static_cast<void* const*>(ptr);
+                    auto componentIt = (parent.m_objectIndex == 0 && parent.m_isContainer)
+                        ? AZStd::find(components.begin(), components.end(), target)
+                        : components.end();
+                    if (componentIt != components.end())
+                    {
+                        size_t objectIndex = aznumeric_cast<size_t>(AZStd::distance(components.begin(), componentIt)) + 1;
+                        frame.m_objectAddress =
+                            static_cast<const AZ::u8*>(GetObjectAddress(prototype, objectIndex, m_objects[objectIndex].m_type));
+                        frame.m_objectIndex = objectIndex;
+                        frame.m_isIndirect = false;
+                    }
+                    else
+                    {
+                        frame.m_isIndirect = true;
+                    }
+                }
+            }
+            frame.m_isContainer = classData->m_container != nullptr;
+
+            ObjectPlan& object = m_objects[frame.m_objectIndex];
+            if (classData->m_eventHandler)
+            {
+                // Event handlers may react to ids being written, which won't happen if the ids are patched directly.
+                object.m_useReflection = true;
+            }
+            if (classData->m_typeId == azrtti_typeid<AZ::EntityId>())
+            {
+                if (frame.m_isIndirect)
+                {
+                    object.m_useReflection = true;
+                }
+                else
+                {
+                    IdLocation location;
+                    location.m_generator = nullptr;
+                    location.m_offset = aznumeric_cast<size_t>(static_cast<const AZ::u8*>(ptr) - frame.m_objectAddress);
+                    if (elementData)
+                    {
+                        AZ::Attribute* attribute = AZ::FindAttribute(AZ::Edit::Attributes::IdGeneratorFunction, elementData->m_attributes);
+                        location.m_generator = attribute ? azrtti_cast<IdGeneratorAttribute*>(attribute) : nullptr;
+                    }
+                    object.m_ids.push_back(location);
+                }
+            }
+
+            stack.push_back(frame);
+            return true;
+        };
+
+        auto endCB = [&stack]() -> bool
+        {
+            stack.pop_back();
+            return true;
+        };
+
+        AZ::SerializeContext::EnumerateInstanceCallContext callContext(
+            beginCB, endCB, &serializeContext, AZ::SerializeContext::ENUM_ACCESS_FOR_READ, nullptr);
+        serializeContext.EnumerateInstanceConst(&callContext, &prototype, azrtti_typeid<AZ::Entity>(), nullptr, nullptr);
+
+        // Patching the entity's own ids while using reflection for the entity would process the components twice, so
+        // there's no benefit to a plan in that case.
+        m_isValid = !m_objects[0].m_useReflection;
+        return m_isValid;
+    }
+
+    bool EntityClonePlan::IsValid() const
+    {
+        return m_isValid;
+    }
+
+    bool EntityClonePlan::IsCompatible(const AZ::Entity& prototype) const
+    {
+        const AZ::Entity::ComponentArrayType& components = prototype.GetComponents();
+        if (components.size() + 1 != m_objects.size())
+        {
+            return false;
+        }
+        for (size_t i = 0; i < components.size(); ++i)
+        {
+            if (components[i]->RTTI_GetType() != m_objects[i + 1].m_type)
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    AZ::Entity* EntityClonePlan::Clone(
+        const AZ::Entity& prototype, EntityIdMap& prototypeToCloneMap, AZ::SerializeContext& serializeContext) const
+    {
+        AZ_Assert(m_isValid, "Cloning entity '%s' with a clone plan that isn't valid.", prototype.GetName().c_str());
+
+        AZ::Entity* clone = serializeContext.CloneObject(&prototype);
+        if (clone)
+        {
+            RemapIds(*clone, prototypeToCloneMap, serializeContext);
+        }
+        return clone;
+    }
+
+    void EntityClonePlan::RemapIds(AZ::Entity& clone, EntityIdMap& prototypeToCloneMap, AZ::SerializeContext& serializeContext) const
+    {
+        AZ_Assert(m_isValid, "Remapping ids of entity '%s' with a clone plan that isn't valid.", clone.GetName().c_str());
+        AZ_Assert(IsCompatible(clone), "Clone plan doesn't match the entity '%s'.", clone.GetName().c_str());
+
+        // Same behavior as the mapper in AZ::IdUtils::Remapper::GenerateNewIdsAndFixRefs without duplicate ids.
+        auto idMapper = [&prototypeToCloneMap](
+                            const AZ::EntityId& originalId, bool replaceId,
+                            const AZ::IdUtils::Remapper<AZ::EntityId>::IdGenerator& idGenerator) -> AZ::EntityId
+        {
+            if (replaceId)
+            {
+                return idGenerator ? prototypeToCloneMap.emplace(originalId, idGenerator()).first->second : originalId;
+            }
+            auto it = prototypeToCloneMap.find(originalId);
+            return it != prototypeToCloneMap.end() ? it->second : originalId;
+        };
+
+        // New ids have to be generated for the entire entity before references are updated so references to ids owned by
+        // this entity are found, matching the order of the reflection passes.
+        for (bool replaceIds : { true, false })
+        {
+            for (size_t i = 0; i < m_objects.size(); ++i)
+            {
+                const ObjectPlan& object = m_objects[i];
+                void* objectAddress = GetObjectAddress(clone, i, object.m_type);
+                if (object.m_useReflection)
+                {
+                    AZ::IdUtils::Remapper<AZ::EntityId>::RemapIds(objectAddress, object.m_type, idMapper, &serializeContext, replaceIds);
+                    continue;
+                }
+
+                for (const IdLocation& location : object.m_ids)
+                {
+                    if ((location.m_generator != nullptr) != replaceIds)
+                    {
+                        continue;
+                    }
+
+                    AZ::EntityId& id = *reinterpret_cast<AZ::EntityId*>(static_cast<AZ::u8*>(objectAddress) + location.m_offset);
+                    if (replaceIds)
+                    {
+                        id = prototypeToCloneMap.emplace(id, location.m_generator->Invoke(nullptr)).first->second;
+                    }
+                    else if (auto it = prototypeToCloneMap.find(id); it != prototypeToCloneMap.end())
+                    {
+                        id = it->second;
+                    }
+                }
+            }
+        }
+    }
+
+    void* EntityClonePlan::GetObjectAddress(AZ::Entity& entity, size_t objectIndex, const AZ::TypeId& type)
+    {
+        // Components can use multiple inheritance so the component pointer doesn't have to point to the start of the component.
+        return objectIndex == 0 ? static_cast<void*>(&entity) : entity.GetComponents()[objectIndex - 1]->RTTI_AddressOf(type);
+    }
+
+    const void* EntityClonePlan::GetObjectAddress(const AZ::Entity& entity, size_t objectIndex, const AZ::TypeId& type)
+    {
+        return objectIndex == 0 ? static_cast<const void*>(&entity)
+                                : static_cast<const AZ::Component*>(entity.GetComponents()[objectIndex - 1])->RTTI_AddressOf(type);
+    }
+} // namespace AzFramework
@@ -0,0 +1,83 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Component/EntityId.h>
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/RTTI/ReflectContext.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzFramework/AzFrameworkAPI.h>
+
+namespace AZ
+{
+    class Entity;
+    class SerializeContext;
+}
+
+namespace AzFramework
+{
+    //! Precompiled description of where the entity ids are stored in a prototype entity and its components.
+    //! Spawning an entity clones the prototype and then makes two passes with the SerializeContext over the clone to generate
+    //! new entity ids and fix up references to other entities. The clone plan records the offsets of all entity ids once, so
+    //! after cloning the ids can be patched directly and only the clone itself requires reflection.
+    //! Components that store entity ids in containers, behind pointers or in classes with serialization event handlers can't
+    //! be described with fixed offsets. These components are still remapped through reflection.
+    class AZF_API EntityClonePlan final
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(EntityClonePlan, AZ::SystemAllocator);
+
+        using EntityIdMap = AZStd::unordered_map<AZ::EntityId, AZ::EntityId>;
+
+        //! Builds the plan for the provided prototype. Returns false if no plan could be created for the entity, in which case
+        //! the entity has to be cloned using reflection.
+        bool Build(const AZ::Entity& prototype, AZ::SerializeContext& serializeContext);
+
+        //! Returns true if a plan was successfully built.
+        bool IsValid() const;
+        //! Returns true if the plan was built for an entity with the same components as the provided prototype.
+        bool IsCompatible(const AZ::Entity& prototype) const;
+
+        //! Clones the prototype and generates new entity ids. This produces the same result as
+        //! AZ::IdUtils::Remapper<AZ::EntityId, false>::CloneObjectAndGenerateNewIdsAndFixRefs.
+        AZ::Entity* Clone(const AZ::Entity& prototype, EntityIdMap& prototypeToCloneMap, AZ::SerializeContext& serializeContext) const;
+        //! Generates new entity ids for a clone of the prototype the plan was built for. This is the second half of Clone and
+        //! allows the clone to be created separately, for instance on another thread.
+        void RemapIds(AZ::Entity& clone, EntityIdMap& prototypeToCloneMap, AZ::SerializeContext& serializeContext) const;
+
+    private:
+        using IdGeneratorAttribute = AZ::AttributeFunction<AZ::EntityId()>;
+
+        struct IdLocation
+        {
+            //! The function to create a new id with if this is an entity id that's owned by the object, otherwise nullptr
+            //! if it's a reference to another entity.
+            IdGeneratorAttribute* m_generator;
+            //! The offset of the entity id from the start of the object.
+            size_t m_offset;
+        };
+
+        //! The plan for either the entity or one of its components.
+        struct ObjectPlan
+        {
+            AZStd::vector<IdLocation> m_ids;
+            AZ::TypeId m_type;
+            //! If set the entity ids in the object can't be patched directly and reflection is used instead.
+            bool m_useReflection{ false };
+        };
+
+        static void* GetObjectAddress(AZ::Entity& entity, size_t objectIndex, const AZ::TypeId& type);
+        static const void* GetObjectAddress(const AZ::Entity& entity, size_t objectIndex, const AZ::TypeId& type);
+
+        //! The entity is stored first, followed by its components in the same order as the entity stores them.
+        AZStd::vector<ObjectPlan> m_objects;
+        bool m_isValid{ false };
+    };
+} // namespace AzFramework
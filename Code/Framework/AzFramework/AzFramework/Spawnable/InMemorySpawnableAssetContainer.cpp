@@ -119,12 +119,19 @@ namespace AzFramework
             LoadReferencedAssets(spawnableAssetData);
         }
 
+        AZ::SerializeContext* serializeContext = nullptr;
+        AZ::ComponentApplicationBus::BroadcastResult(serializeContext, &AZ::ComponentApplicationBus::Events::GetSerializeContext);
+
         // Delay resolving aliases to guarantee that the depended spawnables are already registered.
         for (auto spawnablePair : spawnables)
         {
             Spawnable* spawnable = spawnablePair.first;
             const AZStd::string& spawnableName = spawnablePair.second;
             SpawnableAssetUtils::ResolveEntityAliases(spawnable, spawnableName);
+            if (serializeContext)
+            {
+                spawnable->BuildClonePlans(*serializeContext);
+            }
         }
 
         auto& spawnableAssetDataAdded = m_spawnableAssets.emplace(targetSpawnableName, spawnableAssetData).first->second;
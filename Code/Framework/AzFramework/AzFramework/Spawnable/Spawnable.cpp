@@ -446,6 +446,32 @@ namespace AzFramework
         return m_entities.empty();
     }
 
+    void Spawnable::BuildClonePlans(AZ::SerializeContext& serializeContext)
+    {
+        m_clonePlans.clear();
+        m_clonePlans.resize(m_entities.size());
+        for (size_t i = 0; i < m_entities.size(); ++i)
+        {
+            if (m_entities[i])
+            {
+                m_clonePlans[i].Build(*m_entities[i], serializeContext);
+            }
+        }
+    }
+
+    const EntityClonePlan* Spawnable::GetClonePlan(size_t entityIndex) const
+    {
+        if (entityIndex < m_clonePlans.size() && entityIndex < m_entities.size())
+        {
+            const EntityClonePlan& plan = m_clonePlans[entityIndex];
+            if (plan.IsValid() && plan.IsCompatible(*m_entities[entityIndex]))
+            {
+                return &plan;
+            }
+        }
+        return nullptr;
+    }
+
     SpawnableMetaData& Spawnable::GetMetaData()
     {
         return m_metaData;
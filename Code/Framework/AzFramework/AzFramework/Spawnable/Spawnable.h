@@ -14,12 +14,14 @@
 #include <AzCore/std/parallel/atomic.h>
 #include <AzCore/std/containers/vector.h>
 #include <AzCore/std/smart_ptr/unique_ptr.h>
+#include <AzFramework/Spawnable/EntityClonePlan.h>
 #include <AzFramework/Spawnable/SpawnableMetaData.h>
 #include <AzFramework/AzFrameworkAPI.h>
 
 namespace AZ
 {
     class ReflectContext;
+    class SerializeContext;
 }
 
 namespace AzFramework
@@ -168,6 +170,12 @@ namespace AzFramework
         EntityAliasVisitor TryGetAliases();
         bool IsEmpty() const;
 
+        //! Builds the clone plans that speed up spawning the entities in this spawnable. The plans describe the entities as they
+        //! are at the time of the call, so this needs to be called again if entities are changed afterwards.
+        void BuildClonePlans(AZ::SerializeContext& serializeContext);
+        //! Returns the clone plan for the entity at the provided index or nullptr if there's no usable plan for the entity.
+        const EntityClonePlan* GetClonePlan(size_t entityIndex) const;
+
         SpawnableMetaData& GetMetaData();
         const SpawnableMetaData& GetMetaData() const;
 
@@ -181,6 +189,8 @@ namespace AzFramework
         // Container for keeping all entities of the prefab the Spawnable was created from.
         // Includes both direct and nested entities of the prefab.
         EntityList m_entities;
+        // Precompiled plans to clone the entities with, stored at the same index as the entity. Not serialized.
+        AZStd::vector<EntityClonePlan> m_clonePlans;
 
         mutable AZStd::atomic<int32_t> m_shareState{ ShareState::NotShared };
     };
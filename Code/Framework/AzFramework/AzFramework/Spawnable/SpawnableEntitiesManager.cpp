@@ -11,6 +11,8 @@
 #include <AzCore/Serialization/IdUtils.h>
 #include <AzCore/Serialization/SerializeContext.h>
 #include <AzCore/Settings/SettingsRegistry.h>
+#include <AzCore/Task/TaskGraph.h>
+#include <AzCore/std/algorithm.h>
 #include <AzCore/std/parallel/scoped_lock.h>
 #include <AzCore/std/smart_ptr/make_shared.h>
 #include <AzFramework/Components/TransformComponent.h>
@@ -44,6 +46,15 @@ namespace AzFramework
             AZ::u64 value = aznumeric_caster(m_highPriorityThreshold);
             settingsRegistry->Get(value, "/O3DE/AzFramework/Spawnables/HighPriorityThreshold");
             m_highPriorityThreshold = aznumeric_cast<SpawnablePriority>(AZStd::clamp(value, 0llu, 255llu));
+            settingsRegistry->Get(m_useClonePlans, "/O3DE/AzFramework/Spawnables/UseClonePlans");
+
+            value = m_parallelCloneThreshold;
+            settingsRegistry->Get(value, "/O3DE/AzFramework/Spawnables/ParallelCloneThreshold");
+            m_parallelCloneThreshold = aznumeric_cast<size_t>(value);
+
+            value = aznumeric_cast<AZ::u64>(m_regularPriorityTimeBudget.count());
+            settingsRegistry->Get(value, "/O3DE/AzFramework/Spawnables/RegularPriorityTimeBudgetUs");
+            m_regularPriorityTimeBudget = AZStd::chrono::microseconds(value);
         }
     }
 
@@ -232,6 +243,12 @@ namespace AzFramework
 
     auto SpawnableEntitiesManager::ProcessQueue(Queue& queue) -> CommandQueueStatus
     {
+        // Requests that support it will stop adding entities once the time budget has been used up and continue the next
+        // time the queue is processed. Requests in the high priority queue are always completed immediately.
+        m_processingDeadline = (&queue == &m_regularPriorityQueue && m_regularPriorityTimeBudget.count() > 0)
+            ? AZStd::chrono::steady_clock::now() + m_regularPriorityTimeBudget
+            : AZStd::chrono::steady_clock::time_point::max();
+
         // Process delayed requests first.
         // Only process the requests that are currently in this queue, not the ones that could be re-added if they still can't complete.
         size_t delayedSize = queue.m_delayed.size();
@@ -342,18 +359,94 @@ namespace AzFramework
         return reinterpret_cast<Ticket*>(ticket)->m_spawnable;
     }
 
-    AZ::Entity* SpawnableEntitiesManager::CloneSingleEntity(const AZ::Entity& entityPrototype,
+    AZ::Entity* SpawnableEntitiesManager::CloneSingleEntity(const Spawnable& spawnable, size_t entityIndex,
         EntityIdMap& prototypeToCloneMap, AZ::SerializeContext& serializeContext)
     {
+        AZ::Entity* clone = serializeContext.CloneObject(spawnable.GetEntities()[entityIndex].get());
+        if (clone)
+        {
+            RemapClonedEntityIds(spawnable, entityIndex, *clone, prototypeToCloneMap, serializeContext);
+        }
+        return clone;
+    }
+
+    void SpawnableEntitiesManager::RemapClonedEntityIds(
+        const Spawnable& spawnable, size_t entityIndex, AZ::Entity& clone, EntityIdMap& prototypeToCloneMap,
+        AZ::SerializeContext& serializeContext)
+    {
+        // The clone plan patches the entity ids directly instead of searching for them with reflection. Entities without a
+        // plan are remapped using reflection. Plans are built with the default serialize context so can't be used with others.
+        const EntityClonePlan* clonePlan =
+            m_useClonePlans && &serializeContext == m_defaultSerializeContext ? spawnable.GetClonePlan(entityIndex) : nullptr;
+        if (clonePlan)
+        {
+            clonePlan->RemapIds(clone, prototypeToCloneMap, serializeContext);
+            return;
+        }
+
         // If the same ID gets remapped more than once, preserve the original remapping instead of overwriting it.
         constexpr bool allowDuplicateIds = false;
 
-        return AZ::IdUtils::Remapper<AZ::EntityId, allowDuplicateIds>::CloneObjectAndGenerateNewIdsAndFixRefs(
-            &entityPrototype, prototypeToCloneMap, &serializeContext);
+        AZ::IdUtils::Remapper<AZ::EntityId, allowDuplicateIds>::GenerateNewIdsAndFixRefs(&clone, prototypeToCloneMap, &serializeContext);
+    }
+
+    bool SpawnableEntitiesManager::ShouldCloneInParallel(size_t entityCount) const
+    {
+        if (m_parallelCloneThreshold == 0 || entityCount < m_parallelCloneThreshold)
+        {
+            return false;
+        }
+        const AZ::TaskGraphActiveInterface* taskGraphActive = AZ::Interface<AZ::TaskGraphActiveInterface>::Get();
+        return taskGraphActive && taskGraphActive->IsTaskGraphActive();
+    }
+
+    void SpawnableEntitiesManager::CloneEntitiesInParallel(
+        const Spawnable::EntityList& prototypes, AZ::Entity** clones, AZ::SerializeContext& serializeContext)
+    {
+        // Cloning an entity only reads the prototype and the serialize context, so entities can be cloned independently as long
+        // as the component constructors and serialize event handlers don't touch shared state, which is what enabling the
+        // parallel clone threshold opts into. Ids are remapped afterwards as that requires updating the shared id map in spawn order.
+        static const AZ::TaskDescriptor descriptor{ "AzFramework::SpawnableEntitiesManager::CloneEntities", "Spawnables" };
+        AZ::TaskGraph taskGraph{ "SpawnableCloneEntities" };
+        const size_t entityCount = prototypes.size();
+        for (size_t begin = 0; begin < entityCount; begin += ParallelCloneBatchSize)
+        {
+            const size_t end = AZStd::min(begin + ParallelCloneBatchSize, entityCount);
+            taskGraph.AddTask(descriptor, [&prototypes, clones, &serializeContext, begin, end]()
+            {
+                for (size_t i = begin; i < end; ++i)
+                {
+                    clones[i] = serializeContext.CloneObject(prototypes[i].get());
+                }
+            });
+        }
+
+        AZ::TaskGraphEvent finishedEvent{ "SpawnableCloneEntities Wait" };
+        taskGraph.Submit(&finishedEvent);
+        finishedEvent.Wait();
+    }
+
+    bool SpawnableEntitiesManager::AddEntitiesToGame(
+        AZStd::vector<AZ::Entity*>& entities, size_t& nextEntityIndex, EntitySpawnTicket::Id ticketId)
+    {
+        while (nextEntityIndex < entities.size())
+        {
+            AZ::Entity* clone = entities[nextEntityIndex++];
+            clone->SetEntitySpawnTicketId(ticketId);
+            GameEntityContextRequestBus::Broadcast(&GameEntityContextRequestBus::Events::AddGameEntity, clone);
+
+            // Always add at least one entity so progress is made even if the budget is smaller than the time to add an entity.
+            if (AZStd::chrono::steady_clock::now() >= m_processingDeadline)
+            {
+                break;
+            }
+        }
+        return nextEntityIndex == entities.size();
     }
 
     AZ::Entity* SpawnableEntitiesManager::CloneSingleAliasedEntity(
-        const AZ::Entity& entityPrototype,
+        const Spawnable& spawnable,
+        size_t entityIndex,
         const Spawnable::EntityAlias& alias,
         EntityIdMap& prototypeToCloneMap,
         AZ::Entity* previouslySpawnedEntity,
@@ -364,20 +457,20 @@ namespace AzFramework
         {
         case Spawnable::EntityAliasType::Original:
             // Behave as the original version.
-            clone = CloneSingleEntity(entityPrototype, prototypeToCloneMap, serializeContext);
+            clone = CloneSingleEntity(spawnable, entityIndex, prototypeToCloneMap, serializeContext);
             AZ_Assert(clone != nullptr, "Failed to clone spawnable entity.");
             return clone;
         case Spawnable::EntityAliasType::Disable:
             // Do nothing.
             return nullptr;
         case Spawnable::EntityAliasType::Replace:
-            clone = CloneSingleEntity(*(alias.m_spawnable->GetEntities()[alias.m_targetIndex]), prototypeToCloneMap, serializeContext);
+            clone = CloneSingleEntity(*alias.m_spawnable, alias.m_targetIndex, prototypeToCloneMap, serializeContext);
             AZ_Assert(clone != nullptr, "Failed to clone spawnable entity.");
             return clone;
         case Spawnable::EntityAliasType::Additional:
             // The asset handler will have sorted and inserted a Spawnable::EntityAliasType::Original, so the just
             // spawn the additional entity.
-            clone = CloneSingleEntity(*(alias.m_spawnable->GetEntities()[alias.m_targetIndex]), prototypeToCloneMap, serializeContext);
+            clone = CloneSingleEntity(*alias.m_spawnable, alias.m_targetIndex, prototypeToCloneMap, serializeContext);
             AZ_Assert(clone != nullptr, "Failed to clone spawnable entity.");
             return clone;
         case Spawnable::EntityAliasType::Merge:
@@ -449,9 +542,16 @@ namespace AzFramework
         Ticket& ticket = *request.m_ticket;
         if (ticket.m_spawnable.IsReady() && request.m_requestId == ticket.m_currentRequestId)
         {
-            if (Spawnable::EntityAliasConstVisitor aliases = ticket.m_spawnable->TryGetAliasesConst();
-                aliases.IsValid() && aliases.AreAllSpawnablesReady())
+            // Entities are cloned the first time the request is processed. If the time budget ran out while adding the entities
+            // to the game, the request is processed again later to add the remaining entities.
+            if (!request.m_entitiesCloned)
             {
+                Spawnable::EntityAliasConstVisitor aliases = ticket.m_spawnable->TryGetAliasesConst();
+                if (!aliases.IsValid() || !aliases.AreAllSpawnablesReady())
+                {
+                    return CommandResult::Requeue;
+                }
+
                 AZStd::vector<AZ::Entity*>& spawnedEntities = ticket.m_spawnedEntities;
                 AZStd::vector<uint32_t>& spawnedEntityIndices = ticket.m_spawnedEntityIndices;
 
@@ -476,7 +576,27 @@ namespace AzFramework
 
                 auto aliasIt = aliases.begin();
                 auto aliasEnd = aliases.end();
-                if (aliasIt == aliasEnd)
+                if (aliasIt == aliasEnd && ShouldCloneInParallel(entitiesToSpawnSize))
+                {
+                    spawnedEntities.resize(spawnedEntitiesInitialCount + entitiesToSpawnSize);
+                    AZ::Entity** clones = spawnedEntities.data() + spawnedEntitiesInitialCount;
+                    CloneEntitiesInParallel(entitiesToSpawn, clones, *request.m_serializeContext);
+
+                    for (uint32_t i = 0; i < entitiesToSpawnSize; ++i)
+                    {
+                        // If this entity has previously been spawned, give it a new id in the reference map
+                        RefreshEntityIdMapping(
+                            entitiesToSpawn[i].get()->GetId(), ticket.m_entityIdReferenceMap, ticket.m_previouslySpawned);
+
+                        if (clones[i])
+                        {
+                            RemapClonedEntityIds(
+                                *ticket.m_spawnable, i, *clones[i], ticket.m_entityIdReferenceMap, *request.m_serializeContext);
+                        }
+                        spawnedEntityIndices.push_back(i);
+                    }
+                }
+                else if (aliasIt == aliasEnd)
                 {
                     for (uint32_t i = 0; i < entitiesToSpawnSize; ++i)
                     {
@@ -485,7 +605,7 @@ namespace AzFramework
                             entitiesToSpawn[i].get()->GetId(), ticket.m_entityIdReferenceMap, ticket.m_previouslySpawned);
 
                         spawnedEntities.emplace_back(
-                            CloneSingleEntity(*entitiesToSpawn[i], ticket.m_entityIdReferenceMap, *request.m_serializeContext));
+                            CloneSingleEntity(*ticket.m_spawnable, i, ticket.m_entityIdReferenceMap, *request.m_serializeContext));
                         spawnedEntityIndices.push_back(i);
                     }
                 }
@@ -500,7 +620,7 @@ namespace AzFramework
                         if (aliasIt == aliasEnd || aliasIt->m_sourceIndex != i)
                         {
                             spawnedEntities.emplace_back(
-                                CloneSingleEntity(*entitiesToSpawn[i], ticket.m_entityIdReferenceMap, *request.m_serializeContext));
+                                CloneSingleEntity(*ticket.m_spawnable, i, ticket.m_entityIdReferenceMap, *request.m_serializeContext));
                             spawnedEntityIndices.push_back(i);
                         }
                         else
@@ -511,7 +631,7 @@ namespace AzFramework
                             do
                             {
                                 AZ::Entity* clone = CloneSingleAliasedEntity(
-                                    *entitiesToSpawn[i], *aliasIt, ticket.m_entityIdReferenceMap, previousEntity,
+                                    *ticket.m_spawnable, i, *aliasIt, ticket.m_entityIdReferenceMap, previousEntity,
                                     *request.m_serializeContext);
                                 previousEntity = clone;
                                 if (clone)
@@ -529,31 +649,35 @@ namespace AzFramework
                 // a new set are not added so it no longer holds exactly the number of entities.
                 ticket.m_loadAll = spawnedEntitiesInitialCount == 0;
 
-                auto newEntitiesBegin = ticket.m_spawnedEntities.begin() + spawnedEntitiesInitialCount;
-                auto newEntitiesEnd = ticket.m_spawnedEntities.end();
+                request.m_firstNewEntityIndex = spawnedEntitiesInitialCount;
+                request.m_nextEntityToAddIndex = spawnedEntitiesInitialCount;
+                request.m_entitiesCloned = true;
+
                 // Let other systems know about newly spawned entities for any pre-processing before adding to the scene/game context.
                 if (request.m_preInsertionCallback)
                 {
-                    request.m_preInsertionCallback(request.m_ticketId, SpawnableEntityContainerView(newEntitiesBegin, newEntitiesEnd));
-                }
-
-                // Add to the game context, now the entities are active
-                for (auto it = newEntitiesBegin; it != newEntitiesEnd; ++it)
-                {
-                    AZ::Entity* clone = (*it);
-                    clone->SetEntitySpawnTicketId(request.m_ticketId);
-                    GameEntityContextRequestBus::Broadcast(&GameEntityContextRequestBus::Events::AddGameEntity, clone);
+                    request.m_preInsertionCallback(
+                        request.m_ticketId,
+                        SpawnableEntityContainerView(spawnedEntities.begin() + spawnedEntitiesInitialCount, spawnedEntities.end()));
                 }
+            }
 
-                // Let other systems know about newly spawned entities for any post-processing after adding to the scene/game context.
-                if (request.m_completionCallback)
-                {
-                    request.m_completionCallback(request.m_ticketId, SpawnableConstEntityContainerView(newEntitiesBegin, newEntitiesEnd));
-                }
+            // Add to the game context, which will activate the entities. This may take several passes if there's a time budget.
+            if (!AddEntitiesToGame(ticket.m_spawnedEntities, request.m_nextEntityToAddIndex, request.m_ticketId))
+            {
+                return CommandResult::Requeue;
+            }
 
-                ticket.m_currentRequestId++;
-                return CommandResult::Executed;
+            // Let other systems know about newly spawned entities for any post-processing after adding to the scene/game context.
+            if (request.m_completionCallback)
+            {
+                auto newEntitiesBegin = ticket.m_spawnedEntities.begin() + request.m_firstNewEntityIndex;
+                auto newEntitiesEnd = ticket.m_spawnedEntities.end();
+                request.m_completionCallback(request.m_ticketId, SpawnableConstEntityContainerView(newEntitiesBegin, newEntitiesEnd));
             }
+
+            ticket.m_currentRequestId++;
+            return CommandResult::Executed;
         }
         return CommandResult::Requeue;
     }
@@ -607,8 +731,8 @@ namespace AzFramework
                             RefreshEntityIdMapping(
                                 entitiesToSpawn[index].get()->GetId(), ticket.m_entityIdReferenceMap, ticket.m_previouslySpawned);
 
-                            spawnedEntities.push_back(
-                                CloneSingleEntity(*entitiesToSpawn[index], ticket.m_entityIdReferenceMap, *request.m_serializeContext));
+                            spawnedEntities.push_back(CloneSingleEntity(
+                                *ticket.m_spawnable, index, ticket.m_entityIdReferenceMap, *request.m_serializeContext));
                             spawnedEntityIndices.push_back(index);
                         }
                     }
@@ -632,8 +756,8 @@ namespace AzFramework
 
                             if (aliasIt == aliasEnd || aliasIt->m_sourceIndex != index)
                             {
-                                spawnedEntities.emplace_back(
-                                    CloneSingleEntity(*entitiesToSpawn[index], ticket.m_entityIdReferenceMap, *request.m_serializeContext));
+                                spawnedEntities.emplace_back(CloneSingleEntity(
+                                    *ticket.m_spawnable, index, ticket.m_entityIdReferenceMap, *request.m_serializeContext));
                                 spawnedEntityIndices.push_back(index);
                             }
                             else
@@ -644,7 +768,7 @@ namespace AzFramework
                                 do
                                 {
                                     AZ::Entity* clone = CloneSingleAliasedEntity(
-                                        *entitiesToSpawn[index], *aliasIt, ticket.m_entityIdReferenceMap, previousEntity,
+                                        *ticket.m_spawnable, index, *aliasIt, ticket.m_entityIdReferenceMap, previousEntity,
                                         *request.m_serializeContext);
                                     previousEntity = clone;
                                     if (clone)
@@ -802,7 +926,8 @@ namespace AzFramework
                     // If this entity has previously been spawned, give it a new id in the reference map
                     RefreshEntityIdMapping(entities[i].get()->GetId(), ticket.m_entityIdReferenceMap, ticket.m_previouslySpawned);
 
-                    AZ::Entity* clone = CloneSingleEntity(*entities[i], ticket.m_entityIdReferenceMap, *request.m_serializeContext);
+                    AZ::Entity* clone =
+                        CloneSingleEntity(*request.m_spawnable, i, ticket.m_entityIdReferenceMap, *request.m_serializeContext);
                     AZ_Assert(clone != nullptr, "Failed to clone spawnable entity.");
 
                     ticket.m_spawnedEntities.push_back(clone);
@@ -823,7 +948,8 @@ namespace AzFramework
                         // If this entity has previously been spawned, give it a new id in the reference map
                         RefreshEntityIdMapping(entities[index].get()->GetId(), ticket.m_entityIdReferenceMap, ticket.m_previouslySpawned);
 
-                        AZ::Entity* clone = CloneSingleEntity(*entities[index], ticket.m_entityIdReferenceMap, *request.m_serializeContext);
+                        AZ::Entity* clone =
+                            CloneSingleEntity(*request.m_spawnable, index, ticket.m_entityIdReferenceMap, *request.m_serializeContext);
                         AZ_Assert(clone != nullptr, "Failed to clone spawnable entity.");
                         ticket.m_spawnedEntities.push_back(clone);
                     }
@@ -9,6 +9,7 @@
 #pragma once
 
 #include <AzCore/Memory/PoolAllocator.h>
+#include <AzCore/std/chrono/chrono.h>
 #include <AzCore/std/limits.h>
 #include <AzCore/std/containers/queue.h>
 #include <AzCore/std/containers/deque.h>
@@ -135,6 +136,10 @@ namespace AzFramework
             Ticket* m_ticket;
             EntitySpawnTicket::Id m_ticketId;
             uint32_t m_requestId;
+            //! Progress of the request. Adding entities to the game can be spread over multiple updates if there's a time budget.
+            size_t m_firstNewEntityIndex{ 0 };
+            size_t m_nextEntityToAddIndex{ 0 };
+            bool m_entitiesCloned{ false };
         };
         struct SpawnEntitiesCommand final
         {
@@ -266,9 +271,23 @@ namespace AzFramework
         CommandQueueStatus ProcessQueue(Queue& queue);
 
         AZ::Entity* CloneSingleEntity(
-            const AZ::Entity& entityPrototype, EntityIdMap& prototypeToCloneMap, AZ::SerializeContext& serializeContext);
+            const Spawnable& spawnable, size_t entityIndex, EntityIdMap& prototypeToCloneMap, AZ::SerializeContext& serializeContext);
+        void RemapClonedEntityIds(
+            const Spawnable& spawnable,
+            size_t entityIndex,
+            AZ::Entity& clone,
+            EntityIdMap& prototypeToCloneMap,
+            AZ::SerializeContext& serializeContext);
+        bool ShouldCloneInParallel(size_t entityCount) const;
+        //! Clones all prototypes on the task graph. The ids of the clones still need to be remapped. Requires the types in the
+        //! prototypes to be safe to construct and copy through the serialize context from multiple threads at the same time.
+        void CloneEntitiesInParallel(const Spawnable::EntityList& prototypes, AZ::Entity** clones, AZ::SerializeContext& serializeContext);
+        //! Adds entities to the game, starting at nextEntityIndex, until all entities are added or the processing deadline has
+        //! passed. Returns true if all entities have been added.
+        bool AddEntitiesToGame(AZStd::vector<AZ::Entity*>& entities, size_t& nextEntityIndex, EntitySpawnTicket::Id ticketId);
         AZ::Entity* CloneSingleAliasedEntity(
-            const AZ::Entity& entityPrototype,
+            const Spawnable& spawnable,
+            size_t entityIndex,
             const Spawnable::EntityAlias& alias,
             EntityIdMap& prototypeToCloneMap,
             AZ::Entity* previouslySpawnedEntity,
@@ -312,6 +331,21 @@ namespace AzFramework
         //! SpawnablePriority_Default which gives users a bit of room to fine tune the priorities as this value can be configured
         //! through the Settings Registry under the key "/O3DE/AzFramework/Spawnables/HighPriorityThreshold".
         SpawnablePriority m_highPriorityThreshold { 64 };
+        //! Use the clone plans precompiled by spawnables to speed up cloning entities.
+        bool m_useClonePlans { true };
+        //! The minimum number of entities a SpawnAllEntities call needs to spawn before the entities are cloned on the task graph.
+        //! Zero disables cloning in parallel. Can be configured through "/O3DE/AzFramework/Spawnables/ParallelCloneThreshold".
+        //! Cloning on the task graph runs the constructors, serialize event handlers and custom data containers of every component
+        //! in the spawnable on worker threads, so this should only be enabled for projects where those don't access shared
+        //! state such as EBuses, interfaces or globals. Entities are never initialized or activated on worker threads.
+        size_t m_parallelCloneThreshold { 0 };
+        //! The time regular priority requests can spend adding spawned entities to the game each time the queue is processed. Large
+        //! SpawnAllEntities requests will be spread over multiple updates instead of stalling a single one. Zero disables the budget.
+        //! Can be configured through "/O3DE/AzFramework/Spawnables/RegularPriorityTimeBudgetUs".
+        AZStd::chrono::microseconds m_regularPriorityTimeBudget { 0 };
+        //! The time after which requests that support it stop processing until the next time the queue is processed.
+        AZStd::chrono::steady_clock::time_point m_processingDeadline;
+        static constexpr size_t ParallelCloneBatchSize = 64;
 
         AZStd::unordered_map<EntitySpawnTicket::Id, Ticket*> m_entitySpawnTicketMap;
         AZStd::atomic_int m_totalTickets{ 0 };
@@ -19,6 +19,7 @@
 #include <AzCore/Math/Sphere.h>
 #include <AzCore/Name/Name.h>
 #include <AzCore/Interface/Interface.h>
+#include <AzCore/std/containers/span.h>
 #include <AzCore/std/containers/vector.h>
 
 namespace AzFramework
@@ -63,6 +64,22 @@ namespace AzFramework
         };
         using EnumerateCallback = AZStd::function<void(const NodeData&)>;
 
+        //! Maximum number of frusta that can be passed to EnumerateViews.
+        static constexpr uint32_t MaxViewCount = 32;
+        //! Bit mask with a bit per frustum passed to EnumerateViews, bit N is set when the frustum at index N sees the node or entry.
+        using ViewMask = uint32_t;
+
+        struct MultiViewNodeData
+        {
+            const AZ::Aabb m_bounds;
+            const AZStd::vector<VisibilityEntry*>& m_entries;
+            //! The views that overlap the bounds of the node.
+            ViewMask m_nodeViewMask;
+            //! The views that overlap the bounds of each entry, in the same order as m_entries.
+            AZStd::span<const ViewMask> m_entryViewMasks;
+        };
+        using MultiViewEnumerateCallback = AZStd::function<void(const MultiViewNodeData&)>;
+
         //! Get the unique scene name, used to look up the scene in the IVisibilitySystem. Duplicate names will assert on creation.
         virtual const AZ::Name& GetName() const = 0;
 
@@ -111,10 +128,29 @@ namespace AzFramework
         //! @param callback the callback to invoke when a node is visible
         virtual void Enumerate(const AZ::Frustum& includeFrustum, const AZ::Frustum& excludeFrustum, const EnumerateCallback& callback) const = 0;
 
+        //! Intersects multiple frusta against the visibility system, walking the nodes only once for all of them.
+        //! Subtrees are processed in parallel on the task graph when it's active, so the callback can be invoked
+        //! concurrently from multiple threads. The call returns once all nodes have been processed.
+        //! @param frusta the frusta to test against, up to MaxViewCount
+        //! @param callback the callback to invoke when a node is visible from at least one of the frusta
+        virtual void EnumerateViews(AZStd::span<const AZ::Frustum> frusta, const MultiViewEnumerateCallback& callback) const = 0;
+
         //! Enumerate *all* OctreeNodes that have any entries in them (without any culling).
         //! @param callback the callback to invoke when a node is visible
         virtual void EnumerateNoCull(const EnumerateCallback& callback) const = 0;
 
+        //! Intersects an axis aligned bounding box against the bounds of the individual entries in the visibility system.
+        //! Unlike Enumerate, which reports every entry of a visible node, only the entries that overlap are returned.
+        //! @param aabb the axis aligned bounding box to test against
+        //! @param visibleEntries the list the overlapping entries are appended to
+        virtual void GatherEntries(const AZ::Aabb& aabb, AZStd::vector<VisibilityEntry*>& visibleEntries) const = 0;
+
+        //! Intersects a frustum against the bounds of the individual entries in the visibility system.
+        //! Unlike Enumerate, which reports every entry of a visible node, only the entries that overlap are returned.
+        //! @param frustum the frustum to test against
+        //! @param visibleEntries the list the overlapping entries are appended to
+        virtual void GatherEntries(const AZ::Frustum& frustum, AZStd::vector<VisibilityEntry*>& visibleEntries) const = 0;
+
         //! Return the number of VisibilityEntries that have been added to the system
         virtual uint32_t GetEntryCount() const = 0;
     };
@@ -7,8 +7,10 @@
  */
 
 #include <AzFramework/Visibility/OctreeSystemComponent.h>
+#include <AzCore/Math/MathIntrinsics.h>
 #include <AzCore/Math/ShapeIntersection.h>
 #include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/Task/TaskGraph.h>
 
 namespace AzFramework
 {
@@ -16,14 +18,291 @@ namespace AzFramework
     AZ_CVAR(float,    bg_octreeMaxWorldExtents, 16384.0f, nullptr, AZ::ConsoleFunctorFlags::Null, "Maximum supported world size by the world octreeSystemComponent");
     AZ_CVAR(uint32_t, bg_octreeNodeMaxEntries,        64, nullptr, AZ::ConsoleFunctorFlags::Null, "Maximum number of entries to allow in any node before forcing a split");
     AZ_CVAR(uint32_t, bg_octreeNodeMinEntries,        32, nullptr, AZ::ConsoleFunctorFlags::Null, "Minimum number of entries to allow in a node resulting from a merge operation");
+    AZ_CVAR(uint32_t, bg_octreeMultiViewTaskDepth,     2, nullptr, AZ::ConsoleFunctorFlags::Null, "Depth of the nodes whose subtrees are processed on separate tasks when enumerating multiple views, 0 processes all nodes on the calling thread");
+
+    static constexpr uint32_t QuadtreeNodeChildCount = 4;
+    static constexpr uint32_t OctreeNodeChildCount   = 8;
 
     static uint32_t GetChildNodeCount()
     {
-        constexpr uint32_t QuadtreeNodeChildCount = 4;
-        constexpr uint32_t OctreeNodeChildCount   = 8;
         return (bg_octreeUseQuadtree) ? QuadtreeNodeChildCount : OctreeNodeChildCount;
     }
 
+    namespace OctreeCulling
+    {
+        using Vec4 = AZ::Simd::Vec4;
+
+        //! Converts the result of a Vec4 comparison to a mask with a bit for every lane that passed.
+        static uint32_t ToLaneMask(Vec4::FloatArgType comparison)
+        {
+            alignas(16) int32_t lanes[Vec4::ElementCount];
+            Vec4::StoreAligned(lanes, Vec4::CastToInt(comparison));
+            return (lanes[0] ? 0x1 : 0) | (lanes[1] ? 0x2 : 0) | (lanes[2] ? 0x4 : 0) | (lanes[3] ? 0x8 : 0);
+        }
+
+        //! Culls bounds one at a time, for bounding volumes that don't have a SIMD implementation.
+        template <typename T>
+        class ScalarCuller
+        {
+        public:
+            explicit ScalarCuller(const T& boundingVolume)
+                : m_boundingVolume(boundingVolume)
+            {
+            }
+
+            bool Overlaps(const AZ::Aabb& bounds) const
+            {
+                return AZ::ShapeIntersection::Overlaps(m_boundingVolume, bounds);
+            }
+
+            uint32_t Overlaps(const OctreeBoundsBlocks::Block& block, uint32_t laneMask) const
+            {
+                uint32_t result = 0;
+                for (uint32_t lane = 0; lane < OctreeBoundsBlocks::LaneCount; ++lane)
+                {
+                    const uint32_t laneBit = 1u << lane;
+                    if ((laneMask & laneBit) && Overlaps(AZ::Aabb::CreateFromMinMaxValues(
+                        block.m_minX[lane], block.m_minY[lane], block.m_minZ[lane], block.m_maxX[lane], block.m_maxY[lane], block.m_maxZ[lane])))
+                    {
+                        result |= laneBit;
+                    }
+                }
+                return result;
+            }
+
+        private:
+            const T& m_boundingVolume;
+        };
+
+        //! Culls four bounds at a time against an axis aligned bounding box.
+        class AabbCuller
+        {
+        public:
+            explicit AabbCuller(const AZ::Aabb& aabb)
+                : m_aabb(aabb)
+                , m_minX(Vec4::Splat(aabb.GetMin().GetX()))
+                , m_minY(Vec4::Splat(aabb.GetMin().GetY()))
+                , m_minZ(Vec4::Splat(aabb.GetMin().GetZ()))
+                , m_maxX(Vec4::Splat(aabb.GetMax().GetX()))
+                , m_maxY(Vec4::Splat(aabb.GetMax().GetY()))
+                , m_maxZ(Vec4::Splat(aabb.GetMax().GetZ()))
+            {
+            }
+
+            bool Overlaps(const AZ::Aabb& bounds) const
+            {
+                return AZ::ShapeIntersection::Overlaps(m_aabb, bounds);
+            }
+
+            uint32_t Overlaps(const OctreeBoundsBlocks::Block& block, uint32_t laneMask) const
+            {
+                // Same test as Aabb::Overlaps, min <= other.max and max >= other.min on all axes.
+                Vec4::FloatType result = Vec4::CmpLtEq(Vec4::LoadAligned(block.m_minX), m_maxX);
+                result = Vec4::And(result, Vec4::CmpLtEq(Vec4::LoadAligned(block.m_minY), m_maxY));
+                result = Vec4::And(result, Vec4::CmpLtEq(Vec4::LoadAligned(block.m_minZ), m_maxZ));
+                result = Vec4::And(result, Vec4::CmpGtEq(Vec4::LoadAligned(block.m_maxX), m_minX));
+                result = Vec4::And(result, Vec4::CmpGtEq(Vec4::LoadAligned(block.m_maxY), m_minY));
+                result = Vec4::And(result, Vec4::CmpGtEq(Vec4::LoadAligned(block.m_maxZ), m_minZ));
+                return ToLaneMask(result) & laneMask;
+            }
+
+        private:
+            const AZ::Aabb& m_aabb;
+            Vec4::FloatType m_minX;
+            Vec4::FloatType m_minY;
+            Vec4::FloatType m_minZ;
+            Vec4::FloatType m_maxX;
+            Vec4::FloatType m_maxY;
+            Vec4::FloatType m_maxZ;
+        };
+
+        //! Culls four bounds at a time against a frustum.
+        class FrustumCuller
+        {
+        public:
+            explicit FrustumCuller(const AZ::Frustum& frustum)
+                : m_frustum(frustum)
+            {
+                for (AZ::Frustum::PlaneId planeId = AZ::Frustum::PlaneId::Near; planeId < AZ::Frustum::PlaneId::MAX; ++planeId)
+                {
+                    const AZ::Plane plane = frustum.GetPlane(planeId);
+                    const AZ::Vector3 normal = plane.GetNormal();
+                    Plane& simdPlane = m_planes[static_cast<uint32_t>(planeId)];
+                    simdPlane.m_normalX = Vec4::Splat(normal.GetX());
+                    simdPlane.m_normalY = Vec4::Splat(normal.GetY());
+                    simdPlane.m_normalZ = Vec4::Splat(normal.GetZ());
+                    simdPlane.m_absNormalX = Vec4::Splat(AZ::GetAbs(normal.GetX()));
+                    simdPlane.m_absNormalY = Vec4::Splat(AZ::GetAbs(normal.GetY()));
+                    simdPlane.m_absNormalZ = Vec4::Splat(AZ::GetAbs(normal.GetZ()));
+                    simdPlane.m_distance = Vec4::Splat(plane.GetDistance());
+                }
+            }
+
+            bool Overlaps(const AZ::Aabb& bounds) const
+            {
+                return AZ::ShapeIntersection::Overlaps(m_frustum, bounds);
+            }
+
+            uint32_t Overlaps(const OctreeBoundsBlocks::Block& block, uint32_t laneMask) const
+            {
+                // Same test as ShapeIntersection::Overlaps(Frustum, Aabb), the bounds are culled if they're fully behind any plane.
+                // The center and extents are computed with separate multiplies to avoid overflows for bounds close to FLT_MAX.
+                const Vec4::FloatType half = Vec4::Splat(0.5f);
+                const Vec4::FloatType minX = Vec4::Mul(Vec4::LoadAligned(block.m_minX), half);
+                const Vec4::FloatType minY = Vec4::Mul(Vec4::LoadAligned(block.m_minY), half);
+                const Vec4::FloatType minZ = Vec4::Mul(Vec4::LoadAligned(block.m_minZ), half);
+                const Vec4::FloatType maxX = Vec4::Mul(Vec4::LoadAligned(block.m_maxX), half);
+                const Vec4::FloatType maxY = Vec4::Mul(Vec4::LoadAligned(block.m_maxY), half);
+                const Vec4::FloatType maxZ = Vec4::Mul(Vec4::LoadAligned(block.m_maxZ), half);
+                const Vec4::FloatType centerX = Vec4::Add(maxX, minX);
+                const Vec4::FloatType centerY = Vec4::Add(maxY, minY);
+                const Vec4::FloatType centerZ = Vec4::Add(maxZ, minZ);
+                const Vec4::FloatType extentsX = Vec4::Sub(maxX, minX);
+                const Vec4::FloatType extentsY = Vec4::Sub(maxY, minY);
+                const Vec4::FloatType extentsZ = Vec4::Sub(maxZ, minZ);
+                const Vec4::FloatType zero = Vec4::ZeroFloat();
+
+                uint32_t result = laneMask;
+                for (const Plane& plane : m_planes)
+                {
+                    const Vec4::FloatType distance = Vec4::Madd(plane.m_normalX, centerX,
+                        Vec4::Madd(plane.m_normalY, centerY, Vec4::Madd(plane.m_normalZ, centerZ, plane.m_distance)));
+                    const Vec4::FloatType radius = Vec4::Madd(plane.m_absNormalX, extentsX,
+                        Vec4::Madd(plane.m_absNormalY, extentsY, Vec4::Mul(plane.m_absNormalZ, extentsZ)));
+                    result &= ToLaneMask(Vec4::CmpGt(Vec4::Add(distance, radius), zero));
+                    if (result == 0)
+                    {
+                        break;
+                    }
+                }
+                return result;
+            }
+
+        private:
+            struct Plane
+            {
+                Vec4::FloatType m_normalX;
+                Vec4::FloatType m_normalY;
+                Vec4::FloatType m_normalZ;
+                Vec4::FloatType m_absNormalX;
+                Vec4::FloatType m_absNormalY;
+                Vec4::FloatType m_absNormalZ;
+                Vec4::FloatType m_distance;
+            };
+
+            const AZ::Frustum& m_frustum;
+            Plane m_planes[static_cast<uint32_t>(AZ::Frustum::PlaneId::MAX)];
+        };
+
+        //! Invokes the callback with the index of every bounds in the blocks that overlaps the culler's bounding volume.
+        template <typename Culler, typename Callback>
+        static void ForEachOverlap(const Culler& culler, const OctreeBoundsBlocks& bounds, Callback&& callback)
+        {
+            const AZStd::vector<OctreeBoundsBlocks::Block>& blocks = bounds.GetBlocks();
+            for (uint32_t blockIndex = 0; blockIndex < blocks.size(); ++blockIndex)
+            {
+                uint32_t overlaps = culler.Overlaps(blocks[blockIndex], bounds.GetLaneMask(blockIndex));
+                while (overlaps != 0)
+                {
+                    const uint32_t lane = az_ctz_u32(overlaps);
+                    overlaps &= overlaps - 1;
+                    callback(blockIndex * OctreeBoundsBlocks::LaneCount + lane);
+                }
+            }
+        }
+
+        //! Sets the bit of every view in viewMask in the view masks of the bounds that overlap the view's culler.
+        template <typename Culler>
+        static void CullViews(
+            AZStd::span<const Culler> cullers,
+            IVisibilityScene::ViewMask viewMask,
+            const OctreeBoundsBlocks& bounds,
+            IVisibilityScene::ViewMask* viewMasks)
+        {
+            const AZStd::vector<OctreeBoundsBlocks::Block>& blocks = bounds.GetBlocks();
+            for (uint32_t blockIndex = 0; blockIndex < blocks.size(); ++blockIndex)
+            {
+                const uint32_t laneMask = bounds.GetLaneMask(blockIndex);
+                IVisibilityScene::ViewMask* blockViewMasks = viewMasks + blockIndex * OctreeBoundsBlocks::LaneCount;
+                for (IVisibilityScene::ViewMask views = viewMask; views != 0; views &= views - 1)
+                {
+                    const uint32_t view = az_ctz_u32(views);
+                    for (uint32_t overlaps = cullers[view].Overlaps(blocks[blockIndex], laneMask); overlaps != 0; overlaps &= overlaps - 1)
+                    {
+                        blockViewMasks[az_ctz_u32(overlaps)] |= 1u << view;
+                    }
+                }
+            }
+        }
+    } // namespace OctreeCulling
+
+    void OctreeBoundsBlocks::PushBack(const AZ::Aabb& bounds)
+    {
+        if (m_size == m_blocks.size() * LaneCount)
+        {
+            Block& block = m_blocks.emplace_back();
+            for (uint32_t lane = 0; lane < LaneCount; ++lane)
+            {
+                block.m_minX[lane] = block.m_minY[lane] = block.m_minZ[lane] = AZStd::numeric_limits<float>::max();
+                block.m_maxX[lane] = block.m_maxY[lane] = block.m_maxZ[lane] = -AZStd::numeric_limits<float>::max();
+            }
+        }
+        Set(m_size++, bounds);
+    }
+
+    void OctreeBoundsBlocks::Set(uint32_t index, const AZ::Aabb& bounds)
+    {
+        AZ_Assert(index < m_size, "Bounds index %u is out of range, there are %u bounds", index, m_size);
+        Block& block = m_blocks[index / LaneCount];
+        const uint32_t lane = index % LaneCount;
+        const AZ::Vector3& min = bounds.GetMin();
+        const AZ::Vector3& max = bounds.GetMax();
+        block.m_minX[lane] = min.GetX();
+        block.m_minY[lane] = min.GetY();
+        block.m_minZ[lane] = min.GetZ();
+        block.m_maxX[lane] = max.GetX();
+        block.m_maxY[lane] = max.GetY();
+        block.m_maxZ[lane] = max.GetZ();
+    }
+
+    void OctreeBoundsBlocks::RemoveBySwap(uint32_t index)
+    {
+        AZ_Assert(index < m_size, "Bounds index %u is out of range, there are %u bounds", index, m_size);
+        const uint32_t lastIndex = m_size - 1;
+        const Block& lastBlock = m_blocks[lastIndex / LaneCount];
+        const uint32_t lastLane = lastIndex % LaneCount;
+        Set(index, AZ::Aabb::CreateFromMinMaxValues(
+            lastBlock.m_minX[lastLane], lastBlock.m_minY[lastLane], lastBlock.m_minZ[lastLane],
+            lastBlock.m_maxX[lastLane], lastBlock.m_maxY[lastLane], lastBlock.m_maxZ[lastLane]));
+        Set(lastIndex, AZ::Aabb::CreateNull());
+        if (--m_size == (m_blocks.size() - 1) * LaneCount)
+        {
+            m_blocks.pop_back();
+        }
+    }
+
+    void OctreeBoundsBlocks::Clear()
+    {
+        m_blocks.clear();
+        m_size = 0;
+    }
+
+    uint32_t OctreeBoundsBlocks::GetSize() const
+    {
+        return m_size;
+    }
+
+    const AZStd::vector<OctreeBoundsBlocks::Block>& OctreeBoundsBlocks::GetBlocks() const
+    {
+        return m_blocks;
+    }
+
+    uint32_t OctreeBoundsBlocks::GetLaneMask(uint32_t blockIndex) const
+    {
+        const uint32_t usedLanes = AZStd::min(m_size - blockIndex * LaneCount, LaneCount);
+        return (1u << usedLanes) - 1;
+    }
+
     OctreeNode::OctreeNode(const AZ::Aabb& bounds)
         : m_bounds(bounds)
     {
@@ -35,6 +314,8 @@ namespace AzFramework
         , m_parent(rhs.m_parent)
         , m_children(rhs.m_children)
         , m_entries(AZStd::move(rhs.m_entries))
+        , m_entryBounds(AZStd::move(rhs.m_entryBounds))
+        , m_childBounds(AZStd::move(rhs.m_childBounds))
     {
         // Correct internal node pointers
         for (VisibilityEntry* entry : m_entries)
@@ -49,6 +330,8 @@ namespace AzFramework
         m_parent = rhs.m_parent;
         m_children = rhs.m_children;
         m_entries = AZStd::move(rhs.m_entries);
+        m_entryBounds = AZStd::move(rhs.m_entryBounds);
+        m_childBounds = AZStd::move(rhs.m_childBounds);
 
         // Correct internal node pointers
         for (VisibilityEntry* entry : m_entries)
@@ -88,6 +371,7 @@ namespace AzFramework
         else
         {
             m_entries.push_back(entry);
+            m_entryBounds.PushBack(entry->m_boundingVolume);
             entry->m_internalNode = this;
             entry->m_internalNodeIndex = aznumeric_cast<uint32_t>(m_entries.size() - 1);
         }
@@ -103,6 +387,7 @@ namespace AzFramework
             // Entry moved, but is still fully contained within the current node
             // We can only do this for leaf nodes, otherwise entries can get 'stuck' in non-leaf nodes
             // even when one of the child nodes would be an adequate fit, due to this early out check
+            m_entryBounds.Set(entry->m_internalNodeIndex, boundingVolume);
             return;
         }
 
@@ -138,6 +423,7 @@ namespace AzFramework
             m_entries[removeIndex]->m_internalNodeIndex = removeIndex;
         }
         m_entries.pop_back();
+        m_entryBounds.RemoveBySwap(removeIndex);
 
         if (m_parent != nullptr)
         {
@@ -149,7 +435,7 @@ namespace AzFramework
     {
         if (AZ::ShapeIntersection::Overlaps(aabb, m_bounds))
         {
-            EnumerateHelper(aabb, callback);
+            EnumerateHelper(OctreeCulling::AabbCuller(aabb), callback);
         }
     }
 
@@ -157,7 +443,7 @@ namespace AzFramework
     {
         if (AZ::ShapeIntersection::Overlaps(sphere, m_bounds))
         {
-            EnumerateHelper(sphere, callback);
+            EnumerateHelper(OctreeCulling::ScalarCuller<AZ::Sphere>(sphere), callback);
         }
     }
 
@@ -165,7 +451,7 @@ namespace AzFramework
     {
         if (AZ::ShapeIntersection::Overlaps(hemisphere, m_bounds))
         {
-            EnumerateHelper(hemisphere, callback);
+            EnumerateHelper(OctreeCulling::ScalarCuller<AZ::Hemisphere>(hemisphere), callback);
         }
     }
 
@@ -173,7 +459,7 @@ namespace AzFramework
     {
         if (AZ::ShapeIntersection::Overlaps(capsule, m_bounds))
         {
-            EnumerateHelper(capsule, callback);
+            EnumerateHelper(OctreeCulling::ScalarCuller<AZ::Capsule>(capsule), callback);
         }
     }
 
@@ -181,7 +467,7 @@ namespace AzFramework
     {
         if (AZ::ShapeIntersection::Overlaps(frustum, m_bounds))
         {
-            EnumerateHelper(frustum, callback);
+            EnumerateHelper(OctreeCulling::FrustumCuller(frustum), callback);
         }
     }
 
@@ -226,6 +512,75 @@ namespace AzFramework
         }
     }
 
+    void OctreeNode::GatherEntries(const AZ::Aabb& aabb, AZStd::vector<VisibilityEntry*>& visibleEntries) const
+    {
+        if (AZ::ShapeIntersection::Overlaps(aabb, m_bounds))
+        {
+            GatherEntriesHelper(OctreeCulling::AabbCuller(aabb), visibleEntries);
+        }
+    }
+
+    void OctreeNode::GatherEntries(const AZ::Frustum& frustum, AZStd::vector<VisibilityEntry*>& visibleEntries) const
+    {
+        if (AZ::ShapeIntersection::Overlaps(frustum, m_bounds))
+        {
+            GatherEntriesHelper(OctreeCulling::FrustumCuller(frustum), visibleEntries);
+        }
+    }
+
+    void OctreeNode::EnumerateViews(AZStd::span<const AZ::Frustum> frusta, const IVisibilityScene::MultiViewEnumerateCallback& callback) const
+    {
+        AZ_Assert(frusta.size() <= IVisibilityScene::MaxViewCount, "EnumerateViews supports up to %u views, the remaining %zu views are ignored",
+            IVisibilityScene::MaxViewCount, frusta.size() - IVisibilityScene::MaxViewCount);
+        const uint32_t viewCount = static_cast<uint32_t>(AZStd::min<size_t>(frusta.size(), IVisibilityScene::MaxViewCount));
+
+        AZStd::vector<OctreeCulling::FrustumCuller> cullers;
+        cullers.reserve(viewCount);
+        IVisibilityScene::ViewMask viewMask = 0;
+        for (uint32_t view = 0; view < viewCount; ++view)
+        {
+            cullers.emplace_back(frusta[view]);
+            if (AZ::ShapeIntersection::Overlaps(frusta[view], m_bounds))
+            {
+                viewMask |= 1u << view;
+            }
+        }
+
+        if (viewMask == 0)
+        {
+            return;
+        }
+
+        const AZ::TaskGraphActiveInterface* taskGraphActive = AZ::Interface<AZ::TaskGraphActiveInterface>::Get();
+        const bool useTasks = (bg_octreeMultiViewTaskDepth > 0) && taskGraphActive && taskGraphActive->IsTaskGraphActive();
+
+        // Walk the nodes above the task depth on the calling thread, and collect the subtrees below it
+        const AZStd::span<const OctreeCulling::FrustumCuller> cullerSpan(cullers);
+        AZStd::vector<IVisibilityScene::ViewMask> entryViewMasks;
+        AZStd::vector<MultiViewSubtree> subtrees;
+        EnumerateViewsHelper(cullerSpan, viewMask, 0, useTasks ? &subtrees : nullptr, entryViewMasks, callback);
+
+        if (subtrees.empty())
+        {
+            return;
+        }
+
+        static const AZ::TaskDescriptor descriptor{ "AzFramework::OctreeNode::EnumerateViews", "Visibility" };
+        AZ::TaskGraph taskGraph{ "OctreeEnumerateViews" };
+        for (const MultiViewSubtree& subtree : subtrees)
+        {
+            taskGraph.AddTask(descriptor, [cullerSpan, subtree, &callback]()
+            {
+                AZStd::vector<IVisibilityScene::ViewMask> subtreeEntryViewMasks;
+                subtree.m_node->EnumerateViewsHelper(cullerSpan, subtree.m_viewMask, 0, nullptr, subtreeEntryViewMasks, callback);
+            });
+        }
+
+        AZ::TaskGraphEvent finishedEvent{ "OctreeEnumerateViews Wait" };
+        taskGraph.Submit(&finishedEvent);
+        finishedEvent.Wait();
+    }
+
     const AZStd::vector<VisibilityEntry*>& OctreeNode::GetEntries() const
     {
         return m_entries;
@@ -268,10 +623,10 @@ namespace AzFramework
         }
     }
 
-    template <typename T>
-    void OctreeNode::EnumerateHelper(const T& boundingVolume, const IVisibilityScene::EnumerateCallback& callback) const
+    template <typename Culler>
+    void OctreeNode::EnumerateHelper(const Culler& culler, const IVisibilityScene::EnumerateCallback& callback) const
     {
-        AZ_Assert(AZ::ShapeIntersection::Overlaps(boundingVolume, m_bounds), "EnumerateHelper invoked on an octreeSystemComponent node that is not within the bounding volume");
+        AZ_Assert(culler.Overlaps(m_bounds), "EnumerateHelper invoked on an octreeSystemComponent node that is not within the bounding volume");
 
         // Invoke the callback for the current node
         if (!m_entries.empty())
@@ -281,18 +636,73 @@ namespace AzFramework
 
         if (m_children != nullptr)
         {
-            // If this is not a leaf node, recurse into the children
+            // If this is not a leaf node, cull the children in batches and recurse into the ones that overlap
+            OctreeCulling::ForEachOverlap(culler, m_childBounds, [this, &culler, &callback](uint32_t child)
+            {
+                m_children[child].EnumerateHelper(culler, callback);
+            });
+        }
+    }
+
+    template <typename Culler>
+    void OctreeNode::EnumerateViewsHelper(
+        AZStd::span<const Culler> cullers,
+        IVisibilityScene::ViewMask viewMask,
+        uint32_t depth,
+        AZStd::vector<MultiViewSubtree>* subtrees,
+        AZStd::vector<IVisibilityScene::ViewMask>& entryViewMasks,
+        const IVisibilityScene::MultiViewEnumerateCallback& callback) const
+    {
+        if (subtrees != nullptr && depth == bg_octreeMultiViewTaskDepth)
+        {
+            subtrees->push_back({ this, viewMask });
+            return;
+        }
+
+        // Invoke the callback for the current node, with the views each of its entries is visible from
+        if (!m_entries.empty())
+        {
+            entryViewMasks.clear();
+            entryViewMasks.resize(m_entryBounds.GetBlocks().size() * OctreeBoundsBlocks::LaneCount, 0);
+            OctreeCulling::CullViews(cullers, viewMask, m_entryBounds, entryViewMasks.data());
+            callback({ m_bounds, m_entries, viewMask, AZStd::span<const IVisibilityScene::ViewMask>(entryViewMasks.data(), m_entries.size()) });
+        }
+
+        if (m_children != nullptr)
+        {
+            // Cull the children against all views at once, and recurse into the ones that are visible from any of them
+            IVisibilityScene::ViewMask childViewMasks[OctreeNodeChildCount] = {};
+            OctreeCulling::CullViews(cullers, viewMask, m_childBounds, childViewMasks);
             const uint32_t childCount = GetChildNodeCount();
             for (uint32_t child = 0; child < childCount; ++child)
             {
-                if (AZ::ShapeIntersection::Overlaps(boundingVolume, m_children[child].m_bounds))
+                if (childViewMasks[child] != 0)
                 {
-                    m_children[child].EnumerateHelper(boundingVolume, callback);
+                    m_children[child].EnumerateViewsHelper(cullers, childViewMasks[child], depth + 1, subtrees, entryViewMasks, callback);
                 }
             }
         }
     }
 
+    template <typename Culler>
+    void OctreeNode::GatherEntriesHelper(const Culler& culler, AZStd::vector<VisibilityEntry*>& visibleEntries) const
+    {
+        AZ_Assert(culler.Overlaps(m_bounds), "GatherEntriesHelper invoked on an octreeSystemComponent node that is not within the bounding volume");
+
+        OctreeCulling::ForEachOverlap(culler, m_entryBounds, [this, &visibleEntries](uint32_t entryIndex)
+        {
+            visibleEntries.push_back(m_entries[entryIndex]);
+        });
+
+        if (m_children != nullptr)
+        {
+            OctreeCulling::ForEachOverlap(culler, m_childBounds, [this, &culler, &visibleEntries](uint32_t child)
+            {
+                m_children[child].GatherEntriesHelper(culler, visibleEntries);
+            });
+        }
+    }
+
     void OctreeNode::Split(OctreeScene& octreeScene)
     {
         AZ_Assert(m_children == nullptr, "Split invoked on an octreeScene node that has already been split");
@@ -329,11 +739,14 @@ namespace AzFramework
 
                 m_children[child].m_bounds = childBound.GetTranslated(childOffset);
                 m_children[child].m_parent = this;
+                m_childBounds.PushBack(m_children[child].m_bounds);
             }
         }
 
         // Re-partition our entry set across ourself and our child nodes
         AZStd::vector<VisibilityEntry*> entrySet(AZStd::move(m_entries));
+        m_entries.clear();
+        m_entryBounds.Clear();
         for (VisibilityEntry* entry : entrySet)
         {
             entry->m_internalNode = nullptr;
@@ -355,11 +768,14 @@ namespace AzFramework
                 childEntry->m_internalNode = this;
                 childEntry->m_internalNodeIndex = aznumeric_cast<uint32_t>(m_entries.size());
                 m_entries.push_back(childEntry);
+                m_entryBounds.PushBack(childEntry->m_boundingVolume);
             }
             m_children[child].m_entries.clear();
+            m_children[child].m_entryBounds.Clear();
         }
 
         octreeScene.ReleaseChildNodes(m_childNodeIndex);
+        m_childBounds.Clear();
         m_childNodeIndex = InvalidChildNodeIndex;
         m_children = nullptr;
     }
@@ -452,6 +868,24 @@ namespace AzFramework
         m_root.EnumerateNoCull(callback);
     }
 
+    void OctreeScene::EnumerateViews(AZStd::span<const AZ::Frustum> frusta, const IVisibilityScene::MultiViewEnumerateCallback& callback) const
+    {
+        AZStd::shared_lock<AZStd::shared_mutex> lock(m_sharedMutex);
+        m_root.EnumerateViews(frusta, callback);
+    }
+
+    void OctreeScene::GatherEntries(const AZ::Aabb& aabb, AZStd::vector<VisibilityEntry*>& visibleEntries) const
+    {
+        AZStd::shared_lock<AZStd::shared_mutex> lock(m_sharedMutex);
+        m_root.GatherEntries(aabb, visibleEntries);
+    }
+
+    void OctreeScene::GatherEntries(const AZ::Frustum& frustum, AZStd::vector<VisibilityEntry*>& visibleEntries) const
+    {
+        AZStd::shared_lock<AZStd::shared_mutex> lock(m_sharedMutex);
+        m_root.GatherEntries(frustum, visibleEntries);
+    }
+
     uint32_t OctreeScene::GetEntryCount() const
     {
         return m_entryCount;
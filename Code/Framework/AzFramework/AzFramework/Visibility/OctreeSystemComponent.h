@@ -10,6 +10,7 @@
 
 #include <AzFramework/Visibility/IVisibilitySystem.h>
 #include <AzCore/Math/Plane.h>
+#include <AzCore/Math/SimdMath.h>
 #include <AzCore/Component/Component.h>
 #include <AzCore/std/containers/stack.h>
 #include <AzCore/std/containers/vector.h>
@@ -22,6 +23,40 @@ namespace AzFramework
     class OctreeSystemComponent;
     class OctreeScene;
 
+    //! Stores a list of bounds as a structure of arrays, so they can be culled four at a time using AZ::Simd::Vec4.
+    //! Lanes of the last block that aren't in use hold null bounds.
+    class AZF_API OctreeBoundsBlocks
+    {
+    public:
+        static constexpr uint32_t LaneCount = AZ::Simd::Vec4::ElementCount;
+
+        struct alignas(16) Block
+        {
+            float m_minX[LaneCount];
+            float m_minY[LaneCount];
+            float m_minZ[LaneCount];
+            float m_maxX[LaneCount];
+            float m_maxY[LaneCount];
+            float m_maxZ[LaneCount];
+        };
+
+        void PushBack(const AZ::Aabb& bounds);
+        void Set(uint32_t index, const AZ::Aabb& bounds);
+        //! Moves the last bounds to index and removes the last bounds, which matches a swap and pop of the owning list.
+        void RemoveBySwap(uint32_t index);
+        void Clear();
+
+        uint32_t GetSize() const;
+        const AZStd::vector<Block>& GetBlocks() const;
+
+        //! Returns a mask with a bit for every lane of the block that's in use.
+        uint32_t GetLaneMask(uint32_t blockIndex) const;
+
+    private:
+        AZStd::vector<Block> m_blocks;
+        uint32_t m_size = 0;
+    };
+
     //! An internal node within the tree.
     //! It contains all objects that are *fully contained* by the node, if an object spans multiple child nodes that object will be stored in the parent.
     class AZF_API OctreeNode
@@ -61,6 +96,16 @@ namespace AzFramework
         //! Recursively enumerate *all* OctreeNodes that have any entries in them (without any culling).
         void EnumerateNoCull(const IVisibilityScene::EnumerateCallback& callback) const;
 
+        //! Recursively culls the individual entries of this node and its children against the bounding volume and appends
+        //! the ones that overlap it to visibleEntries.
+        //! @{
+        void GatherEntries(const AZ::Aabb& aabb, AZStd::vector<VisibilityEntry*>& visibleEntries) const;
+        void GatherEntries(const AZ::Frustum& frustum, AZStd::vector<VisibilityEntry*>& visibleEntries) const;
+        //! @}
+
+        //! Culls this node and its children against multiple frusta in a single walk, see IVisibilityScene::EnumerateViews.
+        void EnumerateViews(AZStd::span<const AZ::Frustum> frusta, const IVisibilityScene::MultiViewEnumerateCallback& callback) const;
+
         //! Returns the set of entries bound to this node.
         const AZStd::vector<VisibilityEntry*>& GetEntries() const;
 
@@ -74,8 +119,29 @@ namespace AzFramework
 
         void TryMerge(OctreeScene& octreeScene);
 
-        template <typename T>
-        void EnumerateHelper(const T& boundingVolume, const IVisibilityScene::EnumerateCallback& callback) const;
+        template <typename Culler>
+        void EnumerateHelper(const Culler& culler, const IVisibilityScene::EnumerateCallback& callback) const;
+
+        template <typename Culler>
+        void GatherEntriesHelper(const Culler& culler, AZStd::vector<VisibilityEntry*>& visibleEntries) const;
+
+        //! A node that EnumerateViews processes on a separate task, with the views its parent was visible from.
+        struct MultiViewSubtree
+        {
+            const OctreeNode* m_node = nullptr;
+            IVisibilityScene::ViewMask m_viewMask = 0;
+        };
+
+        //! Processes the nodes visible from viewMask. When subtrees isn't null, the nodes at the task depth are added to
+        //! it instead of being processed.
+        template <typename Culler>
+        void EnumerateViewsHelper(
+            AZStd::span<const Culler> cullers,
+            IVisibilityScene::ViewMask viewMask,
+            uint32_t depth,
+            AZStd::vector<MultiViewSubtree>* subtrees,
+            AZStd::vector<IVisibilityScene::ViewMask>& entryViewMasks,
+            const IVisibilityScene::MultiViewEnumerateCallback& callback) const;
 
         void Split(OctreeScene& octreeScene);
         void Merge(OctreeScene& octreeScene);
@@ -88,6 +154,8 @@ namespace AzFramework
         OctreeNode* m_parent = nullptr; //< This is a pointer to an array of GetChildNodeCount() nodes, or nullptr if this is a leaf node
         OctreeNode* m_children = nullptr;
         AZStd::vector<VisibilityEntry*> m_entries;
+        OctreeBoundsBlocks m_entryBounds; //< Bounds of m_entries, in the same order.
+        OctreeBoundsBlocks m_childBounds; //< Bounds of m_children, empty if this is a leaf node.
     };
 
     //! Implementation of the visibility system interface.
@@ -115,6 +183,9 @@ namespace AzFramework
         void Enumerate(const AZ::Frustum& frustum, const IVisibilityScene::EnumerateCallback& callback) const override;
         void Enumerate(const AZ::Frustum& includeFrustum, const AZ::Frustum& excludeFrustum, const EnumerateCallback& callback) const override;
         void EnumerateNoCull(const IVisibilityScene::EnumerateCallback& callback) const override;
+        void EnumerateViews(AZStd::span<const AZ::Frustum> frusta, const IVisibilityScene::MultiViewEnumerateCallback& callback) const override;
+        void GatherEntries(const AZ::Aabb& aabb, AZStd::vector<VisibilityEntry*>& visibleEntries) const override;
+        void GatherEntries(const AZ::Frustum& frustum, AZStd::vector<VisibilityEntry*>& visibleEntries) const override;
         uint32_t GetEntryCount() const override;
         //! @}
 
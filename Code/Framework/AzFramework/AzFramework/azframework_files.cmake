@@ -210,6 +210,7 @@ set(FILES
     IO/LocalFileIO.h
     IO/FileOperations.h
     IO/FileOperations.cpp
+    IO/MemoryMappedFile.h
     IO/RemoteFileIO.cpp
     IO/RemoteFileIO.h
     IO/RemoteStorageDrive.h
@@ -388,6 +389,8 @@ set(FILES
     Spawnable/Script/SpawnableScriptMediator.cpp
     Spawnable/Script/SpawnableScriptMediator.h
     Spawnable/Script/SpawnableScriptNotificationsHandler.h
+    Spawnable/EntityClonePlan.cpp
+    Spawnable/EntityClonePlan.h
     Spawnable/InMemorySpawnableAssetContainer.cpp
     Spawnable/InMemorySpawnableAssetContainer.h
     Spawnable/Spawnable.cpp
@@ -14,6 +14,7 @@ set(FILES
     AzFramework/Device/DeviceAttributesCommon_Android.cpp
     ../Common/Unimplemented/AzFramework/Asset/AssetSystemComponentHelper_Unimplemented.cpp
     AzFramework/IO/LocalFileIO_Android.cpp
+    ../Common/UnixLike/AzFramework/IO/MemoryMappedFile_UnixLike.cpp
     ../Common/Unimplemented/AzFramework/StreamingInstall/StreamingInstall_Unimplemented.cpp
     ../Common/Default/AzFramework/TargetManagement/TargetManagementComponent_Default.cpp
     AzFramework/Input/Buses/Notifications/RawInputNotificationBus_Platform.h
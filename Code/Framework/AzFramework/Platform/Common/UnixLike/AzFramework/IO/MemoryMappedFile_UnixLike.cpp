@@ -0,0 +1,61 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <AzFramework/IO/MemoryMappedFile.h>
+
+namespace AZ::IO
+{
+    MemoryMappedFile::~MemoryMappedFile()
+    {
+        Unmap();
+    }
+
+    bool MemoryMappedFile::Map(const char* nativePath)
+    {
+        Unmap();
+
+        int fileDescriptor = open(nativePath, O_RDONLY | O_CLOEXEC);
+        if (fileDescriptor == -1)
+        {
+            return false;
+        }
+
+        struct stat fileStat;
+        if (fstat(fileDescriptor, &fileStat) != 0 || fileStat.st_size <= 0)
+        {
+            close(fileDescriptor);
+            return false;
+        }
+
+        size_t size = static_cast<size_t>(fileStat.st_size);
+        void* address = mmap(nullptr, size, PROT_READ, MAP_SHARED, fileDescriptor, 0);
+        // The mapping keeps its own reference to the file so the descriptor isn't needed anymore.
+        close(fileDescriptor);
+        if (address == MAP_FAILED)
+        {
+            return false;
+        }
+
+        m_data = static_cast<const uint8_t*>(address);
+        m_size = size;
+        return true;
+    }
+
+    void MemoryMappedFile::Unmap()
+    {
+        if (m_data)
+        {
+            munmap(const_cast<uint8_t*>(m_data), static_cast<size_t>(m_size));
+            m_data = nullptr;
+            m_size = 0;
+        }
+    }
+} // namespace AZ::IO
@@ -0,0 +1,66 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#include <AzCore/PlatformIncl.h>
+#include <AzCore/IO/Path/Path.h>
+#include <AzCore/std/string/conversions.h>
+#include <AzFramework/IO/MemoryMappedFile.h>
+
+namespace AZ::IO
+{
+    MemoryMappedFile::~MemoryMappedFile()
+    {
+        Unmap();
+    }
+
+    bool MemoryMappedFile::Map(const char* nativePath)
+    {
+        Unmap();
+
+        AZStd::fixed_wstring<AZ::IO::MaxPathLength> nativePathW;
+        AZStd::to_wstring(nativePathW, nativePath);
+        HANDLE file = CreateFileW(nativePathW.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (file == INVALID_HANDLE_VALUE)
+        {
+            return false;
+        }
+
+        LARGE_INTEGER fileSize;
+        if (!GetFileSizeEx(file, &fileSize) || fileSize.QuadPart <= 0)
+        {
+            CloseHandle(file);
+            return false;
+        }
+
+        HANDLE mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        void* address = mapping ? MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0) : nullptr;
+        // The view keeps its own reference to the file and mapping objects so the handles aren't needed anymore.
+        if (mapping)
+        {
+            CloseHandle(mapping);
+        }
+        CloseHandle(file);
+        if (!address)
+        {
+            return false;
+        }
+
+        m_data = static_cast<const uint8_t*>(address);
+        m_size = static_cast<AZ::u64>(fileSize.QuadPart);
+        return true;
+    }
+
+    void MemoryMappedFile::Unmap()
+    {
+        if (m_data)
+        {
+            UnmapViewOfFile(m_data);
+            m_data = nullptr;
+            m_size = 0;
+        }
+    }
+} // namespace AZ::IO
@@ -18,6 +18,7 @@ set(FILES
     AzFramework/Process/ProcessCommunicator_Mac.cpp
     ../Common/Apple/AzFramework/Device/DeviceAttributesCommon_Apple.mm
     ../Common/UnixLike/AzFramework/IO/LocalFileIO_UnixLike.cpp
+    ../Common/UnixLike/AzFramework/IO/MemoryMappedFile_UnixLike.cpp
     ../Common/Unimplemented/AzFramework/StreamingInstall/StreamingInstall_Unimplemented.cpp
     AzFramework/TargetManagement/TargetManagementComponent_Mac.cpp
     AzFramework/Input/Buses/Notifications/RawInputNotificationBus_Platform.h
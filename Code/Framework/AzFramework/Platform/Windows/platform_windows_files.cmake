@@ -19,6 +19,7 @@ set(FILES
     AzFramework/Process/ProcessUtils_Win.cpp
     ../Common/WinAPI/AzFramework/IO/LocalFileIO_WinAPI.cpp
     AzFramework/IO/LocalFileIO_Windows.cpp
+    ../Common/WinAPI/AzFramework/IO/MemoryMappedFile_WinAPI.cpp
     ../Common/Unimplemented/AzFramework/StreamingInstall/StreamingInstall_Unimplemented.cpp
     AzFramework/Input/Buses/Notifications/RawInputNotificationBus_Platform.h
     AzFramework/Input/Buses/Notifications/RawInputNotificationBus_Windows.h
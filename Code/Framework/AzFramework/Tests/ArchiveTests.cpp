@@ -231,6 +231,29 @@ namespace UnitTest
         bool m_valueStored{};
     };
 
+    struct CVarBoolValueScope
+    {
+        CVarBoolValueScope(AZ::IConsole& console, const char* cvarName)
+            : m_console{ console }
+            , m_cvarName{ cvarName }
+        {
+            // Store current CVar value
+            m_valueStored = m_cvarName != nullptr && m_console.GetCvarValue(cvarName, m_oldValue) == AZ::GetValueResult::Success;
+        }
+        ~CVarBoolValueScope()
+        {
+            // Restore the old value if it was successfully stored
+            if (m_valueStored)
+            {
+                m_console.PerformCommand(m_cvarName, { m_oldValue ? "true" : "false" });
+            }
+        }
+        AZ::IConsole& m_console;
+        const char* m_cvarName{};
+        bool m_oldValue{};
+        bool m_valueStored{};
+    };
+
     TEST_F(ArchiveTestFixture, TestArchiveFGetCachedFileData_PakFile)
     {
         // Test setup - from Archive
@@ -279,6 +302,72 @@ namespace UnitTest
         TestFGetCachedFileData(fileInArchiveFile, dataString.size(), dataString.data());
     }
 
+    TEST_F(ArchiveTestFixture, TestArchiveMemoryMapped_StoredFile_ReturnsViewIntoMapping)
+    {
+        constexpr const char* fileInArchiveFile = "levels\\mappedlevel\\levelinfo.xml";
+        constexpr AZStd::string_view dataString = "HELLO MAPPED WORLD";
+
+        AZ::IO::IArchive* archive = AZ::Interface<AZ::IO::IArchive>::Get();
+        ASSERT_NE(nullptr, archive);
+
+        AZ::IO::FileIOBase* fileIo = AZ::IO::FileIOBase::GetInstance();
+        ASSERT_NE(nullptr, fileIo);
+
+        auto console = AZ::Interface<AZ::IConsole>::Get();
+        ASSERT_NE(nullptr, console);
+
+        const char* testArchivePath = "@usercache@/memorymapped.pak";
+        archive->ClosePack(testArchivePath);
+        fileIo->Remove(testArchivePath);
+
+        AZStd::intrusive_ptr<AZ::IO::INestedArchive> pArchive = archive->OpenArchive(testArchivePath, {}, AZ::IO::INestedArchive::FLAGS_CREATE_NEW);
+        ASSERT_NE(nullptr, pArchive);
+        EXPECT_EQ(0, pArchive->UpdateFile(fileInArchiveFile, dataString.data(), dataString.size(), AZ::IO::INestedArchive::METHOD_STORE, AZ::IO::INestedArchive::LEVEL_FASTEST));
+        pArchive.reset();
+
+        CVarIntValueScope previousLocationPriority{ *console, "sys_pakPriority" };
+        console->PerformCommand("sys_PakPriority", { AZ::CVarFixedString::format("%d", aznumeric_cast<int>(AZ::IO::FileSearchPriority::PakOnly)) });
+        CVarBoolValueScope previousMemoryMap{ *console, "sys_PakMemoryMap" };
+        console->PerformCommand("sys_PakMemoryMap", { "true" });
+        EXPECT_TRUE(archive->OpenPack("@products@", testArchivePath));
+
+        AZ::IO::ArchiveFileIO archiveFileIo(archive);
+        AZ::IO::HandleType fileHandle = AZ::IO::InvalidHandle;
+        ASSERT_EQ(AZ::IO::ResultCode::Success, archiveFileIo.Open(fileInArchiveFile, AZ::IO::OpenMode::ModeRead | AZ::IO::OpenMode::ModeBinary, fileHandle));
+
+        AZ::u64 mappedSize = 0;
+        auto mappedData = reinterpret_cast<const char*>(archiveFileIo.GetMappedData(fileHandle, mappedSize));
+        ASSERT_NE(nullptr, mappedData);
+        EXPECT_EQ(dataString.size(), mappedSize);
+        EXPECT_EQ(dataString, AZStd::string_view(mappedData, mappedSize));
+
+        // Cached data is a writable copy, the read-only mapping is only handed out through the mapped accessors.
+        size_t cachedSize = 0;
+        auto cachedData = reinterpret_cast<char*>(archive->FGetCachedFileData(fileHandle, cachedSize));
+        ASSERT_NE(nullptr, cachedData);
+        EXPECT_NE(mappedData, cachedData);
+        EXPECT_EQ(dataString.size(), cachedSize);
+        EXPECT_EQ(dataString, AZStd::string_view(cachedData, cachedSize));
+
+        char readBuffer[dataString.size()]{};
+        EXPECT_EQ(AZ::IO::ResultCode::Success, archiveFileIo.Seek(fileHandle, 0, AZ::IO::SeekType::SeekFromStart));
+        EXPECT_EQ(AZ::IO::ResultCode::Success, archiveFileIo.Read(fileHandle, readBuffer, dataString.size(), true));
+        EXPECT_EQ(dataString, AZStd::string_view(readBuffer, dataString.size()));
+
+        // Writing to the copy must not touch the read-only mapping.
+        cachedData[0] = 'J';
+        EXPECT_EQ(dataString, AZStd::string_view(mappedData, mappedSize));
+
+        // Streamer requests hold on to the mapping, so it stays readable after the archive is closed.
+        AZ::IO::CompressionInfo compressionInfo;
+        ASSERT_TRUE(AZ::IO::CompressionUtils::FindCompressionInfo(compressionInfo, "levels/mappedlevel/levelinfo.xml"));
+        ASSERT_NE(nullptr, compressionInfo.m_mappedData);
+
+        EXPECT_EQ(AZ::IO::ResultCode::Success, archiveFileIo.Close(fileHandle));
+        EXPECT_TRUE(archive->ClosePack(testArchivePath));
+        EXPECT_EQ(dataString, AZStd::string_view(reinterpret_cast<const char*>(compressionInfo.m_mappedData.get()), dataString.size()));
+    }
+
     TEST_F(ArchiveTestFixture, TestArchiveOpenPacks_FindsMultiplePaks_Works)
     {
         AZ::IO::IArchive* archive = AZ::Interface<AZ::IO::IArchive>::Get();
@@ -332,6 +332,115 @@ namespace Benchmark
         }
         RemoveEntries(EntryCount);
     }
+
+    BENCHMARK_F(BM_Octree, GatherEntriesAabb10000)(benchmark::State& state)
+    {
+        constexpr uint32_t EntryCount = 10000;
+        InsertEntries(EntryCount);
+        AZStd::vector<AzFramework::VisibilityEntry*> visibleEntries;
+        for ([[maybe_unused]] auto _ : state)
+        {
+            for (auto& queryData : m_queryDataArray)
+            {
+                visibleEntries.clear();
+                m_visScene->GatherEntries(queryData.aabb, visibleEntries);
+            }
+            benchmark::DoNotOptimize(visibleEntries.data());
+        }
+        RemoveEntries(EntryCount);
+    }
+
+    BENCHMARK_F(BM_Octree, GatherEntriesAabb100000)(benchmark::State& state)
+    {
+        constexpr uint32_t EntryCount = 100000;
+        InsertEntries(EntryCount);
+        AZStd::vector<AzFramework::VisibilityEntry*> visibleEntries;
+        for ([[maybe_unused]] auto _ : state)
+        {
+            for (auto& queryData : m_queryDataArray)
+            {
+                visibleEntries.clear();
+                m_visScene->GatherEntries(queryData.aabb, visibleEntries);
+            }
+            benchmark::DoNotOptimize(visibleEntries.data());
+        }
+        RemoveEntries(EntryCount);
+    }
+
+    BENCHMARK_F(BM_Octree, GatherEntriesFrustum10000)(benchmark::State& state)
+    {
+        constexpr uint32_t EntryCount = 10000;
+        InsertEntries(EntryCount);
+        AZStd::vector<AzFramework::VisibilityEntry*> visibleEntries;
+        for ([[maybe_unused]] auto _ : state)
+        {
+            for (auto& queryData : m_queryDataArray)
+            {
+                visibleEntries.clear();
+                m_visScene->GatherEntries(queryData.frustum, visibleEntries);
+            }
+            benchmark::DoNotOptimize(visibleEntries.data());
+        }
+        RemoveEntries(EntryCount);
+    }
+
+    BENCHMARK_F(BM_Octree, GatherEntriesFrustum100000)(benchmark::State& state)
+    {
+        constexpr uint32_t EntryCount = 100000;
+        InsertEntries(EntryCount);
+        AZStd::vector<AzFramework::VisibilityEntry*> visibleEntries;
+        for ([[maybe_unused]] auto _ : state)
+        {
+            for (auto& queryData : m_queryDataArray)
+            {
+                visibleEntries.clear();
+                m_visScene->GatherEntries(queryData.frustum, visibleEntries);
+            }
+            benchmark::DoNotOptimize(visibleEntries.data());
+        }
+        RemoveEntries(EntryCount);
+    }
+
+    // Six views per query, like a main view with shadow cascades, enumerated one at a time and in a single walk
+    BENCHMARK_F(BM_Octree, EnumerateFrustumSixViewsSeparately100000)(benchmark::State& state)
+    {
+        constexpr uint32_t EntryCount = 100000;
+        constexpr uint32_t ViewCount = 6;
+        InsertEntries(EntryCount);
+        for ([[maybe_unused]] auto _ : state)
+        {
+            for (size_t query = 0; query + ViewCount <= m_queryDataArray.size(); query += ViewCount)
+            {
+                for (uint32_t view = 0; view < ViewCount; ++view)
+                {
+                    m_visScene->Enumerate(m_queryDataArray[query + view].frustum, [](const AzFramework::IVisibilityScene::NodeData&) {});
+                }
+            }
+        }
+        RemoveEntries(EntryCount);
+    }
+
+    BENCHMARK_F(BM_Octree, EnumerateViewsSixViews100000)(benchmark::State& state)
+    {
+        constexpr uint32_t EntryCount = 100000;
+        constexpr uint32_t ViewCount = 6;
+        InsertEntries(EntryCount);
+        AZStd::vector<AZ::Frustum> frusta;
+        frusta.reserve(m_queryDataArray.size());
+        for (auto& queryData : m_queryDataArray)
+        {
+            frusta.push_back(queryData.frustum);
+        }
+        for ([[maybe_unused]] auto _ : state)
+        {
+            for (size_t query = 0; query + ViewCount <= frusta.size(); query += ViewCount)
+            {
+                m_visScene->EnumerateViews(AZStd::span<const AZ::Frustum>(frusta.data() + query, ViewCount),
+                    [](const AzFramework::IVisibilityScene::MultiViewNodeData&) {});
+            }
+        }
+        RemoveEntries(EntryCount);
+    }
 }
 
 #endif
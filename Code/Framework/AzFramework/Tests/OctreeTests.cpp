@@ -10,8 +10,13 @@
 #include <AzCore/Console/IConsole.h>
 #include <AzCore/Console/Console.h>
 #include <AzCore/Name/NameDictionary.h>
+#include <AzCore/Task/TaskExecutor.h>
+#include <AzCore/Task/TaskGraph.h>
 #include <AzCore/Console/IConsole.h>
 #include <AzCore/Math/MatrixUtils.h>
+#include <AzCore/Math/ShapeIntersection.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/parallel/mutex.h>
 #include <AzFramework/Visibility/OctreeSystemComponent.h>
 #include <random>
 
@@ -363,6 +368,269 @@ namespace UnitTest
         EnumerateMultipleEntriesHelper(m_octreeScene, bound1, bound2, bound3);
     }
 
+    // Same requirements on the bounds as EnumerateMultipleEntriesHelper
+    template <typename BoundType>
+    void GatherMultipleEntriesHelper(IVisibilityScene* visScene, const BoundType& bound1, const BoundType& bound2, const BoundType& bound3)
+    {
+        AZStd::vector<VisibilityEntry*> gatheredEntries;
+
+        AzFramework::VisibilityEntry visEntry[3];
+        visEntry[0].m_boundingVolume = AZ::Aabb::CreateFromMinMax(AZ::Vector3(-0.9f), AZ::Vector3(-0.6f));
+        visEntry[1].m_boundingVolume = AZ::Aabb::CreateFromMinMax(AZ::Vector3( 0.1f), AZ::Vector3( 0.4f));
+        visEntry[2].m_boundingVolume = AZ::Aabb::CreateFromMinMax(AZ::Vector3( 0.6f), AZ::Vector3( 0.9f));
+
+        visScene->InsertOrUpdateEntry(visEntry[0]);
+        visScene->InsertOrUpdateEntry(visEntry[1]);
+        visScene->InsertOrUpdateEntry(visEntry[2]);
+
+        visScene->GatherEntries(bound1, gatheredEntries);
+        EXPECT_EQ(gatheredEntries.size(), 3);
+
+        gatheredEntries.clear();
+        visScene->GatherEntries(bound2, gatheredEntries);
+        ASSERT_EQ(gatheredEntries.size(), 1);
+        EXPECT_EQ(gatheredEntries[0], &(visEntry[0]));
+
+        gatheredEntries.clear();
+        visScene->GatherEntries(bound3, gatheredEntries);
+        ASSERT_EQ(gatheredEntries.size(), 1);
+        EXPECT_EQ(gatheredEntries[0], &(visEntry[2]));
+
+        visScene->RemoveEntry(visEntry[0]);
+        visScene->RemoveEntry(visEntry[1]);
+        visScene->RemoveEntry(visEntry[2]);
+        gatheredEntries.clear();
+        visScene->GatherEntries(bound1, gatheredEntries);
+        EXPECT_TRUE(gatheredEntries.empty());
+    }
+
+    TEST_F(OctreeTests, GatherEntriesAabbMultipleEntries)
+    {
+        AZ::Aabb bound1 = AZ::Aabb::CreateFromMinMax(AZ::Vector3(-1.0f), AZ::Vector3( 1.0f));
+        AZ::Aabb bound2 = AZ::Aabb::CreateFromMinMax(AZ::Vector3(-1.0f), AZ::Vector3(-0.5f));
+        AZ::Aabb bound3 = AZ::Aabb::CreateFromMinMax(AZ::Vector3( 0.6f), AZ::Vector3( 0.9f));
+        GatherMultipleEntriesHelper(m_octreeScene, bound1, bound2, bound3);
+    }
+
+    TEST_F(OctreeTests, GatherEntriesFrustumMultipleEntries)
+    {
+        AZ::Vector3 frustumOrigin = AZ::Vector3(0.0f, -2.0f, 0.0f);
+        AZ::Quaternion frustumDirection = AZ::Quaternion::CreateIdentity();
+        AZ::Transform frustumTransform = AZ::Transform::CreateFromQuaternionAndTranslation(frustumDirection, frustumOrigin);
+        AZ::Frustum bound1 = AZ::Frustum(AZ::ViewFrustumAttributes(frustumTransform, 1.0f, 2.0f * atanf(0.5f), 1.0f, 3.0f));
+        AZ::Frustum bound2 = AZ::Frustum(AZ::ViewFrustumAttributes(frustumTransform, 1.0f, 2.0f * atanf(0.5f), 1.0f, 2.0f));
+        AZ::Frustum bound3 = AZ::Frustum(AZ::ViewFrustumAttributes(frustumTransform, 1.0f, 2.0f * atanf(0.5f), 2.6f, 2.9f));
+        GatherMultipleEntriesHelper(m_octreeScene, bound1, bound2, bound3);
+    }
+
+    TEST_F(OctreeTests, GatherEntries_ManyEntriesPerNode_MatchesPerEntryCulling)
+    {
+        // Allow several entries per node so entries that share a node are culled against each other in the same batch
+        m_console->PerformCommand("bg_octreeNodeMaxEntries 7");
+        m_console->PerformCommand("bg_octreeNodeMinEntries 3");
+
+        constexpr uint32_t EntryCount = 200;
+        std::mt19937 rng(1);
+        std::uniform_real_distribution<float> positionDistribution(-0.95f, 0.95f);
+        std::uniform_real_distribution<float> sizeDistribution(0.001f, 0.05f);
+        auto randomAabb = [&]()
+        {
+            const AZ::Vector3 center(positionDistribution(rng), positionDistribution(rng), positionDistribution(rng));
+            return AZ::Aabb::CreateCenterHalfExtents(center, AZ::Vector3(sizeDistribution(rng)));
+        };
+
+        AZStd::vector<AzFramework::VisibilityEntry> visEntries(EntryCount);
+        for (AzFramework::VisibilityEntry& entry : visEntries)
+        {
+            entry.m_boundingVolume = randomAabb();
+            m_octreeScene->InsertOrUpdateEntry(entry);
+        }
+
+        const AZ::Aabb aabb = AZ::Aabb::CreateFromMinMax(AZ::Vector3(-0.5f, -0.3f, -1.0f), AZ::Vector3(0.2f, 0.6f, 0.4f));
+        const AZ::Transform frustumTransform = AZ::Transform::CreateFromQuaternionAndTranslation(
+            AZ::Quaternion::CreateRotationZ(0.3f), AZ::Vector3(0.2f, -2.0f, 0.1f));
+        const AZ::Frustum frustum = AZ::Frustum(AZ::ViewFrustumAttributes(frustumTransform, 1.0f, 2.0f * atanf(0.25f), 1.5f, 2.8f));
+
+        auto validate = [&]()
+        {
+            AZStd::vector<VisibilityEntry*> gatheredEntries;
+            m_octreeScene->GatherEntries(aabb, gatheredEntries);
+            for (AzFramework::VisibilityEntry& entry : visEntries)
+            {
+                const bool gathered = AZStd::find(gatheredEntries.begin(), gatheredEntries.end(), &entry) != gatheredEntries.end();
+                EXPECT_EQ(gathered, entry.m_internalNode != nullptr && AZ::ShapeIntersection::Overlaps(aabb, entry.m_boundingVolume));
+            }
+
+            gatheredEntries.clear();
+            m_octreeScene->GatherEntries(frustum, gatheredEntries);
+            for (AzFramework::VisibilityEntry& entry : visEntries)
+            {
+                const bool gathered = AZStd::find(gatheredEntries.begin(), gatheredEntries.end(), &entry) != gatheredEntries.end();
+                EXPECT_EQ(gathered, entry.m_internalNode != nullptr && AZ::ShapeIntersection::Overlaps(frustum, entry.m_boundingVolume));
+            }
+        };
+        validate();
+
+        // Move entries around, most of them will stay in the node they're in
+        for (AzFramework::VisibilityEntry& entry : visEntries)
+        {
+            entry.m_boundingVolume.Translate(AZ::Vector3(0.01f));
+            m_octreeScene->InsertOrUpdateEntry(entry);
+        }
+        validate();
+
+        // Remove every third entry, which causes nodes to merge
+        for (uint32_t i = 0; i < EntryCount; i += 3)
+        {
+            m_octreeScene->RemoveEntry(visEntries[i]);
+        }
+        validate();
+
+        for (uint32_t i = 0; i < EntryCount; ++i)
+        {
+            if (visEntries[i].m_internalNode != nullptr)
+            {
+                m_octreeScene->RemoveEntry(visEntries[i]);
+            }
+        }
+    }
+
+    // Validates that every entry is reported exactly once with the views that overlap it
+    void EnumerateViewsHelper(IVisibilityScene* visScene, AZStd::span<const AZ::Frustum> frusta, AZStd::span<AzFramework::VisibilityEntry> visEntries)
+    {
+        AZStd::mutex mutex;
+        AZStd::unordered_map<const VisibilityEntry*, IVisibilityScene::ViewMask> gatheredViewMasks;
+        visScene->EnumerateViews(frusta, [&](const IVisibilityScene::MultiViewNodeData& nodeData)
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(mutex);
+            EXPECT_NE(nodeData.m_nodeViewMask, 0u);
+            ASSERT_EQ(nodeData.m_entryViewMasks.size(), nodeData.m_entries.size());
+            for (size_t i = 0; i < nodeData.m_entries.size(); ++i)
+            {
+                EXPECT_EQ(nodeData.m_entryViewMasks[i] & ~nodeData.m_nodeViewMask, 0u);
+                EXPECT_TRUE(gatheredViewMasks.emplace(nodeData.m_entries[i], nodeData.m_entryViewMasks[i]).second);
+            }
+        });
+
+        for (const AzFramework::VisibilityEntry& entry : visEntries)
+        {
+            IVisibilityScene::ViewMask expectedViewMask = 0;
+            for (uint32_t view = 0; view < frusta.size(); ++view)
+            {
+                if (AZ::ShapeIntersection::Overlaps(frusta[view], entry.m_boundingVolume))
+                {
+                    expectedViewMask |= 1u << view;
+                }
+            }
+
+            auto gathered = gatheredViewMasks.find(&entry);
+            const IVisibilityScene::ViewMask viewMask = (gathered != gatheredViewMasks.end()) ? gathered->second : 0;
+            EXPECT_EQ(viewMask, expectedViewMask);
+        }
+    }
+
+    class OctreeMultiViewTests
+        : public OctreeTests
+        , public AZ::TaskGraphActiveInterface
+    {
+    public:
+        void SetUp() override
+        {
+            OctreeTests::SetUp();
+
+            m_console->PerformCommand("bg_octreeNodeMaxEntries 7");
+            m_console->PerformCommand("bg_octreeNodeMinEntries 3");
+            m_console->GetCvarValue("bg_octreeMultiViewTaskDepth", m_savedTaskDepth);
+
+            std::mt19937 rng(2);
+            std::uniform_real_distribution<float> positionDistribution(-0.95f, 0.95f);
+            std::uniform_real_distribution<float> sizeDistribution(0.001f, 0.05f);
+            m_visEntries.resize(EntryCount);
+            for (AzFramework::VisibilityEntry& entry : m_visEntries)
+            {
+                const AZ::Vector3 center(positionDistribution(rng), positionDistribution(rng), positionDistribution(rng));
+                entry.m_boundingVolume = AZ::Aabb::CreateCenterHalfExtents(center, AZ::Vector3(sizeDistribution(rng)));
+                m_octreeScene->InsertOrUpdateEntry(entry);
+            }
+
+            // A main view, three cascades that cover the same region at increasing distances, and a view that sees nothing
+            const AZ::Transform viewTransform = AZ::Transform::CreateFromQuaternionAndTranslation(
+                AZ::Quaternion::CreateRotationZ(0.2f), AZ::Vector3(0.1f, -2.0f, 0.0f));
+            m_frusta.push_back(AZ::Frustum(AZ::ViewFrustumAttributes(viewTransform, 1.0f, 2.0f * atanf(0.4f), 1.0f, 3.0f)));
+            m_frusta.push_back(AZ::Frustum(AZ::ViewFrustumAttributes(viewTransform, 1.0f, 2.0f * atanf(0.4f), 1.0f, 1.5f)));
+            m_frusta.push_back(AZ::Frustum(AZ::ViewFrustumAttributes(viewTransform, 1.0f, 2.0f * atanf(0.4f), 1.5f, 2.2f)));
+            m_frusta.push_back(AZ::Frustum(AZ::ViewFrustumAttributes(viewTransform, 1.0f, 2.0f * atanf(0.4f), 2.2f, 3.0f)));
+            m_frusta.push_back(AZ::Frustum(AZ::ViewFrustumAttributes(
+                AZ::Transform::CreateTranslation(AZ::Vector3(0.0f, 5.0f, 0.0f)), 1.0f, 2.0f * atanf(0.4f), 1.0f, 3.0f)));
+        }
+
+        void TearDown() override
+        {
+            for (AzFramework::VisibilityEntry& entry : m_visEntries)
+            {
+                m_octreeScene->RemoveEntry(entry);
+            }
+            m_visEntries.clear();
+            m_visEntries.shrink_to_fit();
+            m_frusta.clear();
+            m_frusta.shrink_to_fit();
+
+            AZStd::string commandString;
+            commandString.format("bg_octreeMultiViewTaskDepth %u", m_savedTaskDepth);
+            m_console->PerformCommand(commandString.c_str());
+
+            OctreeTests::TearDown();
+        }
+
+        bool IsTaskGraphActive() const override
+        {
+            return true;
+        }
+
+        static constexpr uint32_t EntryCount = 300;
+        AZStd::vector<AzFramework::VisibilityEntry> m_visEntries;
+        AZStd::vector<AZ::Frustum> m_frusta;
+        uint32_t m_savedTaskDepth = 0;
+    };
+
+    TEST_F(OctreeMultiViewTests, EnumerateViews_SingleThreaded_MatchesPerViewCulling)
+    {
+        m_console->PerformCommand("bg_octreeMultiViewTaskDepth 0");
+        EnumerateViewsHelper(m_octreeScene, m_frusta, m_visEntries);
+    }
+
+    TEST_F(OctreeMultiViewTests, EnumerateViews_OnTaskGraph_MatchesPerViewCulling)
+    {
+        AZ::TaskExecutor* executor = aznew AZ::TaskExecutor(4);
+        AZ::TaskExecutor::SetInstance(executor);
+        AZ::Interface<AZ::TaskGraphActiveInterface>::Register(this);
+
+        for (uint32_t taskDepth = 1; taskDepth <= 3; ++taskDepth)
+        {
+            AZStd::string commandString;
+            commandString.format("bg_octreeMultiViewTaskDepth %u", taskDepth);
+            m_console->PerformCommand(commandString.c_str());
+            EnumerateViewsHelper(m_octreeScene, m_frusta, m_visEntries);
+        }
+
+        AZ::Interface<AZ::TaskGraphActiveInterface>::Unregister(this);
+        if (&AZ::TaskExecutor::Instance() == executor)
+        {
+            AZ::TaskExecutor::SetInstance(nullptr);
+        }
+        delete executor;
+    }
+
+    TEST_F(OctreeMultiViewTests, EnumerateViews_NoVisibleViews_CallbackIsNotInvoked)
+    {
+        bool invoked = false;
+        m_octreeScene->EnumerateViews(AZStd::span<const AZ::Frustum>(&m_frusta.back(), 1), [&invoked](const IVisibilityScene::MultiViewNodeData&)
+        {
+            invoked = true;
+        });
+        EXPECT_FALSE(invoked);
+    }
+
     TEST_F(OctreeTests, InsertOrUpdateEntry_OverFillRootNodeWithLargeEntries_EntriesAreNotLost)
     {
         // Validate that the octree works if you exceed the max entry count with large entries,
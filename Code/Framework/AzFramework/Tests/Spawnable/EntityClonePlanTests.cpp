@@ -0,0 +1,282 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Component/Component.h>
+#include <AzCore/Component/Entity.h>
+#include <AzCore/Serialization/IdUtils.h>
+#include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+#include <AzFramework/Spawnable/EntityClonePlan.h>
+#include <AzTest/AzTest.h>
+
+namespace UnitTest
+{
+    class ClonePlanFixedReferenceComponent : public AZ::Component
+    {
+    public:
+        AZ_COMPONENT(ClonePlanFixedReferenceComponent, "{5E0B83C6-1E41-4E2C-A3A4-0D8C5B2C7B61}");
+
+        void Activate() override {}
+        void Deactivate() override {}
+
+        static void Reflect(AZ::ReflectContext* reflection)
+        {
+            if (auto* serializeContext = azrtti_cast<AZ::SerializeContext*>(reflection))
+            {
+                serializeContext->Class<ClonePlanFixedReferenceComponent, AZ::Component>()
+                    ->Field("Name", &ClonePlanFixedReferenceComponent::m_name)
+                    ->Field("Target", &ClonePlanFixedReferenceComponent::m_target)
+                    ->Field("Value", &ClonePlanFixedReferenceComponent::m_value)
+                    ->Field("Parent", &ClonePlanFixedReferenceComponent::m_parent);
+            }
+        }
+
+        AZStd::string m_name{ "Reference" };
+        AZ::EntityId m_target;
+        float m_value{ 1.0f };
+        AZ::EntityId m_parent;
+    };
+
+    class ClonePlanContainerReferenceComponent : public AZ::Component
+    {
+    public:
+        AZ_COMPONENT(ClonePlanContainerReferenceComponent, "{1B7A3F0E-94C5-4E8B-9E3E-2F6C48D1A0C7}");
+
+        void Activate() override {}
+        void Deactivate() override {}
+
+        static void Reflect(AZ::ReflectContext* reflection)
+        {
+            if (auto* serializeContext = azrtti_cast<AZ::SerializeContext*>(reflection))
+            {
+                serializeContext->Class<ClonePlanContainerReferenceComponent, AZ::Component>()
+                    ->Field("Targets", &ClonePlanContainerReferenceComponent::m_targets);
+            }
+        }
+
+        AZStd::vector<AZ::EntityId> m_targets;
+    };
+
+    class EntityClonePlanTest : public LeakDetectionFixture
+    {
+    public:
+        void SetUp() override
+        {
+            LeakDetectionFixture::SetUp();
+
+            m_serializeContext = AZStd::make_unique<AZ::SerializeContext>();
+            AZ::Entity::Reflect(m_serializeContext.get());
+            m_fixedDescriptor = ClonePlanFixedReferenceComponent::CreateDescriptor();
+            m_fixedDescriptor->Reflect(m_serializeContext.get());
+            m_containerDescriptor = ClonePlanContainerReferenceComponent::CreateDescriptor();
+            m_containerDescriptor->Reflect(m_serializeContext.get());
+
+            m_prototype = AZStd::make_unique<AZ::Entity>(AZ::EntityId(10), "Prototype");
+            auto* fixed = aznew ClonePlanFixedReferenceComponent();
+            fixed->m_target = AZ::EntityId(11);
+            fixed->m_parent = AZ::EntityId(12);
+            m_prototype->AddComponent(fixed);
+        }
+
+        void TearDown() override
+        {
+            m_prototype.reset();
+            m_containerDescriptor->ReleaseDescriptor();
+            m_fixedDescriptor->ReleaseDescriptor();
+            m_serializeContext.reset();
+
+            LeakDetectionFixture::TearDown();
+        }
+
+    protected:
+        AZStd::unique_ptr<AZ::SerializeContext> m_serializeContext;
+        AZ::ComponentDescriptor* m_fixedDescriptor{ nullptr };
+        AZ::ComponentDescriptor* m_containerDescriptor{ nullptr };
+        AZStd::unique_ptr<AZ::Entity> m_prototype;
+        AzFramework::EntityClonePlan m_plan;
+    };
+
+    TEST_F(EntityClonePlanTest, Clone_FixedReferences_IdsAreRemapped)
+    {
+        ASSERT_TRUE(m_plan.Build(*m_prototype, *m_serializeContext));
+
+        AzFramework::EntityClonePlan::EntityIdMap idMap;
+        idMap.emplace(AZ::EntityId(11), AZ::EntityId(111));
+        AZStd::unique_ptr<AZ::Entity> clone(m_plan.Clone(*m_prototype, idMap, *m_serializeContext));
+        ASSERT_NE(nullptr, clone.get());
+
+        EXPECT_NE(m_prototype->GetId(), clone->GetId());
+        EXPECT_EQ(clone->GetId(), idMap[m_prototype->GetId()]);
+
+        auto* component = clone->FindComponent<ClonePlanFixedReferenceComponent>();
+        ASSERT_NE(nullptr, component);
+        EXPECT_EQ(AZ::EntityId(111), component->m_target);
+        EXPECT_EQ(AZ::EntityId(12), component->m_parent);
+        EXPECT_EQ(AZStd::string("Reference"), component->m_name);
+    }
+
+    TEST_F(EntityClonePlanTest, Clone_ReferenceToOwnId_UsesNewId)
+    {
+        m_prototype->FindComponent<ClonePlanFixedReferenceComponent>()->m_parent = m_prototype->GetId();
+        ASSERT_TRUE(m_plan.Build(*m_prototype, *m_serializeContext));
+
+        AzFramework::EntityClonePlan::EntityIdMap idMap;
+        AZStd::unique_ptr<AZ::Entity> clone(m_plan.Clone(*m_prototype, idMap, *m_serializeContext));
+        ASSERT_NE(nullptr, clone.get());
+        EXPECT_EQ(clone->GetId(), clone->FindComponent<ClonePlanFixedReferenceComponent>()->m_parent);
+    }
+
+    TEST_F(EntityClonePlanTest, Clone_ReferencesInContainer_RemappedThroughReflection)
+    {
+        auto* container = aznew ClonePlanContainerReferenceComponent();
+        container->m_targets = { AZ::EntityId(11), AZ::EntityId(13) };
+        m_prototype->AddComponent(container);
+        ASSERT_TRUE(m_plan.Build(*m_prototype, *m_serializeContext));
+
+        AzFramework::EntityClonePlan::EntityIdMap idMap;
+        idMap.emplace(AZ::EntityId(11), AZ::EntityId(111));
+        AZStd::unique_ptr<AZ::Entity> clone(m_plan.Clone(*m_prototype, idMap, *m_serializeContext));
+        ASSERT_NE(nullptr, clone.get());
+
+        auto* component = clone->FindComponent<ClonePlanContainerReferenceComponent>();
+        ASSERT_NE(nullptr, component);
+        ASSERT_EQ(2u, component->m_targets.size());
+        EXPECT_EQ(AZ::EntityId(111), component->m_targets[0]);
+        EXPECT_EQ(AZ::EntityId(13), component->m_targets[1]);
+        EXPECT_EQ(AZ::EntityId(111), clone->FindComponent<ClonePlanFixedReferenceComponent>()->m_target);
+    }
+
+    TEST_F(EntityClonePlanTest, IsCompatible_ComponentAdded_ReturnsFalse)
+    {
+        ASSERT_TRUE(m_plan.Build(*m_prototype, *m_serializeContext));
+        EXPECT_TRUE(m_plan.IsCompatible(*m_prototype));
+
+        m_prototype->AddComponent(aznew ClonePlanContainerReferenceComponent());
+        EXPECT_FALSE(m_plan.IsCompatible(*m_prototype));
+    }
+} // namespace UnitTest
+
+#if defined(HAVE_BENCHMARK)
+
+#include <benchmark/benchmark.h>
+
+namespace Benchmark
+{
+    class BM_EntityClonePlan
+        : public benchmark::Fixture
+    {
+        void internalSetUp()
+        {
+            m_serializeContext = AZStd::make_unique<AZ::SerializeContext>();
+            AZ::Entity::Reflect(m_serializeContext.get());
+            m_descriptor = UnitTest::ClonePlanFixedReferenceComponent::CreateDescriptor();
+            m_descriptor->Reflect(m_serializeContext.get());
+
+            m_prototypes.reserve(EntityCount);
+            m_plans.resize(EntityCount);
+            for (AZ::u64 i = 0; i < EntityCount; ++i)
+            {
+                auto entity = AZStd::make_unique<AZ::Entity>(AZ::EntityId(i + 1), "Prototype");
+                for (AZ::u64 c = 0; c < ComponentsPerEntity; ++c)
+                {
+                    auto* component = aznew UnitTest::ClonePlanFixedReferenceComponent();
+                    component->m_target = AZ::EntityId(((i + c) % EntityCount) + 1);
+                    component->m_parent = AZ::EntityId(i > 0 ? i : EntityCount);
+                    entity->AddComponent(component);
+                }
+                m_plans[i].Build(*entity, *m_serializeContext);
+                m_prototypes.push_back(AZStd::move(entity));
+            }
+            m_clones.reserve(EntityCount);
+        }
+
+        void internalTearDown()
+        {
+            m_clones = {};
+            m_plans = {};
+            m_prototypes = {};
+            m_descriptor->ReleaseDescriptor();
+            m_serializeContext.reset();
+        }
+
+    public:
+        static constexpr AZ::u64 EntityCount = 1000;
+        static constexpr AZ::u64 ComponentsPerEntity = 4;
+
+        void SetUp(const benchmark::State&) override
+        {
+            internalSetUp();
+        }
+        void SetUp(benchmark::State&) override
+        {
+            internalSetUp();
+        }
+
+        void TearDown(const benchmark::State&) override
+        {
+            internalTearDown();
+        }
+        void TearDown(benchmark::State&) override
+        {
+            internalTearDown();
+        }
+
+        void DestroyClones()
+        {
+            for (AZ::Entity* clone : m_clones)
+            {
+                delete clone;
+            }
+            m_clones.clear();
+        }
+
+        AZStd::unique_ptr<AZ::SerializeContext> m_serializeContext;
+        AZ::ComponentDescriptor* m_descriptor{ nullptr };
+        AZStd::vector<AZStd::unique_ptr<AZ::Entity>> m_prototypes;
+        AZStd::vector<AzFramework::EntityClonePlan> m_plans;
+        AZStd::vector<AZ::Entity*> m_clones;
+    };
+
+    BENCHMARK_F(BM_EntityClonePlan, CloneWithReflection)(benchmark::State& state)
+    {
+        for ([[maybe_unused]] auto _ : state)
+        {
+            AzFramework::EntityClonePlan::EntityIdMap idMap;
+            for (const auto& prototype : m_prototypes)
+            {
+                m_clones.push_back(AZ::IdUtils::Remapper<AZ::EntityId, false>::CloneObjectAndGenerateNewIdsAndFixRefs(
+                    prototype.get(), idMap, m_serializeContext.get()));
+            }
+
+            state.PauseTiming();
+            DestroyClones();
+            state.ResumeTiming();
+        }
+        state.SetItemsProcessed(state.iterations() * EntityCount);
+    }
+
+    BENCHMARK_F(BM_EntityClonePlan, CloneWithPlan)(benchmark::State& state)
+    {
+        for ([[maybe_unused]] auto _ : state)
+        {
+            AzFramework::EntityClonePlan::EntityIdMap idMap;
+            for (size_t i = 0; i < m_prototypes.size(); ++i)
+            {
+                m_clones.push_back(m_plans[i].Clone(*m_prototypes[i], idMap, *m_serializeContext));
+            }
+
+            state.PauseTiming();
+            DestroyClones();
+            state.ResumeTiming();
+        }
+        state.SetItemsProcessed(state.iterations() * EntityCount);
+    }
+} // namespace Benchmark
+
+#endif // HAVE_BENCHMARK
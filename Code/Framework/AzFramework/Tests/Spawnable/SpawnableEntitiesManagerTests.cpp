@@ -6,8 +6,11 @@
  *
  */
 
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/Settings/SettingsRegistry.h>
 #include <AzCore/UnitTest/TestTypes.h>
 #include <AzCore/UserSettings/UserSettingsComponent.h>
+#include <AzCore/std/containers/unordered_set.h>
 #include <AzFramework/Application/Application.h>
 #include <AzFramework/Spawnable/SpawnableAssetHandler.h>
 #include <AzFramework/Spawnable/SpawnableEntitiesManager.h>
@@ -108,6 +111,7 @@ namespace UnitTest
             LeakDetectionFixture::SetUp();
 
             m_application = new TestApplication();
+            ConfigureSettingsRegistry(*AZ::SettingsRegistry::Get());
             AZ::ComponentApplication::Descriptor descriptor;
             AZ::ComponentApplication::StartupParameters startupParameters;
             startupParameters.m_loadSettingsRegistry = false;
@@ -151,6 +155,11 @@ namespace UnitTest
             LeakDetectionFixture::TearDown();
         }
 
+        //! Called before the application is started so tests can change the settings the Spawnable Entities Manager reads.
+        virtual void ConfigureSettingsRegistry([[maybe_unused]] AZ::SettingsRegistryInterface& registry)
+        {
+        }
+
         void ProcessQueueTillEmtpy()
         {
             for (size_t i=0; i<1000; ++i) // Don't do this indefinitely to avoid deadlocking on a failing test.
@@ -1543,4 +1552,155 @@ namespace UnitTest
 
         EXPECT_LT(defaultPriorityCallId, highPriorityCallId);
     }
+
+    //
+    // Parallel cloning
+    //
+
+    class SpawnableEntitiesManagerParallelCloneTest : public SpawnableEntitiesManagerTest
+    {
+    public:
+        static constexpr AZ::u64 ParallelCloneThreshold = 16;
+
+        void SetUp() override
+        {
+            SpawnableEntitiesManagerTest::SetUp();
+            auto console = AZ::Interface<AZ::IConsole>::Get();
+            ASSERT_NE(nullptr, console);
+            console->PerformCommand("cl_activateTaskGraph", { "true" });
+        }
+
+        void TearDown() override
+        {
+            if (auto console = AZ::Interface<AZ::IConsole>::Get(); console != nullptr)
+            {
+                console->PerformCommand("cl_activateTaskGraph", { "false" });
+            }
+            SpawnableEntitiesManagerTest::TearDown();
+        }
+
+        void ConfigureSettingsRegistry(AZ::SettingsRegistryInterface& registry) override
+        {
+            registry.Set("/O3DE/AzFramework/Spawnables/ParallelCloneThreshold", ParallelCloneThreshold);
+        }
+    };
+
+    TEST_F(SpawnableEntitiesManagerParallelCloneTest, SpawnAllEntities_AboveThreshold_ClonesMatchSerialClones)
+    {
+        // Use enough entities for multiple clone batches. The references are remapped after cloning, so they need to point to
+        // the same entities as they would if the entities were cloned one at a time.
+        for (EntityReferenceScheme refScheme : {
+                EntityReferenceScheme::AllReferenceFirst, EntityReferenceScheme::AllReferenceLast,
+                EntityReferenceScheme::AllReferenceThemselves, EntityReferenceScheme::AllReferenceNextCircular,
+                EntityReferenceScheme::AllReferencePreviousCircular })
+        {
+            constexpr size_t NumEntities = 200;
+            FillSpawnable(NumEntities);
+            CreateEntityReferences(refScheme);
+
+            bool hasCompleted = false;
+            auto callback = [this, refScheme, &hasCompleted]
+                (AzFramework::EntitySpawnTicket::Id, AzFramework::SpawnableConstEntityContainerView entities)
+            {
+                hasCompleted = true;
+                ASSERT_EQ(NumEntities, entities.size());
+                ValidateEntityReferences(refScheme, NumEntities, entities);
+
+                // Every clone is a copy of the prototype at the same index, but with a new id.
+                const AzFramework::Spawnable::EntityList& prototypes = m_spawnable->GetEntities();
+                AZStd::unordered_set<AZ::EntityId> cloneIds;
+                for (size_t i = 0; i < NumEntities; ++i)
+                {
+                    const AZ::Entity* clone = *(entities.begin() + i);
+                    ASSERT_NE(nullptr, clone);
+                    EXPECT_NE(prototypes[i]->GetId(), clone->GetId());
+                    EXPECT_TRUE(cloneIds.insert(clone->GetId()).second);
+
+                    const AZ::Entity::ComponentArrayType& prototypeComponents = prototypes[i]->GetComponents();
+                    const AZ::Entity::ComponentArrayType& cloneComponents = clone->GetComponents();
+                    ASSERT_EQ(prototypeComponents.size(), cloneComponents.size());
+                    for (size_t componentIndex = 0; componentIndex < cloneComponents.size(); ++componentIndex)
+                    {
+                        EXPECT_EQ(
+                            azrtti_typeid(prototypeComponents[componentIndex]), azrtti_typeid(cloneComponents[componentIndex]));
+                        EXPECT_EQ(prototypeComponents[componentIndex]->GetId(), cloneComponents[componentIndex]->GetId());
+                    }
+                }
+            };
+            AzFramework::SpawnAllEntitiesOptionalArgs optionalArgs;
+            optionalArgs.m_completionCallback = AZStd::move(callback);
+            m_manager->SpawnAllEntities(*m_ticket, AZStd::move(optionalArgs));
+            ProcessQueueTillEmtpy();
+            EXPECT_TRUE(hasCompleted);
+
+            m_manager->DespawnAllEntities(*m_ticket);
+            ProcessQueueTillEmtpy();
+        }
+    }
+
+    //
+    // Time budget
+    //
+
+    class SpawnableEntitiesManagerTimeBudgetTest : public SpawnableEntitiesManagerTest
+    {
+    public:
+        void ConfigureSettingsRegistry(AZ::SettingsRegistryInterface& registry) override
+        {
+            // The smallest possible budget, so only a single entity is added to the game per update.
+            registry.Set("/O3DE/AzFramework/Spawnables/RegularPriorityTimeBudgetUs", AZ::u64{ 1 });
+        }
+    };
+
+    TEST_F(SpawnableEntitiesManagerTimeBudgetTest, SpawnAllEntities_RegularPriority_SpreadOverMultipleUpdates)
+    {
+        static constexpr size_t NumEntities = 8;
+        FillSpawnable(NumEntities);
+
+        size_t spawnedEntitiesCount = 0;
+        size_t completionCount = 0;
+        auto callback = [&spawnedEntitiesCount, &completionCount]
+            (AzFramework::EntitySpawnTicket::Id, AzFramework::SpawnableConstEntityContainerView entities)
+        {
+            spawnedEntitiesCount += entities.size();
+            completionCount++;
+        };
+        AzFramework::SpawnAllEntitiesOptionalArgs optionalArgs;
+        optionalArgs.m_completionCallback = AZStd::move(callback);
+        optionalArgs.m_priority = AzFramework::SpawnablePriority_Default;
+        m_manager->SpawnAllEntities(*m_ticket, AZStd::move(optionalArgs));
+
+        size_t numUpdates = 0;
+        while (completionCount == 0 && numUpdates < 1000)
+        {
+            m_manager->ProcessQueue(AzFramework::SpawnableEntitiesManager::CommandQueuePriority::Regular);
+            numUpdates++;
+        }
+
+        EXPECT_EQ(1, completionCount);
+        EXPECT_EQ(NumEntities, spawnedEntitiesCount);
+        // At least one entity is added per update, so the request can take at most one update per entity.
+        EXPECT_GT(numUpdates, 1);
+        EXPECT_LE(numUpdates, NumEntities);
+    }
+
+    TEST_F(SpawnableEntitiesManagerTimeBudgetTest, SpawnAllEntities_HighPriority_CompletedInSingleUpdate)
+    {
+        static constexpr size_t NumEntities = 8;
+        FillSpawnable(NumEntities);
+
+        size_t spawnedEntitiesCount = 0;
+        auto callback = [&spawnedEntitiesCount](AzFramework::EntitySpawnTicket::Id, AzFramework::SpawnableConstEntityContainerView entities)
+        {
+            spawnedEntitiesCount += entities.size();
+        };
+        AzFramework::SpawnAllEntitiesOptionalArgs optionalArgs;
+        optionalArgs.m_completionCallback = AZStd::move(callback);
+        optionalArgs.m_priority = AzFramework::SpawnablePriority_High;
+        m_manager->SpawnAllEntities(*m_ticket, AZStd::move(optionalArgs));
+
+        m_manager->ProcessQueue(AzFramework::SpawnableEntitiesManager::CommandQueuePriority::High);
+
+        EXPECT_EQ(NumEntities, spawnedEntitiesCount);
+    }
 } // namespace UnitTest
@@ -8,6 +8,7 @@
 
 set(FILES
     Main.cpp
+    Spawnable/EntityClonePlanTests.cpp
     Spawnable/SpawnableEntitiesInterfaceTests.cpp
     Spawnable/SpawnableEntitiesManagerTests.cpp
     Spawnable/SpawnableScriptMediatorTests.cpp
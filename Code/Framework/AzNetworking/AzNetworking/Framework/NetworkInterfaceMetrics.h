@@ -34,6 +34,8 @@ namespace AzNetworking
         int64_t m_sendBytesCompressedDelta = 0;
         //! Returns the numbers of bytes added by encryption.
         uint64_t m_sendBytesEncryptionInflation = 0;
+        //! Returns the total number of batched system calls used to send packets on this socket, zero when sends aren't batched.
+        uint64_t m_sendBatches = 0;
         //! Returns the total number of packets that had to be resent on this network interface due to packet loss.
         uint64_t m_resentPackets = 0;
         //! Returns the total number of milliseconds spent processing received data on this network interface.
@@ -44,6 +46,8 @@ namespace AzNetworking
         uint64_t m_recvBytes = 0;
         //! Returns the total number of bytes received on this socket before compression.
         uint64_t m_recvBytesUncompressed = 0;
+        //! Returns the total number of batched system calls used to receive packets on this socket, zero when receives aren't batched.
+        uint64_t m_recvBatches = 0;
         //! Returns the total number of packets that were discarded due to timeslice budgets.
         uint64_t m_discardedPackets = 0;
     };
@@ -235,7 +235,6 @@ namespace AzNetworking
         }
 
         m_unackedPacketCount++;
-        UpdateHeartbeat(currentTimeMs);
 
         return true;
     }
@@ -97,6 +97,10 @@ namespace AzNetworking
         //! @return the timeout identifier for this connection instance
         TimeoutId GetTimeoutId() const;
 
+        //! Retrieves the network interface receive shard this connection's packets are received and decoded on.
+        //! @return the index of the receive shard that owns this connection
+        uint32_t GetReceiveShardIndex() const;
+
     protected:
 
         //! Prepare a reliable packet for transmission.
@@ -119,6 +123,7 @@ namespace AzNetworking
         PacketTimeoutResult ProcessTimeout(PacketId packetId, ReliabilityType reliability);
 
         //! Process a received packet header.
+        //! Only updates state owned by this connection and never sends, so the network interface can call it from a receive shard's worker thread.
         //! @param header        the packet header received to process
         //! @param serializer    the output serializer containing the transmitted packet data
         //! @param packetSize    the size of the received packet in bytes
@@ -149,6 +154,7 @@ namespace AzNetworking
 
         TimeoutId m_timeoutId;
         uint32_t  m_timeoutCounter = 0;
+        uint32_t  m_receiveShardIndex = 0; //!< The network interface receive shard whose socket receives this connection's packets
 
         AZStd::mutex m_sendPacketMutex;
     };
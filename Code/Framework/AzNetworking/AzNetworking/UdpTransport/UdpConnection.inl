@@ -40,6 +40,11 @@ namespace AzNetworking
         return m_timeoutId;
     }
 
+    inline uint32_t UdpConnection::GetReceiveShardIndex() const
+    {
+        return m_receiveShardIndex;
+    }
+
     inline bool UdpConnection::PrepareReliablePacketForSend(PacketId packetId, SequenceId reliableSequenceId, const IPacket& packet)
     {
         return m_reliableQueue.PrepareForSend(packetId, reliableSequenceId, packet);
@@ -39,6 +39,10 @@ namespace AzNetworking
     AZ_CVAR(uint32_t, net_FragmentedHeaderOverhead, 32, nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "A fudge overhead value to take out of fragmented packet payloads");
     AZ_CVAR(bool, net_FragmentsAlwaysReliable, false, nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "Whether fragmented packets should be reliable by default or use their source packet's reliability type");
     AZ_CVAR(AZ::CVarFixedString, net_UdpCompressor, "MultiplayerCompressor", nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "UDP compressor to use."); // WARN: similar to encryption this needs to be set once and only once before creating the network interface
+    AZ_CVAR(uint32_t, net_UdpReceiveShards, 1, nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "The number of sockets and threads a listening Udp network interface receives and decodes packets with, 1 disables sharding. Requires SO_REUSEPORT and is ignored for encrypted interfaces");
+
+    //! Upper bound on net_UdpReceiveShards, well beyond the core count of any server we run on
+    static constexpr uint32_t MaxUdpReceiveShards = 64;
 
     static uint64_t ConstructTimeoutId(ConnectionId connectionId, PacketId packetId, ReliabilityType reliability)
     {
@@ -67,12 +71,20 @@ namespace AzNetworking
     {
         const AZ::CVarFixedString compressor = static_cast<AZ::CVarFixedString>(net_UdpCompressor);
         m_compressor = AZ::Interface<INetworking>::Get()->CreateCompressor(compressor);
+
+        // The interface's own socket is always the first receive shard
+        AZStd::unique_ptr<ReceiveShard> shard = AZStd::make_unique<ReceiveShard>();
+        shard->m_socket = m_socket.get();
+        shard->m_compressor = m_compressor.get();
+        m_receiveShards.emplace_back(AZStd::move(shard));
+
         m_heartbeatThread.RegisterNetworkInterface(this);
     }
 
     UdpNetworkInterface::~UdpNetworkInterface()
     {
         m_heartbeatThread.UnregisterNetworkInterface(this);
+        CloseReceiveShards();
         m_readerThread.UnregisterSocket(m_socket.get());
     }
 
@@ -116,9 +128,31 @@ namespace AzNetworking
 
         m_port = port;
         m_allowIncomingConnections = true;
+
+        uint32_t shardCount = AZ::GetClamp(static_cast<uint32_t>(net_UdpReceiveShards), 1u, MaxUdpReceiveShards);
+#if !AZ_TRAIT_USE_SOCKET_REUSEPORT
+        shardCount = 1;
+#endif
+        if (shardCount > 1 && m_socket->IsEncrypted())
+        {
+            // The DTLS handshake state is shared between decoding and dispatching packets, so it can't be split across threads
+            AZLOG_WARN("net_UdpReceiveShards is ignored for encrypted network interfaces");
+            shardCount = 1;
+        }
+        else if (shardCount > 1 && m_port == 0)
+        {
+            // Ephemeral ports can't be shared between sockets
+            shardCount = 1;
+        }
+
+        m_socket->SetReusePort(shardCount > 1);
         if (m_socket->Open(m_port, UdpSocket::CanAcceptConnections::True, m_trustZone))
         {
             m_readerThread.RegisterSocket(m_socket.get());
+            if (shardCount > 1)
+            {
+                OpenReceiveShards(shardCount);
+            }
             return true;
         }
         else
@@ -181,153 +215,53 @@ namespace AzNetworking
         }
 
         const AZ::TimeMs startTimeMs = AZ::GetElapsedTimeMs();
-        const UdpReaderThread::ReceivedPackets* packets = m_readerThread.GetReceivedPackets(m_socket.get());
-        if (packets == nullptr)
-        {
-            // Socket is not yet registered with the reader thread and is likely still pending, try again later
-            return;
-        }
-
-        for (uint32_t i = 0; i < packets->size(); ++i)
-        {
-            const UdpReaderThread::ReceivedPacket& packet = (*packets)[i];
-            const AZ::TimeMs currentTimeMs = AZ::GetElapsedTimeMs();
-
-            // Don't exceed our timeslice, even if unprocessed data remains
-            if ((currentTimeMs - startTimeMs) > net_UdpPacketTimeSliceMs)
-            {
-                AZLOG_WARN("Processing time exceeded, discarding %d/%d received packets", aznumeric_cast<int32_t>(packets->size() - i), aznumeric_cast<int32_t>(packets->size()));
-                GetMetrics().m_discardedPackets += packets->size() - i;
-                break;
-            }
 
-            UdpConnection* connection = m_connectionSet.GetConnection(packet.m_address);
-            if (connection == nullptr)
-            {
-                AcceptConnection(packet);
-                continue;
-            }
+        // Send everything queued for the connection set since the last update in as few batches as possible
+        m_socket->FlushSendQueue();
 
-            const DisconnectReason disconnectReason = GetDisconnectReasonForSocketResult(packet.m_receivedBytes);
-            if (disconnectReason != DisconnectReason::MAX)
-            {
-                connection->Disconnect(disconnectReason, TerminationEndpoint::Local);
-                continue;
-            }
-            
-            const ConnectionState connectionState = connection->GetConnectionState();
-            if (connectionState == ConnectionState::Disconnecting || connectionState == ConnectionState::Disconnected)
-            {
-                // Skip packets from disconnected connections
-                continue;
-            }
-
-            int32_t decodedPacketSize = 0;
-            m_decryptBuffer.Resize(m_decryptBuffer.GetCapacity());
-            const uint8_t* decodedPacketData = connection->GetDtlsEndpoint().DecodePacket(*connection, packet.m_buffer, packet.m_receivedBytes, m_decryptBuffer.GetBuffer(), decodedPacketSize);
-            m_decryptBuffer.Resize(decodedPacketSize);
-
-            if (decodedPacketSize == 0)
-            {
-                // OpenSSL may have consumed packets during handshake negotiation
-                continue;
-            }
-            else if (decodedPacketSize < 0)
-            {
-                // Late unencrypted handshake packets or just random garbage can show up, discard and continue
-                continue;
-            }
-
-            connection->GetMetrics().LogPacketRecv(packet.m_receivedBytes + UdpPacketHeaderSize, currentTimeMs);
+        if (m_receiveShards.size() > 1)
+        {
+            DecodeReceiveShards(startTimeMs);
 
-            // Decode the packet flag bitset first since it's always uncompressed
-            UdpPacketHeader header;
+            // Dispatch in shard order, each connection's packets are all on one shard so they're dispatched in the order they arrived.
+            // net_UdpPacketTimeSliceMs was already applied while decoding. Dispatch isn't time sliced, as decoding acked the packets
+            // and dropping them now would lose them for good
+            for (AZStd::unique_ptr<ReceiveShard>& shard : m_receiveShards)
             {
-                NetworkOutputSerializer flagSerializer(decodedPacketData, decodedPacketSize);
-                if (!header.SerializePacketFlags(flagSerializer))
+                for (DecodedPacket& decoded : shard->m_decodedPackets)
                 {
-                    continue;
+                    decoded.m_payload = shard->m_payloadData.data() + decoded.m_payloadOffset;
+                    DispatchDecodedPacket(*shard, decoded, startTimeMs);
                 }
-                // Adjust decoded tracking to represent the payload now that we've grabbed the flags
-                decodedPacketData = flagSerializer.GetUnreadData();
-                decodedPacketSize = flagSerializer.GetUnreadSize();
-                GetMetrics().m_recvBytesUncompressed += flagSerializer.GetReadSize();
+                shard->m_decodedPackets.clear();
+                shard->m_payloadData.clear();
             }
-
-            if (m_compressor && header.IsPacketFlagSet(PacketFlag::Compressed))
+        }
+        else
+        {
+            const UdpReaderThread::ReceivedPackets* packets = m_readerThread.GetReceivedPackets(m_socket.get());
+            if (packets == nullptr)
             {
-                // Only the payload is compressed
-                if (!DecompressPacket(decodedPacketData, decodedPacketSize, m_decompressBuffer))
-                {
-                    AZLOG_WARN("Failed to decompress packet!");
-                    continue;
-                }
-                decodedPacketData = m_decompressBuffer.GetBuffer();
-                decodedPacketSize = static_cast<int32_t>(m_decompressBuffer.GetSize());
+                // Socket is not yet registered with the reader thread and is likely still pending, try again later
+                return;
             }
-            GetMetrics().m_recvBytesUncompressed += decodedPacketSize;
 
-            TimeoutQueue::TimeoutItem* timeoutItem = m_connectionTimeoutQueue.RetrieveItem(connection->GetTimeoutId());
-            if (timeoutItem == nullptr)
+            ReceiveShard& shard = *m_receiveShards[0];
+            for (uint32_t i = 0; i < packets->size(); ++i)
             {
-                connection->Disconnect(DisconnectReason::Unknown, TerminationEndpoint::Local);
-                continue;
-            }
-            else
-            {
-                // Deserialize the packet header
-                NetworkOutputSerializer packetSerializer(decodedPacketData, decodedPacketSize);
-                ISerializer& serializer = packetSerializer; // To get the default typeinfo parameters in ISerializer
-                if (!serializer.Serialize(header, "Header"))
-                {
-                    continue;
-                }
+                const AZ::TimeMs currentTimeMs = AZ::GetElapsedTimeMs();
 
-                // Note that the serializer passed in here is unused for UDP
-                if (!connection->ProcessReceived(header, packetSerializer, packet.m_receivedBytes + UdpPacketHeaderSize, currentTimeMs))
+                // Don't exceed our timeslice, even if unprocessed data remains
+                if ((currentTimeMs - startTimeMs) > net_UdpPacketTimeSliceMs)
                 {
-                    continue;
+                    AZLOG_WARN("Processing time exceeded, discarding %d/%d received packets", aznumeric_cast<int32_t>(packets->size() - i), aznumeric_cast<int32_t>(packets->size()));
+                    shard.m_discardedPackets += packets->size() - i;
+                    break;
                 }
 
-                timeoutItem->UpdateTimeoutTime(startTimeMs);
-                connection->m_timeoutCounter = 0;
-
-                PacketDispatchResult handledPacket = PacketDispatchResult::Failure;
-                if (header.GetPacketType() < aznumeric_cast<PacketType>(CorePackets::PacketType::MAX))
-                {
-                    handledPacket = connection->HandleCorePacket(m_connectionListener, header, packetSerializer);
-                }
-                else
-                {
-                    handledPacket = m_connectionListener.OnPacketReceived(connection, header, packetSerializer);
-                }
-
-                if (handledPacket == PacketDispatchResult::Success)
-                {
-                    connection->UpdateHeartbeat(currentTimeMs);
-                    if (connection->GetConnectionState() == ConnectionState::Connecting && !connection->GetDtlsEndpoint().IsConnecting())
-                    {
-                        // Connection is realized once a packet is received and socket handshake is verified complete
-                        connection->m_state = ConnectionState::Connected;
-                    }
-                }
-                else if (m_socket->IsEncrypted() && connection->GetDtlsEndpoint().IsConnecting() &&
-                    !IsHandshakePacket(connection->GetDtlsEndpoint(), header.GetPacketType()))
-                {
-                    // It's possible for one side to finish its half of the encryption handshake and start sending encrypted data
-                    // This will appear as a SerializationError due to the incomplete encryption handshake
-                    // If it's not an expected unencrypted type then skip it for now
-                    continue;
-                }
-                else if (handledPacket == PacketDispatchResult::Skipped)
-                {
-                    // If the result is marked as skipped then do so (i.e. if a handshake is not yet complete)
-                    continue;
-                }
-                else if (connection->GetConnectionState() != ConnectionState::Disconnecting)
-                {
-                    connection->Disconnect(DisconnectReason::StreamError, TerminationEndpoint::Local);
-                }
+                DecodedPacket decoded;
+                DecodeReceivedPacket(shard, (*packets)[i], currentTimeMs, decoded);
+                DispatchDecodedPacket(shard, decoded, startTimeMs);
             }
         }
         const AZ::TimeMs receiveTimeMs = AZ::GetElapsedTimeMs() - startTimeMs;
@@ -346,14 +280,32 @@ namespace AzNetworking
         }
         m_removedConnections.clear();
 
+        // Send the acks, heartbeats and resends queued while processing this update
+        m_socket->FlushSendQueue();
+
         // Update metrics
+        for (AZStd::unique_ptr<ReceiveShard>& shard : m_receiveShards)
+        {
+            GetMetrics().m_recvBytesUncompressed += shard->m_recvBytesUncompressed;
+            GetMetrics().m_discardedPackets += shard->m_discardedPackets;
+            shard->m_recvBytesUncompressed = 0;
+            shard->m_discardedPackets = 0;
+        }
         GetMetrics().m_sendPackets = m_socket->GetSentPackets();
         GetMetrics().m_sendBytes = m_socket->GetSentBytes();
         GetMetrics().m_sendPacketsEncrypted = m_socket->GetSentPacketsEncrypted();
         GetMetrics().m_sendBytesEncryptionInflation = m_socket->GetSentBytesEncryptionInflation();
         GetMetrics().m_recvTimeMs += receiveTimeMs;
-        GetMetrics().m_recvPackets = m_socket->GetRecvPackets();
-        GetMetrics().m_recvBytes = m_socket->GetRecvBytes();
+        GetMetrics().m_recvPackets = 0;
+        GetMetrics().m_recvBytes = 0;
+        GetMetrics().m_recvBatches = 0;
+        for (const AZStd::unique_ptr<ReceiveShard>& shard : m_receiveShards)
+        {
+            GetMetrics().m_recvPackets += shard->m_socket->GetRecvPackets();
+            GetMetrics().m_recvBytes += shard->m_socket->GetRecvBytes();
+            GetMetrics().m_recvBatches += shard->m_socket->GetRecvBatches();
+        }
+        GetMetrics().m_sendBatches = m_socket->GetSentBatches();
         GetMetrics().m_connectionCount = m_connectionSet.GetConnectionCount();
         GetMetrics().m_updateTimeMs += AZ::GetElapsedTimeMs() - startTimeMs;
     }
@@ -395,6 +347,7 @@ namespace AzNetworking
             return false;
         }
 
+        CloseReceiveShards();
         m_port = 0;
         m_readerThread.UnregisterSocket(m_socket.get());
         m_allowIncomingConnections = false;
@@ -432,6 +385,362 @@ namespace AzNetworking
         return m_socket->IsOpen();
     }
 
+    void UdpNetworkInterface::OpenReceiveShards(uint32_t shardCount)
+    {
+        const AZ::CVarFixedString compressor = static_cast<AZ::CVarFixedString>(net_UdpCompressor);
+        for (uint32_t shardIndex = 1; shardIndex < shardCount; ++shardIndex)
+        {
+            AZStd::unique_ptr<ReceiveShard> shard = AZStd::make_unique<ReceiveShard>();
+            shard->m_shardIndex = shardIndex;
+            shard->m_ownedSocket = AZStd::make_unique<UdpSocket>();
+            shard->m_ownedSocket->SetReusePort(true);
+            if (!shard->m_ownedSocket->Open(m_port, UdpSocket::CanAcceptConnections::True, m_trustZone))
+            {
+                AZLOG_WARN("Failed to open receive shard %u on port %u, continuing with %u shards", shardIndex, aznumeric_cast<uint32_t>(m_port), shardIndex);
+                break;
+            }
+            shard->m_socket = shard->m_ownedSocket.get();
+            if (m_compressor)
+            {
+                // Compressors aren't required to be thread safe, so each shard decompresses with its own
+                shard->m_ownedCompressor = AZ::Interface<INetworking>::Get()->CreateCompressor(compressor);
+                shard->m_compressor = shard->m_ownedCompressor.get();
+            }
+            m_readerThread.RegisterSocket(shard->m_socket);
+            m_receiveShards.emplace_back(AZStd::move(shard));
+        }
+
+        m_receiveShardsExit = false;
+        AZStd::thread_desc desc;
+        desc.m_name = "UdpReceiveShard";
+        m_receiveShardThreads.reserve(m_receiveShards.size() - 1);
+        for (size_t shardIndex = 1; shardIndex < m_receiveShards.size(); ++shardIndex)
+        {
+            m_receiveShardThreads.emplace_back(desc, [this, &shard = *m_receiveShards[shardIndex]]() { ReceiveShardWorkerLoop(shard); });
+        }
+    }
+
+    void UdpNetworkInterface::CloseReceiveShards()
+    {
+        {
+            AZStd::scoped_lock<AZStd::mutex> lock(m_receiveShardMutex);
+            m_receiveShardsExit = true;
+        }
+        m_receiveShardWakeCondition.notify_all();
+        for (AZStd::thread& thread : m_receiveShardThreads)
+        {
+            thread.join();
+        }
+        m_receiveShardThreads.clear();
+
+        for (size_t shardIndex = 1; shardIndex < m_receiveShards.size(); ++shardIndex)
+        {
+            m_readerThread.UnregisterSocket(m_receiveShards[shardIndex]->m_socket);
+            m_receiveShards[shardIndex]->m_socket->Close();
+        }
+        m_receiveShards.resize(1);
+        m_receiveShards[0]->m_decodedPackets.clear();
+        m_receiveShards[0]->m_payloadData.clear();
+
+        // Any connections left are now received on the interface's own socket
+        m_connectionSet.VisitConnections([](IConnection& connection) { static_cast<UdpConnection&>(connection).m_receiveShardIndex = 0; });
+    }
+
+    void UdpNetworkInterface::ReceiveShardWorkerLoop(ReceiveShard& shard)
+    {
+        uint64_t decodedGeneration = 0;
+        for (;;)
+        {
+            AZ::TimeMs startTimeMs = AZ::Time::ZeroTimeMs;
+            {
+                AZStd::unique_lock<AZStd::mutex> lock(m_receiveShardMutex);
+                m_receiveShardWakeCondition.wait(lock, [this, decodedGeneration]()
+                {
+                    return m_receiveShardsExit || (m_receiveShardGeneration != decodedGeneration);
+                });
+                if (m_receiveShardsExit)
+                {
+                    return;
+                }
+                decodedGeneration = m_receiveShardGeneration;
+                startTimeMs = m_receiveShardStartTimeMs;
+            }
+
+            DecodeShardPackets(shard, startTimeMs);
+
+            {
+                AZStd::scoped_lock<AZStd::mutex> lock(m_receiveShardMutex);
+                if (--m_receiveShardsPending == 0)
+                {
+                    m_receiveShardDoneCondition.notify_one();
+                }
+            }
+        }
+    }
+
+    void UdpNetworkInterface::DecodeReceiveShards(AZ::TimeMs startTimeMs)
+    {
+        {
+            AZStd::scoped_lock<AZStd::mutex> lock(m_receiveShardMutex);
+            ++m_receiveShardGeneration;
+            m_receiveShardStartTimeMs = startTimeMs;
+            m_receiveShardsPending = aznumeric_cast<uint32_t>(m_receiveShardThreads.size());
+        }
+        m_receiveShardWakeCondition.notify_all();
+
+        // Shard zero is decoded on this thread while the workers decode the others
+        DecodeShardPackets(*m_receiveShards[0], startTimeMs);
+
+        AZStd::unique_lock<AZStd::mutex> lock(m_receiveShardMutex);
+        m_receiveShardDoneCondition.wait(lock, [this]() { return m_receiveShardsPending == 0; });
+    }
+
+    void UdpNetworkInterface::DecodeShardPackets(ReceiveShard& shard, AZ::TimeMs startTimeMs)
+    {
+        const UdpReaderThread::ReceivedPackets* packets = m_readerThread.GetReceivedPackets(shard.m_socket);
+        if (packets == nullptr)
+        {
+            // Socket is not yet registered with the reader thread and is likely still pending, try again later
+            return;
+        }
+
+        for (uint32_t i = 0; i < packets->size(); ++i)
+        {
+            const AZ::TimeMs currentTimeMs = AZ::GetElapsedTimeMs();
+
+            // Don't exceed our timeslice, even if unprocessed data remains. Packets that have been decoded are always dispatched, since
+            // decoding acknowledges them
+            if ((currentTimeMs - startTimeMs) > net_UdpPacketTimeSliceMs)
+            {
+                AZLOG_WARN("Processing time exceeded on receive shard %u, discarding %d/%d received packets", shard.m_shardIndex,
+                    aznumeric_cast<int32_t>(packets->size() - i), aznumeric_cast<int32_t>(packets->size()));
+                shard.m_discardedPackets += packets->size() - i;
+                break;
+            }
+
+            DecodedPacket& decoded = shard.m_decodedPackets.emplace_back();
+            DecodeReceivedPacket(shard, (*packets)[i], currentTimeMs, decoded);
+            if (decoded.m_action == ReceiveAction::Skip)
+            {
+                shard.m_decodedPackets.pop_back();
+            }
+            else if (decoded.m_action == ReceiveAction::Dispatch)
+            {
+                // The decoded payload lives in the shard's decode buffers which the next packet reuses, so keep a copy for dispatch
+                decoded.m_payloadOffset = aznumeric_cast<uint32_t>(shard.m_payloadData.size());
+                shard.m_payloadData.insert(shard.m_payloadData.end(), decoded.m_payload, decoded.m_payload + decoded.m_payloadSize);
+                decoded.m_payload = nullptr;
+            }
+        }
+    }
+
+    void UdpNetworkInterface::DecodeReceivedPacket(ReceiveShard& shard, const UdpReaderThread::ReceivedPacket& packet, AZ::TimeMs currentTimeMs, DecodedPacket& outDecoded)
+    {
+        outDecoded.m_receivedPacket = &packet;
+        outDecoded.m_receiveTimeMs = currentTimeMs;
+
+        // The connection set is only modified while dispatching, so looking up connections is safe while shards decode in parallel
+        UdpConnection* connection = m_connectionSet.GetConnection(packet.m_address);
+        outDecoded.m_connection = connection;
+        if (connection == nullptr)
+        {
+            outDecoded.m_action = ReceiveAction::Accept;
+            return;
+        }
+
+        if (connection->m_receiveShardIndex != shard.m_shardIndex)
+        {
+            // Another shard owns this connection and may be decoding its packets right now
+            outDecoded.m_action = ReceiveAction::Reassign;
+            return;
+        }
+
+        const DisconnectReason disconnectReason = GetDisconnectReasonForSocketResult(packet.m_receivedBytes);
+        if (disconnectReason != DisconnectReason::MAX)
+        {
+            outDecoded.m_action = ReceiveAction::Disconnect;
+            outDecoded.m_disconnectReason = disconnectReason;
+            return;
+        }
+
+        const ConnectionState connectionState = connection->GetConnectionState();
+        if (connectionState == ConnectionState::Disconnecting || connectionState == ConnectionState::Disconnected)
+        {
+            // Skip packets from disconnected connections
+            return;
+        }
+
+        int32_t decodedPacketSize = 0;
+        shard.m_decryptBuffer.Resize(shard.m_decryptBuffer.GetCapacity());
+        const uint8_t* decodedPacketData = connection->GetDtlsEndpoint().DecodePacket(*connection, packet.m_buffer, packet.m_receivedBytes, shard.m_decryptBuffer.GetBuffer(), decodedPacketSize);
+        shard.m_decryptBuffer.Resize(decodedPacketSize);
+
+        if (decodedPacketSize == 0)
+        {
+            // OpenSSL may have consumed packets during handshake negotiation
+            return;
+        }
+        else if (decodedPacketSize < 0)
+        {
+            // Late unencrypted handshake packets or just random garbage can show up, discard and continue
+            return;
+        }
+
+        connection->GetMetrics().LogPacketRecv(packet.m_receivedBytes + UdpPacketHeaderSize, currentTimeMs);
+
+        // Decode the packet flag bitset first since it's always uncompressed
+        UdpPacketHeader& header = outDecoded.m_header;
+        {
+            NetworkOutputSerializer flagSerializer(decodedPacketData, decodedPacketSize);
+            if (!header.SerializePacketFlags(flagSerializer))
+            {
+                return;
+            }
+            // Adjust decoded tracking to represent the payload now that we've grabbed the flags
+            decodedPacketData = flagSerializer.GetUnreadData();
+            decodedPacketSize = flagSerializer.GetUnreadSize();
+            shard.m_recvBytesUncompressed += flagSerializer.GetReadSize();
+        }
+
+        if (shard.m_compressor && header.IsPacketFlagSet(PacketFlag::Compressed))
+        {
+            // Only the payload is compressed
+            if (!DecompressPacket(shard.m_compressor, decodedPacketData, decodedPacketSize, shard.m_decompressBuffer))
+            {
+                AZLOG_WARN("Failed to decompress packet!");
+                return;
+            }
+            decodedPacketData = shard.m_decompressBuffer.GetBuffer();
+            decodedPacketSize = static_cast<int32_t>(shard.m_decompressBuffer.GetSize());
+        }
+        shard.m_recvBytesUncompressed += decodedPacketSize;
+
+        // Deserialize the packet header
+        NetworkOutputSerializer packetSerializer(decodedPacketData, decodedPacketSize);
+        ISerializer& serializer = packetSerializer; // To get the default typeinfo parameters in ISerializer
+        if (!serializer.Serialize(header, "Header"))
+        {
+            return;
+        }
+
+        // Note that the serializer passed in here is unused for UDP
+        if (!connection->ProcessReceived(header, packetSerializer, packet.m_receivedBytes + UdpPacketHeaderSize, currentTimeMs))
+        {
+            return;
+        }
+
+        outDecoded.m_action = ReceiveAction::Dispatch;
+        outDecoded.m_payload = packetSerializer.GetUnreadData();
+        outDecoded.m_payloadSize = packetSerializer.GetUnreadSize();
+    }
+
+    void UdpNetworkInterface::DispatchDecodedPacket(ReceiveShard& shard, DecodedPacket& decoded, AZ::TimeMs startTimeMs)
+    {
+        switch (decoded.m_action)
+        {
+        case ReceiveAction::Skip:
+            return;
+
+        case ReceiveAction::Accept:
+            if (m_connectionSet.GetConnection(decoded.m_receivedPacket->m_address) == nullptr)
+            {
+                AcceptConnection(*decoded.m_receivedPacket, shard.m_shardIndex);
+                return;
+            }
+            // An earlier packet in this update created the connection, decode the packet again now that it has one
+            break;
+
+        case ReceiveAction::Reassign:
+            // The kernel routes each remote endpoint to a single socket, so this only happens for connections this interface initiated
+            // or after the shard count changed. The connection now belongs to the shard its packets arrive on
+            AZLOG(NET_Debug, "Moving connection to %s to receive shard %u", decoded.m_connection->GetRemoteAddress().GetString().c_str(), shard.m_shardIndex);
+            decoded.m_connection->m_receiveShardIndex = shard.m_shardIndex;
+            break;
+
+        case ReceiveAction::Disconnect:
+            decoded.m_connection->Disconnect(decoded.m_disconnectReason, TerminationEndpoint::Local);
+            return;
+
+        case ReceiveAction::Dispatch:
+            break;
+        }
+
+        if (decoded.m_action != ReceiveAction::Dispatch)
+        {
+            // Decoding on this thread is safe as the shards have finished decoding, and the payloads of packets still to be dispatched
+            // were copied out of the shard's decode buffers
+            const UdpReaderThread::ReceivedPacket& packet = *decoded.m_receivedPacket;
+            const AZ::TimeMs receiveTimeMs = decoded.m_receiveTimeMs;
+            decoded = DecodedPacket();
+            DecodeReceivedPacket(shard, packet, receiveTimeMs, decoded);
+            if (decoded.m_action != ReceiveAction::Dispatch)
+            {
+                DispatchDecodedPacket(shard, decoded, startTimeMs);
+                return;
+            }
+        }
+
+        UdpConnection* connection = decoded.m_connection;
+        const ConnectionState connectionState = connection->GetConnectionState();
+        if (connectionState == ConnectionState::Disconnecting || connectionState == ConnectionState::Disconnected)
+        {
+            // An earlier packet may have disconnected the connection after this one was decoded
+            return;
+        }
+
+        TimeoutQueue::TimeoutItem* timeoutItem = m_connectionTimeoutQueue.RetrieveItem(connection->GetTimeoutId());
+        if (timeoutItem == nullptr)
+        {
+            connection->Disconnect(DisconnectReason::Unknown, TerminationEndpoint::Local);
+            return;
+        }
+
+        const AZ::TimeMs currentTimeMs = decoded.m_receiveTimeMs;
+        connection->UpdateHeartbeat(currentTimeMs);
+
+        timeoutItem->UpdateTimeoutTime(startTimeMs);
+        connection->m_timeoutCounter = 0;
+
+        UdpPacketHeader& header = decoded.m_header;
+        NetworkOutputSerializer packetSerializer(decoded.m_payload, decoded.m_payloadSize);
+        PacketDispatchResult handledPacket = PacketDispatchResult::Failure;
+        if (header.GetPacketType() < aznumeric_cast<PacketType>(CorePackets::PacketType::MAX))
+        {
+            handledPacket = connection->HandleCorePacket(m_connectionListener, header, packetSerializer);
+        }
+        else
+        {
+            handledPacket = m_connectionListener.OnPacketReceived(connection, header, packetSerializer);
+        }
+
+        if (handledPacket == PacketDispatchResult::Success)
+        {
+            connection->UpdateHeartbeat(currentTimeMs);
+            if (connection->GetConnectionState() == ConnectionState::Connecting && !connection->GetDtlsEndpoint().IsConnecting())
+            {
+                // Connection is realized once a packet is received and socket handshake is verified complete
+                connection->m_state = ConnectionState::Connected;
+            }
+        }
+        else if (m_socket->IsEncrypted() && connection->GetDtlsEndpoint().IsConnecting() &&
+            !IsHandshakePacket(connection->GetDtlsEndpoint(), header.GetPacketType()))
+        {
+            // It's possible for one side to finish its half of the encryption handshake and start sending encrypted data
+            // This will appear as a SerializationError due to the incomplete encryption handshake
+            // If it's not an expected unencrypted type then skip it for now
+            return;
+        }
+        else if (handledPacket == PacketDispatchResult::Skipped)
+        {
+            // If the result is marked as skipped then do so (i.e. if a handshake is not yet complete)
+            return;
+        }
+        else if (connection->GetConnectionState() != ConnectionState::Disconnecting)
+        {
+            connection->Disconnect(DisconnectReason::StreamError, TerminationEndpoint::Local);
+        }
+    }
+
     void UdpNetworkInterface::RegisterWithTimeoutQueue(ConnectionId connectionId, PacketId packetId, ReliabilityType reliability, const ConnectionMetrics& metrics)
     {
         const float avgRtt = metrics.m_connectionRtt.GetRoundTripTimeSeconds(); // Time is in seconds, timeout times are in milliseconds
@@ -441,9 +750,9 @@ namespace AzNetworking
         m_packetTimeoutQueue.RegisterItem(ConstructTimeoutId(connectionId, packetId, reliability), packetTimeoutMs);
     }
 
-    bool UdpNetworkInterface::DecompressPacket(const uint8_t* packetBuffer, size_t packetSize, UdpPacketEncodingBuffer& packetBufferOut) const
+    bool UdpNetworkInterface::DecompressPacket(ICompressor* compressor, const uint8_t* packetBuffer, size_t packetSize, UdpPacketEncodingBuffer& packetBufferOut) const
     {
-        if (!m_compressor) // should probably have some compression handshake than relying on existence of compressor
+        if (!compressor) // should probably have some compression handshake than relying on existence of compressor
         {
             AZLOG_ERROR("Decompress called without a compressor.");
             return false;
@@ -453,7 +762,7 @@ namespace AzNetworking
         AZStd::size_t bytesConsumed = 0;
 
         packetBufferOut.Resize(packetBufferOut.GetCapacity());
-        const CompressorError compErr = m_compressor->Decompress(packetBuffer, packetSize, packetBufferOut.GetBuffer(), packetBufferOut.GetCapacity(), bytesConsumed, uncompSize);
+        const CompressorError compErr = compressor->Decompress(packetBuffer, packetSize, packetBufferOut.GetBuffer(), packetBufferOut.GetCapacity(), bytesConsumed, uncompSize);
         packetBufferOut.Resize(aznumeric_cast<uint32_t>(uncompSize)); // Decompress will fail if larger than buffer size, so this cast is safe
 
         if (compErr != CompressorError::Ok)
@@ -638,7 +947,7 @@ namespace AzNetworking
         return InvalidPacketId;
     }
 
-    void UdpNetworkInterface::AcceptConnection(const UdpReaderThread::ReceivedPacket& connectPacket)
+    void UdpNetworkInterface::AcceptConnection(const UdpReaderThread::ReceivedPacket& connectPacket, uint32_t shardIndex)
     {
         if (!m_allowIncomingConnections)
         {
@@ -701,6 +1010,7 @@ namespace AzNetworking
         // Transition state based on our how our socket resolved
         connection->m_state = result == DtlsEndpoint::ConnectResult::Complete ? ConnectionState::Connected : ConnectionState::Connecting;
         connection->SetTimeoutId(timeoutId);
+        connection->m_receiveShardIndex = shardIndex;
         m_connectionListener.OnConnect(connection.get());
         m_connectionSet.AddConnection(AZStd::move(connection));
     }
@@ -795,6 +1105,16 @@ namespace AzNetworking
         return TimeoutResult::Delete;
     }
 
+    void UdpNetworkInterface::FlushSendQueue()
+    {
+        m_socket->FlushSendQueue();
+    }
+
+    uint32_t UdpNetworkInterface::GetReceiveShardCount() const
+    {
+        return aznumeric_cast<uint32_t>(m_receiveShards.size());
+    }
+
     AZStd::atomic<AZ::TimeMs> UdpNetworkInterface::GetLastSystemTickUpdate() const
     {
         return m_lastSystemTickUpdate.load();
@@ -18,6 +18,8 @@
 #include <AzNetworking/DataStructures/TimeoutQueue.h>
 #include <AzCore/Threading/ThreadSafeDeque.h>
 #include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/condition_variable.h>
+#include <AzCore/std/parallel/thread.h>
 
 namespace AzNetworking
 {
@@ -85,6 +87,18 @@ namespace AzNetworking
     //! AzNetworking uses the [OpenSSL](https://www.openssl.org/) library to implement Datagram Layer Transport Security (DTLS) encryption
     //! on UDP traffic. Encryption operates as described in [O3DE Networking Encryption](http://o3de.org/docs/user-guide/networking/encryption)
     //! on the documentation website. Once both endpoints have completed their handshake, all traffic is expected to be fully encrypted.
+    //!
+    //! ### Receive sharding
+    //!
+    //! When net_UdpReceiveShards is greater than one, a listening interface opens that many sockets on its port with SO_REUSEPORT.
+    //! The kernel hashes each remote endpoint to one of those sockets, and every connection belongs to the shard whose socket
+    //! receives its packets. Each update, the shards decode their packets in parallel: decryption, decompression, header parsing
+    //! and ack and reliability tracking. Shard zero runs on the calling thread and every other shard on its own worker thread.
+    //! Only the shard's own connections are touched. The decoded packets are then dispatched to the IConnectionListener on the
+    //! calling thread, so sharding is invisible to the listener and to users of the connection set. Sends and connection
+    //! management also stay on the calling thread. Encrypted interfaces are not sharded.
+    //! The net_UdpPacketTimeSliceMs budget applies to decoding: each shard discards the packets it couldn't decode in time.
+    //! Dispatching the decoded packets isn't time sliced, since they have already been acked.
     class UdpNetworkInterface final
         : public INetworkInterface
     {
@@ -122,8 +136,93 @@ namespace AzNetworking
 
         AZStd::atomic<AZ::TimeMs> GetLastSystemTickUpdate() const;
 
+        //! Sends any packets queued on the socket when batched sends are enabled.
+        //! Called as part of Update, and by the heartbeat thread after it sends on behalf of a blocked main thread.
+        void FlushSendQueue();
+
+        //! Returns the number of receive shards, including shard zero which receives on the interface's own socket.
+        //! @return the number of receive shards, 1 if the interface isn't sharded
+        uint32_t GetReceiveShardCount() const;
+
     private:
 
+        //! What to do with a received packet once it has been decoded.
+        enum class ReceiveAction
+        {
+            Skip,       // Nothing left to do, the packet was consumed or discarded while decoding
+            Dispatch,   // Dispatch the decoded payload to the connection
+            Accept,     // The packet isn't from a known connection and may be a connection request
+            Disconnect, // The socket reported an error for the connection
+            Reassign    // The packet arrived on a shard that doesn't own its connection
+        };
+
+        //! A received packet after decoding, holding everything needed to dispatch it.
+        struct DecodedPacket
+        {
+            ReceiveAction m_action = ReceiveAction::Skip;
+            const UdpReaderThread::ReceivedPacket* m_receivedPacket = nullptr;
+            UdpConnection* m_connection = nullptr;
+            DisconnectReason m_disconnectReason = DisconnectReason::MAX;
+            UdpPacketHeader m_header;
+            const uint8_t* m_payload = nullptr;
+            uint32_t m_payloadOffset = 0;
+            uint32_t m_payloadSize = 0;
+            AZ::TimeMs m_receiveTimeMs = AZ::Time::ZeroTimeMs;
+        };
+
+        //! A socket receiving on the interface's port along with the state used to decode the packets of the connections it owns.
+        //! Shard zero uses the interface's own socket and compressor.
+        struct ReceiveShard
+        {
+            uint32_t m_shardIndex = 0;
+            UdpSocket* m_socket = nullptr;
+            AZStd::unique_ptr<UdpSocket> m_ownedSocket;
+            ICompressor* m_compressor = nullptr;
+            AZStd::unique_ptr<ICompressor> m_ownedCompressor;
+            UdpPacketEncodingBuffer m_decryptBuffer;
+            UdpPacketEncodingBuffer m_decompressBuffer;
+            //! Packets decoded on a worker thread, waiting for dispatch. Their payloads are stored in m_payloadData.
+            AZStd::vector<DecodedPacket> m_decodedPackets;
+            AZStd::vector<uint8_t> m_payloadData;
+            //! Metrics gathered while decoding, added to the interface metrics after dispatch.
+            uint64_t m_recvBytesUncompressed = 0;
+            uint64_t m_discardedPackets = 0;
+        };
+
+        //! Opens the additional sockets that share the listen port and starts their worker threads.
+        //! @param shardCount the total number of shards, including the shard using the interface's own socket
+        void OpenReceiveShards(uint32_t shardCount);
+
+        //! Stops the shard worker threads and closes the additional sockets, leaving only shard zero.
+        void CloseReceiveShards();
+
+        //! Main loop for the worker thread decoding a shard's packets.
+        //! @param shard the shard this worker thread decodes packets for
+        void ReceiveShardWorkerLoop(ReceiveShard& shard);
+
+        //! Decodes the packets received on every shard in parallel and waits for all of them to complete.
+        //! @param startTimeMs the time the current update started, used for the processing time budget
+        void DecodeReceiveShards(AZ::TimeMs startTimeMs);
+
+        //! Decodes all the packets received on a shard's socket into the shard's list of decoded packets.
+        //! @param shard       the shard to decode packets for
+        //! @param startTimeMs the time the current update started, used for the processing time budget
+        void DecodeShardPackets(ReceiveShard& shard, AZ::TimeMs startTimeMs);
+
+        //! Decodes a received packet. Only touches the shard and the connection the packet belongs to, so it is safe to call for
+        //! different shards at the same time.
+        //! @param shard         the shard the packet was received on
+        //! @param packet        the received packet to decode
+        //! @param currentTimeMs current wall clock time in milliseconds
+        //! @param outDecoded    the decoded packet and what to do with it
+        void DecodeReceivedPacket(ReceiveShard& shard, const UdpReaderThread::ReceivedPacket& packet, AZ::TimeMs currentTimeMs, DecodedPacket& outDecoded);
+
+        //! Dispatches a decoded packet to its connection and the connection listener. Must be called from the thread updating the interface.
+        //! @param shard       the shard the packet was received on
+        //! @param decoded     the decoded packet to dispatch
+        //! @param startTimeMs the time the current update started
+        void DispatchDecodedPacket(ReceiveShard& shard, DecodedPacket& decoded, AZ::TimeMs startTimeMs);
+
         //! Registers a packet with a timeout queue on the provided connection.
         //! @param connectionId identifier of the connection to register
         //! @param packetId     packet id of the packet to register for the given connection
@@ -132,11 +231,12 @@ namespace AzNetworking
         void RegisterWithTimeoutQueue(ConnectionId connectionId, PacketId packetId, ReliabilityType reliability, const ConnectionMetrics& metrics);
 
         //! Decompresses an incoming packet data buffer.
+        //! @param compressor      the compressor to decompress with
         //! @param packetBuffer    the compressed packet buffer to decode
         //! @param packetSize      the size of the compressed packet buffer
         //! @param packetBufferOut the decoded data
         //! @return boolean true on success, false on failure
-        bool DecompressPacket(const uint8_t* packetBuffer, size_t packetSize, UdpPacketEncodingBuffer& packetBufferOut) const;
+        bool DecompressPacket(ICompressor* compressor, const uint8_t* packetBuffer, size_t packetSize, UdpPacketEncodingBuffer& packetBufferOut) const;
 
         //! Sends a packet to the remote connection.
         //! @param connection         the UdpConnection instance to send the packet on
@@ -147,7 +247,8 @@ namespace AzNetworking
 
         //! Accepts an incoming udp connection.
         //! @param connectPacket the initial connectPacket
-        void AcceptConnection(const UdpReaderThread::ReceivedPacket& connectPacket);
+        //! @param shardIndex    index of the shard the connect packet was received on, which will own the connection
+        void AcceptConnection(const UdpReaderThread::ReceivedPacket& connectPacket, uint32_t shardIndex);
 
         //! Internal helper to cleanly remove a connection from the network interface.
         //! @param connection pointer to the connection to disconnect
@@ -196,8 +297,15 @@ namespace AzNetworking
         };
         AZStd::vector<RemovedConnection> m_removedConnections;
 
-        UdpPacketEncodingBuffer m_decryptBuffer;
-        UdpPacketEncodingBuffer m_decompressBuffer;
+        AZStd::vector<AZStd::unique_ptr<ReceiveShard>> m_receiveShards;
+        AZStd::vector<AZStd::thread> m_receiveShardThreads;
+        AZStd::mutex m_receiveShardMutex;
+        AZStd::condition_variable m_receiveShardWakeCondition;
+        AZStd::condition_variable m_receiveShardDoneCondition;
+        uint64_t m_receiveShardGeneration = 0;
+        uint32_t m_receiveShardsPending = 0;
+        AZ::TimeMs m_receiveShardStartTimeMs = AZ::Time::ZeroTimeMs;
+        bool m_receiveShardsExit = false;
 
         friend class UdpReliableQueue;
         friend class UdpConnection; // For access to private RequestDisconnect() method
@@ -11,6 +11,7 @@
 #include <AzNetworking/Utilities/NetworkCommon.h>
 #include <AzCore/Console/IConsole.h>
 #include <AzCore/Console/ILogger.h>
+#include <AzCore/std/algorithm.h>
 
 namespace AzNetworking
 {
@@ -176,7 +177,6 @@ namespace AzNetworking
                     break;
                 }
 
-                IpAddress address;
                 const uint32_t bufferHead = static_cast<uint32_t>(receiveBuffer.GetSize());
                 if (bufferHead + MaxUdpTransmissionUnit >= receiveBuffer.GetCapacity())
                 {
@@ -185,18 +185,38 @@ namespace AzNetworking
                     break;
                 }
 
+                // Hand the socket as many MTU sized slots as the buffers have room for, so it can fill them all with a single call
+                const uint32_t freeBufferSlots = static_cast<uint32_t>(receiveBuffer.GetCapacity() - bufferHead) / MaxUdpTransmissionUnit;
+                const uint32_t freePacketSlots = MaxUdpReceivePacketCount - static_cast<uint32_t>(receivedPackets.size());
+                const uint32_t slotCount = AZStd::min(AZStd::min(freeBufferSlots, freePacketSlots), UdpSocket::MaxBatchedPacketCount);
+                if (slotCount == 0)
+                {
+                    break;
+                }
+
                 uint8_t* dstData = receiveBuffer.GetBufferEnd();
-                receiveBuffer.Resize(bufferHead + MaxUdpTransmissionUnit);
+                receiveBuffer.Resize(bufferHead + slotCount * MaxUdpTransmissionUnit);
 
-                const int32_t receivedBytes = socket->Receive(address, dstData, MaxUdpTransmissionUnit);
-                if (receivedBytes > 0 && !receivedPackets.full())
+                UdpSocket::ReceiveEntry entries[UdpSocket::MaxBatchedPacketCount];
+                for (uint32_t i = 0; i < slotCount; ++i)
                 {
-                    receivedPackets.push_back(ReceivedPacket(address, dstData, receivedBytes));
-                    receiveBuffer.Resize(bufferHead + receivedBytes);
+                    entries[i].m_buffer = dstData + i * MaxUdpTransmissionUnit;
+                    entries[i].m_bufferSize = MaxUdpTransmissionUnit;
                 }
-                else
+
+                const uint32_t receivedCount = socket->ReceiveBatch(entries, slotCount);
+                for (uint32_t i = 0; i < receivedCount; ++i)
+                {
+                    receivedPackets.push_back(ReceivedPacket(entries[i].m_address, entries[i].m_buffer, entries[i].m_receivedBytes));
+                }
+
+                if (receivedCount < slotCount)
                 {
-                    receiveBuffer.Resize(bufferHead);
+                    // The socket has been drained, trim the unused slots off the buffer
+                    const uint32_t usedBytes = (receivedCount > 0)
+                        ? static_cast<uint32_t>(entries[receivedCount - 1].m_buffer - dstData) + static_cast<uint32_t>(entries[receivedCount - 1].m_receivedBytes)
+                        : 0;
+                    receiveBuffer.Resize(bufferHead + usedBytes);
                     break;
                 }
             }
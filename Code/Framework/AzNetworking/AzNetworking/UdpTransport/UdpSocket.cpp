@@ -18,11 +18,32 @@
 #include <AzCore/EBus/ScheduledEvent.h>
 #include <AzCore/Interface/Interface.h>
 
+#if AZ_TRAIT_USE_SOCKET_BATCHED_IO
+#   include <netinet/udp.h>
+#   ifndef SOL_UDP
+#       define SOL_UDP 17
+#   endif
+#   ifndef UDP_SEGMENT
+#       define UDP_SEGMENT 103
+#   endif
+#endif
+
 namespace AzNetworking
 {
     AZ_CVAR(int32_t, net_UdpSendBufferSize, 1 * 1024 * 1024, nullptr, AZ::ConsoleFunctorFlags::Null, "Default UDP socket send buffer size");
     AZ_CVAR(int32_t, net_UdpRecvBufferSize, 1 * 1024 * 1024, nullptr, AZ::ConsoleFunctorFlags::Null, "Default UDP socket receive buffer size");
     AZ_CVAR(bool, net_UdpIgnoreWin10054, true, nullptr, AZ::ConsoleFunctorFlags::Null, "If true, will ignore 10054 socket errors on windows");
+#if AZ_TRAIT_USE_SOCKET_BATCHED_IO
+    AZ_CVAR(bool, net_UdpBatchedIo, false, nullptr, AZ::ConsoleFunctorFlags::DontReplicate,
+        "If true, UDP sockets opened afterwards read with recvmmsg and queue outgoing packets to send them with sendmmsg once per network interface update");
+    AZ_CVAR(bool, net_UdpSegmentationOffload, true, nullptr, AZ::ConsoleFunctorFlags::DontReplicate,
+        "If true, batched UDP sends coalesce consecutive same sized packets to the same address using UDP generic segmentation offload where the kernel supports it");
+
+    // Largest payload a single UDP datagram can carry, which bounds the size of a segmented send
+    static constexpr uint32_t MaxSegmentedSendSize = 65507;
+    // Kernel limit on the number of segments in a single segmented send (UDP_MAX_SEGMENTS)
+    static constexpr uint32_t MaxSegmentsPerSend = 64;
+#endif
 
     UdpSocket::~UdpSocket()
     {
@@ -68,6 +89,20 @@ namespace AzNetworking
             }
         }
 
+#if AZ_TRAIT_USE_SOCKET_REUSEPORT
+        if (m_reusePort)
+        {
+            const int32_t enable = 1;
+            if (::setsockopt(static_cast<int32_t>(m_socketFd), SOL_SOCKET, SO_REUSEPORT, &enable, sizeof(enable)) != 0)
+            {
+                const int32_t error = GetLastNetworkError();
+                AZLOG_WARN("Failed to enable port reuse on UDP socket (%d:%s)", error, GetNetworkErrorDesc(error));
+                Close();
+                return false;
+            }
+        }
+#endif
+
         // Handle binding
         {
             sockaddr_in hints;
@@ -91,13 +126,38 @@ namespace AzNetworking
             return false;
         }
 
+#if AZ_TRAIT_USE_SOCKET_BATCHED_IO
+        m_batchedIo = net_UdpBatchedIo;
+        m_useSegmentationOffload = false;
+        if (m_batchedIo)
+        {
+            m_sendQueue.reserve(MaxQueuedSendCount);
+            m_sendQueueData.reserve(MaxQueuedSendCount * MaxUdpTransmissionUnit);
+
+            if (net_UdpSegmentationOffload)
+            {
+                // Kernels without UDP generic segmentation offload reject the option
+                int32_t segmentSize = 0;
+                socklen_t optionLength = sizeof(segmentSize);
+                m_useSegmentationOffload = (::getsockopt(static_cast<int32_t>(m_socketFd), SOL_UDP, UDP_SEGMENT, &segmentSize, &optionLength) == 0);
+            }
+        }
+#endif
+
         return true;
     }
 
     void UdpSocket::Close()
     {
+        if (IsOpen())
+        {
+            // Don't drop packets queued before the socket was closed, such as disconnect notifications
+            FlushSendQueue();
+        }
+
         CloseSocket(m_socketFd);
         m_socketFd = InvalidSocketFd;
+        m_batchedIo = false;
     }
 
     int32_t UdpSocket::Send
@@ -223,8 +283,122 @@ namespace AzNetworking
         return receivedBytes;
     }
 
+    uint32_t UdpSocket::ReceiveBatch(ReceiveEntry* entries, uint32_t entryCount) const
+    {
+        AZ_Assert(entries != nullptr || entryCount == 0, "NULL entries pointer passed to receive");
+
+        if (!IsOpen())
+        {
+            return 0;
+        }
+
+#if AZ_TRAIT_USE_SOCKET_BATCHED_IO
+        if (m_batchedIo)
+        {
+            entryCount = AZStd::min(entryCount, MaxBatchedPacketCount);
+            if (entryCount == 0)
+            {
+                return 0;
+            }
+
+            mmsghdr messages[MaxBatchedPacketCount];
+            iovec iovecs[MaxBatchedPacketCount];
+            sockaddr_in from[MaxBatchedPacketCount];
+            memset(messages, 0, sizeof(mmsghdr) * entryCount);
+            for (uint32_t i = 0; i < entryCount; ++i)
+            {
+                AZ_Assert(entries[i].m_buffer != nullptr && entries[i].m_bufferSize > 0, "Invalid receive buffer");
+                iovecs[i].iov_base = entries[i].m_buffer;
+                iovecs[i].iov_len = entries[i].m_bufferSize;
+                messages[i].msg_hdr.msg_iov = &iovecs[i];
+                messages[i].msg_hdr.msg_iovlen = 1;
+                messages[i].msg_hdr.msg_name = &from[i];
+                messages[i].msg_hdr.msg_namelen = sizeof(from[i]);
+            }
+
+            const int32_t receivedCount = ::recvmmsg(static_cast<int32_t>(m_socketFd), messages, entryCount, 0, nullptr);
+            if (receivedCount < 0)
+            {
+                const int32_t error = GetLastNetworkError();
+
+                bool ignoreForciblyClosedError = false;
+                if (!ErrorIsWouldBlock(error) && !ErrorIsForciblyClosed(error, ignoreForciblyClosedError))
+                {
+                    AZLOG_WARN("Failed to read from socket (%d:%s)", error, GetNetworkErrorDesc(error));
+                }
+                return 0;
+            }
+
+            ++m_recvBatches;
+
+            // Empty datagrams carry nothing to process, drop them the same way Receive does
+            uint32_t filledCount = 0;
+            for (int32_t i = 0; i < receivedCount; ++i)
+            {
+                const int32_t receivedBytes = static_cast<int32_t>(messages[i].msg_len);
+                if (receivedBytes <= 0)
+                {
+                    continue;
+                }
+
+                ReceiveEntry& entry = entries[filledCount++];
+                if (entry.m_buffer != entries[i].m_buffer)
+                {
+                    memcpy(entry.m_buffer, entries[i].m_buffer, receivedBytes);
+                }
+                entry.m_address = IpAddress(ByteOrder::Network, from[i].sin_addr.s_addr, from[i].sin_port);
+                entry.m_receivedBytes = receivedBytes;
+
+                m_recvPackets++;
+                m_recvBytes += receivedBytes;
+            }
+            return filledCount;
+        }
+#endif
+
+        for (uint32_t i = 0; i < entryCount; ++i)
+        {
+            ReceiveEntry& entry = entries[i];
+            entry.m_receivedBytes = Receive(entry.m_address, entry.m_buffer, entry.m_bufferSize);
+            if (entry.m_receivedBytes <= 0)
+            {
+                return i;
+            }
+        }
+        return entryCount;
+    }
+
+    void UdpSocket::FlushSendQueue() const
+    {
+        if (!m_batchedIo)
+        {
+            return;
+        }
+
+        AZStd::scoped_lock<AZStd::mutex> lock(m_sendQueueMutex);
+        FlushSendQueueLocked();
+    }
+
     int32_t UdpSocket::SendInternal(const IpAddress& address, const uint8_t* data, uint32_t size,
         [[maybe_unused]] bool encrypt, [[maybe_unused]] DtlsEndpoint& dtlsEndpoint) const
+    {
+        if (m_batchedIo)
+        {
+            AZStd::scoped_lock<AZStd::mutex> lock(m_sendQueueMutex);
+            const uint32_t offset = aznumeric_cast<uint32_t>(m_sendQueueData.size());
+            m_sendQueueData.insert(m_sendQueueData.end(), data, data + size);
+            m_sendQueue.push_back(QueuedSend{ address, offset, size });
+            if (m_sendQueue.size() >= MaxQueuedSendCount)
+            {
+                FlushSendQueueLocked();
+            }
+            return static_cast<int32_t>(size);
+        }
+
+        return SendTo(address, data, size);
+    }
+
+    int32_t UdpSocket::SendTo(const IpAddress& address, const uint8_t* data, uint32_t size) const
     {
         sockaddr_in destAddr;
         memset(&destAddr, 0, sizeof(destAddr));
@@ -234,6 +408,139 @@ namespace AzNetworking
         return static_cast<int32_t>(sendto(static_cast<int32_t>(m_socketFd), reinterpret_cast<const char*>(data), size, 0, (sockaddr*)&destAddr, sizeof(destAddr)));
     }
 
+    void UdpSocket::FlushSendQueueLocked() const
+    {
+        if (m_sendQueue.empty())
+        {
+            return;
+        }
+
+#if AZ_TRAIT_USE_SOCKET_BATCHED_IO
+        mmsghdr messages[MaxBatchedPacketCount];
+        iovec iovecs[MaxBatchedPacketCount];
+        sockaddr_in destAddrs[MaxBatchedPacketCount];
+        alignas(cmsghdr) char controlBuffers[MaxBatchedPacketCount][CMSG_SPACE(sizeof(uint16_t))];
+
+        const uint32_t queueSize = aznumeric_cast<uint32_t>(m_sendQueue.size());
+        for (uint32_t batchStart = 0; batchStart < queueSize; batchStart += MaxBatchedPacketCount)
+        {
+            const uint32_t batchEnd = AZStd::min(batchStart + MaxBatchedPacketCount, queueSize);
+
+            // With segmentation offload, consecutive payloads to the same address are coalesced into a single message that the kernel
+            // splits back into datagrams, which requires every segment but the last to be exactly the segment size
+            uint32_t messageCount = 0;
+            uint32_t segmentSize = 0;
+            uint32_t messageSize = 0;
+            for (uint32_t queueIndex = batchStart; queueIndex < batchEnd; ++queueIndex)
+            {
+                const QueuedSend& queued = m_sendQueue[queueIndex];
+                iovec& payload = iovecs[queueIndex - batchStart];
+                payload.iov_base = m_sendQueueData.data() + queued.m_offset;
+                payload.iov_len = queued.m_size;
+
+                if (m_useSegmentationOffload && (messageCount > 0))
+                {
+                    const QueuedSend& previous = m_sendQueue[queueIndex - 1];
+                    msghdr& header = messages[messageCount - 1].msg_hdr;
+                    if ((previous.m_address == queued.m_address)
+                     && (previous.m_size == segmentSize)
+                     && (queued.m_size <= segmentSize)
+                     && (header.msg_iovlen < MaxSegmentsPerSend)
+                     && (messageSize + queued.m_size <= MaxSegmentedSendSize))
+                    {
+                        ++header.msg_iovlen;
+                        messageSize += queued.m_size;
+                        continue;
+                    }
+                }
+
+                sockaddr_in& destAddr = destAddrs[messageCount];
+                memset(&destAddr, 0, sizeof(destAddr));
+                destAddr.sin_family = AF_INET;
+                destAddr.sin_addr.s_addr = queued.m_address.GetAddress(ByteOrder::Network);
+                destAddr.sin_port = queued.m_address.GetPort(ByteOrder::Network);
+
+                mmsghdr& message = messages[messageCount++];
+                memset(&message, 0, sizeof(message));
+                message.msg_hdr.msg_name = &destAddr;
+                message.msg_hdr.msg_namelen = sizeof(destAddr);
+                message.msg_hdr.msg_iov = &payload;
+                message.msg_hdr.msg_iovlen = 1;
+                segmentSize = queued.m_size;
+                messageSize = queued.m_size;
+            }
+
+            for (uint32_t messageIndex = 0; messageIndex < messageCount; ++messageIndex)
+            {
+                msghdr& header = messages[messageIndex].msg_hdr;
+                if (header.msg_iovlen > 1)
+                {
+                    header.msg_control = controlBuffers[messageIndex];
+                    header.msg_controllen = sizeof(controlBuffers[messageIndex]);
+                    cmsghdr* segmentOption = CMSG_FIRSTHDR(&header);
+                    segmentOption->cmsg_level = SOL_UDP;
+                    segmentOption->cmsg_type = UDP_SEGMENT;
+                    segmentOption->cmsg_len = CMSG_LEN(sizeof(uint16_t));
+                    const uint16_t messageSegmentSize = aznumeric_cast<uint16_t>(header.msg_iov[0].iov_len);
+                    memcpy(CMSG_DATA(segmentOption), &messageSegmentSize, sizeof(messageSegmentSize));
+                }
+            }
+
+            uint32_t messageIndex = 0;
+            while (messageIndex < messageCount)
+            {
+                const int32_t sentCount = ::sendmmsg(static_cast<int32_t>(m_socketFd), messages + messageIndex, messageCount - messageIndex, 0);
+                if (sentCount > 0)
+                {
+                    ++m_sentBatches;
+                    messageIndex += sentCount;
+                    continue;
+                }
+
+                const int32_t error = GetLastNetworkError();
+                if (ErrorIsWouldBlock(error))
+                {
+                    // Same as an unbatched send, anything that doesn't fit in the socket buffer is dropped and left to reliability
+                    break;
+                }
+
+                msghdr& header = messages[messageIndex].msg_hdr;
+                if ((error == EIO) && (header.msg_iovlen > 1))
+                {
+                    // The network device can't checksum segmented sends, send this message one datagram at a time from now on
+                    AZLOG_WARN("UDP segmentation offload is not supported by the network device, disabling it");
+                    m_useSegmentationOffload = false;
+                    for (size_t segmentIndex = 0; segmentIndex < header.msg_iovlen; ++segmentIndex)
+                    {
+                        const iovec& segment = header.msg_iov[segmentIndex];
+                        ::sendto(static_cast<int32_t>(m_socketFd), segment.iov_base, segment.iov_len, 0, (sockaddr*)header.msg_name, header.msg_namelen);
+                    }
+                }
+                else
+                {
+                    AZLOG_WARN("Failed to write to socket (%d:%s)", error, GetNetworkErrorDesc(error));
+                }
+                ++messageIndex;
+            }
+        }
+#else
+        for (const QueuedSend& queued : m_sendQueue)
+        {
+            if (SendTo(queued.m_address, m_sendQueueData.data() + queued.m_offset, queued.m_size) < 0)
+            {
+                const int32_t error = GetLastNetworkError();
+                if (!ErrorIsWouldBlock(error))
+                {
+                    AZLOG_WARN("Failed to write to socket (%d:%s)", error, GetNetworkErrorDesc(error));
+                }
+            }
+        }
+#endif
+
+        m_sendQueue.clear();
+        m_sendQueueData.clear();
+    }
+
 #ifdef ENABLE_LATENCY_DEBUG
     int32_t UdpSocket::SendInternalDeferred(const DeferredData& data) const
     {
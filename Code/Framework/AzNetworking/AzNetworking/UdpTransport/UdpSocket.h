@@ -14,6 +14,8 @@
 #include <AzNetworking/UdpTransport/DtlsEndpoint.h>
 #include <AzCore/Math/Random.h>
 #include <AzCore/std/containers/fixed_vector.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/mutex.h>
 
 #ifndef _RELEASE
 #   define ENABLE_LATENCY_DEBUG 1
@@ -42,6 +44,21 @@ namespace AzNetworking
             True   // Socket can accept incoming connections and may require a valid certificate and private key file
         };
 
+        //! Maximum number of datagrams moved by a single batched send or receive call.
+        static constexpr uint32_t MaxBatchedPacketCount = 64;
+
+        //! Maximum number of outgoing datagrams held in the send queue before it is flushed.
+        static constexpr uint32_t MaxQueuedSendCount = 256;
+
+        //! A single datagram slot for ReceiveBatch.
+        struct ReceiveEntry
+        {
+            IpAddress m_address;
+            uint8_t* m_buffer = nullptr;
+            uint32_t m_bufferSize = 0;
+            int32_t m_receivedBytes = 0;
+        };
+
         UdpSocket() = default;
         virtual ~UdpSocket();
 
@@ -62,6 +79,12 @@ namespace AzNetworking
         //! @return a connect result specifying whether the connection is still pending, failed, or complete
         virtual DtlsEndpoint::ConnectResult AcceptDtlsEndpoint(DtlsEndpoint& dtlsEndpoint, const IpAddress& address) const;
 
+        //! Allows other sockets to bind the same port, this must be set on every socket sharing the port before it is opened.
+        //! The kernel distributes incoming datagrams between the sockets sharing a port by hashing the source address, so all the
+        //! datagrams from one remote endpoint arrive on the same socket. Only has an effect where AZ_TRAIT_USE_SOCKET_REUSEPORT is set.
+        //! @param reusePort if true, the socket will be opened with SO_REUSEPORT
+        void SetReusePort(bool reusePort);
+
         //! Opens the UDP socket on the given port.
         //! @param port      the port number to open the UDP socket on, 0 will bind to any available port
         //! @param canAccept if true, the socket will be opened in a way that allows accepting incoming connections
@@ -93,6 +116,19 @@ namespace AzNetworking
         //! @return number of bytes received, <= 0 on error
         int32_t Receive(IpAddress& outAddress, uint8_t* outData, uint32_t size) const;
 
+        //! Receives as many payloads as are available, up to the number of provided entries, with as few system calls as the platform allows.
+        //! @param entries    the slots to receive into, each entry must provide a buffer and its size
+        //! @param entryCount the number of slots provided
+        //! @return the number of entries that were filled, entries past the returned count are left untouched
+        uint32_t ReceiveBatch(ReceiveEntry* entries, uint32_t entryCount) const;
+
+        //! Returns true if outgoing payloads are queued and sent in batches by FlushSendQueue rather than sent immediately.
+        //! @return boolean true if outgoing payloads are queued
+        bool IsBatchingSends() const;
+
+        //! Sends all queued outgoing payloads, does nothing if sends aren't batched.
+        void FlushSendQueue() const;
+
         //! Returns the underlying socket file descriptor.
         //! @return the underlying socket file descriptor
         SocketFd GetSocketFd() const;
@@ -121,6 +157,14 @@ namespace AzNetworking
         //! @return the total number of bytes received on this socket
         uint32_t GetRecvBytes() const;
 
+        //! Returns the total number of batched system calls used to send packets on this socket.
+        //! @return the total number of batched system calls used to send packets on this socket
+        uint32_t GetSentBatches() const;
+
+        //! Returns the total number of batched system calls used to receive packets on this socket.
+        //! @return the total number of batched system calls used to receive packets on this socket
+        uint32_t GetRecvBatches() const;
+
     protected:
 
         mutable uint32_t m_sentPacketsEncrypted = 0;
@@ -130,11 +174,35 @@ namespace AzNetworking
 
     private:
 
+        //! Sends a single datagram on the socket, bypassing the send queue.
+        int32_t SendTo(const IpAddress& address, const uint8_t* data, uint32_t size) const;
+
+        //! Sends all queued outgoing payloads, the send queue mutex must be held.
+        void FlushSendQueueLocked() const;
+
         SocketFd m_socketFd = InvalidSocketFd;
         mutable uint32_t m_sentPackets = 0;
         mutable uint32_t m_sentBytes = 0;
         mutable uint32_t m_recvPackets = 0;
         mutable uint32_t m_recvBytes = 0;
+        mutable uint32_t m_sentBatches = 0;
+        mutable uint32_t m_recvBatches = 0;
+
+        bool m_reusePort = false;
+        bool m_batchedIo = false;
+        mutable bool m_useSegmentationOffload = false;
+
+        struct QueuedSend
+        {
+            IpAddress m_address;
+            uint32_t m_offset = 0;
+            uint32_t m_size = 0;
+        };
+
+        // The heartbeat thread can send while the main thread is blocked, so the send queue is guarded
+        mutable AZStd::mutex m_sendQueueMutex;
+        mutable AZStd::vector<QueuedSend> m_sendQueue;
+        mutable AZStd::vector<uint8_t> m_sendQueueData;
 
 #ifdef ENABLE_LATENCY_DEBUG
         struct DeferredData
@@ -10,6 +10,11 @@
 
 namespace AzNetworking
 {
+    inline void UdpSocket::SetReusePort(bool reusePort)
+    {
+        m_reusePort = reusePort;
+    }
+
     inline bool UdpSocket::IsOpen() const
     {
         return (m_socketFd > SocketFd{ 0 });
@@ -49,4 +54,19 @@ namespace AzNetworking
     {
         return m_recvBytes;
     }
+
+    inline uint32_t UdpSocket::GetSentBatches() const
+    {
+        return m_sentBatches;
+    }
+
+    inline uint32_t UdpSocket::GetRecvBatches() const
+    {
+        return m_recvBatches;
+    }
+
+    inline bool UdpSocket::IsBatchingSends() const
+    {
+        return m_batchedIo;
+    }
 }
@@ -0,0 +1,116 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Math/Vector2.h>
+#include <AzCore/Math/Vector3.h>
+#include <AzCore/Math/Quaternion.h>
+#include <AzCore/std/containers/array.h>
+#include <AzNetworking/Serialization/ISerializer.h>
+#include <AzNetworking/Utilities/NetworkCommon.h>
+
+namespace AzNetworking
+{
+    //! Returns the largest integer a quantized value with the provided number of bits can hold.
+    //! @param bitCount the number of bits of the quantized value, in the range [1, 32]
+    //! @return the largest quantized integer
+    constexpr uint32_t GetMaxQuantizedValue(uint32_t bitCount);
+
+    //! Returns the smallest number of bits that quantizes a range with steps no larger than the requested precision.
+    //! @param minValue  the smallest value of the range
+    //! @param maxValue  the largest value of the range
+    //! @param precision the largest step allowed between two quantized values
+    //! @return the number of bits required, at most 32
+    constexpr uint32_t GetRequiredQuantizationBits(float minValue, float maxValue, float precision);
+
+    //! Returns the largest error a value inside the range can pick up when quantized, which is half of a step.
+    //! @param minValue the smallest value of the range
+    //! @param maxValue the largest value of the range
+    //! @param bitCount the number of bits of the quantized value
+    //! @return the largest absolute error of a quantized value
+    float GetQuantizationErrorBound(float minValue, float maxValue, uint32_t bitCount);
+
+    //! Quantizes a value to a fixed point integer within a range, values outside of the range are clamped.
+    //! @param value    the value to quantize
+    //! @param minValue the smallest value of the range
+    //! @param maxValue the largest value of the range
+    //! @param bitCount the number of bits of the quantized value
+    //! @return the quantized integer
+    uint32_t QuantizeFloat(float value, float minValue, float maxValue, uint32_t bitCount);
+
+    //! Converts a fixed point integer produced by QuantizeFloat back into a value within the range.
+    //! @param quantized the quantized integer
+    //! @param minValue  the smallest value of the range
+    //! @param maxValue  the largest value of the range
+    //! @param bitCount  the number of bits of the quantized value
+    //! @return the dequantized value
+    float DequantizeFloat(uint32_t quantized, float minValue, float maxValue, uint32_t bitCount);
+
+    //! Returns the largest error of each of the three components sent by the smallest-three quaternion encoding.
+    //! @param bitCount the number of bits used for each of the three components
+    //! @return the largest absolute error of a sent component
+    float GetSmallestThreeErrorBound(uint32_t bitCount);
+
+    //! A fixed size buffer of values with arbitrary bit widths, serialized as the smallest number of whole bytes.
+    //! Unlike QuantizedValues, which sends every element with a whole number of bytes, several values share bytes.
+    template <uint32_t BIT_COUNT>
+    class PackedBits
+    {
+    public:
+        static_assert(BIT_COUNT > 0, "PackedBits must hold at least one bit");
+        static constexpr uint32_t ByteCount = (BIT_COUNT + 7) / 8;
+
+        //! Appends a value at the write cursor.
+        //! @param value    the value to append, only the lowest bitCount bits are stored
+        //! @param bitCount the number of bits to store, in the range [1, 32]
+        void Write(uint32_t value, uint32_t bitCount);
+
+        //! Reads the next value at the read cursor.
+        //! @param bitCount the number of bits to read, in the range [1, 32]
+        //! @return the value that was read
+        uint32_t Read(uint32_t bitCount);
+
+        //! Returns the packed bytes.
+        //! @return the packed bytes
+        const AZStd::array<uint8_t, ByteCount>& GetBytes() const;
+
+        //! Base serialize method for all serializable structures or classes to implement.
+        //! @param serializer ISerializer instance to use for serialization
+        //! @return boolean true for success, false for serialization failure
+        bool Serialize(ISerializer& serializer);
+
+    private:
+        AZStd::array<uint8_t, ByteCount> m_bytes = {};
+        uint32_t m_writeCursor = 0;
+        uint32_t m_readCursor = 0;
+    };
+
+    //! Serializes each component of a float, AZ::Vector2 or AZ::Vector3 as a BITS wide fixed point value within a range.
+    //! Reading replaces the value with the dequantized result, values outside of the range are clamped when written.
+    //! @param serializer ISerializer instance to use for serialization
+    //! @param value      the value to serialize
+    //! @param minValue   the smallest value of the range, for every component
+    //! @param maxValue   the largest value of the range, for every component
+    //! @param name       the name of the value
+    //! @return boolean true for success, false for serialization failure
+    template <uint32_t BITS, typename TYPE>
+    bool SerializeQuantizedRange(ISerializer& serializer, TYPE& value, float minValue, float maxValue, const char* name);
+
+    //! Serializes a unit quaternion with smallest-three encoding.
+    //! The largest component is dropped and rebuilt from the other three, which are sent as BITS wide fixed point values
+    //! along with a 2 bit index of the dropped component.
+    //! @param serializer ISerializer instance to use for serialization
+    //! @param value      the quaternion to serialize, expected to be normalized
+    //! @param name       the name of the value
+    //! @return boolean true for success, false for serialization failure
+    template <uint32_t BITS>
+    bool SerializeSmallestThree(ISerializer& serializer, AZ::Quaternion& value, const char* name);
+}
+
+#include <AzNetworking/Utilities/QuantizedBits.inl>
@@ -0,0 +1,235 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/math.h>
+
+namespace AzNetworking
+{
+    //! Every component but the largest of a unit quaternion lies within [-1/sqrt(2), 1/sqrt(2)].
+    static constexpr float SmallestThreeComponentRange = 0.70710678f;
+    static constexpr uint32_t SmallestThreeIndexBits = 2;
+
+    template <typename TYPE>
+    struct QuantizedRangeHelper;
+
+    template <>
+    struct QuantizedRangeHelper<float>
+    {
+        static constexpr uint32_t ComponentCount = 1;
+        static float GetElement(const float& value, [[maybe_unused]] int32_t index) { return value; }
+        static void SetElement(float& value, [[maybe_unused]] int32_t index, float element) { value = element; }
+    };
+
+    template <>
+    struct QuantizedRangeHelper<AZ::Vector2>
+    {
+        static constexpr uint32_t ComponentCount = 2;
+        static float GetElement(const AZ::Vector2& value, int32_t index) { return value.GetElement(index); }
+        static void SetElement(AZ::Vector2& value, int32_t index, float element) { value.SetElement(index, element); }
+    };
+
+    template <>
+    struct QuantizedRangeHelper<AZ::Vector3>
+    {
+        static constexpr uint32_t ComponentCount = 3;
+        static float GetElement(const AZ::Vector3& value, int32_t index) { return value.GetElement(index); }
+        static void SetElement(AZ::Vector3& value, int32_t index, float element) { value.SetElement(index, element); }
+    };
+
+    inline constexpr uint32_t GetMaxQuantizedValue(uint32_t bitCount)
+    {
+        return (bitCount >= 32) ? 0xFFFFFFFF : ((1u << bitCount) - 1);
+    }
+
+    inline constexpr uint32_t GetRequiredQuantizationBits(float minValue, float maxValue, float precision)
+    {
+        const double range = static_cast<double>(maxValue) - static_cast<double>(minValue);
+        if (range <= 0.0)
+        {
+            return 1;
+        }
+
+        for (uint32_t bitCount = 1; bitCount < 32; ++bitCount)
+        {
+            if (range / static_cast<double>(GetMaxQuantizedValue(bitCount)) <= static_cast<double>(precision))
+            {
+                return bitCount;
+            }
+        }
+        return 32;
+    }
+
+    inline float GetQuantizationErrorBound(float minValue, float maxValue, uint32_t bitCount)
+    {
+        const double range = static_cast<double>(maxValue) - static_cast<double>(minValue);
+        return static_cast<float>(0.5 * range / static_cast<double>(GetMaxQuantizedValue(bitCount)));
+    }
+
+    inline uint32_t QuantizeFloat(float value, float minValue, float maxValue, uint32_t bitCount)
+    {
+        const double range = static_cast<double>(maxValue) - static_cast<double>(minValue);
+        if (range <= 0.0)
+        {
+            return 0;
+        }
+
+        // Written so that NaN clamps to the bottom of the range
+        const double normalized = (static_cast<double>(value) - static_cast<double>(minValue)) / range;
+        const double clamped = (normalized > 0.0) ? AZStd::min(normalized, 1.0) : 0.0;
+        return static_cast<uint32_t>(clamped * static_cast<double>(GetMaxQuantizedValue(bitCount)) + 0.5);
+    }
+
+    inline float DequantizeFloat(uint32_t quantized, float minValue, float maxValue, uint32_t bitCount)
+    {
+        const double range = static_cast<double>(maxValue) - static_cast<double>(minValue);
+        const double normalized = static_cast<double>(AZStd::min(quantized, GetMaxQuantizedValue(bitCount))) / static_cast<double>(GetMaxQuantizedValue(bitCount));
+        return static_cast<float>(static_cast<double>(minValue) + normalized * range);
+    }
+
+    inline float GetSmallestThreeErrorBound(uint32_t bitCount)
+    {
+        return GetQuantizationErrorBound(-SmallestThreeComponentRange, SmallestThreeComponentRange, bitCount);
+    }
+
+    template <uint32_t BIT_COUNT>
+    inline void PackedBits<BIT_COUNT>::Write(uint32_t value, uint32_t bitCount)
+    {
+        AZ_Assert((bitCount > 0) && (bitCount <= 32), "Invalid bit count %u", bitCount);
+        AZ_Assert(m_writeCursor + bitCount <= BIT_COUNT, "Writing %u bits would overflow the packed bits", bitCount);
+
+        uint32_t remainingBits = bitCount;
+        uint64_t bits = static_cast<uint64_t>(value) & GetMaxQuantizedValue(bitCount);
+        while (remainingBits > 0)
+        {
+            const uint32_t bitOffset = m_writeCursor % 8;
+            const uint32_t chunkBits = AZStd::min(8 - bitOffset, remainingBits);
+            m_bytes[m_writeCursor / 8] |= static_cast<uint8_t>((bits & GetMaxQuantizedValue(chunkBits)) << bitOffset);
+            bits >>= chunkBits;
+            m_writeCursor += chunkBits;
+            remainingBits -= chunkBits;
+        }
+    }
+
+    template <uint32_t BIT_COUNT>
+    inline uint32_t PackedBits<BIT_COUNT>::Read(uint32_t bitCount)
+    {
+        AZ_Assert((bitCount > 0) && (bitCount <= 32), "Invalid bit count %u", bitCount);
+        AZ_Assert(m_readCursor + bitCount <= BIT_COUNT, "Reading %u bits would overflow the packed bits", bitCount);
+
+        uint64_t value = 0;
+        uint32_t readBits = 0;
+        while (readBits < bitCount)
+        {
+            const uint32_t bitOffset = m_readCursor % 8;
+            const uint32_t chunkBits = AZStd::min(8 - bitOffset, bitCount - readBits);
+            const uint64_t chunk = (m_bytes[m_readCursor / 8] >> bitOffset) & GetMaxQuantizedValue(chunkBits);
+            value |= chunk << readBits;
+            m_readCursor += chunkBits;
+            readBits += chunkBits;
+        }
+        return static_cast<uint32_t>(value);
+    }
+
+    template <uint32_t BIT_COUNT>
+    inline const AZStd::array<uint8_t, PackedBits<BIT_COUNT>::ByteCount>& PackedBits<BIT_COUNT>::GetBytes() const
+    {
+        return m_bytes;
+    }
+
+    template <uint32_t BIT_COUNT>
+    inline bool PackedBits<BIT_COUNT>::Serialize(ISerializer& serializer)
+    {
+        for (uint32_t i = 0; i < ByteCount; ++i)
+        {
+            serializer.Serialize(m_bytes[i], GenerateIndexLabel<ByteCount>(i).c_str());
+        }
+        return serializer.IsValid();
+    }
+
+    template <uint32_t BITS, typename TYPE>
+    inline bool SerializeQuantizedRange(ISerializer& serializer, TYPE& value, float minValue, float maxValue, const char* name)
+    {
+        static_assert((BITS > 0) && (BITS <= 32), "Quantized components must use between 1 and 32 bits");
+        using Helper = QuantizedRangeHelper<TYPE>;
+
+        PackedBits<BITS * Helper::ComponentCount> packedBits;
+        for (int32_t i = 0; i < static_cast<int32_t>(Helper::ComponentCount); ++i)
+        {
+            packedBits.Write(QuantizeFloat(Helper::GetElement(value, i), minValue, maxValue, BITS), BITS);
+        }
+
+        if (!serializer.Serialize(packedBits, name))
+        {
+            return false;
+        }
+
+        if (serializer.GetSerializerMode() == SerializerMode::WriteToObject)
+        {
+            for (int32_t i = 0; i < static_cast<int32_t>(Helper::ComponentCount); ++i)
+            {
+                Helper::SetElement(value, i, DequantizeFloat(packedBits.Read(BITS), minValue, maxValue, BITS));
+            }
+        }
+        return serializer.IsValid();
+    }
+
+    template <uint32_t BITS>
+    inline bool SerializeSmallestThree(ISerializer& serializer, AZ::Quaternion& value, const char* name)
+    {
+        static_assert((BITS > 0) && (BITS <= 32), "Quantized components must use between 1 and 32 bits");
+
+        const float lengthSq = value.GetLengthSq();
+        const AZ::Quaternion normalized = (lengthSq > 0.0f) ? value / AZStd::sqrt(lengthSq) : AZ::Quaternion::CreateIdentity();
+
+        int32_t largestIndex = 0;
+        for (int32_t i = 1; i < 4; ++i)
+        {
+            if (AZStd::abs(normalized.GetElement(i)) > AZStd::abs(normalized.GetElement(largestIndex)))
+            {
+                largestIndex = i;
+            }
+        }
+
+        // q and -q are the same rotation, flip so the dropped component is positive and can be rebuilt with a square root
+        const float sign = (normalized.GetElement(largestIndex) < 0.0f) ? -1.0f : 1.0f;
+        PackedBits<SmallestThreeIndexBits + BITS * 3> packedBits;
+        packedBits.Write(static_cast<uint32_t>(largestIndex), SmallestThreeIndexBits);
+        for (int32_t i = 0; i < 4; ++i)
+        {
+            if (i != largestIndex)
+            {
+                packedBits.Write(QuantizeFloat(sign * normalized.GetElement(i), -SmallestThreeComponentRange, SmallestThreeComponentRange, BITS), BITS);
+            }
+        }
+
+        if (!serializer.Serialize(packedBits, name))
+        {
+            return false;
+        }
+
+        if (serializer.GetSerializerMode() == SerializerMode::WriteToObject)
+        {
+            const int32_t droppedIndex = static_cast<int32_t>(packedBits.Read(SmallestThreeIndexBits));
+            float sumSq = 0.0f;
+            for (int32_t i = 0; i < 4; ++i)
+            {
+                if (i != droppedIndex)
+                {
+                    const float element = DequantizeFloat(packedBits.Read(BITS), -SmallestThreeComponentRange, SmallestThreeComponentRange, BITS);
+                    value.SetElement(i, element);
+                    sumSq += element * element;
+                }
+            }
+            value.SetElement(droppedIndex, AZStd::sqrt(AZStd::max(0.0f, 1.0f - sumSq)));
+        }
+        return serializer.IsValid();
+    }
+}
@@ -11,4 +11,24 @@
 
 namespace UnitTest
 {
+    TEST(FixedSizeVectorBitset, TestEquality)
+    {
+        AzNetworking::FixedSizeVectorBitset<128> lhs;
+        AzNetworking::FixedSizeVectorBitset<128> rhs;
+        lhs.Resize(20);
+        rhs.Resize(20);
+        EXPECT_TRUE(lhs == rhs);
+
+        lhs.SetBit(3, true);
+        lhs.SetBit(17, true);
+        EXPECT_TRUE(lhs != rhs);
+
+        rhs.SetBit(3, true);
+        rhs.SetBit(17, true);
+        EXPECT_TRUE(lhs == rhs);
+
+        // Same bits set, but a different number of valid bits
+        rhs.Resize(24);
+        EXPECT_FALSE(lhs == rhs);
+    }
 }
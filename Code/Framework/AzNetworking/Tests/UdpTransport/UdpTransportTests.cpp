@@ -6,17 +6,21 @@
  *
  */
 
+#include <AzNetworking/UdpTransport/UdpConnection.h>
 #include <AzNetworking/UdpTransport/UdpNetworkInterface.h>
+#include <AzNetworking/UdpTransport/UdpSocket.h>
 #include <AzNetworking/UdpTransport/UdpPacketTracker.h>
 #include <AzNetworking/UdpTransport/UdpPacketIdWindow.h>
 #include <AzNetworking/ConnectionLayer/IConnectionListener.h>
 #include <AzNetworking/Framework/NetworkingSystemComponent.h>
 #include <AzNetworking/AutoGen/CorePackets.AutoPackets.h>
 #include <AzCore/Interface/Interface.h>
+#include <AzCore/Console/Console.h>
 #include <AzCore/Console/LoggerSystemComponent.h>
 #include <AzCore/Time/TimeSystem.h>
 #include <AzCore/Name/NameDictionary.h>
 #include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/std/containers/set.h>
 
 namespace UnitTest
 {
@@ -320,4 +324,125 @@ namespace UnitTest
             EXPECT_EQ(testClient[i].m_clientNetworkInterface->GetConnectionSet().GetConnectionCount(), 1);
         }
     }
+
+    TEST_F(UdpTransportTests, TestBatchedSendAndReceive)
+    {
+        // Batched I/O is only available on some platforms, elsewhere this exercises the unbatched fallback
+        AZ::Console console;
+        console.LinkDeferredFunctors(AZ::ConsoleFunctorBase::GetDeferredHead());
+        console.PerformCommand("net_UdpBatchedIo true");
+
+        constexpr uint16_t ReceiverPort = 12346;
+        UdpSocket receiver;
+        UdpSocket sender;
+        EXPECT_TRUE(receiver.Open(ReceiverPort, UdpSocket::CanAcceptConnections::True, TrustZone::ExternalClientToServer));
+        EXPECT_TRUE(sender.Open(0, UdpSocket::CanAcceptConnections::False, TrustZone::ExternalClientToServer));
+
+        // Runs of equal sized packets followed by a shorter one, so segmentation offload can coalesce them where it's supported
+        constexpr uint32_t NumTestPackets = 9;
+        constexpr uint32_t PacketSizes[NumTestPackets] = { 100, 100, 100, 40, 100, 100, 60, 80, 80 };
+
+        const IpAddress receiverAddress(127, 0, 0, 1, ReceiverPort);
+        DtlsEndpoint dtlsEndpoint;
+        uint8_t payload[MaxUdpTransmissionUnit];
+        for (uint32_t i = 0; i < NumTestPackets; ++i)
+        {
+            memset(payload, aznumeric_cast<int>(i + 1), PacketSizes[i]);
+            EXPECT_EQ(sender.Send(receiverAddress, payload, PacketSizes[i], false, dtlsEndpoint, ConnectionQuality()), aznumeric_cast<int32_t>(PacketSizes[i]));
+        }
+        sender.FlushSendQueue();
+
+        uint8_t receiveBuffer[NumTestPackets][MaxUdpTransmissionUnit];
+        UdpSocket::ReceiveEntry entries[NumTestPackets];
+        uint32_t receivedCount = 0;
+        const AZ::TimeMs startTimeMs = AZ::GetElapsedTimeMs();
+        while ((receivedCount < NumTestPackets) && (AZ::GetElapsedTimeMs() - startTimeMs < AZ::TimeMs{ 1000 }))
+        {
+            for (uint32_t i = receivedCount; i < NumTestPackets; ++i)
+            {
+                entries[i].m_buffer = receiveBuffer[i];
+                entries[i].m_bufferSize = MaxUdpTransmissionUnit;
+            }
+            receivedCount += receiver.ReceiveBatch(entries + receivedCount, NumTestPackets - receivedCount);
+        }
+
+        ASSERT_EQ(receivedCount, NumTestPackets);
+        for (uint32_t i = 0; i < NumTestPackets; ++i)
+        {
+            ASSERT_EQ(entries[i].m_receivedBytes, aznumeric_cast<int32_t>(PacketSizes[i]));
+            EXPECT_EQ(entries[i].m_buffer[0], i + 1);
+            EXPECT_EQ(entries[i].m_buffer[PacketSizes[i] - 1], i + 1);
+        }
+        EXPECT_EQ(sender.GetSentPackets(), NumTestPackets);
+        EXPECT_EQ(receiver.GetRecvPackets(), NumTestPackets);
+
+        if (sender.IsBatchingSends())
+        {
+            EXPECT_GT(sender.GetSentBatches(), 0u);
+            EXPECT_GT(receiver.GetRecvBatches(), 0u);
+        }
+
+        sender.Close();
+        receiver.Close();
+        console.PerformCommand("net_UdpBatchedIo false");
+    }
+
+    TEST_F(UdpTransportTests, TestShardedMultipleClients)
+    {
+        // Receive sharding needs SO_REUSEPORT, elsewhere the server quietly runs a single shard
+        AZ::Console console;
+        console.LinkDeferredFunctors(AZ::ConsoleFunctorBase::GetDeferredHead());
+        console.PerformCommand("net_UdpReceiveShards 4");
+
+        constexpr uint32_t NumTestClients = 50;
+
+        TestUdpServer testServer;
+        TestUdpClient testClient[NumTestClients];
+
+        constexpr AZ::TimeMs TotalIterationTimeMs = AZ::TimeMs{ 5000 };
+        const AZ::TimeMs startTimeMs = AZ::GetElapsedTimeMs();
+        for (;;)
+        {
+            AZStd::this_thread::sleep_for(AZStd::chrono::milliseconds(25));
+            m_networkingSystemComponent->OnSystemTick();
+            bool timeExpired = (AZ::GetElapsedTimeMs() - startTimeMs > TotalIterationTimeMs);
+            bool canTerminate = testServer.m_serverNetworkInterface->GetConnectionSet().GetConnectionCount() == NumTestClients;
+            for (uint32_t i = 0; i < NumTestClients; ++i)
+            {
+                canTerminate &= testClient[i].m_clientNetworkInterface->GetConnectionSet().GetConnectionCount() == 1;
+            }
+            if (canTerminate || timeExpired)
+            {
+                break;
+            }
+        }
+
+        EXPECT_EQ(testServer.m_serverNetworkInterface->GetConnectionSet().GetConnectionCount(), NumTestClients);
+        for (uint32_t i = 0; i < NumTestClients; ++i)
+        {
+            EXPECT_EQ(testClient[i].m_clientNetworkInterface->GetConnectionSet().GetConnectionCount(), 1);
+        }
+
+        UdpNetworkInterface* serverNetworkInterface = static_cast<UdpNetworkInterface*>(testServer.m_serverNetworkInterface);
+        AZStd::set<uint32_t> usedShards;
+        serverNetworkInterface->GetConnectionSet().VisitConnections([&usedShards](IConnection& connection)
+        {
+            usedShards.insert(static_cast<UdpConnection&>(connection).GetReceiveShardIndex());
+        });
+#if AZ_TRAIT_USE_SOCKET_REUSEPORT
+        // Every shard opened its own socket on the port and the kernel spread the clients across them
+        EXPECT_EQ(serverNetworkInterface->GetReceiveShardCount(), 4u);
+        EXPECT_GT(usedShards.size(), 1u);
+#else
+        EXPECT_EQ(serverNetworkInterface->GetReceiveShardCount(), 1u);
+        EXPECT_EQ(usedShards.size(), 1u);
+#endif
+        for (uint32_t shardIndex : usedShards)
+        {
+            EXPECT_LT(shardIndex, serverNetworkInterface->GetReceiveShardCount());
+        }
+
+        EXPECT_TRUE(testServer.m_serverNetworkInterface->StopListening());
+        console.PerformCommand("net_UdpReceiveShards 1");
+    }
 }
@@ -0,0 +1,200 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzNetworking/Utilities/QuantizedBits.h>
+#include <AzNetworking/Serialization/NetworkInputSerializer.h>
+#include <AzNetworking/Serialization/NetworkOutputSerializer.h>
+#include <AzCore/Math/MathUtils.h>
+#include <AzCore/std/limits.h>
+#include <AzCore/UnitTest/TestTypes.h>
+
+namespace UnitTest
+{
+    // Small tolerance on top of the quantization error bound for float rounding of the dequantized result
+    static constexpr float RoundingTolerance = 1e-5f;
+
+    template <uint32_t BITS, typename TYPE>
+    TYPE RoundTripQuantizedRange(const TYPE& value, float minValue, float maxValue, uint32_t& outSize)
+    {
+        AZStd::array<uint8_t, 64> buffer;
+        AzNetworking::NetworkInputSerializer inputSerializer(buffer.data(), static_cast<uint32_t>(buffer.size()));
+        AzNetworking::NetworkOutputSerializer outputSerializer(buffer.data(), static_cast<uint32_t>(buffer.size()));
+
+        TYPE input = value;
+        EXPECT_TRUE(AzNetworking::SerializeQuantizedRange<BITS>(inputSerializer, input, minValue, maxValue, "Value"));
+        outSize = inputSerializer.GetSize();
+
+        TYPE output = {};
+        EXPECT_TRUE(AzNetworking::SerializeQuantizedRange<BITS>(outputSerializer, output, minValue, maxValue, "Value"));
+        return output;
+    }
+
+    template <uint32_t BITS>
+    AZ::Quaternion RoundTripSmallestThree(const AZ::Quaternion& value, uint32_t& outSize)
+    {
+        AZStd::array<uint8_t, 64> buffer;
+        AzNetworking::NetworkInputSerializer inputSerializer(buffer.data(), static_cast<uint32_t>(buffer.size()));
+        AzNetworking::NetworkOutputSerializer outputSerializer(buffer.data(), static_cast<uint32_t>(buffer.size()));
+
+        AZ::Quaternion input = value;
+        EXPECT_TRUE(AzNetworking::SerializeSmallestThree<BITS>(inputSerializer, input, "Value"));
+        outSize = inputSerializer.GetSize();
+
+        AZ::Quaternion output = AZ::Quaternion::CreateZero();
+        EXPECT_TRUE(AzNetworking::SerializeSmallestThree<BITS>(outputSerializer, output, "Value"));
+        return output;
+    }
+
+    template <uint32_t BITS>
+    void TestFloatErrorBound(float minValue, float maxValue)
+    {
+        const float errorBound = AzNetworking::GetQuantizationErrorBound(minValue, maxValue, BITS);
+        constexpr uint32_t SampleCount = 1000;
+        for (uint32_t i = 0; i <= SampleCount; ++i)
+        {
+            const float value = minValue + (maxValue - minValue) * static_cast<float>(i) / static_cast<float>(SampleCount);
+            uint32_t size = 0;
+            const float result = RoundTripQuantizedRange<BITS>(value, minValue, maxValue, size);
+            EXPECT_EQ(size, (BITS + 7) / 8);
+            EXPECT_LE(AZStd::abs(result - value), errorBound + RoundingTolerance * AZStd::max(AZStd::abs(minValue), AZStd::abs(maxValue)));
+        }
+    }
+
+    template <uint32_t BITS>
+    void TestVector3ErrorBound(float minValue, float maxValue)
+    {
+        const float errorBound = AzNetworking::GetQuantizationErrorBound(minValue, maxValue, BITS) + RoundingTolerance * AZStd::max(AZStd::abs(minValue), AZStd::abs(maxValue));
+        constexpr uint32_t SampleCount = 200;
+        for (uint32_t i = 0; i <= SampleCount; ++i)
+        {
+            const float t = static_cast<float>(i) / static_cast<float>(SampleCount);
+            const AZ::Vector3 value(
+                AZ::Lerp(minValue, maxValue, t),
+                AZ::Lerp(maxValue, minValue, t),
+                AZ::Lerp(minValue, maxValue, AZStd::fmod(t * 7.0f, 1.0f)));
+            uint32_t size = 0;
+            const AZ::Vector3 result = RoundTripQuantizedRange<BITS>(value, minValue, maxValue, size);
+            // All three components share bytes
+            EXPECT_EQ(size, (BITS * 3 + 7) / 8);
+            EXPECT_TRUE(result.IsClose(value, errorBound));
+        }
+    }
+
+    template <uint32_t BITS>
+    void TestSmallestThreeErrorBound()
+    {
+        // Components are rebuilt from the three sent ones, the rebuilt one can pick up roughly three times their error
+        const float errorBound = 4.0f * AzNetworking::GetSmallestThreeErrorBound(BITS) + RoundingTolerance;
+        for (float angle = -AZ::Constants::TwoPi; angle <= AZ::Constants::TwoPi; angle += 0.37f)
+        {
+            for (const AZ::Vector3& axis : { AZ::Vector3::CreateAxisX(), AZ::Vector3(1.0f, 2.0f, -3.0f).GetNormalized(), AZ::Vector3(-0.3f, 0.1f, 0.9f).GetNormalized() })
+            {
+                const AZ::Quaternion value = AZ::Quaternion::CreateFromAxisAngle(axis, angle);
+                uint32_t size = 0;
+                const AZ::Quaternion result = RoundTripSmallestThree<BITS>(value, size);
+                EXPECT_EQ(size, (2 + BITS * 3 + 7) / 8);
+                EXPECT_NEAR(result.GetLength(), 1.0f, errorBound);
+
+                // q and -q are the same rotation, the encoding is free to pick either
+                const AZ::Quaternion aligned = (result.Dot(value) < 0.0f) ? -result : result;
+                EXPECT_TRUE(aligned.IsClose(value, errorBound));
+            }
+        }
+    }
+
+    TEST(QuantizedBitsTests, TestPackedBitsRoundTrip)
+    {
+        AzNetworking::PackedBits<56> packedIn;
+        packedIn.Write(0x5, 3);
+        packedIn.Write(0x1ABC, 13);
+        packedIn.Write(0x1, 1);
+        packedIn.Write(0xDEADBEEF, 32);
+        packedIn.Write(0x7F, 7);
+
+        AZStd::array<uint8_t, 64> buffer;
+        AzNetworking::NetworkInputSerializer inputSerializer(buffer.data(), static_cast<uint32_t>(buffer.size()));
+        AzNetworking::NetworkOutputSerializer outputSerializer(buffer.data(), static_cast<uint32_t>(buffer.size()));
+        EXPECT_TRUE(packedIn.Serialize(inputSerializer));
+        EXPECT_EQ(inputSerializer.GetSize(), 7u);
+
+        AzNetworking::PackedBits<56> packedOut;
+        EXPECT_TRUE(packedOut.Serialize(outputSerializer));
+        EXPECT_EQ(packedOut.Read(3), 0x5u);
+        EXPECT_EQ(packedOut.Read(13), 0x1ABCu);
+        EXPECT_EQ(packedOut.Read(1), 0x1u);
+        EXPECT_EQ(packedOut.Read(32), 0xDEADBEEFu);
+        EXPECT_EQ(packedOut.Read(7), 0x7Fu);
+    }
+
+    TEST(QuantizedBitsTests, TestRequiredQuantizationBits)
+    {
+        EXPECT_EQ(AzNetworking::GetRequiredQuantizationBits(0.0f, 1023.0f, 1.0f), 10u);
+        EXPECT_EQ(AzNetworking::GetRequiredQuantizationBits(0.0f, 1024.0f, 1.0f), 11u);
+        EXPECT_EQ(AzNetworking::GetRequiredQuantizationBits(-2048.0f, 2048.0f, 0.01f), 19u);
+        static_assert(AzNetworking::GetRequiredQuantizationBits(0.0f, 1.0f, 1.0f / 255.0f) == 8);
+
+        // The requested precision is always honoured
+        const uint32_t bitCount = AzNetworking::GetRequiredQuantizationBits(-100.0f, 100.0f, 0.005f);
+        EXPECT_LE(2.0f * AzNetworking::GetQuantizationErrorBound(-100.0f, 100.0f, bitCount), 0.005f);
+        EXPECT_GT(2.0f * AzNetworking::GetQuantizationErrorBound(-100.0f, 100.0f, bitCount - 1), 0.005f);
+    }
+
+    TEST(QuantizedBitsTests, TestFloatErrorBound)
+    {
+        TestFloatErrorBound<4>(0.0f, 1.0f);
+        TestFloatErrorBound<8>(-1.0f, 1.0f);
+        TestFloatErrorBound<16>(0.0f, 10.0f);
+        TestFloatErrorBound<20>(-2048.0f, 2048.0f);
+        TestFloatErrorBound<32>(-1.0f, 1.0f);
+    }
+
+    TEST(QuantizedBitsTests, TestVector3ErrorBound)
+    {
+        TestVector3ErrorBound<8>(-1.0f, 1.0f);
+        TestVector3ErrorBound<13>(-100.0f, 100.0f);
+        TestVector3ErrorBound<21>(-4096.0f, 4096.0f);
+    }
+
+    TEST(QuantizedBitsTests, TestOutOfRangeValuesClamp)
+    {
+        uint32_t size = 0;
+        EXPECT_FLOAT_EQ(RoundTripQuantizedRange<10>(-5.0f, -1.0f, 1.0f, size), -1.0f);
+        EXPECT_FLOAT_EQ(RoundTripQuantizedRange<10>(5.0f, -1.0f, 1.0f, size), 1.0f);
+        EXPECT_FLOAT_EQ(RoundTripQuantizedRange<10>(AZStd::numeric_limits<float>::quiet_NaN(), -1.0f, 1.0f, size), -1.0f);
+
+        const AZ::Vector2 clamped = RoundTripQuantizedRange<12>(AZ::Vector2(-10.0f, 10.0f), 0.0f, 1.0f, size);
+        EXPECT_TRUE(clamped.IsClose(AZ::Vector2(0.0f, 1.0f)));
+        EXPECT_EQ(size, 3u);
+    }
+
+    TEST(QuantizedBitsTests, TestSmallestThreeErrorBound)
+    {
+        TestSmallestThreeErrorBound<8>();
+        TestSmallestThreeErrorBound<10>();
+        TestSmallestThreeErrorBound<12>();
+        TestSmallestThreeErrorBound<16>();
+    }
+
+    TEST(QuantizedBitsTests, TestSmallestThreeIdentityAndDenormalized)
+    {
+        uint32_t size = 0;
+        const AZ::Quaternion identity = RoundTripSmallestThree<12>(AZ::Quaternion::CreateIdentity(), size);
+        EXPECT_TRUE(identity.IsClose(AZ::Quaternion::CreateIdentity()));
+        // A 12 bit smallest-three rotation takes 5 bytes instead of the 16 of four full floats
+        EXPECT_EQ(size, 5u);
+
+        // Rotations are normalized before they are sent
+        const AZ::Quaternion rotation = AZ::Quaternion::CreateRotationZ(1.0f);
+        const AZ::Quaternion scaled = RoundTripSmallestThree<12>(rotation * 3.0f, size);
+        EXPECT_TRUE(scaled.IsClose(rotation, 4.0f * AzNetworking::GetSmallestThreeErrorBound(12)));
+
+        // A zero quaternion has no rotation to send, it arrives as identity
+        const AZ::Quaternion zero = RoundTripSmallestThree<12>(AZ::Quaternion::CreateZero(), size);
+        EXPECT_TRUE(zero.IsClose(AZ::Quaternion::CreateIdentity()));
+    }
+}
@@ -26,5 +26,6 @@ set(FILES
     Utilities/CidrAddressTests.cpp
     Utilities/IpAddressTests.cpp
     Utilities/NetworkCommonTests.cpp
+    Utilities/QuantizedBitsTests.cpp
     Utilities/QuantizedValuesTests.cpp
 )
@@ -37,6 +37,7 @@ struct CryPakMock
     MOCK_CONST_METHOD0(GetLocalizationRoot, const char*());
     MOCK_METHOD2(FOpen, AZ::IO::HandleType(AZStd::string_view pName, const char* mode));
     MOCK_METHOD2(FGetCachedFileData, void*(AZ::IO::HandleType handle, size_t& nFileSize));
+    MOCK_METHOD2(FGetMappedFileData, const void*(AZ::IO::HandleType handle, size_t& nFileSize));
     MOCK_METHOD3(FRead, size_t(void* data, size_t bytesToRead, AZ::IO::HandleType handle));
     MOCK_METHOD3(FWrite, size_t(const void* data, size_t bytesToWrite, AZ::IO::HandleType handle));
     MOCK_METHOD1(FGetSize, size_t(AZ::IO::HandleType f));
@@ -101,6 +101,8 @@ set(FILES
     native/utilities/JobDiagnosticTracker.h
     native/utilities/LineByLineDependencyScanner.cpp
     native/utilities/LineByLineDependencyScanner.h
+    native/utilities/LocalProductCache.cpp
+    native/utilities/LocalProductCache.h
     native/utilities/MissingDependencyScanner.cpp
     native/utilities/MissingDependencyScanner.h
     native/utilities/PlatformConfiguration.cpp
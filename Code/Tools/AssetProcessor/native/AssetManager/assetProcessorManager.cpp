@@ -39,6 +39,7 @@
 #include <native/utilities/UuidManager.h>
 #include <native/utilities/ProductOutputUtil.h>
 #include <native/AssetManager/FileStateCache.h>
+#include <native/utilities/LocalProductCache.h>
 
 namespace AssetProcessor
 {
@@ -3507,6 +3508,13 @@ namespace AssetProcessor
         m_totalScannerFilesToAssess = filePaths.size();
         m_scannerFilesAssessed = 0;
 
+        if (m_allowModtimeSkippingFeature)
+        {
+            AssetProcessor::StatsCapture::BeginCaptureStat("HashingModifiedFiles");
+            HashModifiedScannerFiles(filePaths);
+            AssetProcessor::StatsCapture::EndCaptureStat("HashingModifiedFiles");
+        }
+
         for (const AssetFileInfo& fileInfo : filePaths)
         {
             if (m_allowModtimeSkippingFeature)
@@ -3555,6 +3563,8 @@ namespace AssetProcessor
             m_assetsNeedingProcessing_TimeStampChanged,
             m_assetsNeedingProcessing_DependenciesChanged);
 
+        m_scannedFileHashes.clear();
+
         AssetProcessor::StatsCapture::EndCaptureStat("InitialFileAssessment");
 
         // place a message in the queue that will cause us to transition
@@ -3600,6 +3610,71 @@ namespace AssetProcessor
         m_excludedFolderCache->InitializeFromKnownSet(AZStd::move(excludedFolders));
     }
 
+    void AssetProcessorManager::HashModifiedScannerFiles(const QSet<AssetFileInfo>& filePaths)
+    {
+        m_scannedFileHashes.clear();
+
+        // CanSkipProcessingFile doesn't look at hashes at all when the builders changed.
+        if (m_buildersAddedOrRemoved)
+        {
+            return;
+        }
+
+        // use the same checks as CanSkipProcessingFile to find the files it would hash.
+        AZStd::vector<const AssetFileInfo*> filesToHash;
+        AZStd::vector<AZStd::string> pathsToHash;
+        for (const AssetFileInfo& fileInfo : filePaths)
+        {
+            AZStd::string filePath = fileInfo.m_filePath.toUtf8().constData();
+            auto fileItr = m_fileModTimes.find(filePath);
+            if (fileItr == m_fileModTimes.end() || fileItr->second == 0)
+            {
+                continue;
+            }
+
+            auto thisModTime = aznumeric_cast<AZ::u64>(AssetUtilities::AdjustTimestamp(fileInfo.m_modTime));
+            if (fileItr->second == thisModTime)
+            {
+                continue;
+            }
+
+            auto hashItr = m_fileHashes.find(filePath);
+            if (hashItr == m_fileHashes.end() || hashItr->second == 0)
+            {
+                continue;
+            }
+
+            filesToHash.push_back(&fileInfo);
+            pathsToHash.push_back(AZStd::move(filePath));
+        }
+
+        if (pathsToHash.empty())
+        {
+            return;
+        }
+
+        AZStd::vector<AZ::u64> hashes = AssetUtilities::GetFileHashes(pathsToHash);
+
+        // the file cache only knows the hashes of files whose modtime didn't change, so record these as well
+        // so that processing the files that did change doesn't hash them a second time.
+        IFileStateRequests* fileStateCache = AZ::Interface<IFileStateRequests>::Get();
+        for (size_t index = 0; index < pathsToHash.size(); ++index)
+        {
+            if (hashes[index] == 0)
+            {
+                continue;
+            }
+
+            if (fileStateCache)
+            {
+                fileStateCache->WarmUpCache(*filesToHash[index], hashes[index]);
+            }
+            m_scannedFileHashes.emplace(AZStd::move(pathsToHash[index]), hashes[index]);
+        }
+
+        AZ_TracePrintf(AssetProcessor::DebugChannel, "Hashed %zu files with modified timestamps.\n", pathsToHash.size());
+    }
+
     bool AssetProcessorManager::CanSkipProcessingFile(const AssetFileInfo &fileInfo, AZ::u64& fileHashOut)
     {
         // Check to see if the file has changed since the last time we saw it
@@ -3660,7 +3735,18 @@ namespace AssetProcessor
                 return false;
             }
 
-            AZ::u64 fileHash = AssetUtilities::GetFileHash(fileInfo.m_filePath.toUtf8().constData());
+            // the hash was usually already computed along with the other modified files by HashModifiedScannerFiles.
+            AZ::u64 fileHash = 0;
+            auto scannedHashItr = m_scannedFileHashes.find(fileInfo.m_filePath.toUtf8().constData());
+            if (scannedHashItr != m_scannedFileHashes.end())
+            {
+                fileHash = scannedHashItr->second;
+                m_scannedFileHashes.erase(scannedHashItr);
+            }
+            else
+            {
+                fileHash = AssetUtilities::GetFileHash(fileInfo.m_filePath.toUtf8().constData());
+            }
 
             if(fileHash != databaseHashValue)
             {
@@ -3906,6 +3992,11 @@ namespace AssetProcessor
             m_jobFingerprintMap[jobIndentifier] = job.m_jobEntry.m_computedFingerprint;
         }
         job.m_jobEntry.m_computedFingerprintTimeStamp = QDateTime::currentMSecsSinceEpoch();
+
+        if (auto* localProductCache = AZ::Interface<ILocalProductCache>::Get(); localProductCache && localProductCache->IsEnabled())
+        {
+            job.m_productCacheKey = AssetUtilities::GenerateProductCacheKey(job);
+        }
         if (job.m_jobEntry.m_computedFingerprint == 0)
         {
             // unable to fingerprint this file.
@@ -453,6 +453,9 @@ namespace AssetProcessor
         void WarmUpFileCache(QSet<AssetFileInfo> filePaths);
         // Checks whether or not a file can be skipped for processing (ie, file content hasn't changed, builders haven't been added/removed, builders for the file haven't changed)
         bool CanSkipProcessingFile(const AssetFileInfo &fileInfo, AZ::u64& fileHash);
+        // Hashes, in parallel, the files that CanSkipProcessingFile would otherwise have to hash one at a time:
+        // files whose modtime changed since last run but that have a hash recorded in the database.
+        void HashModifiedScannerFiles(const QSet<AssetFileInfo>& filePaths);
 
         void CheckReadyToAssessScanFiles();
 
@@ -566,6 +569,9 @@ namespace AssetProcessor
         // this map contains hashes of all files AP processed last time it ran
         AZStd::unordered_map<AZStd::string, AZ::u64> m_fileHashes;
 
+        // this map contains the current hashes of the scanned files that were hashed up front by HashModifiedScannerFiles
+        AZStd::unordered_map<AZStd::string, AZ::u64> m_scannedFileHashes;
+
         QSet<QString> m_knownFolders; // a cache of all known folder names, normalized to have forward slashes.
         typedef AZStd::unordered_map<AZ::u64, AzToolsFramework::AssetSystem::JobInfo> JobRunKeyToJobInfoMap;  // for when network requests come in about the jobInfo
 
@@ -8,7 +8,10 @@
 #include "native/AssetManager/assetScannerWorker.h"
 #include "native/AssetManager/assetScanner.h"
 #include "native/utilities/PlatformConfiguration.h"
+#include "native/utilities/assetUtils.h"
+#include <AzCore/std/parallel/thread.h>
 #include <QDir>
+#include <QElapsedTimer>
 #include <QtConcurrent/QtConcurrentFilter>
 
 using namespace AssetProcessor;
@@ -35,11 +38,10 @@ void AssetScannerWorker::StartScan()
     Q_EMIT ScanningStateChanged(AssetProcessor::AssetScanningStatus::Started);
     Q_EMIT ScanningStateChanged(AssetProcessor::AssetScanningStatus::InProgress);
 
-    for (int idx = 0; idx < m_platformConfiguration->GetScanFolderCount(); idx++)
-    {
-        const ScanFolderInfo& scanFolderInfo = m_platformConfiguration->GetScanFolderAt(idx);
-        ScanForSourceFiles(scanFolderInfo, scanFolderInfo);
-    }
+    QElapsedTimer scanTimer;
+    scanTimer.start();
+
+    ScanForSourceFiles();
 
     // we want not to emit any signals until we're finished scanning
     // so that we don't interleave directory tree walking (IO access to the file table)
@@ -56,6 +58,8 @@ void AssetScannerWorker::StartScan()
     }
     else
     {
+        AZ_TracePrintf(AssetProcessor::ConsoleChannel, "Found %i files and %i folders in %lld ms.\n",
+            static_cast<int>(m_fileList.size()), static_cast<int>(m_folderList.size()), scanTimer.elapsed());
         EmitFiles();
     }
 
@@ -70,115 +74,183 @@ void AssetScannerWorker::StartScan()
 void AssetScannerWorker::StopScan()
 {
     m_doScan = false;
+    m_directoriesCondition.notify_all();
 }
 
-void AssetScannerWorker::ScanForSourceFiles(const ScanFolderInfo& scanFolderInfo, const ScanFolderInfo& rootScanFolder)
+void AssetScannerWorker::ScanForSourceFiles()
 {
-    if (!m_doScan)
+    QDir cacheDir;
+    AssetUtilities::ComputeProjectCacheRoot(cacheDir);
+    m_normalizedCachePath = AssetUtilities::NormalizeDirectoryPath(cacheDir.absolutePath());
+    m_cachePath = AZ::IO::Path(m_normalizedCachePath.toUtf8().constData());
+
+    QString intermediateAssetsFolder = QString::fromUtf8(AssetUtilities::GetIntermediateAssetsFolder(m_cachePath).c_str());
+    m_normalizedIntermediateAssetsFolder = AssetUtilities::NormalizeDirectoryPath(intermediateAssetsFolder);
+
+    // Every directory, in every scan folder, is a separate unit of work, so the scan is spread over the threads
+    // even if most of the files are in a single scan folder.
+    m_directoriesToScan.clear();
+    for (int idx = 0; idx < m_platformConfiguration->GetScanFolderCount(); idx++)
     {
-        return;
+        const ScanFolderInfo& scanFolderInfo = m_platformConfiguration->GetScanFolderAt(idx);
+        m_directoriesToScan.push_back({ scanFolderInfo.ScanPath(), &scanFolderInfo });
     }
+    m_pendingDirectoryCount = m_directoriesToScan.size();
 
-    QFileInfoList entries;
+    // This thread scans as well, so only the remaining threads have to be started.
+    const size_t threadCount = AZStd::max<size_t>(AssetUtilities::GetMaxConcurrentFileReads(), 1);
+    AZStd::vector<ScanResults> results(threadCount);
+    AZStd::vector<AZStd::thread> threads;
+    threads.reserve(threadCount - 1);
+    AZStd::thread_desc desc;
+    desc.m_name = "AssetScannerWorker Directory Scan";
+    for (size_t threadIndex = 1; threadIndex < threadCount; ++threadIndex)
+    {
+        threads.emplace_back(desc, [this, &threadResults = results[threadIndex]]() { ScanDirectories(threadResults); });
+    }
+    ScanDirectories(results[0]);
+    for (AZStd::thread& thread : threads)
+    {
+        thread.join();
+    }
 
-    QDir cacheDir;
-    AssetUtilities::ComputeProjectCacheRoot(cacheDir);
-    QString normalizedCachePath = AssetUtilities::NormalizeDirectoryPath(cacheDir.absolutePath());
-    AZ::IO::Path cachePath(normalizedCachePath.toUtf8().constData());
+    m_directoriesToScan.clear();
+    m_pendingDirectoryCount = 0;
 
-    QString intermediateAssetsFolder = QString::fromUtf8(AssetUtilities::GetIntermediateAssetsFolder(cachePath).c_str());
-    QString normalizedIntermediateAssetsFolder = AssetUtilities::NormalizeDirectoryPath(intermediateAssetsFolder);
+    if (!m_doScan)
+    {
+        return;
+    }
 
-    // Implemented non-recursively so that the above functions only have to be called once per scan,
-    // and so that the performance is easy to analyze in a profiler:
-    QList<ScanFolderInfo> pathsToScanQueue;
-    pathsToScanQueue.push_back(scanFolderInfo);
+    for (ScanResults& threadResults : results)
+    {
+        m_fileList.unite(threadResults.m_fileList);
+        m_folderList.unite(threadResults.m_folderList);
+        m_excludedList.unite(threadResults.m_excludedList);
+    }
+}
 
-    while (!pathsToScanQueue.empty())
+void AssetScannerWorker::ScanDirectories(ScanResults& results)
+{
+    AZStd::vector<DirectoryToScan> subdirectories;
+    while (true)
     {
-        ScanFolderInfo pathToScan = pathsToScanQueue.back();
-        pathsToScanQueue.pop_back();
-        QDir dir(pathToScan.ScanPath());
-        dir.setSorting(QDir::Unsorted);
-        // Only scan sub folders if recurseSubFolders flag is set
-        if (!scanFolderInfo.RecurseSubFolders())
+        DirectoryToScan directory;
         {
-            entries = dir.entryInfoList(QDir::NoDotAndDotDot | QDir::Files);
+            AZStd::unique_lock<AZStd::mutex> lock(m_directoriesMutex);
+            m_directoriesCondition.wait(lock, [this]()
+            {
+                return !m_directoriesToScan.empty() || m_pendingDirectoryCount == 0 || !m_doScan;
+            });
+
+            if (m_pendingDirectoryCount == 0 || !m_doScan)
+            {
+                return;
+            }
+
+            directory = AZStd::move(m_directoriesToScan.back());
+            m_directoriesToScan.pop_back();
         }
-        else
+
+        subdirectories.clear();
+        ScanDirectory(directory, results, subdirectories);
+
         {
-            entries = dir.entryInfoList(QDir::Dirs | QDir::NoDotAndDotDot | QDir::Files);
+            AZStd::lock_guard<AZStd::mutex> lock(m_directoriesMutex);
+            m_pendingDirectoryCount += subdirectories.size();
+            m_directoriesToScan.insert(m_directoriesToScan.end(), subdirectories.begin(), subdirectories.end());
+            --m_pendingDirectoryCount;
         }
 
-        for (const QFileInfo& entry : entries)
+        // wake up threads waiting for work, or all of them if this was the last directory.
+        m_directoriesCondition.notify_all();
+    }
+}
+
+void AssetScannerWorker::ScanDirectory(const DirectoryToScan& directory, ScanResults& results, AZStd::vector<DirectoryToScan>& subdirectoriesOut)
+{
+    const ScanFolderInfo& rootScanFolder = *directory.m_rootScanFolder;
+
+    QDir dir(directory.m_path);
+    dir.setSorting(QDir::Unsorted);
+    QFileInfoList entries;
+    // Only scan sub folders if recurseSubFolders flag is set
+    if (!rootScanFolder.RecurseSubFolders())
+    {
+        entries = dir.entryInfoList(QDir::NoDotAndDotDot | QDir::Files);
+    }
+    else
+    {
+        entries = dir.entryInfoList(QDir::Dirs | QDir::NoDotAndDotDot | QDir::Files);
+    }
+
+    for (const QFileInfo& entry : entries)
+    {
+        if (!m_doScan) // scan was cancelled!
         {
-            if (!m_doScan) // scan was cancelled!
-            {
-                return;
-            }
+            return;
+        }
 
-            QString absPath = entry.absoluteFilePath();
-            const bool isDirectory = entry.isDir();
-            QDateTime modTime = entry.lastModified();
-            AZ::u64 fileSize = isDirectory ? 0 : entry.size();
-            AssetFileInfo assetFileInfo(absPath, modTime, fileSize, &rootScanFolder, isDirectory);
-            QString relPath = absPath.mid(rootScanFolder.ScanPath().length() + 1);
+        QString absPath = entry.absoluteFilePath();
+        const bool isDirectory = entry.isDir();
+        QDateTime modTime = entry.lastModified();
+        AZ::u64 fileSize = isDirectory ? 0 : entry.size();
+        AssetFileInfo assetFileInfo(absPath, modTime, fileSize, &rootScanFolder, isDirectory);
+        QString relPath = absPath.mid(rootScanFolder.ScanPath().length() + 1);
 
-            if (isDirectory)
-            {
-                // in debug, assert that the paths coming from qt directory info iteration is already normalized
-                // allowing us to skip normalization and know that comparisons like "IsInCacheFolder" will actually succed.
-                Q_ASSERT(absPath == AssetUtilities::NormalizeDirectoryPath(absPath));
-                // Filtering out excluded directories immediately (not in a thread pool) since that prevents us from recursing.
+        if (isDirectory)
+        {
+            // in debug, assert that the paths coming from qt directory info iteration is already normalized
+            // allowing us to skip normalization and know that comparisons like "IsInCacheFolder" will actually succed.
+            Q_ASSERT(absPath == AssetUtilities::NormalizeDirectoryPath(absPath));
+            // Filtering out excluded directories immediately (not in a thread pool) since that prevents us from recursing.
 
-                // we already know the root scan folder, and can thus chop that part off and call the cheaper IsFileExcludedRelPath:
+            // we already know the root scan folder, and can thus chop that part off and call the cheaper IsFileExcludedRelPath:
 
-                if (m_platformConfiguration->IsFileExcludedRelPath(relPath))
-                {
-                    m_excludedList.insert(AZStd::move(assetFileInfo));
-                    continue;
-                }
+            if (m_platformConfiguration->IsFileExcludedRelPath(relPath))
+            {
+                results.m_excludedList.insert(AZStd::move(assetFileInfo));
+                continue;
+            }
 
-                // Entry is a directory
-                // The AP needs to know about all directories so it knows when a delete occurs if the path refers to a folder or a file
-                m_folderList.insert(AZStd::move(assetFileInfo));
+            // Entry is a directory
+            // The AP needs to know about all directories so it knows when a delete occurs if the path refers to a folder or a file
+            results.m_folderList.insert(AZStd::move(assetFileInfo));
 
-                // recurse into this folder.
-                // Since we only care about source files, we can skip cache folders that are not the Intermediate Assets Folder.
+            // recurse into this folder.
+            // Since we only care about source files, we can skip cache folders that are not the Intermediate Assets Folder.
 
-                if (absPath.startsWith(normalizedCachePath))
+            if (absPath.startsWith(m_normalizedCachePath))
+            {
+                // its in the cache.  Is it the cache itself?
+                if (absPath.length() != m_normalizedCachePath.length())
                 {
-                    // its in the cache.  Is it the cache itself?
-                    if (absPath.length() != normalizedCachePath.length())
+                    // no.  Is it in the intermediateassets?
+                    if (!absPath.startsWith(m_normalizedIntermediateAssetsFolder))
                     {
-                        // no.  Is it in the intermediateassets?
-                        if (!absPath.startsWith(normalizedIntermediateAssetsFolder))
-                        {
-                            // Its not something in the intermediate assets folder, nor is it the cache itself,
-                            // so it is just a file somewhere in the cache.
-                            continue; // do not recurse.
-                        }
+                        // Its not something in the intermediate assets folder, nor is it the cache itself,
+                        // so it is just a file somewhere in the cache.
+                        continue; // do not recurse.
                     }
                 }
-                // then we can recurse.  Otherwise, its a non-intermediate-assets-folder
-                ScanFolderInfo tempScanFolderInfo(absPath, "", "", false, true);
-                pathsToScanQueue.push_back(tempScanFolderInfo);
             }
-            else
-            {
-                // Entry is a file
-                Q_ASSERT(absPath == AssetUtilities::NormalizeFilePath(absPath));
+            // then we can recurse.  Otherwise, its a non-intermediate-assets-folder
+            subdirectoriesOut.push_back({ AZStd::move(absPath), &rootScanFolder });
+        }
+        else
+        {
+            // Entry is a file
+            Q_ASSERT(absPath == AssetUtilities::NormalizeFilePath(absPath));
 
-                if (!AssetUtilities::IsInCacheFolder(absPath.toUtf8().constData(), cachePath)) // Ignore files in the cache
+            if (!AssetUtilities::IsInCacheFolder(absPath.toUtf8().constData(), m_cachePath)) // Ignore files in the cache
+            {
+                if (!m_platformConfiguration->IsFileExcludedRelPath(relPath))
                 {
-                    if (!m_platformConfiguration->IsFileExcludedRelPath(relPath))
-                    {
-                        m_fileList.insert(AZStd::move(assetFileInfo));
-                    }
-                    else
-                    {
-                        m_excludedList.insert(AZStd::move(assetFileInfo));
-                    }
+                    results.m_fileList.insert(AZStd::move(assetFileInfo));
+                }
+                else
+                {
+                    results.m_excludedList.insert(AZStd::move(assetFileInfo));
                 }
             }
         }
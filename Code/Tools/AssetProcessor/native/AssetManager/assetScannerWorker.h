@@ -11,6 +11,11 @@
 #if !defined(Q_MOC_RUN)
 #include "native/assetprocessor.h"
 #include "assetScanFolderInfo.h"
+#include <AzCore/IO/Path/Path.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/condition_variable.h>
+#include <AzCore/std/parallel/mutex.h>
 #include <QString>
 #include <QSet>
 #include <QObject>
@@ -43,17 +48,47 @@ Q_SIGNALS:
         void StopScan();
 
     protected:
-        // scanFolderInfo - the folder we're currently scanning (this will sometimes be a fake scanfolder created when recursing through directories)
-        // rootScanFolder - the actual scan folder we started with, which will either be the same as scanFolderInfo or a parent folder
-        void ScanForSourceFiles(const ScanFolderInfo& scanFolderInfo, const ScanFolderInfo& rootScanFolder);
+        // A directory waiting to be scanned, together with the actual scan folder it was found in.
+        struct DirectoryToScan
+        {
+            QString m_path;
+            const ScanFolderInfo* m_rootScanFolder = nullptr;
+        };
+
+        // What a single scanning thread found.  These are merged once all threads are done.
+        struct ScanResults
+        {
+            QSet<AssetFileInfo> m_fileList;
+            QSet<AssetFileInfo> m_folderList;
+            QSet<AssetFileInfo> m_excludedList;
+        };
+
+        // Walks all the scan folders, scanning directories in parallel on up to AssetUtilities::GetMaxConcurrentFileReads threads.
+        void ScanForSourceFiles();
+        // Takes directories from the shared queue and scans them until there are no directories left or scanning is stopped.
+        void ScanDirectories(ScanResults& results);
+        // Scans the entries of a single directory, adding the subdirectories that need to be scanned to subdirectoriesOut.
+        void ScanDirectory(const DirectoryToScan& directory, ScanResults& results, AZStd::vector<DirectoryToScan>& subdirectoriesOut);
         void EmitFiles();
 
     private:
-        volatile bool m_doScan = true;
+        AZStd::atomic_bool m_doScan{ true };
         QSet<AssetFileInfo> m_fileList; // note:  neither QSet nor QString are qobject-derived
         QSet<AssetFileInfo> m_folderList;
         QSet<AssetFileInfo> m_excludedList;
 
+        // Shared between the scanning threads.  m_pendingDirectoryCount counts both the queued directories and the ones being scanned,
+        // so the scan is done when it reaches zero.
+        AZStd::mutex m_directoriesMutex;
+        AZStd::condition_variable m_directoriesCondition;
+        AZStd::vector<DirectoryToScan> m_directoriesToScan;
+        size_t m_pendingDirectoryCount = 0;
+
+        // Computed once per scan, as this is needed for every directory.
+        QString m_normalizedCachePath;
+        QString m_normalizedIntermediateAssetsFolder;
+        AZ::IO::Path m_cachePath;
+
         PlatformConfiguration* m_platformConfiguration;
     };
 } // end namespace AssetProcessor
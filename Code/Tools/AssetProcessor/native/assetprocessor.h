@@ -234,6 +234,10 @@ namespace AssetProcessor
         // before we start processing locally
         bool m_checkServer = false;
 
+        // identifies the outputs of this job in the local product cache, see AssetUtilities::GenerateProductCacheKey.
+        // empty if the local product cache is not enabled.
+        AZStd::string m_productCacheKey;
+
         // Indicates whether this job needs to be processed irrespective of whether its fingerprint got modified or not.
         bool m_autoProcessJob = false;
 
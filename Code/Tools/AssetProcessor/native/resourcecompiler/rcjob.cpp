@@ -21,6 +21,7 @@
 
 #include <qstorageinfo.h>
 #include <native/utilities/ProductOutputUtil.h>
+#include <native/utilities/LocalProductCache.h>
 
 namespace
 {
@@ -646,11 +647,24 @@ namespace AssetProcessor
                         }
                     }
 
+                    // the local product cache is only used for jobs that weren't already handled by the asset server.
+                    ILocalProductCache* localProductCache = AZ::Interface<ILocalProductCache>::Get();
+                    const bool useLocalProductCache = runProcessJob && localProductCache && !m_jobDetails.m_productCacheKey.empty();
+                    if (useLocalProductCache)
+                    {
+                        runProcessJob = !RetrieveFromLocalProductCache(builderParams, jobLogTraceListener, result);
+                    }
+
                     if(runProcessJob)
                     {
                         result.m_outputProducts.clear();
                         // sending process job command to the builder
                         builderParams.m_assetBuilderDesc.m_processJobFunction(builderParams.m_processJobRequest, result);
+
+                        if (useLocalProductCache && result.m_resultCode == AssetBuilderSDK::ProcessJobResult_Success && !JobCancelListener.IsCancelled())
+                        {
+                            StoreInLocalProductCache(builderParams, result);
+                        }
                     }
                 }
             }
@@ -1135,7 +1149,7 @@ namespace AssetProcessor
         return AZ::Success(sourceFiles);
     }
 
-    bool RCJob::AfterRetrievingJobResult(const BuilderParams& builderParams, AssetUtilities::JobLogTraceListener& jobLogTraceListener, AssetBuilderSDK::ProcessJobResponse& jobResponse)
+    bool RCJob::AfterRetrievingJobResult(const BuilderParams& builderParams, AssetUtilities::JobLogTraceListener& jobLogTraceListener, AssetBuilderSDK::ProcessJobResponse& jobResponse, bool jobLogRequired)
     {
         AZStd::string responseFilePath;
         AzFramework::StringFunc::Path::ConstructFull(builderParams.m_processJobRequest.m_tempDirPath.c_str(), AssetBuilderSDK::s_processJobResponseFileName, responseFilePath, true);
@@ -1156,7 +1170,13 @@ namespace AssetProcessor
 
         if (!AZ::Utils::LoadObjectFromFileInPlace(jobLogFilePath.c_str(), jobLogResponse))
         {
-            return false;
+            return !jobLogRequired;
+        }
+
+        if (!jobLogResponse.m_isSuccess && !jobLogRequired)
+        {
+            // the job ran without logging anything, so there's nothing to replay.
+            return true;
         }
 
         if (!jobLogResponse.m_isSuccess)
@@ -1185,6 +1205,70 @@ namespace AssetProcessor
         return true;
     }
 
+    bool RCJob::RetrieveFromLocalProductCache(const BuilderParams& builderParams, AssetUtilities::JobLogTraceListener& jobLogTraceListener, AssetBuilderSDK::ProcessJobResponse& jobResponse)
+    {
+        ILocalProductCache* localProductCache = AZ::Interface<ILocalProductCache>::Get();
+        const AZStd::string& cacheKey = builderParams.m_rcJob->m_jobDetails.m_productCacheKey;
+        QString tempFolder = QString::fromUtf8(builderParams.m_processJobRequest.m_tempDirPath.c_str());
+        if (!localProductCache || !localProductCache->RetrieveJobResult(cacheKey, tempFolder))
+        {
+            return false;
+        }
+
+        // the cache holds the temp folder as it was after storing the job result, so it's restored the same way as a job from the server.
+        // Builders that don't log anything leave no job log behind, and the products are verified by the cache, so the log is optional.
+        jobResponse = {};
+        if (!AfterRetrievingJobResult(builderParams, jobLogTraceListener, jobResponse, false))
+        {
+            AZ_TracePrintf(AssetProcessor::DebugChannel, "Unable to restore job (%s, %s, %s) from the local product cache. Processing locally.\n",
+                builderParams.m_rcJob->GetJobEntry().m_sourceAssetReference.AbsolutePath().c_str(), builderParams.m_rcJob->GetJobKey().toUtf8().data(),
+                builderParams.m_rcJob->GetPlatformInfo().m_identifier.c_str());
+
+            // start the builder from an empty temp folder.
+            QDir tempDir(tempFolder);
+            tempDir.removeRecursively();
+            tempDir.mkpath(".");
+            jobResponse = {};
+            jobResponse.m_resultCode = AssetBuilderSDK::ProcessJobResult_Failed;
+            return false;
+        }
+
+        AZ_TracePrintf(AssetProcessor::DebugChannel, "Restored job (%s, %s, %s) from the local product cache.\n",
+            builderParams.m_rcJob->GetJobEntry().m_sourceAssetReference.AbsolutePath().c_str(), builderParams.m_rcJob->GetJobKey().toUtf8().data(),
+            builderParams.m_rcJob->GetPlatformInfo().m_identifier.c_str());
+        return true;
+    }
+
+    void RCJob::StoreInLocalProductCache(const BuilderParams& builderParams, const AssetBuilderSDK::ProcessJobResponse& jobResponse)
+    {
+        ILocalProductCache* localProductCache = AZ::Interface<ILocalProductCache>::Get();
+        if (!localProductCache)
+        {
+            return;
+        }
+
+        auto beforeStoreResult = BeforeStoringJobResult(builderParams, jobResponse);
+        if (!beforeStoreResult.IsSuccess())
+        {
+            AZ_Warning(AssetBuilderSDK::WarningWindow, false, "Failed preparing store result for %s", builderParams.m_processJobRequest.m_sourceFile.c_str());
+            return;
+        }
+
+        if (!beforeStoreResult.GetValue().empty())
+        {
+            // products that are copies of source files aren't in the temp folder.  These jobs are cheap to run again, so they're not cached.
+            return;
+        }
+
+        const AZStd::string& cacheKey = builderParams.m_rcJob->m_jobDetails.m_productCacheKey;
+        if (!localProductCache->StoreJobResult(cacheKey, QString::fromUtf8(builderParams.m_processJobRequest.m_tempDirPath.c_str())))
+        {
+            AZ_TracePrintf(AssetProcessor::DebugChannel, "Unable to store job (%s, %s, %s) in the local product cache.\n",
+                builderParams.m_rcJob->GetJobEntry().m_sourceAssetReference.AbsolutePath().c_str(), builderParams.m_rcJob->GetJobKey().toUtf8().data(),
+                builderParams.m_rcJob->GetPlatformInfo().m_identifier.c_str());
+        }
+    }
+
     AZStd::string BuilderParams::GetTempJobDirectory() const
     {
         return m_processJobRequest.m_tempDirPath;
@@ -247,7 +247,12 @@ namespace AssetProcessor
         static AZ::Outcome<AZStd::vector<AZStd::string>> BeforeStoringJobResult(const BuilderParams& builderParams, AssetBuilderSDK::ProcessJobResponse jobResponse);
         //! This method will retrieve the processJobResponse and the job log from the temp directory.
         //! This method is also responsible for emitting the server job logs to the local job log file.
-        static bool AfterRetrievingJobResult(const BuilderParams& builderParams, AssetUtilities::JobLogTraceListener& jobLogTraceListener, AssetBuilderSDK::ProcessJobResponse& jobResponse);
+        //! Jobs that didn't log anything have no job log, so callers that can trust the result without one set jobLogRequired to false.
+        static bool AfterRetrievingJobResult(const BuilderParams& builderParams, AssetUtilities::JobLogTraceListener& jobLogTraceListener, AssetBuilderSDK::ProcessJobResponse& jobResponse, bool jobLogRequired = true);
+        //! Restores the result of the job from the local product cache into the temp directory, returns false if it's not in the cache.
+        static bool RetrieveFromLocalProductCache(const BuilderParams& builderParams, AssetUtilities::JobLogTraceListener& jobLogTraceListener, AssetBuilderSDK::ProcessJobResponse& jobResponse);
+        //! Stores the result of the job, which is still in the temp directory, in the local product cache.
+        static void StoreInLocalProductCache(const BuilderParams& builderParams, const AssetBuilderSDK::ProcessJobResponse& jobResponse);
 
         QString GetJobKey() const;
         AZ::Uuid GetBuilderGuid() const;
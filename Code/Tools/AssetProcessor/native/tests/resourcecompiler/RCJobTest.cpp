@@ -12,6 +12,7 @@
 #include <AzCore/Serialization/SerializeContext.h>
 #include <tests/assetmanager/AssetManagerTestingBase.h>
 #include <native/utilities/AssetServerHandler.h>
+#include <native/utilities/LocalProductCache.h>
 
 namespace UnitTests
 {
@@ -403,4 +404,82 @@ namespace UnitTests
         EXPECT_EQ(result.m_outputProducts.at(1).m_outputFlags & ProductOutputFlags::CachedAsset, ProductOutputFlags::CachedAsset);
     }
 
+    TEST_F(RCJobTest, RCJob_DoWork_LocalProductCacheHit_RestoresProductsWithoutRunningBuilder)
+    {
+        struct TestRCJob
+            : public RCJob
+        {
+            void DoWork(AssetBuilderSDK::ProcessJobResponse& result, BuilderParams& builderParams, AssetUtilities::QuitListener& listener) override
+            {
+                RCJob::DoWork(result, builderParams, listener);
+            }
+        };
+
+        auto serializeContext = AZStd::make_unique<AZ::SerializeContext>();
+        AssetBuilderSDK::ProcessJobResponse::Reflect(&*serializeContext);
+        AssetBuilderSDK::JobProduct::Reflect(&*serializeContext);
+        AzToolsFramework::AssetSystem::AssetJobLogResponse::Reflect(&*serializeContext);
+        AzFramework::AssetSystem::BaseAssetProcessorMessage::Reflect(&*serializeContext);
+
+        auto mockComponentApplication = NiceMock<::UnitTests::MockComponentApplication>();
+        ON_CALL(mockComponentApplication, GetSerializeContext()).WillByDefault(Return(serializeContext.get()));
+
+        LocalProductCache localProductCache(m_data->tempDirPath.absoluteFilePath("ProductCache"));
+        ASSERT_TRUE(localProductCache.IsEnabled());
+
+        JobDetails jobDetails;
+        jobDetails.m_jobEntry.m_jobRunKey = 1;
+        jobDetails.m_productCacheKey = "0123456789abcdef";
+
+        AssetProcessor::RCJob rcJob;
+        rcJob.Init(jobDetails);
+
+        // the builder doesn't log anything, so the job leaves no job log behind.
+        int builderRuns = 0;
+        BuilderParams builderParams;
+        builderParams.m_rcJob = &rcJob;
+        builderParams.m_cacheOutputDir = m_data->m_absolutePathToTempOutputFolder;
+        builderParams.m_intermediateOutputDir = AssetUtilities::GetIntermediateAssetsFolder(m_data->m_absolutePathToTempOutputFolder.c_str());
+        builderParams.m_assetBuilderDesc.m_processJobFunction = [&builderRuns](const ProcessJobRequest& request, ProcessJobResponse& response)
+        {
+            ++builderRuns;
+            UnitTestUtils::CreateDummyFile(QDir(request.m_tempDirPath.c_str()).absoluteFilePath("product.txt"), "product contents");
+            AssetBuilderSDK::JobProduct product("product.txt");
+            product.m_dependenciesHandled = true;
+            response.m_outputProducts.push_back(product);
+            response.m_resultCode = AssetBuilderSDK::ProcessJobResult_Success;
+        };
+
+        QString productPath = QDir(QString::fromUtf8(m_data->m_absolutePathToTempOutputFolder.c_str())).absoluteFilePath("product.txt");
+        AssetUtilities::QuitListener listener;
+
+        TestRCJob firstRun;
+        firstRun.Init(jobDetails);
+        AssetBuilderSDK::ProcessJobResponse firstResult;
+        BuilderParams firstParams = builderParams;
+        firstRun.DoWork(firstResult, firstParams, listener);
+        ASSERT_EQ(firstResult.m_resultCode, AssetBuilderSDK::ProcessJobResult_Success);
+        EXPECT_EQ(builderRuns, 1);
+
+        // change the product in place, which must not reach the copy held by the local product cache.
+        {
+            QFile productFile(productPath);
+            ASSERT_TRUE(productFile.open(QIODevice::ReadWrite));
+            productFile.write("PRODUCT");
+        }
+
+        TestRCJob secondRun;
+        secondRun.Init(jobDetails);
+        AssetBuilderSDK::ProcessJobResponse secondResult;
+        BuilderParams secondParams = builderParams;
+        secondRun.DoWork(secondResult, secondParams, listener);
+        ASSERT_EQ(secondResult.m_resultCode, AssetBuilderSDK::ProcessJobResult_Success);
+        EXPECT_EQ(builderRuns, 1);
+        ASSERT_EQ(secondResult.m_outputProducts.size(), 1);
+
+        QFile productFile(productPath);
+        ASSERT_TRUE(productFile.open(QIODevice::ReadOnly));
+        EXPECT_EQ(productFile.readAll(), QByteArray("product contents"));
+    }
+
 } // end namespace UnitTests
@@ -0,0 +1,192 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <native/tests/AssetProcessorTest.h>
+#include <native/unittests/UnitTestUtils.h>
+#include <native/utilities/LocalProductCache.h>
+#include <AzCore/IO/FileIO.h>
+#include <AzFramework/IO/LocalFileIO.h>
+
+#include <QDir>
+#include <QDirIterator>
+#include <QFile>
+#include <QTemporaryDir>
+
+namespace AssetProcessor
+{
+    class LocalProductCacheTests
+        : public AssetProcessorTest
+    {
+    protected:
+        void SetUp() override
+        {
+            AssetProcessorTest::SetUp();
+
+            if (AZ::IO::FileIOBase::GetInstance() == nullptr)
+            {
+                m_localFileIo = aznew AZ::IO::LocalFileIO();
+                AZ::IO::FileIOBase::SetInstance(m_localFileIo);
+            }
+
+            m_tempDir = AZStd::make_unique<QTemporaryDir>();
+            QDir tempPath(m_tempDir->path());
+            m_cache = AZStd::make_unique<LocalProductCache>(tempPath.absoluteFilePath("ProductCache"));
+        }
+
+        void TearDown() override
+        {
+            m_cache.reset();
+            m_tempDir.reset();
+
+            if (m_localFileIo)
+            {
+                delete m_localFileIo;
+                m_localFileIo = nullptr;
+                AZ::IO::FileIOBase::SetInstance(nullptr);
+            }
+
+            AssetProcessorTest::TearDown();
+        }
+
+        QString MakeJobFolder(const QString& name)
+        {
+            QDir tempPath(m_tempDir->path());
+            QString jobFolder = tempPath.absoluteFilePath(name);
+            EXPECT_TRUE(QDir().mkpath(jobFolder));
+            return jobFolder;
+        }
+
+        static QString ReadFile(const QString& filePath)
+        {
+            QFile file(filePath);
+            if (!file.open(QIODevice::ReadOnly))
+            {
+                return {};
+            }
+            return QString::fromUtf8(file.readAll());
+        }
+
+        int CountObjects() const
+        {
+            int count = 0;
+            QDirIterator objectIterator(QDir(m_tempDir->path()).absoluteFilePath("ProductCache/objects"), QDir::Files, QDirIterator::Subdirectories);
+            while (objectIterator.hasNext())
+            {
+                objectIterator.next();
+                ++count;
+            }
+            return count;
+        }
+
+        AZ::IO::FileIOBase* m_localFileIo = nullptr;
+        AZStd::unique_ptr<QTemporaryDir> m_tempDir;
+        AZStd::unique_ptr<LocalProductCache> m_cache;
+    };
+
+    TEST_F(LocalProductCacheTests, StoreAndRetrieve_JobFolder_FilesAreRestored)
+    {
+        QString jobFolder = MakeJobFolder("job");
+        EXPECT_TRUE(UnitTestUtils::CreateDummyFile(QDir(jobFolder).absoluteFilePath("product.bin"), "product contents"));
+        EXPECT_TRUE(UnitTestUtils::CreateDummyFile(QDir(jobFolder).absoluteFilePath("subfolder/other.bin"), "other contents"));
+
+        ASSERT_TRUE(m_cache->IsEnabled());
+        EXPECT_TRUE(m_cache->StoreJobResult("0123456789abcdef", jobFolder));
+
+        QString retrieveFolder = MakeJobFolder("retrieve");
+        EXPECT_TRUE(m_cache->RetrieveJobResult("0123456789abcdef", retrieveFolder));
+        EXPECT_EQ(ReadFile(QDir(retrieveFolder).absoluteFilePath("product.bin")), "product contents");
+        EXPECT_EQ(ReadFile(QDir(retrieveFolder).absoluteFilePath("subfolder/other.bin")), "other contents");
+    }
+
+    TEST_F(LocalProductCacheTests, Store_IdenticalFilesInDifferentJobs_StoredOnce)
+    {
+        QString firstJobFolder = MakeJobFolder("first");
+        QString secondJobFolder = MakeJobFolder("second");
+        EXPECT_TRUE(UnitTestUtils::CreateDummyFile(QDir(firstJobFolder).absoluteFilePath("product.bin"), "shared contents"));
+        EXPECT_TRUE(UnitTestUtils::CreateDummyFile(QDir(secondJobFolder).absoluteFilePath("renamed.bin"), "shared contents"));
+        EXPECT_TRUE(UnitTestUtils::CreateDummyFile(QDir(secondJobFolder).absoluteFilePath("unique.bin"), "unique contents"));
+
+        EXPECT_TRUE(m_cache->StoreJobResult("aa00", firstJobFolder));
+        EXPECT_TRUE(m_cache->StoreJobResult("bb00", secondJobFolder));
+        EXPECT_EQ(CountObjects(), 2);
+
+        QString retrieveFolder = MakeJobFolder("retrieve");
+        EXPECT_TRUE(m_cache->RetrieveJobResult("bb00", retrieveFolder));
+        EXPECT_EQ(ReadFile(QDir(retrieveFolder).absoluteFilePath("renamed.bin")), "shared contents");
+        EXPECT_EQ(ReadFile(QDir(retrieveFolder).absoluteFilePath("unique.bin")), "unique contents");
+    }
+
+    TEST_F(LocalProductCacheTests, Retrieve_UnknownKey_ReturnsFalse)
+    {
+        QString retrieveFolder = MakeJobFolder("retrieve");
+        EXPECT_FALSE(m_cache->RetrieveJobResult("cc00", retrieveFolder));
+        EXPECT_TRUE(QDir(retrieveFolder).isEmpty());
+    }
+
+    TEST_F(LocalProductCacheTests, Retrieve_MissingObject_ReturnsFalseAndLeavesFolderEmpty)
+    {
+        QString jobFolder = MakeJobFolder("job");
+        EXPECT_TRUE(UnitTestUtils::CreateDummyFile(QDir(jobFolder).absoluteFilePath("a.bin"), "a"));
+        EXPECT_TRUE(UnitTestUtils::CreateDummyFile(QDir(jobFolder).absoluteFilePath("b.bin"), "b"));
+        EXPECT_TRUE(m_cache->StoreJobResult("dd00", jobFolder));
+
+        // remove one of the objects, as if it was deleted by hand.
+        QDirIterator objectIterator(QDir(m_tempDir->path()).absoluteFilePath("ProductCache/objects"), QDir::Files, QDirIterator::Subdirectories);
+        ASSERT_TRUE(objectIterator.hasNext());
+        QString objectPath = objectIterator.next();
+        QFile::setPermissions(objectPath, QFile::permissions(objectPath) | QFileDevice::WriteOwner);
+        EXPECT_TRUE(QFile::remove(objectPath));
+
+        QString retrieveFolder = MakeJobFolder("retrieve");
+        EXPECT_FALSE(m_cache->RetrieveJobResult("dd00", retrieveFolder));
+        EXPECT_TRUE(QDir(retrieveFolder).isEmpty());
+    }
+
+    TEST_F(LocalProductCacheTests, Retrieve_ChangedObject_ReturnsFalseAndRemovesObject)
+    {
+        QString jobFolder = MakeJobFolder("job");
+        EXPECT_TRUE(UnitTestUtils::CreateDummyFile(QDir(jobFolder).absoluteFilePath("product.bin"), "product contents"));
+        EXPECT_TRUE(m_cache->StoreJobResult("ee00", jobFolder));
+
+        // change the object without changing its size, as a write through a link to it would have.
+        QDirIterator objectIterator(QDir(m_tempDir->path()).absoluteFilePath("ProductCache/objects"), QDir::Files, QDirIterator::Subdirectories);
+        ASSERT_TRUE(objectIterator.hasNext());
+        QString objectPath = objectIterator.next();
+        EXPECT_FALSE(QFile::permissions(objectPath).testFlag(QFileDevice::WriteOwner));
+        QFile::setPermissions(objectPath, QFile::permissions(objectPath) | QFileDevice::WriteOwner);
+        {
+            QFile objectFile(objectPath);
+            ASSERT_TRUE(objectFile.open(QIODevice::ReadWrite));
+            objectFile.write("PRODUCT");
+        }
+
+        QString retrieveFolder = MakeJobFolder("retrieve");
+        EXPECT_FALSE(m_cache->RetrieveJobResult("ee00", retrieveFolder));
+        EXPECT_TRUE(QDir(retrieveFolder).isEmpty());
+        EXPECT_FALSE(QFile::exists(objectPath));
+    }
+
+    TEST_F(LocalProductCacheTests, Retrieve_ChangeRetrievedFile_CacheIsUnchanged)
+    {
+        QString jobFolder = MakeJobFolder("job");
+        EXPECT_TRUE(UnitTestUtils::CreateDummyFile(QDir(jobFolder).absoluteFilePath("product.bin"), "product contents"));
+        EXPECT_TRUE(m_cache->StoreJobResult("ff00", jobFolder));
+
+        QString firstFolder = MakeJobFolder("first");
+        EXPECT_TRUE(m_cache->RetrieveJobResult("ff00", firstFolder));
+        {
+            QFile retrievedFile(QDir(firstFolder).absoluteFilePath("product.bin"));
+            ASSERT_TRUE(retrievedFile.open(QIODevice::ReadWrite));
+            retrievedFile.write("PRODUCT");
+        }
+
+        QString secondFolder = MakeJobFolder("second");
+        EXPECT_TRUE(m_cache->RetrieveJobResult("ff00", secondFolder));
+        EXPECT_EQ(ReadFile(QDir(secondFolder).absoluteFilePath("product.bin")), "product contents");
+    }
+} // namespace AssetProcessor
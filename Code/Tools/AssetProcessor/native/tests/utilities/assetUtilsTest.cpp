@@ -552,6 +552,30 @@ TEST_F(AssetUtilitiesTest, GetFileFingerprint_NonExistentFiles)
     EXPECT_STREQ(AssetUtilities::GetFileFingerprint(nonExistentFile1, "Name").c_str(), AssetUtilities::GetFileFingerprint(nonExistentFile1, "Name").c_str());
 }
 
+TEST_F(AssetUtilitiesTest, GetFileHashes_MultipleFiles_MatchesHashingEachFile)
+{
+    QTemporaryDir dir;
+    QDir tempPath(dir.path());
+
+    AZStd::vector<AZStd::string> filePaths;
+    for (int fileIndex = 0; fileIndex < 32; ++fileIndex)
+    {
+        QString absoluteTestFilePath = tempPath.absoluteFilePath(QString("file%1.txt").arg(fileIndex));
+        EXPECT_TRUE(UnitTestUtils::CreateDummyFile(absoluteTestFilePath, QString("contents%1").arg(fileIndex)));
+        filePaths.push_back(absoluteTestFilePath.toUtf8().constData());
+    }
+
+    // use fewer readers than files so that every reader hashes several of them.
+    AZStd::vector<AZ::u64> hashes = AssetUtilities::GetFileHashes(filePaths, 4);
+    ASSERT_EQ(hashes.size(), filePaths.size());
+    for (size_t fileIndex = 0; fileIndex < filePaths.size(); ++fileIndex)
+    {
+        EXPECT_NE(hashes[fileIndex], 0u);
+        EXPECT_EQ(hashes[fileIndex], AssetBuilderSDK::GetFileHash(filePaths[fileIndex].c_str()));
+    }
+    EXPECT_NE(hashes[0], hashes[1]);
+}
+
 TEST_F(AssetUtilitiesTest, CreateDirWithTimeout_Valid)
 {
     QTemporaryDir tempDir;
@@ -24,6 +24,7 @@
 #include <native/FileWatcher/FileWatcher.h>
 #include <native/utilities/ApplicationServer.h>
 #include <native/utilities/AssetServerHandler.h>
+#include <native/utilities/LocalProductCache.h>
 #include <native/utilities/assetUtils.h>
 #include <native/InternalBuilders/SettingsRegistryBuilder.h>
 #include <AzToolsFramework/Application/Ticker.h>
@@ -964,6 +965,7 @@ void ApplicationManagerBase::Destroy()
     DestroyConnectionManager();
     DestroyAssetServerHandler();
     DestroyRCController();
+    DestroyLocalProductCache();
     DestroyAssetScanner();
     ShutDownAssetDatabase();
     DestroyPlatformConfiguration();
@@ -1398,6 +1400,16 @@ void ApplicationManagerBase::DestroyAssetServerHandler()
     m_assetServerHandler = nullptr;
 }
 
+void ApplicationManagerBase::InitLocalProductCache()
+{
+    m_localProductCache = AZStd::make_unique<AssetProcessor::LocalProductCache>();
+}
+
+void ApplicationManagerBase::DestroyLocalProductCache()
+{
+    m_localProductCache.reset();
+}
+
 // IMPLEMENTATION OF -------------- AzToolsFramework::AssetDatabase::AssetDatabaseRequests::Bus::Listener
 bool ApplicationManagerBase::GetAssetDatabaseLocation(AZStd::string& location)
 {
@@ -1556,6 +1568,7 @@ bool ApplicationManagerBase::Activate()
     InitFileMonitor(AZStd::make_unique<FileWatcher>());
     InitAssetScanner();
     InitAssetServerHandler();
+    InitLocalProductCache();
     InitRCController();
 
     InitConnectionManager();
@@ -42,6 +42,7 @@ namespace AssetProcessor
     class FileStateBase;
     class FileStateCache;
     class InternalAssetBuilderInfo;
+    class LocalProductCache;
     class PlatformConfiguration;
     class RCController;
     class SettingsRegistryBuilder;
@@ -183,6 +184,8 @@ protected:
     void ShutDownAssetDatabase();
     void InitAssetServerHandler();
     void DestroyAssetServerHandler();
+    void InitLocalProductCache();
+    void DestroyLocalProductCache();
     void InitFileProcessor();
     void ShutDownFileProcessor();
     virtual void InitSourceControl() = 0;
@@ -238,6 +241,7 @@ protected:
 
     AZStd::unique_ptr<AssetProcessor::FileStateBase> m_fileStateCache;
     AZStd::unique_ptr<AssetProcessor::FileProcessor> m_fileProcessor;
+    AZStd::unique_ptr<AssetProcessor::LocalProductCache> m_localProductCache;
     AZStd::unique_ptr<AssetProcessor::BuilderConfigurationManager> m_builderConfig;
     AZStd::unique_ptr<AssetProcessor::UuidManager> m_uuidManager;
 
@@ -0,0 +1,337 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <native/utilities/LocalProductCache.h>
+#include <native/utilities/assetUtils.h>
+#include <native/assetprocessor.h>
+#include <AssetBuilderSDK/AssetBuilderSDK.h>
+#include <AzCore/JSON/document.h>
+#include <AzCore/Math/Uuid.h>
+#include <AzCore/Serialization/Json/JsonUtils.h>
+#include <AzCore/Settings/SettingsRegistry.h>
+#include <AzCore/Utils/Utils.h>
+#include <QDir>
+#include <QDirIterator>
+#include <QFile>
+#include <QFileInfo>
+
+#if defined(AZ_PLATFORM_LINUX)
+#include <fcntl.h>
+#include <unistd.h>
+#include <linux/fs.h>
+#include <sys/ioctl.h>
+#elif defined(AZ_PLATFORM_MAC)
+#include <sys/clonefile.h>
+#endif
+
+namespace AssetProcessor
+{
+    namespace LocalProductCacheInternal
+    {
+        constexpr const char* ObjectsFolder = "objects";
+        constexpr const char* JobsFolder = "jobs";
+        constexpr const char* FilesKey = "files";
+        constexpr const char* PathKey = "path";
+        constexpr const char* ObjectKey = "object";
+
+        // a unique name next to the destination, so that several jobs storing the same file at the same time don't write to the same file.
+        QString GetUniqueTempPath(const QString& destinationPath)
+        {
+            return QString("%1.%2.tmp").arg(destinationPath, AZ::Uuid::CreateRandom().ToFixedString(false, false).c_str());
+        }
+
+        // moves a file that was written under a temporary name into place.  Losing the race against another job
+        // that stored the same file is fine, as the contents are the same.
+        bool CommitFile(const QString& tempPath, const QString& destinationPath)
+        {
+            if (QFile::rename(tempPath, destinationPath))
+            {
+                return true;
+            }
+            QFile::remove(tempPath);
+            return QFile::exists(destinationPath);
+        }
+
+        // objects are named "<hash>-<size>", so the name is enough to check that an object still holds what was stored.
+        bool IsObjectIntact(const QString& objectPath, const QString& objectName)
+        {
+            const int separator = objectName.lastIndexOf('-');
+            bool validHash = false;
+            bool validSize = false;
+            const AZ::u64 expectedHash = objectName.left(separator).toULongLong(&validHash, 16);
+            const qint64 expectedSize = objectName.mid(separator + 1).toLongLong(&validSize);
+            if (separator < 0 || !validHash || !validSize)
+            {
+                return false;
+            }
+
+            // the size is checked first, as it's free and catches most truncated or rewritten files.
+            return QFileInfo(objectPath).size() == expectedSize && AssetBuilderSDK::GetFileHash(objectPath.toUtf8().constData()) == expectedHash;
+        }
+
+        void RemoveObject(const QString& objectPath)
+        {
+            QFile::setPermissions(objectPath, QFile::permissions(objectPath) | QFileDevice::WriteOwner);
+            QFile::remove(objectPath);
+        }
+    } // namespace LocalProductCacheInternal
+
+    LocalProductCache::LocalProductCache()
+    {
+        auto settingsRegistry = AZ::SettingsRegistry::Get();
+        if (!settingsRegistry)
+        {
+            return;
+        }
+
+        const AZ::SettingsRegistryInterface::FixedValueString settingsKey(LocalProductCacheSettingsKey);
+        bool enabled = false;
+        settingsRegistry->Get(enabled, settingsKey + "/Enabled");
+        if (!enabled)
+        {
+            return;
+        }
+
+        if (!AssetUtilities::ShouldUseFileHashing())
+        {
+            AZ_Warning(AssetProcessor::ConsoleChannel, false,
+                "The local product cache is enabled but file hashing is disabled.  The cache needs file hashes to identify the inputs of jobs "
+                "and will not be used.\n");
+            return;
+        }
+
+        AZStd::string cacheFolder;
+        if (!settingsRegistry->Get(cacheFolder, settingsKey + "/Folder") || cacheFolder.empty())
+        {
+            cacheFolder = (AZ::IO::Path(AZ::Utils::GetProjectUserPath(settingsRegistry).c_str()) / "AssetProcessor" / "ProductCache").Native();
+        }
+
+        m_cacheFolder = AssetUtilities::NormalizeDirectoryPath(QString::fromUtf8(cacheFolder.c_str(), aznumeric_cast<int>(cacheFolder.size())));
+        m_enabled = QDir().mkpath(m_cacheFolder);
+        AZ_Warning(AssetProcessor::ConsoleChannel, m_enabled, "Unable to create the local product cache folder %s.\n", m_cacheFolder.toUtf8().constData());
+        AZ_TracePrintf(AssetProcessor::DebugChannel, "Local product cache: %s\n", m_cacheFolder.toUtf8().constData());
+    }
+
+    LocalProductCache::LocalProductCache(const QString& cacheFolder)
+        : m_cacheFolder(AssetUtilities::NormalizeDirectoryPath(cacheFolder))
+    {
+        m_enabled = QDir().mkpath(m_cacheFolder);
+    }
+
+    bool LocalProductCache::IsEnabled() const
+    {
+        return m_enabled;
+    }
+
+    QString LocalProductCache::GetManifestPath(AZStd::string_view cacheKey) const
+    {
+        // spread the entries over subfolders, as some file systems get slow with very large folders.
+        QString key = QString::fromUtf8(cacheKey.data(), aznumeric_cast<int>(cacheKey.size()));
+        return QString("%1/%2/%3/%4.json").arg(m_cacheFolder, LocalProductCacheInternal::JobsFolder, key.left(2), key);
+    }
+
+    QString LocalProductCache::GetObjectPath(const QString& objectName) const
+    {
+        return QString("%1/%2/%3/%4").arg(m_cacheFolder, LocalProductCacheInternal::ObjectsFolder, objectName.left(2), objectName);
+    }
+
+    bool LocalProductCache::RetrieveJobResult(AZStd::string_view cacheKey, const QString& tempFolder)
+    {
+        using namespace LocalProductCacheInternal;
+
+        if (!m_enabled || cacheKey.empty())
+        {
+            return false;
+        }
+
+        QString manifestPath = GetManifestPath(cacheKey);
+        if (!QFile::exists(manifestPath))
+        {
+            return false;
+        }
+
+        auto readResult = AZ::JsonSerializationUtils::ReadJsonFile(manifestPath.toUtf8().constData());
+        if (!readResult.IsSuccess())
+        {
+            AZ_Warning(AssetProcessor::DebugChannel, false, "Unable to read local product cache entry %s: %s\n",
+                manifestPath.toUtf8().constData(), readResult.GetError().c_str());
+            return false;
+        }
+
+        const rapidjson::Document& manifest = readResult.GetValue();
+        auto filesMember = manifest.IsObject() ? manifest.FindMember(FilesKey) : manifest.MemberEnd();
+        if (filesMember == manifest.MemberEnd() || !filesMember->value.IsArray())
+        {
+            AZ_Warning(AssetProcessor::DebugChannel, false, "Local product cache entry %s is damaged.\n", manifestPath.toUtf8().constData());
+            return false;
+        }
+
+        // check the entire entry before placing any files, so a damaged entry or one with missing objects leaves the temp folder untouched.
+        QDir tempDir(tempFolder);
+        QList<QPair<QString, QString>> filesToPlace; // object path, destination path
+        for (const rapidjson::Value& file : filesMember->value.GetArray())
+        {
+            auto pathMember = file.IsObject() ? file.FindMember(PathKey) : file.MemberEnd();
+            auto objectMember = file.IsObject() ? file.FindMember(ObjectKey) : file.MemberEnd();
+            if (pathMember == file.MemberEnd() || objectMember == file.MemberEnd() || !pathMember->value.IsString() || !objectMember->value.IsString())
+            {
+                AZ_Warning(AssetProcessor::DebugChannel, false, "Local product cache entry %s is damaged.\n", manifestPath.toUtf8().constData());
+                return false;
+            }
+
+            QString relativePath = QDir::cleanPath(QString::fromUtf8(pathMember->value.GetString(), aznumeric_cast<int>(pathMember->value.GetStringLength())));
+            if (!QDir::isRelativePath(relativePath) || relativePath.startsWith(".."))
+            {
+                AZ_Warning(AssetProcessor::DebugChannel, false, "Local product cache entry %s contains a file outside of the job folder (%s).\n",
+                    manifestPath.toUtf8().constData(), relativePath.toUtf8().constData());
+                return false;
+            }
+
+            QString objectName = QString::fromUtf8(objectMember->value.GetString(), aznumeric_cast<int>(objectMember->value.GetStringLength()));
+            QString objectPath = GetObjectPath(objectName);
+            if (!QFile::exists(objectPath))
+            {
+                AZ_TracePrintf(AssetProcessor::DebugChannel, "Local product cache entry %s is missing %s.\n",
+                    manifestPath.toUtf8().constData(), objectPath.toUtf8().constData());
+                return false;
+            }
+
+            if (!IsObjectIntact(objectPath, objectName))
+            {
+                // remove the damaged object so the next successful run of any job that outputs this file stores it again.
+                AZ_Warning(AssetProcessor::ConsoleChannel, false, "Local product cache object %s doesn't match its contents and is removed.\n",
+                    objectPath.toUtf8().constData());
+                RemoveObject(objectPath);
+                return false;
+            }
+
+            filesToPlace.append({ objectPath, tempDir.absoluteFilePath(relativePath) });
+        }
+
+        QStringList placedFiles;
+        for (const auto& [objectPath, destinationPath] : filesToPlace)
+        {
+            if (!QDir().mkpath(QFileInfo(destinationPath).absolutePath()) || !PlaceFile(objectPath, destinationPath))
+            {
+                AZ_Warning(AssetProcessor::DebugChannel, false, "Unable to retrieve %s from the local product cache.\n", destinationPath.toUtf8().constData());
+                for (const QString& placedFile : placedFiles)
+                {
+                    QFile::remove(placedFile);
+                }
+                return false;
+            }
+            placedFiles.append(destinationPath);
+        }
+
+        return true;
+    }
+
+    bool LocalProductCache::StoreJobResult(AZStd::string_view cacheKey, const QString& tempFolder)
+    {
+        using namespace LocalProductCacheInternal;
+
+        if (!m_enabled || cacheKey.empty())
+        {
+            return false;
+        }
+
+        rapidjson::Document manifest(rapidjson::kObjectType);
+        rapidjson::Document::AllocatorType& allocator = manifest.GetAllocator();
+        rapidjson::Value files(rapidjson::kArrayType);
+
+        QDir tempDir(tempFolder);
+        QDirIterator fileIterator(tempFolder, QDir::Files | QDir::Hidden | QDir::NoDotAndDotDot, QDirIterator::Subdirectories);
+        while (fileIterator.hasNext())
+        {
+            QString filePath = fileIterator.next();
+
+            // objects are named after their contents, so a file that's already stored, by this or any other job, is not stored again.
+            AZ::u64 hash = AssetBuilderSDK::GetFileHash(filePath.toUtf8().constData());
+            QString objectName = QString("%1-%2").arg(hash, 16, 16, QChar('0')).arg(fileIterator.fileInfo().size());
+            QString objectPath = GetObjectPath(objectName);
+            if (!QFile::exists(objectPath))
+            {
+                QString objectTempPath = GetUniqueTempPath(objectPath);
+                if (!QDir().mkpath(QFileInfo(objectPath).absolutePath()) || !PlaceFile(filePath, objectTempPath) || !CommitFile(objectTempPath, objectPath))
+                {
+                    AZ_Warning(AssetProcessor::DebugChannel, false, "Unable to store %s in the local product cache.\n", filePath.toUtf8().constData());
+                    return false;
+                }
+                // objects are never written again once stored, so anything trying to change one in place fails instead of damaging the cache.
+                QFile::setPermissions(objectPath, QFileDevice::ReadOwner | QFileDevice::ReadUser | QFileDevice::ReadGroup | QFileDevice::ReadOther);
+            }
+
+            QByteArray relativePath = tempDir.relativeFilePath(filePath).toUtf8();
+            QByteArray objectNameUtf8 = objectName.toUtf8();
+            rapidjson::Value file(rapidjson::kObjectType);
+            rapidjson::Value pathValue(relativePath.constData(), aznumeric_cast<rapidjson::SizeType>(relativePath.size()), allocator);
+            rapidjson::Value objectValue(objectNameUtf8.constData(), aznumeric_cast<rapidjson::SizeType>(objectNameUtf8.size()), allocator);
+            file.AddMember(rapidjson::StringRef(PathKey), pathValue, allocator);
+            file.AddMember(rapidjson::StringRef(ObjectKey), objectValue, allocator);
+            files.PushBack(file, allocator);
+        }
+        manifest.AddMember(rapidjson::StringRef(FilesKey), files, allocator);
+
+        // the manifest is written last, so an entry is only found once all its objects are stored.
+        QString manifestPath = GetManifestPath(cacheKey);
+        QString manifestTempPath = GetUniqueTempPath(manifestPath);
+        if (!QDir().mkpath(QFileInfo(manifestPath).absolutePath()) ||
+            !AZ::JsonSerializationUtils::WriteJsonFile(manifest, manifestTempPath.toUtf8().constData()).IsSuccess() ||
+            !CommitFile(manifestTempPath, manifestPath))
+        {
+            AZ_Warning(AssetProcessor::DebugChannel, false, "Unable to write local product cache entry %s.\n", manifestPath.toUtf8().constData());
+            return false;
+        }
+
+        return true;
+    }
+
+    bool LocalProductCache::PlaceFile(const QString& sourcePath, const QString& destinationPath)
+    {
+        // files are never hard linked. A link shares the inode, so a product that's rewritten in place in the Cache folder would change
+        // the object and every later job that uses it.
+#if defined(AZ_PLATFORM_LINUX)
+        // a copy-on-write clone (btrfs, xfs) doesn't share anything that can be changed later, so try that first.
+        QByteArray encodedSourcePath = QFile::encodeName(sourcePath);
+        QByteArray encodedDestinationPath = QFile::encodeName(destinationPath);
+        int sourceFile = ::open(encodedSourcePath.constData(), O_RDONLY | O_CLOEXEC);
+        if (sourceFile >= 0)
+        {
+            int destinationFile = ::open(encodedDestinationPath.constData(), O_WRONLY | O_CREAT | O_EXCL | O_CLOEXEC, 0644);
+            if (destinationFile >= 0)
+            {
+                const bool cloned = ::ioctl(destinationFile, FICLONE, sourceFile) == 0;
+                ::close(destinationFile);
+                if (cloned)
+                {
+                    ::close(sourceFile);
+                    return true;
+                }
+                ::unlink(encodedDestinationPath.constData());
+            }
+            ::close(sourceFile);
+        }
+#elif defined(AZ_PLATFORM_MAC)
+        // APFS clones are copy-on-write as well.
+        if (::clonefile(QFile::encodeName(sourcePath).constData(), QFile::encodeName(destinationPath).constData(), CLONE_NOOWNERCOPY) == 0)
+        {
+            QFile::setPermissions(destinationPath, QFile::permissions(destinationPath) | QFileDevice::WriteOwner | QFileDevice::WriteUser);
+            return true;
+        }
+#endif
+
+        // file systems without clones.  Copies keep the permissions of the source, and objects are read-only, so make the copy writable
+        // again as products are replaced and removed later.
+        if (!QFile::copy(sourcePath, destinationPath))
+        {
+            return false;
+        }
+        QFile::setPermissions(destinationPath, QFile::permissions(destinationPath) | QFileDevice::WriteOwner | QFileDevice::WriteUser);
+        return true;
+    }
+} // namespace AssetProcessor
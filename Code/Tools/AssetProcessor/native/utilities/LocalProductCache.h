@@ -0,0 +1,79 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Interface/Interface.h>
+#include <AzCore/RTTI/RTTI.h>
+#include <AzCore/std/string/string.h>
+#include <AzCore/std/string/string_view.h>
+#include <QString>
+
+namespace AssetProcessor
+{
+    //! Settings for the local product cache, under the asset processor settings.
+    //!   Enabled - true to store and reuse job outputs, false by default.
+    //!   Folder  - where the cache is stored, defaults to AssetProcessor/ProductCache in the project user folder so it survives
+    //!             deleting the Cache folder.
+    inline constexpr const char* LocalProductCacheSettingsKey{ "/Amazon/AssetProcessor/Settings/LocalProductCache" };
+
+    //! Stores the outputs of jobs on the local machine so that running a job again with the same inputs, for instance after switching
+    //! branches or deleting the Cache folder, can reuse the outputs instead of running the builder.
+    class ILocalProductCache
+    {
+    public:
+        AZ_RTTI(ILocalProductCache, "{6B0C2A53-7F0E-4E07-9A8C-2E51D3F7A1C4}");
+
+        virtual ~ILocalProductCache() = default;
+
+        //! Returns true if jobs should be looked up in, and stored to, the cache.
+        virtual bool IsEnabled() const = 0;
+
+        //! Places the files that were stored for the cache key in the temp folder of a job, exactly as the builder left them.
+        //! Returns false, without changing the temp folder, if there's nothing stored for the key.
+        virtual bool RetrieveJobResult(AZStd::string_view cacheKey, const QString& tempFolder) = 0;
+
+        //! Stores all the files in the temp folder of a job under the cache key.
+        virtual bool StoreJobResult(AZStd::string_view cacheKey, const QString& tempFolder) = 0;
+    };
+
+    //! Content addressed implementation of the local product cache.
+    //! Every file is stored once under a name derived from its contents in the objects folder, so identical products of different
+    //! jobs, or of the same job on different branches, share storage. A small manifest per cache key in the jobs folder lists which
+    //! objects make up the outputs of that job.
+    //! Files are placed with a copy-on-write clone where the file system supports it and copied otherwise, never hard linked, so
+    //! changing a product can't change the object it came from. Objects are read-only and are checked against their name, which holds
+    //! their hash and size, before they're used.
+    class LocalProductCache
+        : public AZ::Interface<ILocalProductCache>::Registrar
+    {
+    public:
+        //! Reads the settings. The cache stays disabled if it isn't enabled in the settings or if file hashing is disabled,
+        //! as the cache keys are only content based when files are hashed.
+        LocalProductCache();
+        //! Uses the given folder, which is mostly useful for tests.
+        explicit LocalProductCache(const QString& cacheFolder);
+        ~LocalProductCache() override = default;
+
+        // ILocalProductCache overrides
+        bool IsEnabled() const override;
+        bool RetrieveJobResult(AZStd::string_view cacheKey, const QString& tempFolder) override;
+        bool StoreJobResult(AZStd::string_view cacheKey, const QString& tempFolder) override;
+
+    protected:
+        QString GetManifestPath(AZStd::string_view cacheKey) const;
+        QString GetObjectPath(const QString& objectName) const;
+
+        //! Places a writable copy of the source file at the destination, using a copy-on-write clone where possible.
+        static bool PlaceFile(const QString& sourcePath, const QString& destinationPath);
+
+    private:
+        QString m_cacheFolder;
+        bool m_enabled = false;
+    };
+} // namespace AssetProcessor
@@ -359,6 +359,8 @@ namespace AssetProcessor
             PrintStat("WarmingFileCache", cacheWarmTime.m_cumulativeTime, cacheWarmTime.m_operationCount);
             StatsEntry& assessTime = m_stats["InitialFileAssessment"];
             PrintStat("InitialFileAssessment", assessTime.m_cumulativeTime, assessTime.m_operationCount);
+            StatsEntry& hashModifiedTime = m_stats["HashingModifiedFiles"];
+            PrintStat("HashingModifiedFiles", hashModifiedTime.m_cumulativeTime, hashModifiedTime.m_operationCount);
 
             StatsEntry& totalHashTime = m_stats["HashFileTotal"];
             PrintStat("HashFileTotal", totalHashTime.m_cumulativeTime, totalHashTime.m_operationCount);
@@ -10,6 +10,8 @@
 #include <AzCore/Component/ComponentApplication.h>
 #include <AzCore/Math/Sha1.h>
 #include <AzCore/Settings/SettingsRegistry.h>
+#include <AzCore/std/parallel/thread.h>
+#include <AzCore/std/sort.h>
 
 #include <native/assetprocessor.h>
 #include <native/utilities/PlatformConfiguration.h>
@@ -1104,22 +1106,9 @@ namespace AssetUtilities
     template bool SetUserSetting<AZStd::string>(const char* settingName, AZStd::string value);
     template AZStd::string GetUserSetting<AZStd::string>(const char* settingName, AZStd::string defaultValue);
 
-    unsigned int GenerateFingerprint(const AssetProcessor::JobDetails& jobDetail)
+    // appends the fingerprints of all the files and jobs that the job depends on, separated by colons.
+    static void AppendInputFingerprints(const AssetProcessor::JobDetails& jobDetail, AZStd::string& fingerprintString)
     {
-        // it is assumed that m_fingerprintFilesList contains the original file and all dependencies, and is in a stable order without duplicates
-        // CRC32 is not an effective hash for this purpose, so we will build a string and then use SHA1 on it.
-
-        // to avoid resizing and copying repeatedly we will keep track of the largest reserved capacity ever needed for this function, and reserve that much data
-        static size_t s_largestFingerprintCapacitySoFar = 1;
-        AZStd::string fingerprintString;
-        fingerprintString.reserve(s_largestFingerprintCapacitySoFar);
-
-        // in general, we'll build a string which is:
-        // (version):[Array of individual file fingerprints][Array of individual job fingerprints]
-        // with each element of the arrays seperated by colons.
-
-        fingerprintString.append(jobDetail.m_extraInformationForFingerprinting);
-
         for (const auto& fingerprintFile : jobDetail.m_fingerprintFiles)
         {
             fingerprintString.append(":");
@@ -1147,6 +1136,24 @@ namespace AssetUtilities
                 }
             }
         }
+    }
+
+    unsigned int GenerateFingerprint(const AssetProcessor::JobDetails& jobDetail)
+    {
+        // it is assumed that m_fingerprintFilesList contains the original file and all dependencies, and is in a stable order without duplicates
+        // CRC32 is not an effective hash for this purpose, so we will build a string and then use SHA1 on it.
+
+        // to avoid resizing and copying repeatedly we will keep track of the largest reserved capacity ever needed for this function, and reserve that much data
+        static size_t s_largestFingerprintCapacitySoFar = 1;
+        AZStd::string fingerprintString;
+        fingerprintString.reserve(s_largestFingerprintCapacitySoFar);
+
+        // in general, we'll build a string which is:
+        // (version):[Array of individual file fingerprints][Array of individual job fingerprints]
+        // with each element of the arrays seperated by colons.
+
+        fingerprintString.append(jobDetail.m_extraInformationForFingerprinting);
+        AppendInputFingerprints(jobDetail, fingerprintString);
         s_largestFingerprintCapacitySoFar = AZStd::GetMax(fingerprintString.capacity(), s_largestFingerprintCapacitySoFar);
 
         if (fingerprintString.empty())
@@ -1163,6 +1170,42 @@ namespace AssetUtilities
         return digest[0]; // we only currently use 32-bit hashes.  This could be extended if collisions still occur.
     }
 
+    AZStd::string GenerateProductCacheKey(const AssetProcessor::JobDetails& jobDetail)
+    {
+        // unlike the fingerprint, which only has to change when the inputs of a job change, this key has to identify the outputs of the job
+        // on its own, so it also includes which job this is.
+        AZStd::string keyString = AZStd::string::format("%s:%s:%s:%s:%s:%s:%s",
+            jobDetail.m_assetBuilderDesc.m_busId.ToFixedString().c_str(),
+            jobDetail.m_assetBuilderDesc.m_analysisFingerprint.c_str(),
+            jobDetail.m_jobEntry.m_jobKey.toUtf8().constData(),
+            jobDetail.m_jobEntry.m_platformInfo.m_identifier.c_str(),
+            jobDetail.m_jobEntry.m_sourceAssetReference.RelativePath().c_str(),
+            jobDetail.m_sourceUuid.ToFixedString().c_str(),
+            jobDetail.m_extraInformationForFingerprinting.c_str());
+
+        // the job parameters are in an unordered map, so sort them to get a stable key.
+        AZStd::vector<AZ::u32> parameterKeys;
+        parameterKeys.reserve(jobDetail.m_jobParam.size());
+        for (const auto& parameter : jobDetail.m_jobParam)
+        {
+            parameterKeys.push_back(parameter.first);
+        }
+        AZStd::sort(parameterKeys.begin(), parameterKeys.end());
+        for (AZ::u32 parameterKey : parameterKeys)
+        {
+            keyString.append(AZStd::string::format(":%u=%s", parameterKey, jobDetail.m_jobParam.at(parameterKey).c_str()));
+        }
+
+        AppendInputFingerprints(jobDetail, keyString);
+
+        AZ::Sha1 sha;
+        sha.ProcessBytes(AZStd::as_bytes(AZStd::span(keyString)));
+        AZ::u32 digest[5];
+        sha.GetDigest(digest);
+
+        return AZStd::string::format("%08x%08x%08x%08x%08x", digest[0], digest[1], digest[2], digest[3], digest[4]);
+    }
+
     std::uint64_t AdjustTimestamp(QDateTime timestamp, int overridePrecision)
     {
         if (timestamp.isDaylightTime())
@@ -1215,6 +1258,60 @@ namespace AssetUtilities
         return hash;
     }
 
+    AZStd::vector<AZ::u64> GetFileHashes(const AZStd::vector<AZStd::string>& filePaths, AZ::u32 maxConcurrentReads)
+    {
+        AZStd::vector<AZ::u64> hashes(filePaths.size(), 0);
+        if (filePaths.empty() || !ShouldUseFileHashing())
+        {
+            return hashes;
+        }
+
+        if (maxConcurrentReads == 0)
+        {
+            maxConcurrentReads = GetMaxConcurrentFileReads();
+        }
+        const size_t workerCount = AZStd::min(filePaths.size(), aznumeric_cast<size_t>(maxConcurrentReads));
+
+        // Every worker pulls the next file from a shared index, so the number of workers is the number of files being read at the same time
+        // and a few large files don't hold up the rest of the batch.
+        AZStd::atomic<size_t> nextFile{ 0 };
+        auto hashFiles = [&filePaths, &hashes, &nextFile]()
+        {
+            for (size_t index = nextFile++; index < filePaths.size(); index = nextFile++)
+            {
+                hashes[index] = AssetBuilderSDK::GetFileHash(filePaths[index].c_str());
+            }
+        };
+
+        // The calling thread is one of the workers.
+        AZStd::vector<AZStd::thread> workers;
+        workers.reserve(workerCount - 1);
+        AZStd::thread_desc desc;
+        desc.m_name = "AssetProcessor File Hashing";
+        for (size_t worker = 1; worker < workerCount; ++worker)
+        {
+            workers.emplace_back(desc, hashFiles);
+        }
+        hashFiles();
+        for (AZStd::thread& worker : workers)
+        {
+            worker.join();
+        }
+
+        return hashes;
+    }
+
+    AZ::u32 GetMaxConcurrentFileReads()
+    {
+        AZ::u64 maxConcurrentReads = AZStd::thread::hardware_concurrency();
+        if (auto settingsRegistry = AZ::SettingsRegistry::Get())
+        {
+            settingsRegistry->Get(maxConcurrentReads, AZ::SettingsRegistryInterface::FixedValueString(AssetProcessor::AssetProcessorSettingsKey)
+                + "/Fingerprinting/MaxConcurrentFileReads");
+        }
+        return aznumeric_cast<AZ::u32>(AZStd::clamp<AZ::u64>(maxConcurrentReads, 1, 256));
+    }
+
     AZ::u64 AdjustTimestamp(QDateTime timestamp)
     {
         timestamp = timestamp.toUTC();
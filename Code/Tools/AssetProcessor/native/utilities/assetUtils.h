@@ -25,6 +25,7 @@
 #include <AssetManager/SourceAssetReference.h>
 #include <AzCore/EBus/Event.h>
 #include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/containers/vector.h>
 
 namespace AzToolsFramework
 {
@@ -273,11 +274,26 @@ namespace AssetUtilities
     //! interrogate a given file, which is specified as a full path name, and generate a fingerprint for it.
     unsigned int GenerateFingerprint(const AssetProcessor::JobDetails& jobDetail);
 
+    //! Generates a key that identifies the outputs of a job from everything that goes into it: the builder and its version,
+    //! the job and its parameters, and the contents of the source files and jobs it depends on.
+    //! This is used to find the outputs of the job in the local product cache, and is only content based if file hashing is enabled.
+    AZStd::string GenerateProductCacheKey(const AssetProcessor::JobDetails& jobDetail);
+
     //! Returns a hash of the contents of the specified file
     // hashMsDelay is only for automated tests to test that writing to a file while it's hashing does not cause a crash.
     // hashMsDelay is not used in non-unit test builds.
     AZ::u64 GetFileHash(const char* filePath, bool force = false, AZ::IO::SizeType* bytesReadOut = nullptr, int hashMsDelay = 0);
 
+    //! Returns a hash of the contents of each of the specified files, in the same order as the paths.
+    //! The files are hashed in parallel, with at most maxConcurrentReads files being read at the same time (0 uses GetMaxConcurrentFileReads).
+    //! Unlike GetFileHash this always reads the files: it doesn't go through the file state cache, which hashes while holding its lock,
+    //! and it doesn't capture per file stats, as those can only be captured from one thread. Returns 0 for every file if hashing is disabled.
+    AZStd::vector<AZ::u64> GetFileHashes(const AZStd::vector<AZStd::string>& filePaths, AZ::u32 maxConcurrentReads = 0);
+
+    //! Returns the maximum number of files that are read at the same time when scanning and hashing files in parallel.
+    //! Defaults to the number of hardware threads and can be changed with the Fingerprinting/MaxConcurrentFileReads setting.
+    AZ::u32 GetMaxConcurrentFileReads();
+
     //! Adjusts a timestamp to fix timezone settings and account for any precision adjustment needed
     AZ::u64 AdjustTimestamp(QDateTime timestamp);
 
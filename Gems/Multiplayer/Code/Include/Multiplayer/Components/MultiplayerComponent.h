@@ -11,7 +11,9 @@
 #include <AzCore/Component/Component.h>
 #include <AzNetworking/Serialization/ISerializer.h>
 #include <AzNetworking/DataStructures/FixedSizeBitsetView.h>
+#include <AzNetworking/Utilities/QuantizedBits.h>
 #include <Multiplayer/NetworkEntity/NetworkEntityHandle.h>
+#include <Multiplayer/NetworkTime/RewindableObject.h>
 #include <Multiplayer/MultiplayerStats.h>
 #include <Multiplayer/MultiplayerTypes.h>
 #include <Multiplayer/IMultiplayer.h>
@@ -134,14 +136,26 @@ namespace Multiplayer
         }
     }
 
-    template <typename TYPE>
-    inline void SerializeNetworkPropertyHelper
+    template <typename TYPE, typename SERIALIZE_FUNCTOR>
+    inline bool SerializeNetworkPropertyValue(AzNetworking::ISerializer& serializer, TYPE& value, const SERIALIZE_FUNCTOR& serializeFunctor)
+    {
+        return serializeFunctor(serializer, value);
+    }
+
+    template <typename TYPE, AZStd::size_t REWIND_SIZE, typename SERIALIZE_FUNCTOR>
+    inline bool SerializeNetworkPropertyValue(AzNetworking::ISerializer& serializer, RewindableObject<TYPE, REWIND_SIZE>& value, const SERIALIZE_FUNCTOR& serializeFunctor)
+    {
+        return value.Serialize(serializer, serializeFunctor);
+    }
+
+    template <typename TYPE, typename SERIALIZE_FUNCTOR>
+    inline void SerializeNetworkPropertyHelperCustom
     (
         AzNetworking::ISerializer& serializer,
         AzNetworking::FixedSizeBitsetView& bitset,
         int32_t bitIndex,
         TYPE& value,
-        const char* name,
+        const SERIALIZE_FUNCTOR& serializeFunctor,
         NetComponentId componentId,
         PropertyIndex propertyIndex,
         MultiplayerStats& stats
@@ -152,10 +166,11 @@ namespace Multiplayer
             const bool modifyRecord = serializer.GetSerializerMode() == AzNetworking::SerializerMode::WriteToObject;
             const uint32_t prevUpdateSize = serializer.GetSize();
             serializer.ClearTrackedChangesFlag();
-            serializer.Serialize(value, name);
+            SerializeNetworkPropertyValue(serializer, value, serializeFunctor);
             if (modifyRecord && !serializer.GetTrackedChangesFlag())
             {
-                // If the serializer didn't change any values, then lower the flag so we don't unnecessarily notify
+                // If the serializer didn't change any values, then lower the flag so we don't unnecessarily notify.
+                // Quantized encodings compare against the re-quantized local value, so changes smaller than a quantization step don't notify
                 bitset.SetBit(bitIndex, false);
             }
             const uint32_t postUpdateSize = serializer.GetSize();
@@ -163,6 +178,65 @@ namespace Multiplayer
         }
     }
 
+    template <typename TYPE>
+    inline void SerializeNetworkPropertyHelper
+    (
+        AzNetworking::ISerializer& serializer,
+        AzNetworking::FixedSizeBitsetView& bitset,
+        int32_t bitIndex,
+        TYPE& value,
+        const char* name,
+        NetComponentId componentId,
+        PropertyIndex propertyIndex,
+        MultiplayerStats& stats
+    )
+    {
+        SerializeNetworkPropertyHelperCustom(serializer, bitset, bitIndex, value, [name](AzNetworking::ISerializer& valueSerializer, auto& element)
+        {
+            return valueSerializer.Serialize(element, name);
+        }, componentId, propertyIndex, stats);
+    }
+
+    template <uint32_t BITS, typename TYPE>
+    inline void SerializeQuantizedNetworkPropertyHelper
+    (
+        AzNetworking::ISerializer& serializer,
+        AzNetworking::FixedSizeBitsetView& bitset,
+        int32_t bitIndex,
+        TYPE& value,
+        float minValue,
+        float maxValue,
+        const char* name,
+        NetComponentId componentId,
+        PropertyIndex propertyIndex,
+        MultiplayerStats& stats
+    )
+    {
+        SerializeNetworkPropertyHelperCustom(serializer, bitset, bitIndex, value, [minValue, maxValue, name](AzNetworking::ISerializer& valueSerializer, auto& element)
+        {
+            return AzNetworking::SerializeQuantizedRange<BITS>(valueSerializer, element, minValue, maxValue, name);
+        }, componentId, propertyIndex, stats);
+    }
+
+    template <uint32_t BITS, typename TYPE>
+    inline void SerializeSmallestThreeNetworkPropertyHelper
+    (
+        AzNetworking::ISerializer& serializer,
+        AzNetworking::FixedSizeBitsetView& bitset,
+        int32_t bitIndex,
+        TYPE& value,
+        const char* name,
+        NetComponentId componentId,
+        PropertyIndex propertyIndex,
+        MultiplayerStats& stats
+    )
+    {
+        SerializeNetworkPropertyHelperCustom(serializer, bitset, bitIndex, value, [name](AzNetworking::ISerializer& valueSerializer, AZ::Quaternion& element)
+        {
+            return AzNetworking::SerializeSmallestThree<BITS>(valueSerializer, element, name);
+        }, componentId, propertyIndex, stats);
+    }
+
     template <typename TYPE, AZStd::size_t SIZE>
     inline void SerializeNetworkPropertyHelperArray
     (
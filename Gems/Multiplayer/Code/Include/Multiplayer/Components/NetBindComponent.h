@@ -18,6 +18,7 @@
 #include <AzNetworking/Serialization/ISerializer.h>
 #include <AzNetworking/ConnectionLayer/IConnection.h>
 #include <Multiplayer/NetworkEntity/EntityReplication/ReplicationRecord.h>
+#include <Multiplayer/NetworkEntity/EntityReplication/StateDeltaCache.h>
 #include <Multiplayer/NetworkEntity/NetworkEntityHandle.h>
 #include <Multiplayer/NetworkInput/IMultiplayerComponentInput.h>
 #include <Multiplayer/NetworkTime/INetworkTime.h>
@@ -201,6 +202,10 @@ namespace Multiplayer
         void FillReplicationRecord(ReplicationRecord& replicationRecord) const;
         void FillTotalReplicationRecord(ReplicationRecord& replicationRecord) const;
 
+        //! Returns the cache of state deltas serialized for this entity since it was last dirtied, shared by all connections.
+        //! @return the state delta cache for this entity
+        StateDeltaCache& GetStateDeltaCache();
+
     private:
         void PreInit(AZ::Entity* entity, const PrefabEntityId& prefabEntityId, NetEntityId netEntityId, NetEntityRole netEntityRole);
 
@@ -230,6 +235,7 @@ namespace Multiplayer
         ReplicationRecord m_totalRecord = NetEntityRole::InvalidRole;
         ReplicationRecord m_predictableRecord = NetEntityRole::Autonomous;
         ReplicationRecord m_localNotificationRecord = NetEntityRole::InvalidRole;
+        StateDeltaCache   m_stateDeltaCache;
         PrefabEntityId    m_prefabEntityId;
         AZ::Data::AssetId m_prefabAssetId;
         // It is important that this component map be ordered, as we walk it to generate serialization ordering
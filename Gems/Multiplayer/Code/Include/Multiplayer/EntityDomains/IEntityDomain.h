@@ -19,6 +19,10 @@ namespace Multiplayer
     public:
         virtual ~IEntityDomain() = default;
 
+        //! Invoked when this domain becomes the domain of the local network entity manager. Domains that are only used to
+        //! describe a remote host, see EntityReplicationManager::SetRemoteEntityDomain, are never activated.
+        virtual void ActivateTracking() = 0;
+
         //! For domains that operate on a region of space, this sets the area the domain is responsible for.
         //! @param aabb the aabb associated with this entity domain
         virtual void SetAabb(const AZ::Aabb& aabb) = 0;
@@ -0,0 +1,91 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <Multiplayer/EntityDomains/IEntityDomain.h>
+#include <AzCore/EBus/ScheduledEvent.h>
+#include <AzCore/Math/Aabb.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+
+namespace Multiplayer
+{
+    //! An entity domain that owns one cell of a grid that splits the world between servers.
+    //! Entities are owned based on their world position. To keep entities that move along the edge of a cell from bouncing
+    //! between servers, the domain keeps owning entities until they are further than the hysteresis distance outside of the cell along x or y.
+    //! Authoritative entities that left the domain are collected on a timer and handed to the network entity manager in batches,
+    //! which migrates them to the server whose domain contains them.
+    //! To use it, pass the domain for the cell of this server to INetworkEntityManager::Initialize before calling
+    //! IMultiplayer::InitializeMultiplayer, otherwise the server falls back to a FullOwnershipEntityDomain.
+    class SpatialGridEntityDomain
+        : public IEntityDomain
+    {
+    public:
+        //! @param aabb       the area of the grid cell this domain is responsible for
+        //! @param hysteresis distance an entity has to move outside of the cell before it leaves the domain
+        SpatialGridEntityDomain(const AZ::Aabb& aabb, float hysteresis);
+        //! Uses the sv_EntityDomainHysteresis cvar for the hysteresis distance.
+        explicit SpatialGridEntityDomain(const AZ::Aabb& aabb);
+
+        //! Returns the area of one cell of a grid that splits the world into columns along x and rows along y.
+        //! The cells cover the full height of the world aabb and are numbered row by row.
+        //! @param worldAabb the area of the world covered by the grid
+        //! @param columns   the number of cells along x
+        //! @param rows      the number of cells along y
+        //! @param cellIndex the index of the cell, in the range [0, columns * rows)
+        //! @return the area of the cell, a null aabb if the cell index is out of range
+        static AZ::Aabb GetGridCellAabb(const AZ::Aabb& worldAabb, uint32_t columns, uint32_t rows, uint32_t cellIndex);
+
+        //! Returns whether or not a world position is owned by this domain, including the hysteresis band around the cell.
+        //! @param position the world position to check
+        //! @return true if the position is inside the cell or within the hysteresis distance of it
+        bool IsPositionInDomain(const AZ::Vector3& position) const;
+
+        struct EntityPosition
+        {
+            NetEntityId m_netEntityId = InvalidNetEntityId;
+            AZ::Vector3 m_position = AZ::Vector3::CreateZero();
+        };
+
+        //! Selects the entities that are outside of the domain, including the hysteresis band.
+        //! When more than maxCount entities are outside, entities that haven't been selected before go first, furthest from the
+        //! cell first. Entities that are still outside after being selected, because no other server accepted them, are only
+        //! retried after that, least recently selected first, so they can't hold up entities that can migrate.
+        //! @param entities the entities to check along with their world positions
+        //! @param maxCount the maximum number of entities to select
+        //! @return the set of selected entities
+        NetEntityIdSet SelectExitedEntities(const AZStd::vector<EntityPosition>& entities, uint32_t maxCount);
+
+        //! Collects the authoritative entities that left the domain and hands them to the network entity manager for migration.
+        //! At most sv_EntityDomainMaxMigrationsPerUpdate entities are handed over per call, the rest follow on later updates.
+        //! @return the set of entities that were handed over
+        NetEntityIdSet UpdateExitedEntities();
+
+        //! IEntityDomain overrides.
+        //! @{
+        void ActivateTracking() override;
+        void SetAabb(const AZ::Aabb& aabb) override;
+        const AZ::Aabb& GetAabb() const override;
+        bool IsInDomain(const ConstNetworkEntityHandle& entityHandle) const override;
+        void HandleLossOfAuthoritativeReplicator(const ConstNetworkEntityHandle& entityHandle) override;
+        void DebugDraw() const override;
+        //! @}
+
+    private:
+        AZ::Aabb m_aabb = AZ::Aabb::CreateNull();
+        AZ::Aabb m_hysteresisAabb = AZ::Aabb::CreateNull();
+        float m_hysteresis = 0.0f;
+
+        //! The selection in which exited entities were last handed over, used to retry entities that didn't migrate last.
+        AZStd::unordered_map<NetEntityId, uint64_t> m_lastSelections;
+        uint64_t m_selectionCount = 0;
+
+        AZ::ScheduledEvent m_updateExitedEntitiesEvent;
+    };
+}
@@ -40,5 +40,10 @@ namespace Multiplayer
 
         // Other systems
         MultiplayerStat_PhysicsFrameTimeUs,
+
+        // Connection update phases
+        MultiplayerStat_ReplicationSetUpdateTimeUs, // Time spent querying the replication windows of all connections
+        MultiplayerStat_ReplicationSetApplyTimeUs,  // Time spent adding and removing entity replicators for new replication sets
+        MultiplayerStat_ReplicationSendTimeUs,      // Time spent generating and sending the updates of all connections
     };
 }
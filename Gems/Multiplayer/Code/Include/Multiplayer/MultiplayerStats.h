@@ -26,6 +26,13 @@ namespace Multiplayer
         AZ::u64 m_clientConnectionCount = 0;
         AZ::u64 m_serverConnectionCount = 0;
 
+        //! Time spent in each phase of the last connection update.
+        //! The replication set phases are only measured separately when sv_taskGraphConnectionUpdates is enabled, otherwise the
+        //! replication windows are updated by scheduled events and only the send time is recorded.
+        AZ::TimeUs m_replicationSetUpdateTimeUs = AZ::Time::ZeroTimeUs;
+        AZ::TimeUs m_replicationSetApplyTimeUs = AZ::Time::ZeroTimeUs;
+        AZ::TimeUs m_replicationSendTimeUs = AZ::Time::ZeroTimeUs;
+
         uint64_t m_recordMetricIndex = 0;
         AZ::TimeMs m_totalHistoryTimeMs = AZ::Time::ZeroTimeMs;
 
@@ -54,10 +61,28 @@ namespace Multiplayer
         void RecordComponentSerializeEnd(AzNetworking::SerializerMode mode, NetComponentId netComponentId);
         void RecordEntitySerializeStop(AzNetworking::SerializerMode mode, AZ::EntityId entityId, const char* entityName);
         void RecordPropertySent(NetComponentId netComponentId, PropertyIndex propertyId, uint32_t totalBytes);
+
+        //! A single property update as passed to RecordPropertySent.
+        struct PropertySent
+        {
+            NetComponentId m_netComponentId = InvalidNetComponentId;
+            PropertyIndex m_propertyIndex = PropertyIndex{ 0 };
+            uint32_t m_totalBytes = 0;
+        };
+        using PropertiesSent = AZStd::vector<PropertySent>;
+
+        //! Appends every property update recorded as sent on the calling thread to propertiesSent until EndCapturePropertiesSent is
+        //! called, so the updates of a serialized state delta can be replayed when its bytes are reused.
+        static void BeginCapturePropertiesSent(PropertiesSent& propertiesSent);
+        static void EndCapturePropertiesSent();
+        //! Records the captured property updates of an entity again, as if it was serialized.
+        void ReplayPropertiesSent(AZ::EntityId entityId, const char* entityName, const PropertiesSent& propertiesSent);
+
         void RecordPropertyReceived(NetComponentId netComponentId, PropertyIndex propertyId, uint32_t totalBytes);
         void RecordRpcSent(AZ::EntityId entityId, const char* entityName, NetComponentId netComponentId, RpcIndex rpcId, uint32_t totalBytes);
         void RecordRpcReceived(AZ::EntityId entityId, const char* entityName, NetComponentId netComponentId, RpcIndex rpcId, uint32_t totalBytes);
         void RecordFrameTime(AZ::TimeUs networkFrameTime);
+        void RecordReplicationPhaseTimes(AZ::TimeUs replicationSetUpdateTime, AZ::TimeUs replicationSetApplyTime, AZ::TimeUs sendTime);
         void TickStats(AZ::TimeMs metricFrameTimeMs);
 
         Metric CalculateComponentPropertyUpdateSentMetrics(NetComponentId netComponentId) const;
@@ -104,6 +104,21 @@ namespace Multiplayer
         
         bool IsUpdateModeToServerClient();
 
+        //! Used by sv_taskGraphConnectionUpdates, which defers the scheduled replication window updates so the window queries of
+        //! all connections can run in parallel.
+        //! @return true if a replication window update was deferred and UpdateReplicationSet should be called
+        bool HasPendingReplicationSetUpdate() const;
+
+        //! Queries the replication window for a new replication set without changing any entity replicators.
+        //! This only touches the replication window of this connection, so it can run on a task in parallel with other connections.
+        //! Replication windows call IFilterEntityManager::IsEntityFiltered from here, which therefore has to be thread safe.
+        //! @return true if a new replication set was generated that has to be passed to ApplyReplicationSet
+        bool UpdateReplicationSet();
+
+        //! Adds and removes entity replicators to match the replication set generated by UpdateReplicationSet.
+        //! Adding replicators connects handlers to events of the shared entities, so this has to run on the main thread.
+        void ApplyReplicationSet();
+
     private:
         AZ_DISABLE_COPY_MOVE(EntityReplicationManager);
 
@@ -137,6 +152,7 @@ namespace Multiplayer
         EntityReplicator* GetEntityReplicator(const ConstNetworkEntityHandle& entityHandle);
 
         void UpdateWindow();
+        void OnUpdateWindowEvent();
         void OnEntityActivated(AZ::Entity* entity);
         void OnEntityDeactivated(AZ::Entity* entity);
 
@@ -217,6 +233,7 @@ namespace Multiplayer
         uint32_t m_maxRemoteEntitiesPendingCreationCount = AZStd::numeric_limits<uint32_t>::max();
         uint32_t m_maxPayloadSize = 0;
         Mode m_updateMode = Mode::Invalid;
+        bool m_replicationSetUpdatePending = false;
 
         friend class EntityReplicator;
     };
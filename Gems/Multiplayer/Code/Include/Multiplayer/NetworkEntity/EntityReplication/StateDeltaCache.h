@@ -0,0 +1,65 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzNetworking/DataStructures/ByteBuffer.h>
+#include <Multiplayer/MultiplayerStats.h>
+#include <Multiplayer/NetworkEntity/EntityReplication/ReplicationRecord.h>
+
+namespace Multiplayer
+{
+    //! @class StateDeltaCache
+    //! @brief Caches the serialized state deltas of a single entity so they can be shared between connections.
+    //! Every connection replicating an entity serializes the properties marked in its own pending record, which depends on what
+    //! that connection has acknowledged. Connections that are in the same state need identical bytes, so the first one to
+    //! serialize a record stores the result here and the others copy it instead of serializing the entity again.
+    //! The owning NetBindComponent invalidates the cache whenever the entity is dirtied, so entries never outlive the state they
+    //! were serialized from. Lookups and stores are thread safe, as connections can be updated in parallel.
+    class StateDeltaCache
+    {
+    public:
+        //! Maximum number of distinct records cached per entity, further records are serialized without being cached.
+        static constexpr uint32_t MaxCachedRecords = 4;
+
+        //! Copies the state delta previously serialized for an identical record into the output buffer.
+        //! @param record            the record describing which properties need to be serialized
+        //! @param outData           the buffer to copy the serialized state delta into
+        //! @param outPropertiesSent the property updates that were recorded while serializing the state delta
+        //! @return boolean true if a state delta was found and copied, false if the record needs to be serialized
+        bool Retrieve(
+            const ReplicationRecord& record,
+            AzNetworking::PacketEncodingBuffer& outData,
+            MultiplayerStats::PropertiesSent& outPropertiesSent) const;
+
+        //! Stores a serialized state delta for later retrieval.
+        //! @param record         the record the state delta was serialized for
+        //! @param data           the serialized state delta
+        //! @param propertiesSent the property updates that were recorded while serializing the state delta
+        void Store(
+            const ReplicationRecord& record,
+            const AzNetworking::PacketEncodingBuffer& data,
+            const MultiplayerStats::PropertiesSent& propertiesSent);
+
+        //! Discards all cached state deltas.
+        void Invalidate();
+
+    private:
+        struct CachedStateDelta
+        {
+            ReplicationRecord m_record;
+            AZStd::vector<uint8_t> m_data;
+            MultiplayerStats::PropertiesSent m_propertiesSent;
+        };
+
+        mutable AZStd::mutex m_mutex;
+        AZStd::vector<CachedStateDelta> m_cachedStateDeltas;
+    };
+}
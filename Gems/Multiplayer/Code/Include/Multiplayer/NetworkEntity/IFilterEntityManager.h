@@ -39,6 +39,9 @@ namespace Multiplayer
         //! Return true if a given entity should be filtered out, false otherwise.
         //! Important: this method is a hot code path, it will be called over all entities around each player frequently.
         //! Ideally, this method should be implemented as a quick look up.
+        //! Thread safety: when sv_taskGraphConnectionUpdates is enabled the replication windows of all connections are updated in
+        //! parallel, so this is called concurrently from task graph worker threads, for different connections at the same time.
+        //! Implementations must only read state that isn't modified while the connections are updated, or guard it themselves.
         //!
         //! @param entity the entity to be considered for filtering
         //! @param controllerEntity player's entity for the associated connection
@@ -87,6 +87,13 @@ namespace Multiplayer
         //! @return boolean true for success, false for serialization failure
         bool Serialize(AzNetworking::ISerializer& serializer);
 
+        //! Serializes the value for the current time with a custom encoding, such as a quantized one.
+        //! @param serializer       ISerializer instance to use for serialization
+        //! @param serializeFunctor callable taking the ISerializer and a BASE_TYPE reference, returning a boolean
+        //! @return boolean true for success, false for serialization failure
+        template <typename SERIALIZE_FUNCTOR>
+        bool Serialize(AzNetworking::ISerializer& serializer, const SERIALIZE_FUNCTOR& serializeFunctor);
+
     private:
 
         //! Returns what the appropriate current time is for this rewindable property.
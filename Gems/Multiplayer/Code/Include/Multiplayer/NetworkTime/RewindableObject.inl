@@ -110,10 +110,20 @@ namespace Multiplayer
 
     template <typename BASE_TYPE, AZStd::size_t REWIND_SIZE>
     inline bool RewindableObject<BASE_TYPE, REWIND_SIZE>::Serialize(AzNetworking::ISerializer& serializer)
+    {
+        return Serialize(serializer, [](AzNetworking::ISerializer& elementSerializer, BASE_TYPE& value)
+        {
+            return elementSerializer.Serialize(value, "Element");
+        });
+    }
+
+    template <typename BASE_TYPE, AZStd::size_t REWIND_SIZE>
+    template <typename SERIALIZE_FUNCTOR>
+    inline bool RewindableObject<BASE_TYPE, REWIND_SIZE>::Serialize(AzNetworking::ISerializer& serializer, const SERIALIZE_FUNCTOR& serializeFunctor)
     {
         const HostFrameId frameTime = GetCurrentTimeForProperty();
         BASE_TYPE value = GetValueForTime(frameTime);
-        if (serializer.Serialize(value, "Element") && (serializer.GetSerializerMode() == AzNetworking::SerializerMode::WriteToObject))
+        if (serializeFunctor(serializer, value) && (serializer.GetSerializerMode() == AzNetworking::SerializerMode::WriteToObject))
         {
             SetValueForTime(value, frameTime);
             if (m_headTime == frameTime && m_headTime > m_lastSerializedTime)
@@ -263,6 +263,7 @@ namespace Multiplayer
 
         // Remove this entity from the NetworkEntityTracker and NetworkEntityManager.
         Unregister();
+        m_stateDeltaCache.Invalidate();
     }
 
     NetEntityRole NetBindComponent::GetNetEntityRole() const
@@ -712,6 +713,11 @@ namespace Multiplayer
         }
     }
 
+    StateDeltaCache& NetBindComponent::GetStateDeltaCache()
+    {
+        return m_stateDeltaCache;
+    }
+
     void NetBindComponent::PreInit(AZ::Entity* entity, const PrefabEntityId& prefabEntityId, NetEntityId netEntityId, NetEntityRole netEntityRole)
     {
         AZ_Assert(entity != nullptr, "AZ::Entity is null");
@@ -856,6 +862,8 @@ namespace Multiplayer
 
     void NetBindComponent::HandleMarkedDirty()
     {
+        // Property values have changed, so any state deltas serialized from the previous values are stale
+        m_stateDeltaCache.Invalidate();
         m_dirtiedEvent.Signal();
         if (HasController())
         {
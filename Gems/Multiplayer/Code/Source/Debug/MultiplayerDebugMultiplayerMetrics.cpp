@@ -179,6 +179,9 @@ namespace Multiplayer
         ImGui::Text("Total networked entities: %llu", aznumeric_cast<AZ::u64>(stats.m_entityCount));
         ImGui::Text("Total client connections: %llu", aznumeric_cast<AZ::u64>(stats.m_clientConnectionCount));
         ImGui::Text("Total server connections: %llu", aznumeric_cast<AZ::u64>(stats.m_serverConnectionCount));
+        ImGui::Text("Replication set update time: %lldus", static_cast<AZ::s64>(stats.m_replicationSetUpdateTimeUs));
+        ImGui::Text("Replication set apply time: %lldus", static_cast<AZ::s64>(stats.m_replicationSetApplyTimeUs));
+        ImGui::Text("Replication send time: %lldus", static_cast<AZ::s64>(stats.m_replicationSendTimeUs));
         ImGui::NewLine();
 
         static ImGuiTableFlags flags = ImGuiTableFlags_BordersV
@@ -105,6 +105,10 @@ namespace Multiplayer
                     ImGui::TableNextColumn();
                     ImGui::Text("%lld", aznumeric_cast<AZ::s64>(metrics.m_sendBytesCompressedDelta));
                     ImGui::TableNextRow(); ImGui::TableNextColumn();
+                    ImGui::Text("Total send batches");
+                    ImGui::TableNextColumn();
+                    ImGui::Text("%llu", aznumeric_cast<AZ::u64>(metrics.m_sendBatches));
+                    ImGui::TableNextRow(); ImGui::TableNextColumn();
                     ImGui::Text("Total packets resent");
                     ImGui::TableNextColumn();
                     ImGui::Text("%llu", aznumeric_cast<AZ::u64>(metrics.m_resentPackets));
@@ -125,6 +129,10 @@ namespace Multiplayer
                     ImGui::TableNextColumn();
                     ImGui::Text("%llu", aznumeric_cast<AZ::u64>(metrics.m_recvBytesUncompressed));
                     ImGui::TableNextRow(); ImGui::TableNextColumn();
+                    ImGui::Text("Total receive batches");
+                    ImGui::TableNextColumn();
+                    ImGui::Text("%llu", aznumeric_cast<AZ::u64>(metrics.m_recvBatches));
+                    ImGui::TableNextRow(); ImGui::TableNextColumn();
                     ImGui::Text("Total packets discarded due to load");
                     ImGui::TableNextColumn();
                     ImGui::Text("%llu", aznumeric_cast<AZ::u64>(metrics.m_discardedPackets));
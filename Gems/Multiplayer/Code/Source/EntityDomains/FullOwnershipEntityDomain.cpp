@@ -10,6 +10,11 @@
 
 namespace Multiplayer 
 {
+    void FullOwnershipEntityDomain::ActivateTracking()
+    {
+        ; // Ownership is static, there is nothing to track
+    }
+
     void FullOwnershipEntityDomain::SetAabb([[maybe_unused]] const AZ::Aabb& aabb)
     {
         ; // Do nothing, by definition we own everything
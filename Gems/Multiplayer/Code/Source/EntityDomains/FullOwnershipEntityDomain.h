@@ -21,6 +21,7 @@ namespace Multiplayer
 
         //! IEntityDomain overrides.
         //! @{
+        void ActivateTracking() override;
         void SetAabb(const AZ::Aabb& aabb) override;
         const AZ::Aabb& GetAabb() const override;
         bool IsInDomain(const ConstNetworkEntityHandle& entityHandle) const override;
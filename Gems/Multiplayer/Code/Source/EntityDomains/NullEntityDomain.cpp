@@ -12,6 +12,11 @@
 
 namespace Multiplayer 
 {
+    void NullEntityDomain::ActivateTracking()
+    {
+        ; // We don't own anything, there is nothing to track
+    }
+
     void NullEntityDomain::SetAabb([[maybe_unused]] const AZ::Aabb& aabb)
     {
         ; // Do nothing, by definition we own everything
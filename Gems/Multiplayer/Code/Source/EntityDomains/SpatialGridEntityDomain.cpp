@@ -0,0 +1,227 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Multiplayer/EntityDomains/SpatialGridEntityDomain.h>
+#include <Source/NetworkEntity/NetworkEntityTracker.h>
+#include <AzCore/Component/TransformBus.h>
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/Console/ILogger.h>
+#include <AzCore/Math/Color.h>
+#include <AzCore/std/sort.h>
+#include <AzFramework/Entity/EntityDebugDisplayBus.h>
+#include <Multiplayer/IMultiplayer.h>
+#include <Multiplayer/Components/NetBindComponent.h>
+
+namespace Multiplayer
+{
+    AZ_CVAR(float, sv_EntityDomainHysteresis, 5.0f, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "Distance an entity has to move outside of a spatial entity domain along x or y before it is migrated to another server");
+    AZ_CVAR(AZ::TimeMs, sv_EntityDomainUpdateMs, AZ::TimeMs{ 250 }, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "Rate at which spatial entity domains check for entities that left the domain");
+    AZ_CVAR(uint32_t, sv_EntityDomainMaxMigrationsPerUpdate, 32, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "Maximum number of entities a spatial entity domain hands over for migration per update");
+
+    SpatialGridEntityDomain::SpatialGridEntityDomain(const AZ::Aabb& aabb, float hysteresis)
+        : m_hysteresis(AZStd::max(hysteresis, 0.0f))
+        , m_updateExitedEntitiesEvent([this]() { UpdateExitedEntities(); }, AZ::Name("SpatialGridEntityDomain::UpdateExitedEntities"))
+    {
+        SetAabb(aabb);
+    }
+
+    SpatialGridEntityDomain::SpatialGridEntityDomain(const AZ::Aabb& aabb)
+        : SpatialGridEntityDomain(aabb, sv_EntityDomainHysteresis)
+    {
+        ;
+    }
+
+    void SpatialGridEntityDomain::ActivateTracking()
+    {
+        // Only the domain of the local network entity manager hands entities over, remote domains are only queried
+        m_updateExitedEntitiesEvent.Enqueue(sv_EntityDomainUpdateMs, true);
+    }
+
+    AZ::Aabb SpatialGridEntityDomain::GetGridCellAabb(const AZ::Aabb& worldAabb, uint32_t columns, uint32_t rows, uint32_t cellIndex)
+    {
+        if (!worldAabb.IsValid() || (columns == 0) || (rows == 0) || (cellIndex >= columns * rows))
+        {
+            return AZ::Aabb::CreateNull();
+        }
+
+        const uint32_t column = cellIndex % columns;
+        const uint32_t row = cellIndex / columns;
+        const AZ::Vector3 worldMin = worldAabb.GetMin();
+        const AZ::Vector3 worldMax = worldAabb.GetMax();
+        const float cellWidth = (worldMax.GetX() - worldMin.GetX()) / static_cast<float>(columns);
+        const float cellDepth = (worldMax.GetY() - worldMin.GetY()) / static_cast<float>(rows);
+
+        // Use the world bounds for the last column and row so rounding never leaves a gap at the far edges
+        const float minX = worldMin.GetX() + cellWidth * static_cast<float>(column);
+        const float minY = worldMin.GetY() + cellDepth * static_cast<float>(row);
+        const float maxX = (column + 1 == columns) ? worldMax.GetX() : worldMin.GetX() + cellWidth * static_cast<float>(column + 1);
+        const float maxY = (row + 1 == rows) ? worldMax.GetY() : worldMin.GetY() + cellDepth * static_cast<float>(row + 1);
+        return AZ::Aabb::CreateFromMinMax(AZ::Vector3(minX, minY, worldMin.GetZ()), AZ::Vector3(maxX, maxY, worldMax.GetZ()));
+    }
+
+    bool SpatialGridEntityDomain::IsPositionInDomain(const AZ::Vector3& position) const
+    {
+        return m_hysteresisAabb.IsValid() && m_hysteresisAabb.Contains(position);
+    }
+
+    NetEntityIdSet SpatialGridEntityDomain::SelectExitedEntities(const AZStd::vector<EntityPosition>& entities, uint32_t maxCount)
+    {
+        struct ExitedEntity
+        {
+            NetEntityId m_netEntityId;
+            uint64_t m_lastSelection;
+            float m_distanceSq;
+        };
+        AZStd::vector<ExitedEntity> candidates;
+        AZStd::unordered_map<NetEntityId, uint64_t> lastSelections;
+        for (const EntityPosition& entity : entities)
+        {
+            if (!IsPositionInDomain(entity.m_position))
+            {
+                // Entities that were selected before are still ours, so no other server accepted them
+                auto lastSelection = m_lastSelections.find(entity.m_netEntityId);
+                const uint64_t selection = (lastSelection != m_lastSelections.end()) ? lastSelection->second : 0;
+                candidates.push_back({ entity.m_netEntityId, selection, m_aabb.IsValid() ? m_aabb.GetDistanceSq(entity.m_position) : 0.0f });
+                if (selection != 0)
+                {
+                    lastSelections.emplace(entity.m_netEntityId, selection);
+                }
+            }
+        }
+
+        if (candidates.size() > maxCount)
+        {
+            AZStd::partial_sort(candidates.begin(), candidates.begin() + maxCount, candidates.end(),
+                [](const ExitedEntity& lhs, const ExitedEntity& rhs)
+                {
+                    if (lhs.m_lastSelection != rhs.m_lastSelection)
+                    {
+                        return lhs.m_lastSelection < rhs.m_lastSelection;
+                    }
+                    return lhs.m_distanceSq > rhs.m_distanceSq;
+                });
+            candidates.resize(maxCount);
+        }
+
+        // Entities that re-entered the domain or migrated away are dropped from the history
+        ++m_selectionCount;
+        NetEntityIdSet exitedEntities;
+        for (const ExitedEntity& candidate : candidates)
+        {
+            exitedEntities.insert(candidate.m_netEntityId);
+            lastSelections[candidate.m_netEntityId] = m_selectionCount;
+        }
+        m_lastSelections = AZStd::move(lastSelections);
+        return exitedEntities;
+    }
+
+    NetEntityIdSet SpatialGridEntityDomain::UpdateExitedEntities()
+    {
+        INetworkEntityManager* networkEntityManager = GetNetworkEntityManager();
+        if (networkEntityManager == nullptr)
+        {
+            return {};
+        }
+
+        AZStd::vector<EntityPosition> authoritativeEntities;
+        NetworkEntityTracker* networkEntityTracker = networkEntityManager->GetNetworkEntityTracker();
+        for (auto iter = networkEntityTracker->begin(); iter != networkEntityTracker->end(); ++iter)
+        {
+            AZ::Entity* entity = iter->second;
+            NetBindComponent* netBindComponent = networkEntityTracker->GetNetBindComponent(entity);
+            if ((netBindComponent == nullptr) || !netBindComponent->IsNetEntityRoleAuthority()
+                || (netBindComponent->GetAllowEntityMigration() == EntityMigration::Disabled))
+            {
+                continue;
+            }
+
+            if (const AZ::TransformInterface* transform = entity->GetTransform())
+            {
+                authoritativeEntities.push_back({ iter->first, transform->GetWorldTranslation() });
+            }
+        }
+
+        const NetEntityIdSet exitedEntities = SelectExitedEntities(authoritativeEntities, sv_EntityDomainMaxMigrationsPerUpdate);
+        if (!exitedEntities.empty())
+        {
+            networkEntityManager->HandleEntitiesExitDomain(exitedEntities);
+        }
+        return exitedEntities;
+    }
+
+    void SpatialGridEntityDomain::SetAabb(const AZ::Aabb& aabb)
+    {
+        m_aabb = aabb;
+        m_hysteresisAabb = aabb;
+        if (m_hysteresisAabb.IsValid())
+        {
+            // The grid only splits the world along x and y, so the band doesn't extend above or below the cell
+            m_hysteresisAabb.Expand(AZ::Vector3(m_hysteresis, m_hysteresis, 0.0f));
+        }
+    }
+
+    const AZ::Aabb& SpatialGridEntityDomain::GetAabb() const
+    {
+        return m_aabb;
+    }
+
+    bool SpatialGridEntityDomain::IsInDomain(const ConstNetworkEntityHandle& entityHandle) const
+    {
+        const AZ::Entity* entity = entityHandle.GetEntity();
+        if (entity == nullptr)
+        {
+            return false;
+        }
+
+        const AZ::TransformInterface* transform = entity->GetTransform();
+        if (transform == nullptr)
+        {
+            // Entities without a position never leave the server that owns them
+            return true;
+        }
+        return IsPositionInDomain(transform->GetWorldTranslation());
+    }
+
+    void SpatialGridEntityDomain::HandleLossOfAuthoritativeReplicator(const ConstNetworkEntityHandle& entityHandle)
+    {
+        if (IsInDomain(entityHandle))
+        {
+            // The entity is inside our cell, so we are the server that should simulate it
+            GetNetworkEntityManager()->ForceAssumeAuthority(entityHandle);
+        }
+        else
+        {
+            AZLOG_ERROR("Timed out entity id %llu during migration outside of the domain, marking for removal", aznumeric_cast<AZ::u64>(entityHandle.GetNetEntityId()));
+            GetNetworkEntityManager()->MarkForRemoval(entityHandle);
+        }
+    }
+
+    void SpatialGridEntityDomain::DebugDraw() const
+    {
+        if (!m_aabb.IsValid())
+        {
+            return;
+        }
+
+        AzFramework::DebugDisplayRequestBus::BusPtr debugDisplayBus;
+        AzFramework::DebugDisplayRequestBus::Bind(debugDisplayBus, AzFramework::g_defaultSceneEntityDebugDisplayId);
+        AzFramework::DebugDisplayRequests* debugDisplay = AzFramework::DebugDisplayRequestBus::FindFirstHandler(debugDisplayBus);
+        if (debugDisplay == nullptr)
+        {
+            return;
+        }
+
+        debugDisplay->SetColor(AZ::Colors::Green);
+        debugDisplay->DrawWireBox(m_aabb.GetMin(), m_aabb.GetMax());
+        debugDisplay->SetColor(AZ::Colors::Yellow);
+        debugDisplay->DrawWireBox(m_hysteresisAabb.GetMin(), m_hysteresisAabb.GetMax());
+    }
+}
@@ -12,6 +12,9 @@
 
 namespace Multiplayer
 {
+    //! Property updates recorded on this thread are appended here while a capture is active.
+    static thread_local MultiplayerStats::PropertiesSent* t_capturedPropertiesSent = nullptr;
+
     MultiplayerStats::Metric::Metric()
     {
         AZStd::uninitialized_fill_n(m_callHistory.data(), RingbufferSamples, 0);
@@ -48,6 +51,11 @@ namespace Multiplayer
 
     void MultiplayerStats::RecordPropertySent(NetComponentId netComponentId, PropertyIndex propertyId, uint32_t totalBytes)
     {
+        if (t_capturedPropertiesSent)
+        {
+            t_capturedPropertiesSent->push_back({ netComponentId, propertyId, totalBytes });
+        }
+
         const uint16_t netComponentIndex = aznumeric_cast<uint16_t>(netComponentId);
         const uint16_t propertyIndex = aznumeric_cast<uint16_t>(propertyId);
         if (m_componentStats[netComponentIndex].m_propertyUpdatesSent.size() > propertyIndex)
@@ -66,6 +74,35 @@ namespace Multiplayer
         m_events.m_propertySent.Signal(netComponentId, propertyId, totalBytes);
     }
 
+    void MultiplayerStats::BeginCapturePropertiesSent(PropertiesSent& propertiesSent)
+    {
+        AZ_Assert(t_capturedPropertiesSent == nullptr, "Property updates are already being captured on this thread");
+        t_capturedPropertiesSent = &propertiesSent;
+    }
+
+    void MultiplayerStats::EndCapturePropertiesSent()
+    {
+        t_capturedPropertiesSent = nullptr;
+    }
+
+    void MultiplayerStats::ReplayPropertiesSent(AZ::EntityId entityId, const char* entityName, const PropertiesSent& propertiesSent)
+    {
+        constexpr AzNetworking::SerializerMode mode = AzNetworking::SerializerMode::ReadFromObject;
+        RecordEntitySerializeStart(mode, entityId, entityName);
+        for (size_t index = 0; index < propertiesSent.size(); ++index)
+        {
+            const PropertySent& propertySent = propertiesSent[index];
+            RecordPropertySent(propertySent.m_netComponentId, propertySent.m_propertyIndex, propertySent.m_totalBytes);
+            const bool isLastOfComponent =
+                (index + 1 == propertiesSent.size()) || (propertiesSent[index + 1].m_netComponentId != propertySent.m_netComponentId);
+            if (isLastOfComponent)
+            {
+                RecordComponentSerializeEnd(mode, propertySent.m_netComponentId);
+            }
+        }
+        RecordEntitySerializeStop(mode, entityId, entityName);
+    }
+
     void MultiplayerStats::RecordPropertyReceived(NetComponentId netComponentId, PropertyIndex propertyId, uint32_t totalBytes)
     {
         const uint16_t netComponentIndex = aznumeric_cast<uint16_t>(netComponentId);
@@ -263,4 +300,14 @@ namespace Multiplayer
     {
         SET_PERFORMANCE_STAT(MultiplayerStat_FrameTimeUs, networkFrameTime);
     }
+
+    void MultiplayerStats::RecordReplicationPhaseTimes(AZ::TimeUs replicationSetUpdateTime, AZ::TimeUs replicationSetApplyTime, AZ::TimeUs sendTime)
+    {
+        m_replicationSetUpdateTimeUs = replicationSetUpdateTime;
+        m_replicationSetApplyTimeUs = replicationSetApplyTime;
+        m_replicationSendTimeUs = sendTime;
+        SET_PERFORMANCE_STAT(MultiplayerStat_ReplicationSetUpdateTimeUs, replicationSetUpdateTime);
+        SET_PERFORMANCE_STAT(MultiplayerStat_ReplicationSetApplyTimeUs, replicationSetApplyTime);
+        SET_PERFORMANCE_STAT(MultiplayerStat_ReplicationSendTimeUs, sendTime);
+    }
 } // namespace Multiplayer
@@ -43,6 +43,7 @@
 #include <cmath>
 #include <AzCore/Jobs/JobCompletion.h>
 #include <AzCore/Jobs/JobFunction.h>
+#include <AzCore/Task/TaskGraph.h>
 #include <System/PhysXSystem.h>
 
 #include <AzCore/Jobs/JobCompletion.h>
@@ -130,6 +131,12 @@ namespace Multiplayer
 
     AZ_CVAR(bool, sv_multithreadedConnectionUpdates, false, nullptr, AZ::ConsoleFunctorFlags::DontReplicate,
         "If true, the server will send updates to clients on different threads, which improves performance with large number of clients");
+    AZ_CVAR(bool, sv_taskGraphConnectionUpdates, false, nullptr, AZ::ConsoleFunctorFlags::DontReplicate,
+        "If true, the server updates the replication windows and sends the updates of every client connection in parallel on the task graph, "
+        "this takes precedence over sv_multithreadedConnectionUpdates. Any IFilterEntityManager has to be thread safe when this is enabled");
+    AZ_CVAR(bool, sv_useInterestGrid, false, nullptr, AZ::ConsoleFunctorFlags::DontReplicate,
+        "If true, the server keeps a shared grid of networked entities that all client replication windows gather from, "
+        "instead of querying the visibility system once per connection. Applied when the server starts hosting");
     AZ_CVAR(bool, bg_parallelNotifyPreRender, false, nullptr, AZ::ConsoleFunctorFlags::DontReplicate,
         "If true, OnPreRender events will be sent in parallel from job threads. Please make sure the handlers of the event are thread safe.");
     
@@ -359,6 +366,10 @@ namespace Multiplayer
         DECLARE_PERFORMANCE_STAT(MultiplayerGroup_Networking, MultiplayerStat_TotalPacketsDiscardedDueToLoad, "TotalPacketsDiscardedDueToLoad");
 
         DECLARE_PERFORMANCE_STAT(MultiplayerGroup_Networking, MultiplayerStat_PhysicsFrameTimeUs, "PhysicsFrameTimeUs");        
+
+        DECLARE_PERFORMANCE_STAT(MultiplayerGroup_Networking, MultiplayerStat_ReplicationSetUpdateTimeUs, "ReplicationSetUpdateTimeUs");
+        DECLARE_PERFORMANCE_STAT(MultiplayerGroup_Networking, MultiplayerStat_ReplicationSetApplyTimeUs, "ReplicationSetApplyTimeUs");
+        DECLARE_PERFORMANCE_STAT(MultiplayerGroup_Networking, MultiplayerStat_ReplicationSendTimeUs, "ReplicationSendTimeUs");
     }
 
     void MultiplayerSystemComponent::Deactivate()
@@ -377,6 +388,7 @@ namespace Multiplayer
         AZ::TickBus::Handler::BusDisconnect();
         AzFramework::RootSpawnableNotificationBus::Handler::BusDisconnect();
 
+        m_interestGrid.reset();
         m_networkEntityManager.Reset();
 
 #if (O3DE_EDITOR_CONNECTION_LISTENER_ENABLE)
@@ -673,8 +685,33 @@ namespace Multiplayer
 
     void MultiplayerSystemComponent::UpdateConnections()
     {
-        if (sv_multithreadedConnectionUpdates && (GetAgentType() == MultiplayerAgentType::ClientServer ||
-                                                  GetAgentType() == MultiplayerAgentType::DedicatedServer))
+        const bool isServer = (GetAgentType() == MultiplayerAgentType::ClientServer || GetAgentType() == MultiplayerAgentType::DedicatedServer);
+        const AZ::TaskGraphActiveInterface* taskGraphActive = AZ::Interface<AZ::TaskGraphActiveInterface>::Get();
+        if (sv_taskGraphConnectionUpdates && isServer && taskGraphActive && taskGraphActive->IsTaskGraphActive())
+        {
+            UpdateConnectionsWithTaskGraph();
+            return;
+        }
+
+        if (sv_taskGraphConnectionUpdates)
+        {
+            // The task graph isn't available, apply the replication window updates that were deferred for it on this thread
+            auto updatePendingReplicationSets = [](IConnection& connection)
+            {
+                if (connection.GetUserData() != nullptr)
+                {
+                    EntityReplicationManager& replicationManager = static_cast<IConnectionData*>(connection.GetUserData())->GetReplicationManager();
+                    if (replicationManager.HasPendingReplicationSetUpdate() && replicationManager.UpdateReplicationSet())
+                    {
+                        replicationManager.ApplyReplicationSet();
+                    }
+                }
+            };
+            m_networkInterface->GetConnectionSet().VisitConnections(updatePendingReplicationSets);
+        }
+
+        const AZStd::chrono::steady_clock::time_point startSendTime = AZStd::chrono::steady_clock::now();
+        if (sv_multithreadedConnectionUpdates && isServer)
         {
             // Threaded update calls.
             AZ_PROFILE_SCOPE(MULTIPLAYER, "MultiplayerSystemComponent: UpdateConnections");
@@ -714,6 +751,99 @@ namespace Multiplayer
 
             m_networkInterface->GetConnectionSet().VisitConnections(sendNetworkUpdates);
         }
+
+        const auto sendDuration =
+            AZStd::chrono::duration_cast<AZStd::chrono::microseconds>(AZStd::chrono::steady_clock::now() - startSendTime);
+        GetStats().RecordReplicationPhaseTimes(AZ::Time::ZeroTimeUs, AZ::Time::ZeroTimeUs, AZ::TimeUs{ sendDuration.count() });
+    }
+
+    void MultiplayerSystemComponent::UpdateConnectionsWithTaskGraph()
+    {
+        AZStd::vector<IConnectionData*> connections;
+        AZStd::vector<IConnectionData*> pendingReplicationSets;
+        auto gatherConnections = [&connections, &pendingReplicationSets](IConnection& connection)
+        {
+            if (connection.GetUserData() != nullptr)
+            {
+                IConnectionData* connectionData = static_cast<IConnectionData*>(connection.GetUserData());
+                connections.push_back(connectionData);
+                if (connectionData->GetReplicationManager().HasPendingReplicationSetUpdate())
+                {
+                    pendingReplicationSets.push_back(connectionData);
+                }
+            }
+        };
+        m_networkInterface->GetConnectionSet().VisitConnections(gatherConnections);
+
+        UpdateConnectionsWithTaskGraph(connections, pendingReplicationSets);
+    }
+
+    void MultiplayerSystemComponent::UpdateConnectionsWithTaskGraph(
+        const AZStd::vector<IConnectionData*>& connections, const AZStd::vector<IConnectionData*>& pendingReplicationSets)
+    {
+        AZ_PROFILE_SCOPE(MULTIPLAYER, "MultiplayerSystemComponent: UpdateConnectionsWithTaskGraph");
+
+        // Every task only touches the connection data it was given, the replication window and entity replicators of a connection
+        // are never shared. The shared entity state is only read while generating updates, and the packets are queued on the
+        // connection and the network interface, which are safe to send from multiple threads.
+        //
+        // Query the replication windows that are due for an update, the windows call IFilterEntityManager::IsEntityFiltered from the
+        // worker threads which is why the interface requires it to be thread safe
+        const AZStd::chrono::steady_clock::time_point startReplicationSetUpdateTime = AZStd::chrono::steady_clock::now();
+        AZStd::vector<uint8_t> replicationSetUpdated(pendingReplicationSets.size(), 0);
+        if (!pendingReplicationSets.empty())
+        {
+            static const AZ::TaskDescriptor descriptor{ "Multiplayer::UpdateReplicationSet", "Multiplayer" };
+            AZ::TaskGraph taskGraph{ "MultiplayerUpdateReplicationSets" };
+            for (size_t index = 0; index < pendingReplicationSets.size(); ++index)
+            {
+                taskGraph.AddTask(descriptor, [connectionData = pendingReplicationSets[index], &updated = replicationSetUpdated[index]]()
+                {
+                    updated = connectionData->GetReplicationManager().UpdateReplicationSet() ? 1 : 0;
+                });
+            }
+
+            AZ::TaskGraphEvent finishedEvent{ "MultiplayerUpdateReplicationSets Wait" };
+            taskGraph.Submit(&finishedEvent);
+            finishedEvent.Wait();
+        }
+
+        // Adding and removing entity replicators connects to events on the shared entities, so the new sets are applied serially
+        const AZStd::chrono::steady_clock::time_point startReplicationSetApplyTime = AZStd::chrono::steady_clock::now();
+        for (size_t index = 0; index < pendingReplicationSets.size(); ++index)
+        {
+            if (replicationSetUpdated[index])
+            {
+                pendingReplicationSets[index]->GetReplicationManager().ApplyReplicationSet();
+            }
+        }
+
+        // Generate and send the updates of every connection
+        const AZStd::chrono::steady_clock::time_point startSendTime = AZStd::chrono::steady_clock::now();
+        if (!connections.empty())
+        {
+            static const AZ::TaskDescriptor descriptor{ "Multiplayer::UpdateConnection", "Multiplayer" };
+            AZ::TaskGraph taskGraph{ "MultiplayerUpdateConnections" };
+            for (IConnectionData* connectionData : connections)
+            {
+                taskGraph.AddTask(descriptor, [connectionData]()
+                {
+                    connectionData->Update();
+                });
+            }
+
+            AZ::TaskGraphEvent finishedEvent{ "MultiplayerUpdateConnections Wait" };
+            taskGraph.Submit(&finishedEvent);
+            finishedEvent.Wait();
+        }
+        const AZStd::chrono::steady_clock::time_point endSendTime = AZStd::chrono::steady_clock::now();
+
+        using AZStd::chrono::microseconds;
+        using AZStd::chrono::duration_cast;
+        GetStats().RecordReplicationPhaseTimes(
+            AZ::TimeUs{ duration_cast<microseconds>(startReplicationSetApplyTime - startReplicationSetUpdateTime).count() },
+            AZ::TimeUs{ duration_cast<microseconds>(startSendTime - startReplicationSetApplyTime).count() },
+            AZ::TimeUs{ duration_cast<microseconds>(endSendTime - startSendTime).count() });
     }
 
     int MultiplayerSystemComponent::GetTickOrder()
@@ -1378,12 +1508,21 @@ namespace Multiplayer
                     // Set up a full ownership domain if we didn't construct a domain during the initialize event
                     m_networkEntityManager.Initialize(hostId, AZStd::make_unique<FullOwnershipEntityDomain>());
                 }
+
+                if (sv_useInterestGrid)
+                {
+                    m_interestGrid = AZStd::make_unique<InterestGrid>();
+                }
             }
             else if (multiplayerType == MultiplayerAgentType::Client)
             {
                 m_networkEntityManager.Initialize(AzNetworking::IpAddress(), AZStd::make_unique<NullEntityDomain>());
             }
         }
+        else if (multiplayerType == MultiplayerAgentType::Uninitialized)
+        {
+            m_interestGrid.reset();
+        }
         m_agentType = multiplayerType;
 
         // Spawn the default player for this host since the host is also a player (not a dedicated server)
@@ -1561,6 +1700,9 @@ namespace Multiplayer
         AZLOG_INFO("Total networked entities: %llu", aznumeric_cast<AZ::u64>(stats.m_entityCount));
         AZLOG_INFO("Total client connections: %llu", aznumeric_cast<AZ::u64>(stats.m_clientConnectionCount));
         AZLOG_INFO("Total server connections: %llu", aznumeric_cast<AZ::u64>(stats.m_serverConnectionCount));
+        AZLOG_INFO("Replication set update time: %lldus", static_cast<AZ::s64>(stats.m_replicationSetUpdateTimeUs));
+        AZLOG_INFO("Replication set apply time: %lldus", static_cast<AZ::s64>(stats.m_replicationSetApplyTimeUs));
+        AZLOG_INFO("Replication send time: %lldus", static_cast<AZ::s64>(stats.m_replicationSendTimeUs));
 
         const MultiplayerStats::Metric propertyUpdatesSent = stats.CalculateTotalPropertyUpdateSentMetrics();
         const MultiplayerStats::Metric propertyUpdatesRecv = stats.CalculateTotalPropertyUpdateRecvMetrics();
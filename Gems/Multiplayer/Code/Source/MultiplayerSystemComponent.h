@@ -14,6 +14,7 @@
 #include <Editor/MultiplayerEditorConnection.h>
 #include <NetworkTime/NetworkTime.h>
 #include <NetworkEntity/NetworkEntityManager.h>
+#include <ReplicationWindows/InterestGrid.h>
 #include <Source/AutoGen/Multiplayer.AutoPacketDispatcher.h>
 
 #include <AzCore/Component/Component.h>
@@ -46,6 +47,8 @@ namespace AzNetworking
 
 namespace Multiplayer
 {
+    class IConnectionData;
+
     //! Multiplayer system component wraps the bridging logic between the game and transport layer.
     class MultiplayerSystemComponent final
         : public AZ::Component
@@ -175,6 +178,14 @@ namespace Multiplayer
         bool ShouldBlockLevelLoading(const char* levelName) override;
         //! @}
 
+        //! Updates client connections in parallel on the task graph, this is what sv_taskGraphConnectionUpdates enables.
+        //! The replication windows of pendingReplicationSets are queried in parallel, the new replication sets are applied on the
+        //! calling thread and then every connection in connections generates and sends its updates on its own task.
+        //! @param connections            the connections to send updates for
+        //! @param pendingReplicationSets the connections whose replication window is due for an update
+        static void UpdateConnectionsWithTaskGraph(
+            const AZStd::vector<IConnectionData*>& connections, const AZStd::vector<IConnectionData*>& pendingReplicationSets);
+
     private:
         bool IsHosting() const;
 
@@ -204,6 +215,9 @@ namespace Multiplayer
         
         IFilterEntityManager* m_filterEntityManager = nullptr; // non-owning pointer
 
+        // Shared spatial grid the server to client replication windows gather from, only created on servers when sv_useInterestGrid is set
+        AZStd::unique_ptr<InterestGrid> m_interestGrid;
+
         ConnectionAcquiredEvent m_connectionAcquiredEvent;
         NetworkInitEvent m_networkInitEvent;
         ServerAcceptanceReceivedEvent m_serverAcceptanceReceivedEvent;
@@ -261,6 +275,7 @@ namespace Multiplayer
         void UpdatedMetricsConnectionCount();
 
         void UpdateConnections();
+        void UpdateConnectionsWithTaskGraph();
 
         void OnPhysicsPreSimulate(float dt);
         AzPhysics::SystemEvents::OnPresimulateEvent::Handler m_preSimulateHandler{[this](float dt)
@@ -35,6 +35,7 @@ namespace Multiplayer
 
     AZ_CVAR(bool, bg_replicationWindowImmediateAddRemove, true, nullptr, AZ::ConsoleFunctorFlags::Null, "Update replication windows immediately on visibility Add/Removes.");
     AZ_CVAR(AZ::TimeMs, sv_ReplicationWindowUpdateMs, AZ::TimeMs{ 300 }, nullptr, AZ::ConsoleFunctorFlags::Null, "Rate for replication window updates.");
+    AZ_CVAR_EXTERNED(bool, sv_taskGraphConnectionUpdates);
     
     EntityReplicationManager::EntityReplicationManager(AzNetworking::IConnection& connection, AzNetworking::IConnectionListener& connectionListener, Mode updateMode)
         : m_updateMode(updateMode)
@@ -44,7 +45,7 @@ namespace Multiplayer
         , m_clearRemovedReplicators([this]() { ClearRemovedReplicators(); }, AZ::Name("EntityReplicationManager::ClearRemovedReplicators"))
         , m_entityActivatedEventHandler([this](AZ::Entity* entity) { OnEntityActivated(entity); })
         , m_entityDeactivatedEventHandler([this](AZ::Entity* entity) { OnEntityDeactivated(entity); })
-        , m_updateWindow([this]() { UpdateWindow(); }, AZ::Name("EntityReplicationManager::UpdateWindow"))
+        , m_updateWindow([this]() { OnUpdateWindowEvent(); }, AZ::Name("EntityReplicationManager::UpdateWindow"))
         , m_entityExitDomainEventHandler([this](const ConstNetworkEntityHandle& entityHandle) { OnEntityExitDomain(entityHandle); })
         , m_notifyEntityMigrationHandler([this](const ConstNetworkEntityHandle& entityHandle, const HostId& remoteHostId) { OnPostEntityMigration(entityHandle, remoteHostId); })
     {
@@ -1144,60 +1145,68 @@ namespace Multiplayer
 
     void EntityReplicationManager::UpdateWindow()
     {
+        if (UpdateReplicationSet())
+        {
+            ApplyReplicationSet();
+        }
+    }
+
+    void EntityReplicationManager::OnUpdateWindowEvent()
+    {
+        if (sv_taskGraphConnectionUpdates && (m_updateMode == Mode::LocalServerToRemoteClient))
+        {
+            // The multiplayer system component updates the window along with the other connections on its next tick
+            m_replicationSetUpdatePending = true;
+        }
+        else
+        {
+            UpdateWindow();
+        }
+    }
+
+    bool EntityReplicationManager::HasPendingReplicationSetUpdate() const
+    {
+        return m_replicationSetUpdatePending;
+    }
+
+    bool EntityReplicationManager::UpdateReplicationSet()
+    {
+        m_replicationSetUpdatePending = false;
+
         if (!m_replicationWindow)
         {
             // No window setup, this will occur during connection
-            return;
+            return false;
         }
 
         if (m_replicationWindow->ReplicationSetUpdateReady())
         {
             m_replicationWindow->UpdateWindow();
+            return true;
+        }
+        return false;
+    }
 
-            const ReplicationSet& newWindow = m_replicationWindow->GetReplicationSet();
+    void EntityReplicationManager::ApplyReplicationSet()
+    {
+        if (!m_replicationWindow)
+        {
+            return;
+        }
 
-            // Walk both for adds and removals
-            auto newWindowIter = newWindow.begin();
-            auto currWindowIter = m_entityReplicatorMap.begin();
-            while (newWindowIter != newWindow.end() && currWindowIter != m_entityReplicatorMap.end())
-            {
-                if (newWindowIter->first && (newWindowIter->first.GetNetEntityId() < currWindowIter->first))
-                {
-                    AddEntityReplicator(newWindowIter->first, newWindowIter->second.m_netEntityRole);
-                    ++newWindowIter;
-                }
-                else if (newWindowIter->first.GetNetEntityId() > currWindowIter->first)
-                {
-                    EntityReplicator* currReplicator = currWindowIter->second.get();
-                    if (currReplicator->OwnsReplicatorLifetime())
-                    {
-                        currReplicator->SetPendingRemoval(m_entityPendingRemovalMs);
-                    }
-                    ++currWindowIter;
-                }
-                else // Same entity
-                {
-                    // Check if we changed modes
-                    EntityReplicator* currReplicator = currWindowIter->second.get();
-                    if (currReplicator->GetRemoteNetworkRole() != newWindowIter->second.m_netEntityRole)
-                    {
-                        currReplicator = AddEntityReplicator(newWindowIter->first, newWindowIter->second.m_netEntityRole);
-                    }
-                    currReplicator->ClearPendingRemoval();
-                    ++newWindowIter;
-                    ++currWindowIter;
-                }
-            }
+        const ReplicationSet& newWindow = m_replicationWindow->GetReplicationSet();
 
-            // Do remaining adds
-            while (newWindowIter != newWindow.end())
+        // Walk both for adds and removals
+        auto newWindowIter = newWindow.begin();
+        auto currWindowIter = m_entityReplicatorMap.begin();
+        while (newWindowIter != newWindow.end() && currWindowIter != m_entityReplicatorMap.end())
+        {
+            if (newWindowIter->first && (newWindowIter->first.GetNetEntityId() < currWindowIter->first))
             {
                 AddEntityReplicator(newWindowIter->first, newWindowIter->second.m_netEntityRole);
                 ++newWindowIter;
             }
-
-            // Do remaining removes
-            while (currWindowIter != m_entityReplicatorMap.end())
+            else if (newWindowIter->first.GetNetEntityId() > currWindowIter->first)
             {
                 EntityReplicator* currReplicator = currWindowIter->second.get();
                 if (currReplicator->OwnsReplicatorLifetime())
@@ -1206,6 +1215,36 @@ namespace Multiplayer
                 }
                 ++currWindowIter;
             }
+            else // Same entity
+            {
+                // Check if we changed modes
+                EntityReplicator* currReplicator = currWindowIter->second.get();
+                if (currReplicator->GetRemoteNetworkRole() != newWindowIter->second.m_netEntityRole)
+                {
+                    currReplicator = AddEntityReplicator(newWindowIter->first, newWindowIter->second.m_netEntityRole);
+                }
+                currReplicator->ClearPendingRemoval();
+                ++newWindowIter;
+                ++currWindowIter;
+            }
+        }
+
+        // Do remaining adds
+        while (newWindowIter != newWindow.end())
+        {
+            AddEntityReplicator(newWindowIter->first, newWindowIter->second.m_netEntityRole);
+            ++newWindowIter;
+        }
+
+        // Do remaining removes
+        while (currWindowIter != m_entityReplicatorMap.end())
+        {
+            EntityReplicator* currReplicator = currWindowIter->second.get();
+            if (currReplicator->OwnsReplicatorLifetime())
+            {
+                currReplicator->SetPendingRemoval(m_entityPendingRemovalMs);
+            }
+            ++currWindowIter;
         }
     }
 
@@ -15,6 +15,7 @@
 namespace Multiplayer
 {
     AZ_CVAR(uint32_t, net_EntityReplicatorRecordsMax, 45, nullptr, AZ::ConsoleFunctorFlags::Null, "Number of allowed outstanding entity records");
+    AZ_CVAR(bool, net_EntityReplicatorShareStateDeltas, true, nullptr, AZ::ConsoleFunctorFlags::Null, "If true, connections needing the same changes to an entity share a single serialization of them each tick");
 
     PropertyPublisher::PropertyPublisher(NetEntityRole remoteNetworkRole, OwnsLifetime ownsLifetime, AzNetworking::IConnection& connection)
         : m_ownsLifetime(ownsLifetime)
@@ -372,10 +373,37 @@ namespace Multiplayer
             updateMessage.SetPrefabEntityId(netBindComponent->GetPrefabEntityId());
         }
 
-        InputSerializer inputSerializer(
-            updateMessage.ModifyData().GetBuffer(), static_cast<uint32_t>(updateMessage.ModifyData().GetCapacity()));
-        SerializeEntityRecord(inputSerializer, netBindComponent);
-        updateMessage.ModifyData().Resize(inputSerializer.GetSize());
+        // Every connection with the same pending record needs the same bytes, so reuse them if another connection already
+        // serialized this record since the entity was last dirtied
+        AzNetworking::PacketEncodingBuffer& updateData = updateMessage.ModifyData();
+        StateDeltaCache& stateDeltaCache = netBindComponent->GetStateDeltaCache();
+        const bool shareStateDeltas = net_EntityReplicatorShareStateDeltas;
+        MultiplayerStats::PropertiesSent propertiesSent;
+        if (shareStateDeltas && stateDeltaCache.Retrieve(m_pendingRecord, updateData, propertiesSent))
+        {
+            // The property updates are sent again, so record them like the connection that serialized them did
+            GetMultiplayer()->GetStats().ReplayPropertiesSent(
+                netBindComponent->GetEntityId(), netBindComponent->GetEntity()->GetName().c_str(), propertiesSent);
+            return updateMessage;
+        }
+
+        if (shareStateDeltas)
+        {
+            MultiplayerStats::BeginCapturePropertiesSent(propertiesSent);
+        }
+
+        InputSerializer inputSerializer(updateData.GetBuffer(), static_cast<uint32_t>(updateData.GetCapacity()));
+        const bool serialized = SerializeEntityRecord(inputSerializer, netBindComponent);
+        updateData.Resize(inputSerializer.GetSize());
+
+        if (shareStateDeltas)
+        {
+            MultiplayerStats::EndCapturePropertiesSent();
+            if (serialized)
+            {
+                stateDeltaCache.Store(m_pendingRecord, updateData, propertiesSent);
+            }
+        }
 
         return updateMessage;
     }
@@ -0,0 +1,63 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Multiplayer/NetworkEntity/EntityReplication/StateDeltaCache.h>
+#include <AzCore/std/parallel/scoped_lock.h>
+
+namespace Multiplayer
+{
+    bool StateDeltaCache::Retrieve(
+        const ReplicationRecord& record,
+        AzNetworking::PacketEncodingBuffer& outData,
+        MultiplayerStats::PropertiesSent& outPropertiesSent) const
+    {
+        AZStd::scoped_lock<AZStd::mutex> lock(m_mutex);
+        for (const CachedStateDelta& cachedStateDelta : m_cachedStateDeltas)
+        {
+            if (cachedStateDelta.m_record.HasSameChanges(record))
+            {
+                outPropertiesSent = cachedStateDelta.m_propertiesSent;
+                return outData.CopyValues(cachedStateDelta.m_data.data(), cachedStateDelta.m_data.size());
+            }
+        }
+        return false;
+    }
+
+    void StateDeltaCache::Store(
+        const ReplicationRecord& record,
+        const AzNetworking::PacketEncodingBuffer& data,
+        const MultiplayerStats::PropertiesSent& propertiesSent)
+    {
+        AZStd::scoped_lock<AZStd::mutex> lock(m_mutex);
+        if (m_cachedStateDeltas.size() >= MaxCachedRecords)
+        {
+            return;
+        }
+
+        for (const CachedStateDelta& cachedStateDelta : m_cachedStateDeltas)
+        {
+            if (cachedStateDelta.m_record.HasSameChanges(record))
+            {
+                // Another connection serialized the same record in parallel
+                return;
+            }
+        }
+
+        CachedStateDelta& cachedStateDelta = m_cachedStateDeltas.emplace_back();
+        cachedStateDelta.m_record = record;
+        cachedStateDelta.m_data.assign(data.GetBuffer(), data.GetBuffer() + data.GetSize());
+        cachedStateDelta.m_propertiesSent = propertiesSent;
+    }
+
+    void StateDeltaCache::Invalidate()
+    {
+        AZStd::scoped_lock<AZStd::mutex> lock(m_mutex);
+        // Release the memory as well, most entities are only dirtied occasionally and shouldn't hold on to stale state deltas
+        AZStd::vector<CachedStateDelta>().swap(m_cachedStateDeltas);
+    }
+}
@@ -64,6 +64,10 @@ namespace Multiplayer
         }
 
         m_entityDomain = AZStd::move(entityDomain);
+        if (m_entityDomain != nullptr)
+        {
+            m_entityDomain->ActivateTracking();
+        }
     }
 
     bool NetworkEntityManager::IsInitialized() const
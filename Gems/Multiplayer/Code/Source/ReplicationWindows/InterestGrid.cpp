@@ -0,0 +1,306 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Source/ReplicationWindows/InterestGrid.h>
+#include <Source/NetworkEntity/NetworkEntityTracker.h>
+#include <Multiplayer/IMultiplayer.h>
+#include <Multiplayer/Components/NetBindComponent.h>
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/Debug/Profiler.h>
+#include <AzCore/Interface/Interface.h>
+#include <AzCore/Math/SimdMath.h>
+#include <AzCore/std/math.h>
+#include <AzCore/std/sort.h>
+
+namespace Multiplayer
+{
+    AZ_CVAR(float, sv_InterestGridCellSize, 100.0f, nullptr, AZ::ConsoleFunctorFlags::DontReplicate,
+        "The width and depth of a cell of the shared interest grid, only applied when the grid is created");
+
+    namespace
+    {
+        using Vec4 = AZ::Simd::Vec4;
+
+        uint64_t PackCellKey(int64_t cellX, int64_t cellY)
+        {
+            return (static_cast<uint64_t>(static_cast<uint32_t>(cellX)) << 32) | static_cast<uint64_t>(static_cast<uint32_t>(cellY));
+        }
+
+        int64_t GetCellCoordinate(float value, float inverseCellSize)
+        {
+            return static_cast<int64_t>(AZStd::floor(value * inverseCellSize));
+        }
+    }
+
+    InterestGrid::InterestGrid()
+        : InterestGrid(sv_InterestGridCellSize)
+    {
+        ;
+    }
+
+    InterestGrid::InterestGrid(float cellSize)
+        : m_cellSize(AZStd::max(cellSize, 1.0f))
+        , m_inverseCellSize(1.0f / m_cellSize)
+        , m_entityActivatedEventHandler([this](AZ::Entity* entity) { AddEntity(entity); })
+        , m_entityDeactivatedEventHandler([this](AZ::Entity* entity) { RemoveEntity(entity); })
+    {
+        if (AZ::Interface<InterestGrid>::Get() == nullptr)
+        {
+            AZ::Interface<InterestGrid>::Register(this);
+        }
+
+        if (AZ::ComponentApplicationRequests* componentApplication = AZ::Interface<AZ::ComponentApplicationRequests>::Get())
+        {
+            componentApplication->RegisterEntityActivatedEventHandler(m_entityActivatedEventHandler);
+            componentApplication->RegisterEntityDeactivatedEventHandler(m_entityDeactivatedEventHandler);
+        }
+
+        // Pick up any networked entities that were activated before the grid was created
+        if (NetworkEntityTracker* networkEntityTracker = GetNetworkEntityTracker())
+        {
+            for (auto iter = networkEntityTracker->begin(); iter != networkEntityTracker->end(); ++iter)
+            {
+                AZ::Entity* entity = iter->second;
+                if ((entity != nullptr) && (entity->GetState() == AZ::Entity::State::Active))
+                {
+                    AddEntity(entity);
+                }
+            }
+        }
+    }
+
+    InterestGrid::~InterestGrid()
+    {
+        m_entityActivatedEventHandler.Disconnect();
+        m_entityDeactivatedEventHandler.Disconnect();
+
+        if (AZ::Interface<InterestGrid>::Get() == this)
+        {
+            AZ::Interface<InterestGrid>::Unregister(this);
+        }
+    }
+
+    bool InterestGrid::AddEntity(AZ::Entity* entity)
+    {
+        if ((entity == nullptr) || m_trackedEntities.contains(entity->GetId()))
+        {
+            return false;
+        }
+
+        ConstNetworkEntityHandle entityHandle(entity, GetNetworkEntityTracker());
+        AZ::TransformInterface* transformInterface = entity->GetTransform();
+        if ((entityHandle.GetNetBindComponent() == nullptr) || (transformInterface == nullptr))
+        {
+            return false;
+        }
+
+        auto trackedEntity = AZStd::make_unique<TrackedEntity>();
+        TrackedEntity& trackedEntityRef = *trackedEntity;
+        trackedEntityRef.m_entityHandle = entityHandle;
+        trackedEntityRef.m_transformChangedHandler = AZ::TransformChangedEvent::Handler(
+            [this, &trackedEntityRef]([[maybe_unused]] const AZ::Transform& localTm, const AZ::Transform& worldTm)
+            {
+                OnTransformChanged(trackedEntityRef, worldTm.GetTranslation());
+            });
+        transformInterface->BindTransformChangedEventHandler(trackedEntityRef.m_transformChangedHandler);
+        InsertIntoCell(trackedEntityRef, transformInterface->GetWorldTranslation());
+
+        m_trackedEntities.emplace(entity->GetId(), AZStd::move(trackedEntity));
+        return true;
+    }
+
+    void InterestGrid::RemoveEntity(AZ::Entity* entity)
+    {
+        if (entity == nullptr)
+        {
+            return;
+        }
+
+        auto iter = m_trackedEntities.find(entity->GetId());
+        if (iter != m_trackedEntities.end())
+        {
+            iter->second->m_transformChangedHandler.Disconnect();
+            RemoveFromCell(*iter->second);
+            m_trackedEntities.erase(iter);
+        }
+    }
+
+    bool InterestGrid::IsTracked(const AZ::Entity* entity) const
+    {
+        return (entity != nullptr) && m_trackedEntities.contains(entity->GetId());
+    }
+
+    uint32_t InterestGrid::GetEntityCount() const
+    {
+        return aznumeric_cast<uint32_t>(m_trackedEntities.size());
+    }
+
+    uint32_t InterestGrid::GetCellCount() const
+    {
+        return aznumeric_cast<uint32_t>(m_cells.size());
+    }
+
+    void InterestGrid::GatherCandidates(const AZ::Vector3& position, float radius, CandidateList& outCandidates) const
+    {
+        AZ_PROFILE_SCOPE(MULTIPLAYER, "InterestGrid: GatherCandidates");
+
+        if ((radius < 0.0f) || m_cells.empty())
+        {
+            return;
+        }
+
+        const float radiusSq = radius * radius;
+        const int64_t minCellX = GetCellCoordinate(position.GetX() - radius, m_inverseCellSize);
+        const int64_t maxCellX = GetCellCoordinate(position.GetX() + radius, m_inverseCellSize);
+        const int64_t minCellY = GetCellCoordinate(position.GetY() - radius, m_inverseCellSize);
+        const int64_t maxCellY = GetCellCoordinate(position.GetY() + radius, m_inverseCellSize);
+
+        // When the radius spans more cells than are occupied it is cheaper to test every occupied cell
+        const uint64_t rangeCellCount = static_cast<uint64_t>(maxCellX - minCellX + 1) * static_cast<uint64_t>(maxCellY - minCellY + 1);
+        if (rangeCellCount > m_cells.size())
+        {
+            for (const auto& [cellKey, cell] : m_cells)
+            {
+                GatherFromCell(cell, position, radiusSq, outCandidates);
+            }
+            return;
+        }
+
+        for (int64_t cellX = minCellX; cellX <= maxCellX; ++cellX)
+        {
+            for (int64_t cellY = minCellY; cellY <= maxCellY; ++cellY)
+            {
+                auto cellIter = m_cells.find(PackCellKey(cellX, cellY));
+                if (cellIter != m_cells.end())
+                {
+                    GatherFromCell(cellIter->second, position, radiusSq, outCandidates);
+                }
+            }
+        }
+    }
+
+    void InterestGrid::SelectTopCandidates(CandidateList& candidates, uint32_t maxCount)
+    {
+        if (candidates.size() > maxCount)
+        {
+            AZStd::nth_element(candidates.begin(), candidates.begin() + maxCount, candidates.end(),
+                [](const Candidate& lhs, const Candidate& rhs) { return lhs.m_priority > rhs.m_priority; });
+            candidates.resize(maxCount);
+        }
+    }
+
+    InterestGrid::CellKey InterestGrid::GetCellKey(float x, float y) const
+    {
+        return PackCellKey(GetCellCoordinate(x, m_inverseCellSize), GetCellCoordinate(y, m_inverseCellSize));
+    }
+
+    void InterestGrid::InsertIntoCell(TrackedEntity& trackedEntity, const AZ::Vector3& position)
+    {
+        trackedEntity.m_cellKey = GetCellKey(position.GetX(), position.GetY());
+        Cell& cell = m_cells[trackedEntity.m_cellKey];
+        trackedEntity.m_indexInCell = aznumeric_cast<uint32_t>(cell.m_entities.size());
+        cell.m_positionX.push_back(position.GetX());
+        cell.m_positionY.push_back(position.GetY());
+        cell.m_positionZ.push_back(position.GetZ());
+        cell.m_entities.push_back(&trackedEntity);
+    }
+
+    void InterestGrid::RemoveFromCell(TrackedEntity& trackedEntity)
+    {
+        auto cellIter = m_cells.find(trackedEntity.m_cellKey);
+        AZ_Assert(cellIter != m_cells.end(), "Tracked entity refers to a cell that does not exist");
+        Cell& cell = cellIter->second;
+
+        // Swap the last entity of the cell into the removed slot so the arrays stay packed
+        const uint32_t index = trackedEntity.m_indexInCell;
+        const uint32_t lastIndex = aznumeric_cast<uint32_t>(cell.m_entities.size() - 1);
+        if (index != lastIndex)
+        {
+            cell.m_positionX[index] = cell.m_positionX[lastIndex];
+            cell.m_positionY[index] = cell.m_positionY[lastIndex];
+            cell.m_positionZ[index] = cell.m_positionZ[lastIndex];
+            cell.m_entities[index] = cell.m_entities[lastIndex];
+            cell.m_entities[index]->m_indexInCell = index;
+        }
+        cell.m_positionX.pop_back();
+        cell.m_positionY.pop_back();
+        cell.m_positionZ.pop_back();
+        cell.m_entities.pop_back();
+
+        if (cell.m_entities.empty())
+        {
+            m_cells.erase(cellIter);
+        }
+    }
+
+    void InterestGrid::OnTransformChanged(TrackedEntity& trackedEntity, const AZ::Vector3& position)
+    {
+        if (GetCellKey(position.GetX(), position.GetY()) == trackedEntity.m_cellKey)
+        {
+            // Still in the same cell, just update the stored position
+            Cell& cell = m_cells[trackedEntity.m_cellKey];
+            cell.m_positionX[trackedEntity.m_indexInCell] = position.GetX();
+            cell.m_positionY[trackedEntity.m_indexInCell] = position.GetY();
+            cell.m_positionZ[trackedEntity.m_indexInCell] = position.GetZ();
+            return;
+        }
+
+        RemoveFromCell(trackedEntity);
+        InsertIntoCell(trackedEntity, position);
+    }
+
+    void InterestGrid::GatherFromCell(const Cell& cell, const AZ::Vector3& position, float radiusSq, CandidateList& outCandidates) const
+    {
+        const uint32_t entityCount = aznumeric_cast<uint32_t>(cell.m_entities.size());
+        const uint32_t blockEnd = entityCount - (entityCount % Vec4::ElementCount);
+
+        const Vec4::FloatType positionX = Vec4::Splat(position.GetX());
+        const Vec4::FloatType positionY = Vec4::Splat(position.GetY());
+        const Vec4::FloatType positionZ = Vec4::Splat(position.GetZ());
+        const Vec4::FloatType radiusSqSplat = Vec4::Splat(radiusSq);
+        const Vec4::FloatType zero = Vec4::ZeroFloat();
+        const Vec4::FloatType one = Vec4::Splat(1.0f);
+
+        for (uint32_t blockStart = 0; blockStart < blockEnd; blockStart += Vec4::ElementCount)
+        {
+            const Vec4::FloatType deltaX = Vec4::Sub(Vec4::LoadUnaligned(&cell.m_positionX[blockStart]), positionX);
+            const Vec4::FloatType deltaY = Vec4::Sub(Vec4::LoadUnaligned(&cell.m_positionY[blockStart]), positionY);
+            const Vec4::FloatType deltaZ = Vec4::Sub(Vec4::LoadUnaligned(&cell.m_positionZ[blockStart]), positionZ);
+            const Vec4::FloatType distanceSq = Vec4::Madd(deltaX, deltaX, Vec4::Madd(deltaY, deltaY, Vec4::Mul(deltaZ, deltaZ)));
+            const Vec4::FloatType inRange = Vec4::CmpLtEq(distanceSq, radiusSqSplat);
+
+            // Entities sitting exactly on the gather position get a priority of zero, the inf from dividing by zero is masked out
+            const Vec4::FloatType priority = Vec4::And(Vec4::Div(one, distanceSq), Vec4::CmpGt(distanceSq, zero));
+
+            alignas(16) float distanceSqLanes[Vec4::ElementCount];
+            alignas(16) float priorityLanes[Vec4::ElementCount];
+            alignas(16) int32_t inRangeLanes[Vec4::ElementCount];
+            Vec4::StoreAligned(distanceSqLanes, distanceSq);
+            Vec4::StoreAligned(priorityLanes, priority);
+            Vec4::StoreAligned(inRangeLanes, Vec4::CastToInt(inRange));
+
+            for (uint32_t lane = 0; lane < Vec4::ElementCount; ++lane)
+            {
+                if (inRangeLanes[lane])
+                {
+                    outCandidates.push_back({ cell.m_entities[blockStart + lane]->m_entityHandle, priorityLanes[lane], distanceSqLanes[lane] });
+                }
+            }
+        }
+
+        for (uint32_t index = blockEnd; index < entityCount; ++index)
+        {
+            const float distanceSq = position.GetDistanceSq(AZ::Vector3(cell.m_positionX[index], cell.m_positionY[index], cell.m_positionZ[index]));
+            if (distanceSq <= radiusSq)
+            {
+                const float priority = (distanceSq > 0.0f) ? 1.0f / distanceSq : 0.0f;
+                outCandidates.push_back({ cell.m_entities[index]->m_entityHandle, priority, distanceSq });
+            }
+        }
+    }
+}
@@ -0,0 +1,117 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <Multiplayer/NetworkEntity/NetworkEntityHandle.h>
+#include <AzCore/Component/ComponentApplicationBus.h>
+#include <AzCore/Component/TransformBus.h>
+#include <AzCore/Math/Vector3.h>
+#include <AzCore/RTTI/RTTI.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+
+namespace Multiplayer
+{
+    //! A uniform grid of networked entities shared by all server to client replication windows.
+    //! The grid is kept up to date incrementally from entity transform changes, so each window only has to walk the cells
+    //! around its controlled entity instead of querying the visibility system once per connection.
+    //! Cells partition the world along x and y and store entity positions as separate x, y and z arrays so that
+    //! distances can be tested four entities at a time.
+    class InterestGrid
+    {
+    public:
+        AZ_RTTI(InterestGrid, "{3D2AA749-AA53-4DA3-AFB2-0B8DD621107F}");
+
+        struct Candidate
+        {
+            ConstNetworkEntityHandle m_entityHandle;
+            float m_priority = 0.0f;
+            float m_distanceSq = 0.0f;
+        };
+        using CandidateList = AZStd::vector<Candidate>;
+
+        //! Uses the sv_InterestGridCellSize cvar for the cell size.
+        InterestGrid();
+        //! @param cellSize the width and depth of every grid cell
+        explicit InterestGrid(float cellSize);
+        virtual ~InterestGrid();
+
+        //! Starts tracking an entity, entities without a NetBindComponent or a transform are ignored.
+        //! @param entity the entity to track
+        //! @return true if the entity is now tracked by the grid
+        bool AddEntity(AZ::Entity* entity);
+
+        //! Stops tracking an entity.
+        //! @param entity the entity to stop tracking
+        void RemoveEntity(AZ::Entity* entity);
+
+        //! Returns whether or not an entity is tracked by the grid.
+        //! @param entity the entity to check
+        //! @return true if the entity is tracked
+        bool IsTracked(const AZ::Entity* entity) const;
+
+        //! Returns the number of entities tracked by the grid.
+        //! @return the number of tracked entities
+        uint32_t GetEntityCount() const;
+
+        //! Returns the number of cells that currently hold at least one entity.
+        //! @return the number of occupied cells
+        uint32_t GetCellCount() const;
+
+        //! Appends every tracked entity within a radius of a position to the candidate list, along with its replication priority.
+        //! Priority is the inverse squared distance, matching the visibility based path of the replication window.
+        //! Only reads grid state, so connections may gather concurrently as long as no entity moves in the meantime.
+        //! @param position       the position to gather around
+        //! @param radius         the maximum distance of an entity from the position
+        //! @param outCandidates  the list the gathered entities are appended to
+        void GatherCandidates(const AZ::Vector3& position, float radius, CandidateList& outCandidates) const;
+
+        //! Keeps the maxCount highest priority candidates, in no particular order.
+        //! @param candidates the candidates to select from, shrunk to at most maxCount entries
+        //! @param maxCount   the maximum number of candidates to keep
+        static void SelectTopCandidates(CandidateList& candidates, uint32_t maxCount);
+
+    private:
+        using CellKey = uint64_t;
+
+        struct TrackedEntity;
+
+        //! Entity positions in a cell, stored as separate arrays for batched distance tests.
+        struct Cell
+        {
+            AZStd::vector<float> m_positionX;
+            AZStd::vector<float> m_positionY;
+            AZStd::vector<float> m_positionZ;
+            AZStd::vector<TrackedEntity*> m_entities;
+        };
+
+        struct TrackedEntity
+        {
+            ConstNetworkEntityHandle m_entityHandle;
+            AZ::TransformChangedEvent::Handler m_transformChangedHandler;
+            CellKey m_cellKey = 0;
+            uint32_t m_indexInCell = 0;
+        };
+
+        CellKey GetCellKey(float x, float y) const;
+        void InsertIntoCell(TrackedEntity& trackedEntity, const AZ::Vector3& position);
+        void RemoveFromCell(TrackedEntity& trackedEntity);
+        void OnTransformChanged(TrackedEntity& trackedEntity, const AZ::Vector3& position);
+        void GatherFromCell(const Cell& cell, const AZ::Vector3& position, float radiusSq, CandidateList& outCandidates) const;
+
+        AZStd::unordered_map<CellKey, Cell> m_cells;
+        AZStd::unordered_map<AZ::EntityId, AZStd::unique_ptr<TrackedEntity>> m_trackedEntities;
+        float m_cellSize = 0.0f;
+        float m_inverseCellSize = 0.0f;
+
+        AZ::EntityActivatedEvent::Handler m_entityActivatedEventHandler;
+        AZ::EntityDeactivatedEvent::Handler m_entityDeactivatedEventHandler;
+    };
+}
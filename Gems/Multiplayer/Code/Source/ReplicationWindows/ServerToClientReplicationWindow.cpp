@@ -7,6 +7,7 @@
  */
 
 #include <Source/ReplicationWindows/ServerToClientReplicationWindow.h>
+#include <Source/ReplicationWindows/InterestGrid.h>
 #include <Source/AutoGen/Multiplayer.AutoPackets.h>
 #include <Multiplayer/Components/NetBindComponent.h>
 #include <Multiplayer/Components/NetworkHierarchyRootComponent.h>
@@ -112,6 +113,39 @@ namespace Multiplayer
         AZ::TransformInterface* transformInterface = m_controlledEntity.GetEntity()->GetTransform();
         const AZ::Vector3 controlledEntityPosition = transformInterface->GetWorldTranslation();
 
+        if (InterestGrid* interestGrid = AZ::Interface<InterestGrid>::Get())
+        {
+            GatherFromInterestGrid(*interestGrid, controlledEntityPosition);
+        }
+        else
+        {
+            GatherFromVisibilitySystem(controlledEntityPosition);
+        }
+
+        // Add in all entities that have forced relevancy
+        const Multiplayer::NetEntityHandleSet& alwaysRelevantToClients = GetNetworkEntityManager()->GetAlwaysRelevantToClientsSet();
+        for (const ConstNetworkEntityHandle& entityHandle : alwaysRelevantToClients)
+        {
+            if (entityHandle.Exists())
+            {
+                AZ_Assert(entityHandle.GetNetBindComponent()->IsNetEntityRoleAuthority(), "Encountered forced relevant entity that is not in an authority role");
+                m_replicationSet[entityHandle] = { NetEntityRole::Client, 1.0f }; // Always replicate entities with forced relevancy
+            }
+        }
+
+        // Add in Autonomous Entities
+        // Note: Do not add any Client entities after this point, otherwise you stomp over the Autonomous mode
+        m_replicationSet[m_controlledEntity] = { NetEntityRole::Autonomous, 1.0f }; // Always replicate autonomous entities
+
+        auto* hierarchyComponent = m_controlledEntity.FindComponent<NetworkHierarchyRootComponent>();
+        if (hierarchyComponent != nullptr)
+        {
+            UpdateHierarchyReplicationSet(m_replicationSet, *hierarchyComponent);
+        }
+    }
+
+    void ServerToClientReplicationWindow::GatherFromVisibilitySystem(const AZ::Vector3& controlledEntityPosition)
+    {
         AZStd::vector<AzFramework::VisibilityEntry*> gatheredEntries;
         AZ::Sphere awarenessSphere = AZ::Sphere(controlledEntityPosition, sv_ClientAwarenessRadius);
         AzFramework::IVisibilitySystem* visibilitySystem = AZ::Interface<AzFramework::IVisibilitySystem>::Get();
@@ -159,26 +193,35 @@ namespace Multiplayer
                 
             AddEntityToReplicationSet(entityHandle, priority, gatherDistanceSquared);
         }
+    }
 
-        // Add in all entities that have forced relevancy
-        const Multiplayer::NetEntityHandleSet& alwaysRelevantToClients = GetNetworkEntityManager()->GetAlwaysRelevantToClientsSet();
-        for (const ConstNetworkEntityHandle& entityHandle : alwaysRelevantToClients)
+    void ServerToClientReplicationWindow::GatherFromInterestGrid(const InterestGrid& interestGrid, const AZ::Vector3& controlledEntityPosition)
+    {
+        m_gridCandidates.clear();
+        interestGrid.GatherCandidates(controlledEntityPosition, sv_ClientAwarenessRadius, m_gridCandidates);
+
+        IFilterEntityManager* filterEntityManager = AZ::Interface<IFilterEntityManager>::Get();
+        const AzNetworking::ConnectionId connectionId = m_connection->GetConnectionId();
+        AZStd::erase_if(m_gridCandidates, [this, filterEntityManager, connectionId](InterestGrid::Candidate& candidate)
         {
-            if (entityHandle.Exists())
+            AZ::Entity* entity = candidate.m_entityHandle.GetEntity();
+            if ((entity == nullptr) || (filterEntityManager && filterEntityManager->IsEntityFiltered(entity, m_controlledEntity, connectionId)))
             {
-                AZ_Assert(entityHandle.GetNetBindComponent()->IsNetEntityRoleAuthority(), "Encountered forced relevant entity that is not in an authority role");
-                m_replicationSet[entityHandle] = { NetEntityRole::Client, 1.0f }; // Always replicate entities with forced relevancy
+                return true;
             }
-        }
-
-        // Add in Autonomous Entities
-        // Note: Do not add any Client entities after this point, otherwise you stomp over the Autonomous mode
-        m_replicationSet[m_controlledEntity] = { NetEntityRole::Autonomous, 1.0f }; // Always replicate autonomous entities
+            if (!sv_ReplicateServerProxies)
+            {
+                const NetBindComponent* netBindComponent = candidate.m_entityHandle.GetNetBindComponent();
+                return (netBindComponent != nullptr) && (netBindComponent->GetNetEntityRole() == NetEntityRole::Server);
+            }
+            return false;
+        });
 
-        auto* hierarchyComponent = m_controlledEntity.FindComponent<NetworkHierarchyRootComponent>();
-        if (hierarchyComponent != nullptr)
+        // A single partial selection replaces pushing every neighbour through the bounded candidate heap
+        InterestGrid::SelectTopCandidates(m_gridCandidates, sv_MaxEntitiesToTrackReplication);
+        for (const InterestGrid::Candidate& candidate : m_gridCandidates)
         {
-            UpdateHierarchyReplicationSet(m_replicationSet, *hierarchyComponent);
+            m_replicationSet[candidate.m_entityHandle] = { NetEntityRole::Client, candidate.m_priority };
         }
     }
 
@@ -11,6 +11,7 @@
 #include <Multiplayer/IMultiplayer.h>
 #include <Multiplayer/NetworkEntity/NetworkEntityHandle.h>
 #include <Multiplayer/ReplicationWindows/IReplicationWindow.h>
+#include <Source/ReplicationWindows/InterestGrid.h>
 #include <AzNetworking/ConnectionLayer/IConnection.h>
 #include <AzCore/Component/EntityBus.h>
 #include <AzCore/EBus/ScheduledEvent.h>
@@ -60,6 +61,11 @@ namespace Multiplayer
 
         void UpdateHierarchyReplicationSet(ReplicationSet& replicationSet, NetworkHierarchyRootComponent& hierarchyComponent);
 
+        //! Gathers nearby entities by querying the visibility system, feeding them through the bounded candidate queue.
+        void GatherFromVisibilitySystem(const AZ::Vector3& controlledEntityPosition);
+        //! Gathers nearby entities from the shared interest grid and keeps the highest priority ones.
+        void GatherFromInterestGrid(const InterestGrid& interestGrid, const AZ::Vector3& controlledEntityPosition);
+
         void EvaluateConnection();
         void AddEntityToReplicationSet(ConstNetworkEntityHandle& entityHandle, float priority, float distanceSquared);
 
@@ -68,6 +74,8 @@ namespace Multiplayer
         // sorted in reverse, lowest priority is the top()
         ReplicationCandidateQueue m_candidateQueue;
         ReplicationSet m_replicationSet;
+        // Reused between updates to avoid reallocating when gathering from the interest grid
+        InterestGrid::CandidateList m_gridCandidates;
 
         NetworkEntityHandle m_controlledEntity;
         AZ::TransformInterface* m_controlledEntityTransform = nullptr;
@@ -116,6 +116,8 @@ namespace Multiplayer
 
         void TearDown() override
         {
+            m_entityInfos.clear();
+
             m_multiplayerComponentRegistry.reset();
 
             AZ::Interface<AZ::IConsole>::Unregister(m_console.get());
@@ -256,6 +258,23 @@ namespace Multiplayer
             Role m_role = Role::None;
         };
 
+        //! Creates and activates a networked entity with a transform at the given position, owned by the fixture.
+        AZ::Entity* CreateEntity(NetEntityId netEntityId, const AZ::Vector3& position, NetEntityRole role = NetEntityRole::Authority)
+        {
+            const AZ::u64 entityId = aznumeric_cast<AZ::u64>(netEntityId);
+            auto entityInfo = AZStd::make_unique<EntityInfo>(entityId, "entity", netEntityId, EntityInfo::Role::None);
+            entityInfo->m_entity->CreateComponent<AzFramework::TransformComponent>();
+            entityInfo->m_entity->CreateComponent<NetBindComponent>();
+            SetupEntity(entityInfo->m_entity, netEntityId, role);
+            entityInfo->m_entity->Activate();
+            entityInfo->m_entity->GetTransform()->SetWorldTranslation(position);
+            AZ::Entity* entity = entityInfo->m_entity.get();
+            m_entityInfos.push_back(AZStd::move(entityInfo));
+            return entity;
+        }
+
+        AZStd::vector<AZStd::unique_ptr<EntityInfo>> m_entityInfos;
+
         void PopulateHierarchicalEntity(const EntityInfo& entityInfo)
         {
             entityInfo.m_entity->CreateComponent<AzFramework::TransformComponent>();
@@ -0,0 +1,290 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <CommonNetworkEntitySetup.h>
+#include <Source/ReplicationWindows/InterestGrid.h>
+#include <Source/ReplicationWindows/ServerToClientReplicationWindow.h>
+#include <AzCore/Component/TransformBus.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/unordered_set.h>
+#include <AzCore/std/sort.h>
+
+namespace Multiplayer
+{
+    using namespace testing;
+    using namespace ::UnitTest;
+
+    class InterestGridTests
+        : public NetworkEntityTests
+    {
+    public:
+        // Filters out a fixed set of entities for every connection
+        class TestFilterEntityManager
+            : public IFilterEntityManager
+        {
+        public:
+            bool IsEntityFiltered(AZ::Entity* entity, [[maybe_unused]] ConstNetworkEntityHandle controllerEntity,
+                [[maybe_unused]] AzNetworking::ConnectionId connectionId) override
+            {
+                return m_filteredEntities.find(entity->GetId()) != m_filteredEntities.end();
+            }
+
+            AZStd::unordered_set<AZ::EntityId> m_filteredEntities;
+        };
+
+        void SetUp() override
+        {
+            NetworkEntityTests::SetUp();
+
+            m_console->GetCvarValue<float>("sv_ClientAwarenessRadius", m_awarenessRadius);
+            m_console->GetCvarValue<bool>("sv_ReplicateServerProxies", m_replicateServerProxies);
+            m_console->GetCvarValue<uint32_t>("sv_MaxEntitiesToTrackReplication", m_maxEntitiesToTrackReplication);
+        }
+
+        void TearDown() override
+        {
+            m_console->PerformCommand((AZStd::string("sv_ClientAwarenessRadius ") + AZStd::to_string(m_awarenessRadius)).c_str());
+            m_console->PerformCommand(m_replicateServerProxies ? "sv_ReplicateServerProxies true" : "sv_ReplicateServerProxies false");
+            m_console->PerformCommand(
+                (AZStd::string("sv_MaxEntitiesToTrackReplication ") + AZStd::to_string(m_maxEntitiesToTrackReplication)).c_str());
+
+            if (AZ::Interface<IFilterEntityManager>::Get() == &m_filterEntityManager)
+            {
+                AZ::Interface<IFilterEntityManager>::Unregister(&m_filterEntityManager);
+            }
+
+            NetworkEntityTests::TearDown();
+        }
+
+        static AZStd::unordered_map<NetEntityId, float> ToPriorityMap(const InterestGrid::CandidateList& candidates)
+        {
+            AZStd::unordered_map<NetEntityId, float> priorities;
+            for (const InterestGrid::Candidate& candidate : candidates)
+            {
+                priorities[candidate.m_entityHandle.GetNetEntityId()] = candidate.m_priority;
+            }
+            return priorities;
+        }
+
+        static AZStd::vector<AZStd::pair<NetEntityId, NetEntityRole>> ToSortedList(const ReplicationSet& replicationSet)
+        {
+            AZStd::vector<AZStd::pair<NetEntityId, NetEntityRole>> entities;
+            for (const auto& [entityHandle, replicationData] : replicationSet)
+            {
+                entities.emplace_back(entityHandle.GetNetEntityId(), replicationData.m_netEntityRole);
+            }
+            AZStd::sort(entities.begin(), entities.end());
+            return entities;
+        }
+
+        TestFilterEntityManager m_filterEntityManager;
+        float m_awarenessRadius = 0.0f;
+        bool m_replicateServerProxies = true;
+        uint32_t m_maxEntitiesToTrackReplication = 0;
+    };
+
+    TEST_F(InterestGridTests, TestGatherMatchesBruteForce)
+    {
+        InterestGrid interestGrid(10.0f);
+
+        // Spread entities over several cells, including negative coordinates, with cell populations that are not a multiple of four
+        AZStd::vector<AZ::Vector3> positions;
+        for (uint32_t index = 0; index < 61; ++index)
+        {
+            const float x = static_cast<float>((index * 37) % 97) - 48.0f;
+            const float y = static_cast<float>((index * 53) % 89) - 44.0f;
+            const float z = static_cast<float>(index % 7) - 3.0f;
+            positions.push_back(AZ::Vector3(x, y, z));
+            AZ::Entity* entity = CreateEntity(NetEntityId{ index + 1 }, positions.back());
+            EXPECT_TRUE(interestGrid.AddEntity(entity));
+        }
+        EXPECT_EQ(interestGrid.GetEntityCount(), 61u);
+
+        const AZ::Vector3 gatherPosition(3.0f, -7.0f, 0.0f);
+        constexpr float Radius = 25.0f;
+        InterestGrid::CandidateList candidates;
+        interestGrid.GatherCandidates(gatherPosition, Radius, candidates);
+        const AZStd::unordered_map<NetEntityId, float> gathered = ToPriorityMap(candidates);
+        EXPECT_EQ(gathered.size(), candidates.size());
+
+        size_t expectedCount = 0;
+        for (uint32_t index = 0; index < positions.size(); ++index)
+        {
+            const float distanceSq = gatherPosition.GetDistanceSq(positions[index]);
+            auto iter = gathered.find(NetEntityId{ index + 1 });
+            if (distanceSq <= Radius * Radius)
+            {
+                ++expectedCount;
+                ASSERT_NE(iter, gathered.end());
+                EXPECT_NEAR(iter->second, 1.0f / distanceSq, 1e-6f);
+            }
+            else
+            {
+                EXPECT_EQ(iter, gathered.end());
+            }
+        }
+        EXPECT_GT(expectedCount, 0u);
+        EXPECT_EQ(candidates.size(), expectedCount);
+
+        // A radius covering more cells than are occupied gathers everything
+        candidates.clear();
+        interestGrid.GatherCandidates(gatherPosition, 10000.0f, candidates);
+        EXPECT_EQ(candidates.size(), positions.size());
+    }
+
+    TEST_F(InterestGridTests, TestMovedEntityChangesCell)
+    {
+        InterestGrid interestGrid(10.0f);
+        AZ::Entity* movingEntity = CreateEntity(NetEntityId{ 1 }, AZ::Vector3(5.0f, 5.0f, 0.0f));
+        AZ::Entity* staticEntity = CreateEntity(NetEntityId{ 2 }, AZ::Vector3(6.0f, 5.0f, 0.0f));
+        EXPECT_TRUE(interestGrid.AddEntity(movingEntity));
+        EXPECT_TRUE(interestGrid.AddEntity(staticEntity));
+        EXPECT_EQ(interestGrid.GetCellCount(), 1u);
+
+        // Moving within the cell only updates the stored position
+        movingEntity->GetTransform()->SetWorldTranslation(AZ::Vector3(2.0f, 2.0f, 0.0f));
+        InterestGrid::CandidateList candidates;
+        interestGrid.GatherCandidates(AZ::Vector3(2.0f, 2.0f, 0.0f), 1.0f, candidates);
+        ASSERT_EQ(candidates.size(), 1u);
+        EXPECT_EQ(candidates[0].m_entityHandle.GetNetEntityId(), NetEntityId{ 1 });
+        EXPECT_EQ(interestGrid.GetCellCount(), 1u);
+
+        // Moving to another cell is picked up from the transform change
+        movingEntity->GetTransform()->SetWorldTranslation(AZ::Vector3(55.0f, -5.0f, 0.0f));
+        EXPECT_EQ(interestGrid.GetCellCount(), 2u);
+
+        candidates.clear();
+        interestGrid.GatherCandidates(AZ::Vector3(2.0f, 2.0f, 0.0f), 1.0f, candidates);
+        EXPECT_TRUE(candidates.empty());
+
+        candidates.clear();
+        interestGrid.GatherCandidates(AZ::Vector3(55.0f, -5.0f, 0.0f), 1.0f, candidates);
+        ASSERT_EQ(candidates.size(), 1u);
+        EXPECT_EQ(candidates[0].m_entityHandle.GetNetEntityId(), NetEntityId{ 1 });
+        // An entity exactly on the gather position gets a priority of zero, like the visibility based path
+        EXPECT_EQ(candidates[0].m_priority, 0.0f);
+
+        // The entity left behind is still found after the swap removal from the old cell
+        candidates.clear();
+        interestGrid.GatherCandidates(AZ::Vector3(6.0f, 5.0f, 0.0f), 0.5f, candidates);
+        ASSERT_EQ(candidates.size(), 1u);
+        EXPECT_EQ(candidates[0].m_entityHandle.GetNetEntityId(), NetEntityId{ 2 });
+    }
+
+    TEST_F(InterestGridTests, TestAddAndRemoveEntity)
+    {
+        InterestGrid interestGrid(10.0f);
+        AZ::Entity* entity = CreateEntity(NetEntityId{ 1 }, AZ::Vector3(5.0f, 5.0f, 0.0f));
+        EXPECT_TRUE(interestGrid.AddEntity(entity));
+        EXPECT_FALSE(interestGrid.AddEntity(entity));
+        EXPECT_TRUE(interestGrid.IsTracked(entity));
+
+        // Entities that are not networked are never tracked
+        AZ::Entity plainEntity(AZ::EntityId(100), "plain");
+        plainEntity.CreateComponent<AzFramework::TransformComponent>();
+        plainEntity.Init();
+        plainEntity.Activate();
+        EXPECT_FALSE(interestGrid.AddEntity(&plainEntity));
+        plainEntity.Deactivate();
+
+        interestGrid.RemoveEntity(entity);
+        EXPECT_FALSE(interestGrid.IsTracked(entity));
+        EXPECT_EQ(interestGrid.GetEntityCount(), 0u);
+        EXPECT_EQ(interestGrid.GetCellCount(), 0u);
+
+        // Moving an entity that is no longer tracked leaves the grid untouched
+        entity->GetTransform()->SetWorldTranslation(AZ::Vector3(55.0f, 5.0f, 0.0f));
+        EXPECT_EQ(interestGrid.GetCellCount(), 0u);
+
+        InterestGrid::CandidateList candidates;
+        interestGrid.GatherCandidates(AZ::Vector3(55.0f, 5.0f, 0.0f), 100.0f, candidates);
+        EXPECT_TRUE(candidates.empty());
+    }
+
+    TEST_F(InterestGridTests, TestSelectTopCandidatesKeepsHighestPriorities)
+    {
+        InterestGrid::CandidateList candidates;
+        for (uint32_t index = 0; index < 10; ++index)
+        {
+            // Priorities are shuffled so the selection can't rely on the input order
+            const float priority = static_cast<float>((index * 7) % 10);
+            candidates.push_back({ ConstNetworkEntityHandle(), priority, 0.0f });
+        }
+
+        InterestGrid::SelectTopCandidates(candidates, 3);
+        ASSERT_EQ(candidates.size(), 3u);
+        AZStd::vector<float> priorities;
+        for (const InterestGrid::Candidate& candidate : candidates)
+        {
+            priorities.push_back(candidate.m_priority);
+        }
+        AZStd::sort(priorities.begin(), priorities.end());
+        EXPECT_EQ(priorities[0], 7.0f);
+        EXPECT_EQ(priorities[1], 8.0f);
+        EXPECT_EQ(priorities[2], 9.0f);
+
+        // Lists already within the limit are left alone
+        InterestGrid::SelectTopCandidates(candidates, 5);
+        EXPECT_EQ(candidates.size(), 3u);
+    }
+
+    TEST_F(InterestGridTests, TestReplicationWindowGathersFromInterestGrid)
+    {
+        m_console->PerformCommand("sv_ClientAwarenessRadius 50");
+        m_console->PerformCommand("sv_ReplicateServerProxies false");
+        m_console->PerformCommand("sv_MaxEntitiesToTrackReplication 512");
+
+        CreateEntity(NetEntityId{ 1 }, AZ::Vector3(0.0f, 0.0f, 0.0f));
+        CreateEntity(NetEntityId{ 2 }, AZ::Vector3(5.0f, 0.0f, 0.0f));
+        AZ::Entity* filteredEntity = CreateEntity(NetEntityId{ 3 }, AZ::Vector3(10.0f, 0.0f, 0.0f));
+        CreateEntity(NetEntityId{ 4 }, AZ::Vector3(15.0f, 0.0f, 0.0f), NetEntityRole::Server);
+        CreateEntity(NetEntityId{ 5 }, AZ::Vector3(20.0f, 0.0f, 0.0f));
+        CreateEntity(NetEntityId{ 6 }, AZ::Vector3(30.0f, 0.0f, 0.0f));
+        CreateEntity(NetEntityId{ 7 }, AZ::Vector3(200.0f, 0.0f, 0.0f));
+
+        m_filterEntityManager.m_filteredEntities.insert(filteredEntity->GetId());
+        AZ::Interface<IFilterEntityManager>::Register(&m_filterEntityManager);
+
+        // Stands in for the grid MultiplayerSystemComponent creates when sv_useInterestGrid is set. It's created after the entities,
+        // so it picks up the active ones, and registering it makes the replication window gather from it.
+        InterestGrid interestGrid(10.0f);
+        ASSERT_EQ(AZ::Interface<InterestGrid>::Get(), &interestGrid);
+
+        const NetworkEntityHandle controlledEntity = m_networkEntityManager->GetNetworkEntityTracker()->Get(NetEntityId{ 1 });
+        ServerToClientReplicationWindow replicationWindow(controlledEntity, m_mockConnection.get());
+
+        // Filtered entities, server proxies and entities outside the awareness radius are left out
+        replicationWindow.UpdateWindow();
+        using Entities = AZStd::vector<AZStd::pair<NetEntityId, NetEntityRole>>;
+        EXPECT_EQ(
+            ToSortedList(replicationWindow.GetReplicationSet()),
+            Entities({ { NetEntityId{ 1 }, NetEntityRole::Autonomous },
+                       { NetEntityId{ 2 }, NetEntityRole::Client },
+                       { NetEntityId{ 5 }, NetEntityRole::Client },
+                       { NetEntityId{ 6 }, NetEntityRole::Client } }));
+
+        m_console->PerformCommand("sv_ReplicateServerProxies true");
+        replicationWindow.UpdateWindow();
+        EXPECT_EQ(
+            ToSortedList(replicationWindow.GetReplicationSet()),
+            Entities({ { NetEntityId{ 1 }, NetEntityRole::Autonomous },
+                       { NetEntityId{ 2 }, NetEntityRole::Client },
+                       { NetEntityId{ 4 }, NetEntityRole::Client },
+                       { NetEntityId{ 5 }, NetEntityRole::Client },
+                       { NetEntityId{ 6 }, NetEntityRole::Client } }));
+
+        // Only the closest candidates are tracked, the controlled entity is always added on top
+        m_console->PerformCommand("sv_MaxEntitiesToTrackReplication 2");
+        replicationWindow.UpdateWindow();
+        EXPECT_EQ(
+            ToSortedList(replicationWindow.GetReplicationSet()),
+            Entities({ { NetEntityId{ 1 }, NetEntityRole::Autonomous },
+                       { NetEntityId{ 2 }, NetEntityRole::Client },
+                       { NetEntityId{ 4 }, NetEntityRole::Client } }));
+    }
+}
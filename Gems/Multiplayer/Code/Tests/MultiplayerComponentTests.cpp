@@ -10,6 +10,7 @@
 #include <AzCore/UnitTest/TestTypes.h>
 #include <AzCore/UnitTest/UnitTest.h>
 #include <AzNetworking/Serialization/StringifySerializer.h>
+#include <AzNetworking/Utilities/QuantizedBits.h>
 #include <AzTest/AzTest.h>
 #include <Multiplayer/Components/MultiplayerComponent.h>
 
@@ -71,4 +72,124 @@ namespace Multiplayer
         EXPECT_EQ(valueMap.size(), NumTestEntriesPlusSize);
     }
 
+    TEST_F(MultiplayerComponentTests, SerializeNetworkPropertyHelperRewindableValueClearsDirtyBitOnlyWhenUnchanged)
+    {
+        AZStd::array<uint8_t, 64> buffer;
+        RewindableObject<int32_t, 8> authorityValue(42);
+        RewindableObject<int32_t, 8> clientValue(0);
+        NetComponentId componentId = aznumeric_cast<NetComponentId>(0);
+        PropertyIndex propertyIndex = aznumeric_cast<PropertyIndex>(0);
+        MultiplayerStats stats;
+
+        AzNetworking::FixedSizeVectorBitset<1> bitset;
+        bitset.AddBits(1);
+        bitset.SetBit(0, true);
+        AzNetworking::FixedSizeBitsetView bitsetView(bitset, 0, 1);
+
+        InputSerializer inputSerializer(buffer.data(), static_cast<uint32_t>(buffer.size()));
+        SerializeNetworkPropertyHelper(inputSerializer, bitsetView, 0, authorityValue, "Value", componentId, propertyIndex, stats);
+        const uint32_t sentSize = inputSerializer.GetSize();
+
+        // The first update changes the value, so the dirty bit stays raised
+        OutputSerializer firstOutputSerializer(buffer.data(), sentSize);
+        SerializeNetworkPropertyHelper(firstOutputSerializer, bitsetView, 0, clientValue, "Value", componentId, propertyIndex, stats);
+        EXPECT_TRUE(bitsetView.GetBit(0));
+        EXPECT_EQ(clientValue.Get(), 42);
+
+        // Resending the same value doesn't change anything, so the dirty bit is lowered
+        OutputSerializer secondOutputSerializer(buffer.data(), sentSize);
+        SerializeNetworkPropertyHelper(secondOutputSerializer, bitsetView, 0, clientValue, "Value", componentId, propertyIndex, stats);
+        EXPECT_FALSE(bitsetView.GetBit(0));
+        EXPECT_EQ(clientValue.Get(), 42);
+    }
+
+    TEST_F(MultiplayerComponentTests, SerializeQuantizedNetworkPropertyHelperClearsDirtyBitWhenResendHasSameQuantizedBits)
+    {
+        constexpr uint32_t BitCount = 12;
+        constexpr float MinValue = -100.0f;
+        constexpr float MaxValue = 100.0f;
+        const float errorBound = AzNetworking::GetQuantizationErrorBound(MinValue, MaxValue, BitCount) + 0.0001f;
+
+        AZStd::array<uint8_t, 64> buffer;
+        RewindableObject<AZ::Vector3, 8> authorityValue(AZ::Vector3(12.3f, -45.6f, 78.9f));
+        RewindableObject<AZ::Vector3, 8> clientValue(AZ::Vector3::CreateZero());
+        NetComponentId componentId = aznumeric_cast<NetComponentId>(0);
+        PropertyIndex propertyIndex = aznumeric_cast<PropertyIndex>(0);
+        MultiplayerStats stats;
+
+        AzNetworking::FixedSizeVectorBitset<1> bitset;
+        bitset.AddBits(1);
+        bitset.SetBit(0, true);
+        AzNetworking::FixedSizeBitsetView bitsetView(bitset, 0, 1);
+
+        InputSerializer inputSerializer(buffer.data(), static_cast<uint32_t>(buffer.size()));
+        SerializeQuantizedNetworkPropertyHelper<BitCount>(
+            inputSerializer, bitsetView, 0, authorityValue, MinValue, MaxValue, "Value", componentId, propertyIndex, stats);
+        const uint32_t sentSize = inputSerializer.GetSize();
+
+        OutputSerializer firstOutputSerializer(buffer.data(), sentSize);
+        SerializeQuantizedNetworkPropertyHelper<BitCount>(
+            firstOutputSerializer, bitsetView, 0, clientValue, MinValue, MaxValue, "Value", componentId, propertyIndex, stats);
+        EXPECT_TRUE(bitsetView.GetBit(0));
+        EXPECT_TRUE(clientValue.Get().IsClose(authorityValue.Get(), errorBound));
+
+        // The local value is the dequantized result of the same bits, so resending them doesn't notify
+        OutputSerializer secondOutputSerializer(buffer.data(), sentSize);
+        SerializeQuantizedNetworkPropertyHelper<BitCount>(
+            secondOutputSerializer, bitsetView, 0, clientValue, MinValue, MaxValue, "Value", componentId, propertyIndex, stats);
+        EXPECT_FALSE(bitsetView.GetBit(0));
+        EXPECT_TRUE(clientValue.Get().IsClose(authorityValue.Get(), errorBound));
+
+        // A different value is picked up again
+        authorityValue = AZ::Vector3(-12.3f, 45.6f, -78.9f);
+        bitsetView.SetBit(0, true);
+        InputSerializer changedInputSerializer(buffer.data(), static_cast<uint32_t>(buffer.size()));
+        SerializeQuantizedNetworkPropertyHelper<BitCount>(
+            changedInputSerializer, bitsetView, 0, authorityValue, MinValue, MaxValue, "Value", componentId, propertyIndex, stats);
+
+        OutputSerializer thirdOutputSerializer(buffer.data(), changedInputSerializer.GetSize());
+        SerializeQuantizedNetworkPropertyHelper<BitCount>(
+            thirdOutputSerializer, bitsetView, 0, clientValue, MinValue, MaxValue, "Value", componentId, propertyIndex, stats);
+        EXPECT_TRUE(bitsetView.GetBit(0));
+        EXPECT_TRUE(clientValue.Get().IsClose(authorityValue.Get(), errorBound));
+    }
+
+    TEST_F(MultiplayerComponentTests, SerializeSmallestThreeNetworkPropertyHelperClearsDirtyBitWhenResendHasSameQuantizedBits)
+    {
+        constexpr uint32_t BitCount = 12;
+        // Each sent component is within the error bound, the rebuilt component can pick up the error of all three
+        const float errorBound = 4.0f * AzNetworking::GetSmallestThreeErrorBound(BitCount) + 0.0001f;
+
+        AZStd::array<uint8_t, 64> buffer;
+        // The largest component is a positive w, so the encoding doesn't flip the quaternion to -q
+        RewindableObject<AZ::Quaternion, 8> authorityValue(
+            AZ::Quaternion::CreateFromAxisAngle(AZ::Vector3(1.0f, 2.0f, -3.0f).GetNormalized(), 0.8f));
+        RewindableObject<AZ::Quaternion, 8> clientValue(AZ::Quaternion::CreateIdentity());
+        NetComponentId componentId = aznumeric_cast<NetComponentId>(0);
+        PropertyIndex propertyIndex = aznumeric_cast<PropertyIndex>(0);
+        MultiplayerStats stats;
+
+        AzNetworking::FixedSizeVectorBitset<1> bitset;
+        bitset.AddBits(1);
+        bitset.SetBit(0, true);
+        AzNetworking::FixedSizeBitsetView bitsetView(bitset, 0, 1);
+
+        InputSerializer inputSerializer(buffer.data(), static_cast<uint32_t>(buffer.size()));
+        SerializeSmallestThreeNetworkPropertyHelper<BitCount>(
+            inputSerializer, bitsetView, 0, authorityValue, "Value", componentId, propertyIndex, stats);
+        const uint32_t sentSize = inputSerializer.GetSize();
+
+        OutputSerializer firstOutputSerializer(buffer.data(), sentSize);
+        SerializeSmallestThreeNetworkPropertyHelper<BitCount>(
+            firstOutputSerializer, bitsetView, 0, clientValue, "Value", componentId, propertyIndex, stats);
+        EXPECT_TRUE(bitsetView.GetBit(0));
+        EXPECT_TRUE(clientValue.Get().IsClose(authorityValue.Get(), errorBound));
+
+        OutputSerializer secondOutputSerializer(buffer.data(), sentSize);
+        SerializeSmallestThreeNetworkPropertyHelper<BitCount>(
+            secondOutputSerializer, bitsetView, 0, clientValue, "Value", componentId, propertyIndex, stats);
+        EXPECT_FALSE(bitsetView.GetBit(0));
+        EXPECT_TRUE(clientValue.Get().IsClose(authorityValue.Get(), errorBound));
+    }
+
 } // namespace Multiplayer
@@ -0,0 +1,303 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <CommonNetworkEntitySetup.h>
+#include <Multiplayer/EntityDomains/SpatialGridEntityDomain.h>
+#include <AzCore/Component/TransformBus.h>
+#include <AzCore/std/containers/unordered_map.h>
+
+namespace Multiplayer
+{
+    using namespace testing;
+    using namespace ::UnitTest;
+
+    class SpatialGridEntityDomainTests
+        : public NetworkEntityTests
+    {
+    public:
+        static inline const AZ::Aabb WorldAabb = AZ::Aabb::CreateFromMinMax(AZ::Vector3(0.0f, 0.0f, -10.0f), AZ::Vector3(100.0f, 100.0f, 10.0f));
+    };
+
+    TEST_F(SpatialGridEntityDomainTests, TestGridCellsCoverWorld)
+    {
+        constexpr uint32_t Columns = 3;
+        constexpr uint32_t Rows = 2;
+
+        AZStd::vector<AZ::Aabb> cells;
+        for (uint32_t cellIndex = 0; cellIndex < Columns * Rows; ++cellIndex)
+        {
+            cells.push_back(SpatialGridEntityDomain::GetGridCellAabb(WorldAabb, Columns, Rows, cellIndex));
+            EXPECT_TRUE(cells.back().IsValid());
+        }
+        EXPECT_FALSE(SpatialGridEntityDomain::GetGridCellAabb(WorldAabb, Columns, Rows, Columns * Rows).IsValid());
+        EXPECT_FALSE(SpatialGridEntityDomain::GetGridCellAabb(WorldAabb, 0, Rows, 0).IsValid());
+
+        EXPECT_TRUE(cells[0].GetMin().IsClose(WorldAabb.GetMin()));
+        EXPECT_TRUE(cells[Columns * Rows - 1].GetMax().IsClose(WorldAabb.GetMax()));
+
+        // Every position away from the cell edges belongs to exactly one cell
+        for (float x = 0.5f; x < 100.0f; x += 7.0f)
+        {
+            for (float y = 0.5f; y < 100.0f; y += 7.0f)
+            {
+                const AZ::Vector3 position(x, y, 0.0f);
+                uint32_t containingCells = 0;
+                for (const AZ::Aabb& cell : cells)
+                {
+                    containingCells += cell.Contains(position) ? 1 : 0;
+                }
+                EXPECT_EQ(containingCells, 1u);
+            }
+        }
+    }
+
+    TEST_F(SpatialGridEntityDomainTests, TestHysteresisBand)
+    {
+        SpatialGridEntityDomain leftDomain(SpatialGridEntityDomain::GetGridCellAabb(WorldAabb, 2, 1, 0), 5.0f);
+        SpatialGridEntityDomain rightDomain(SpatialGridEntityDomain::GetGridCellAabb(WorldAabb, 2, 1, 1), 5.0f);
+
+        EXPECT_TRUE(leftDomain.IsPositionInDomain(AZ::Vector3(25.0f, 50.0f, 0.0f)));
+        EXPECT_FALSE(rightDomain.IsPositionInDomain(AZ::Vector3(25.0f, 50.0f, 0.0f)));
+
+        // Inside the band on either side of the edge both domains keep the entity, so it stays with its current owner
+        EXPECT_TRUE(leftDomain.IsPositionInDomain(AZ::Vector3(53.0f, 50.0f, 0.0f)));
+        EXPECT_TRUE(rightDomain.IsPositionInDomain(AZ::Vector3(53.0f, 50.0f, 0.0f)));
+        EXPECT_TRUE(leftDomain.IsPositionInDomain(AZ::Vector3(47.0f, 50.0f, 0.0f)));
+        EXPECT_TRUE(rightDomain.IsPositionInDomain(AZ::Vector3(47.0f, 50.0f, 0.0f)));
+
+        EXPECT_FALSE(leftDomain.IsPositionInDomain(AZ::Vector3(56.0f, 50.0f, 0.0f)));
+        EXPECT_TRUE(rightDomain.IsPositionInDomain(AZ::Vector3(56.0f, 50.0f, 0.0f)));
+
+        // The band only extends along x and y, cells are not expanded above or below
+        EXPECT_FALSE(leftDomain.IsPositionInDomain(AZ::Vector3(25.0f, 50.0f, 13.0f)));
+        EXPECT_FALSE(leftDomain.IsPositionInDomain(AZ::Vector3(25.0f, 50.0f, -13.0f)));
+    }
+
+    TEST_F(SpatialGridEntityDomainTests, TestUpdateExitedEntitiesBatchesFurthestFirst)
+    {
+        SpatialGridEntityDomain domain(SpatialGridEntityDomain::GetGridCellAabb(WorldAabb, 2, 1, 0), 5.0f);
+
+        CreateEntity(NetEntityId{ 1 }, AZ::Vector3(10.0f, 50.0f, 0.0f), NetEntityRole::Authority);
+        CreateEntity(NetEntityId{ 2 }, AZ::Vector3(53.0f, 50.0f, 0.0f), NetEntityRole::Authority);
+        CreateEntity(NetEntityId{ 3 }, AZ::Vector3(60.0f, 50.0f, 0.0f), NetEntityRole::Authority);
+        CreateEntity(NetEntityId{ 4 }, AZ::Vector3(70.0f, 50.0f, 0.0f), NetEntityRole::Authority);
+        CreateEntity(NetEntityId{ 5 }, AZ::Vector3(80.0f, 50.0f, 0.0f), NetEntityRole::Authority);
+        // Entities we don't have authority over are never handed over
+        CreateEntity(NetEntityId{ 6 }, AZ::Vector3(90.0f, 50.0f, 0.0f), NetEntityRole::Client);
+
+        NetEntityIdSet signaledEntities;
+        EntityExitDomainEvent::Handler exitDomainHandler([&signaledEntities](const ConstNetworkEntityHandle& entityHandle)
+        {
+            signaledEntities.insert(entityHandle.GetNetEntityId());
+        });
+        m_networkEntityManager->AddEntityExitDomainHandler(exitDomainHandler);
+
+        uint32_t maxMigrations = 0;
+        m_console->GetCvarValue<uint32_t>("sv_EntityDomainMaxMigrationsPerUpdate", maxMigrations);
+        m_console->PerformCommand("sv_EntityDomainMaxMigrationsPerUpdate 2");
+
+        const NetEntityIdSet firstBatch = domain.UpdateExitedEntities();
+        EXPECT_EQ(firstBatch, NetEntityIdSet({ NetEntityId{ 4 }, NetEntityId{ 5 } }));
+        EXPECT_EQ(signaledEntities, firstBatch);
+
+        m_console->PerformCommand((AZStd::string("sv_EntityDomainMaxMigrationsPerUpdate ") + AZStd::to_string(maxMigrations)).c_str());
+
+        const NetEntityIdSet secondBatch = domain.UpdateExitedEntities();
+        EXPECT_EQ(secondBatch, NetEntityIdSet({ NetEntityId{ 3 }, NetEntityId{ 4 }, NetEntityId{ 5 } }));
+    }
+
+    TEST_F(SpatialGridEntityDomainTests, TestSelectExitedEntitiesRetriesUnacceptedEntitiesLast)
+    {
+        SpatialGridEntityDomain domain(SpatialGridEntityDomain::GetGridCellAabb(WorldAabb, 2, 1, 0), 5.0f);
+
+        // Nothing accepts these entities, so they're still ours after every selection
+        AZStd::vector<SpatialGridEntityDomain::EntityPosition> entities;
+        entities.push_back({ NetEntityId{ 1 }, AZ::Vector3(90.0f, 50.0f, 0.0f) });
+        entities.push_back({ NetEntityId{ 2 }, AZ::Vector3(80.0f, 50.0f, 0.0f) });
+
+        EXPECT_EQ(domain.SelectExitedEntities(entities, 1), NetEntityIdSet({ NetEntityId{ 1 } }));
+        EXPECT_EQ(domain.SelectExitedEntities(entities, 1), NetEntityIdSet({ NetEntityId{ 2 } }));
+
+        // A newly exited entity goes before the ones that didn't migrate, even though it's closer to the cell
+        entities.push_back({ NetEntityId{ 3 }, AZ::Vector3(60.0f, 50.0f, 0.0f) });
+        EXPECT_EQ(domain.SelectExitedEntities(entities, 1), NetEntityIdSet({ NetEntityId{ 3 } }));
+
+        // After that the entities that didn't migrate are retried, least recently selected first
+        EXPECT_EQ(domain.SelectExitedEntities(entities, 1), NetEntityIdSet({ NetEntityId{ 1 } }));
+        EXPECT_EQ(domain.SelectExitedEntities(entities, 1), NetEntityIdSet({ NetEntityId{ 2 } }));
+
+        // Entities that came back into the domain are forgotten
+        entities[0].m_position = AZ::Vector3(10.0f, 50.0f, 0.0f);
+        EXPECT_EQ(domain.SelectExitedEntities(entities, 1), NetEntityIdSet({ NetEntityId{ 3 } }));
+        entities[0].m_position = AZ::Vector3(90.0f, 50.0f, 0.0f);
+        EXPECT_EQ(domain.SelectExitedEntities(entities, 1), NetEntityIdSet({ NetEntityId{ 1 } }));
+    }
+
+    TEST_F(SpatialGridEntityDomainTests, TestIsInDomainUsesEntityPosition)
+    {
+        SpatialGridEntityDomain domain(SpatialGridEntityDomain::GetGridCellAabb(WorldAabb, 2, 1, 0), 5.0f);
+
+        CreateEntity(NetEntityId{ 1 }, AZ::Vector3(10.0f, 50.0f, 0.0f), NetEntityRole::Authority);
+        CreateEntity(NetEntityId{ 2 }, AZ::Vector3(80.0f, 50.0f, 0.0f), NetEntityRole::Authority);
+
+        NetworkEntityTracker* networkEntityTracker = m_networkEntityManager->GetNetworkEntityTracker();
+        EXPECT_TRUE(domain.IsInDomain(networkEntityTracker->Get(NetEntityId{ 1 })));
+        EXPECT_FALSE(domain.IsInDomain(networkEntityTracker->Get(NetEntityId{ 2 })));
+    }
+
+    // Runs several servers in one process, each owning one cell of the grid, and hands entities over the same way the
+    // entity replication managers do: an entity leaves its server when it's outside of the domain and is accepted by the
+    // server whose domain contains it.
+    class LoopbackServers
+    {
+    public:
+        LoopbackServers(const AZ::Aabb& worldAabb, uint32_t columns, uint32_t rows, float hysteresis, uint32_t maxMigrationsPerUpdate)
+            : m_maxMigrationsPerUpdate(maxMigrationsPerUpdate)
+        {
+            for (uint32_t cellIndex = 0; cellIndex < columns * rows; ++cellIndex)
+            {
+                m_domains.push_back(AZStd::make_unique<SpatialGridEntityDomain>(
+                    SpatialGridEntityDomain::GetGridCellAabb(worldAabb, columns, rows, cellIndex), hysteresis));
+            }
+        }
+
+        void AddEntity(NetEntityId netEntityId, const AZ::Vector3& position)
+        {
+            m_positions[netEntityId] = position;
+            for (size_t serverIndex = 0; serverIndex < m_domains.size(); ++serverIndex)
+            {
+                if (m_domains[serverIndex]->GetAabb().Contains(position))
+                {
+                    m_owners[netEntityId] = serverIndex;
+                    return;
+                }
+            }
+        }
+
+        void MoveEntity(NetEntityId netEntityId, const AZ::Vector3& position)
+        {
+            m_positions[netEntityId] = position;
+        }
+
+        //! Runs one domain update on every server and returns the number of migrations.
+        uint32_t Update()
+        {
+            uint32_t migrationCount = 0;
+            for (size_t serverIndex = 0; serverIndex < m_domains.size(); ++serverIndex)
+            {
+                AZStd::vector<SpatialGridEntityDomain::EntityPosition> ownedEntities;
+                for (const auto& [netEntityId, owner] : m_owners)
+                {
+                    if (owner == serverIndex)
+                    {
+                        ownedEntities.push_back({ netEntityId, m_positions[netEntityId] });
+                    }
+                }
+
+                const NetEntityIdSet exitedEntities = m_domains[serverIndex]->SelectExitedEntities(ownedEntities, m_maxMigrationsPerUpdate);
+                EXPECT_LE(exitedEntities.size(), m_maxMigrationsPerUpdate);
+                for (NetEntityId netEntityId : exitedEntities)
+                {
+                    for (size_t remoteIndex = 0; remoteIndex < m_domains.size(); ++remoteIndex)
+                    {
+                        if ((remoteIndex != serverIndex) && m_domains[remoteIndex]->IsPositionInDomain(m_positions[netEntityId]))
+                        {
+                            m_owners[netEntityId] = remoteIndex;
+                            ++migrationCount;
+                            break;
+                        }
+                    }
+                }
+            }
+            return migrationCount;
+        }
+
+        size_t GetOwner(NetEntityId netEntityId) const
+        {
+            return m_owners.find(netEntityId)->second;
+        }
+
+        bool AllEntitiesOwnedByContainingDomain() const
+        {
+            for (const auto& [netEntityId, owner] : m_owners)
+            {
+                if (!m_domains[owner]->IsPositionInDomain(m_positions.find(netEntityId)->second))
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+    private:
+        AZStd::vector<AZStd::unique_ptr<SpatialGridEntityDomain>> m_domains;
+        AZStd::unordered_map<NetEntityId, AZ::Vector3> m_positions;
+        AZStd::unordered_map<NetEntityId, size_t> m_owners;
+        uint32_t m_maxMigrationsPerUpdate = 0;
+    };
+
+    TEST_F(SpatialGridEntityDomainTests, TestLoopbackServersMigrateAcrossCells)
+    {
+        LoopbackServers servers(WorldAabb, 2, 2, 5.0f, 4);
+
+        constexpr uint32_t EntityCount = 20;
+        for (uint32_t index = 0; index < EntityCount; ++index)
+        {
+            servers.AddEntity(NetEntityId{ index }, AZ::Vector3(10.0f + index, 10.0f, 0.0f));
+            EXPECT_EQ(servers.GetOwner(NetEntityId{ index }), size_t{ 0 });
+        }
+
+        // Moving everything into the band next to the neighbouring cell doesn't migrate anything
+        for (uint32_t index = 0; index < EntityCount; ++index)
+        {
+            servers.MoveEntity(NetEntityId{ index }, AZ::Vector3(52.0f, 10.0f, 0.0f));
+        }
+        EXPECT_EQ(servers.Update(), 0u);
+
+        // Crossing the band migrates the entities to the neighbouring server, a few per update
+        for (uint32_t index = 0; index < EntityCount; ++index)
+        {
+            servers.MoveEntity(NetEntityId{ index }, AZ::Vector3(60.0f, 10.0f, 0.0f));
+        }
+        uint32_t updateCount = 0;
+        uint32_t totalMigrations = 0;
+        while (const uint32_t migrations = servers.Update())
+        {
+            EXPECT_LE(migrations, 4u);
+            totalMigrations += migrations;
+            ++updateCount;
+        }
+        EXPECT_EQ(totalMigrations, EntityCount);
+        EXPECT_EQ(updateCount, EntityCount / 4);
+        for (uint32_t index = 0; index < EntityCount; ++index)
+        {
+            EXPECT_EQ(servers.GetOwner(NetEntityId{ index }), size_t{ 1 });
+        }
+
+        // Moving back into the band of the original cell keeps the entities on their new server
+        for (uint32_t index = 0; index < EntityCount; ++index)
+        {
+            servers.MoveEntity(NetEntityId{ index }, AZ::Vector3(47.0f, 10.0f, 0.0f));
+        }
+        EXPECT_EQ(servers.Update(), 0u);
+
+        // Moving diagonally across the corner hands the entities to the opposite server
+        for (uint32_t index = 0; index < EntityCount; ++index)
+        {
+            servers.MoveEntity(NetEntityId{ index }, AZ::Vector3(20.0f, 80.0f, 0.0f));
+        }
+        while (servers.Update() > 0)
+        {
+        }
+        for (uint32_t index = 0; index < EntityCount; ++index)
+        {
+            EXPECT_EQ(servers.GetOwner(NetEntityId{ index }), size_t{ 2 });
+        }
+        EXPECT_TRUE(servers.AllEntitiesOwnedByContainingDomain());
+    }
+}
@@ -0,0 +1,107 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Multiplayer/NetworkEntity/EntityReplication/StateDeltaCache.h>
+#include <AzCore/UnitTest/TestTypes.h>
+
+namespace UnitTest
+{
+    using namespace Multiplayer;
+
+    class StateDeltaCacheTests
+        : public LeakDetectionFixture
+    {
+    public:
+        static ReplicationRecord CreateRecord(NetEntityRole remoteRole, uint32_t dirtyBit)
+        {
+            ReplicationRecord record(remoteRole);
+            record.m_authorityToClient.Resize(16);
+            record.m_authorityToClient.SetBit(dirtyBit, true);
+            return record;
+        }
+
+        static AzNetworking::PacketEncodingBuffer CreateData(uint8_t value, uint32_t size)
+        {
+            AzNetworking::PacketEncodingBuffer data;
+            data.Resize(size);
+            memset(data.GetBuffer(), value, size);
+            return data;
+        }
+    };
+
+    TEST_F(StateDeltaCacheTests, RetrievesStoredStateDelta)
+    {
+        StateDeltaCache cache;
+        const ReplicationRecord record = CreateRecord(NetEntityRole::Client, 3);
+
+        AzNetworking::PacketEncodingBuffer retrieved;
+        MultiplayerStats::PropertiesSent propertiesSent;
+        EXPECT_FALSE(cache.Retrieve(record, retrieved, propertiesSent));
+
+        const MultiplayerStats::PropertiesSent storedPropertiesSent = { { NetComponentId{ 2 }, PropertyIndex{ 3 }, 24 } };
+        cache.Store(record, CreateData(0x5A, 24), storedPropertiesSent);
+
+        // A separately built record marking the same properties shares the cached bytes and their property updates
+        ASSERT_TRUE(cache.Retrieve(CreateRecord(NetEntityRole::Client, 3), retrieved, propertiesSent));
+        EXPECT_EQ(retrieved.GetSize(), 24);
+        EXPECT_EQ(retrieved.GetBuffer()[0], 0x5A);
+        EXPECT_EQ(retrieved.GetBuffer()[23], 0x5A);
+        ASSERT_EQ(propertiesSent.size(), 1);
+        EXPECT_EQ(propertiesSent[0].m_netComponentId, NetComponentId{ 2 });
+        EXPECT_EQ(propertiesSent[0].m_propertyIndex, PropertyIndex{ 3 });
+        EXPECT_EQ(propertiesSent[0].m_totalBytes, 24);
+    }
+
+    TEST_F(StateDeltaCacheTests, DifferentRecordsAreNotShared)
+    {
+        StateDeltaCache cache;
+        cache.Store(CreateRecord(NetEntityRole::Client, 3), CreateData(0x01, 8), {});
+
+        AzNetworking::PacketEncodingBuffer retrieved;
+        MultiplayerStats::PropertiesSent propertiesSent;
+        EXPECT_FALSE(cache.Retrieve(CreateRecord(NetEntityRole::Client, 4), retrieved, propertiesSent));
+        EXPECT_FALSE(cache.Retrieve(CreateRecord(NetEntityRole::Autonomous, 3), retrieved, propertiesSent));
+
+        cache.Store(CreateRecord(NetEntityRole::Autonomous, 3), CreateData(0x02, 12), {});
+        ASSERT_TRUE(cache.Retrieve(CreateRecord(NetEntityRole::Autonomous, 3), retrieved, propertiesSent));
+        EXPECT_EQ(retrieved.GetSize(), 12);
+        EXPECT_EQ(retrieved.GetBuffer()[0], 0x02);
+    }
+
+    TEST_F(StateDeltaCacheTests, InvalidateDiscardsStateDeltas)
+    {
+        StateDeltaCache cache;
+        const ReplicationRecord record = CreateRecord(NetEntityRole::Client, 3);
+        cache.Store(record, CreateData(0x01, 8), {});
+        cache.Invalidate();
+
+        AzNetworking::PacketEncodingBuffer retrieved;
+        MultiplayerStats::PropertiesSent propertiesSent;
+        EXPECT_FALSE(cache.Retrieve(record, retrieved, propertiesSent));
+    }
+
+    TEST_F(StateDeltaCacheTests, CapturedPropertiesSentAreReplayedIntoStats)
+    {
+        MultiplayerStats stats;
+        stats.ReserveComponentStats(NetComponentId{ 2 }, 4, 0);
+
+        MultiplayerStats::PropertiesSent propertiesSent;
+        MultiplayerStats::BeginCapturePropertiesSent(propertiesSent);
+        stats.RecordPropertySent(NetComponentId{ 2 }, PropertyIndex{ 1 }, 10);
+        MultiplayerStats::EndCapturePropertiesSent();
+        stats.RecordPropertySent(NetComponentId{ 2 }, PropertyIndex{ 3 }, 5);
+        ASSERT_EQ(propertiesSent.size(), 1);
+        EXPECT_EQ(propertiesSent[0].m_propertyIndex, PropertyIndex{ 1 });
+
+        // A connection reusing the cached state delta records the same property updates
+        stats.ReplayPropertiesSent(AZ::EntityId(), "entity", propertiesSent);
+        EXPECT_EQ(stats.m_componentStats[2].m_propertyUpdatesSent[1].m_totalCalls, 2);
+        EXPECT_EQ(stats.m_componentStats[2].m_propertyUpdatesSent[1].m_totalBytes, 20);
+        EXPECT_EQ(stats.m_componentStats[2].m_propertyUpdatesSent[3].m_totalCalls, 1);
+    }
+}
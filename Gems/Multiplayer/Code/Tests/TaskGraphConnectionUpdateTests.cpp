@@ -0,0 +1,215 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <CommonNetworkEntitySetup.h>
+#include <MultiplayerSystemComponent.h>
+#include <ConnectionData/ServerToClientConnectionData.h>
+#include <ReplicationWindows/InterestGrid.h>
+#include <ReplicationWindows/ServerToClientReplicationWindow.h>
+#include <Source/AutoGen/Multiplayer.AutoPackets.h>
+#include <AzCore/Component/TransformBus.h>
+#include <AzCore/Task/TaskExecutor.h>
+#include <AzCore/std/sort.h>
+
+namespace Multiplayer
+{
+    using namespace testing;
+    using namespace ::UnitTest;
+
+    class TaskGraphConnectionUpdateTests
+        : public NetworkEntityTests
+    {
+    public:
+        void SetUp() override
+        {
+            NetworkEntityTests::SetUp();
+
+            m_taskExecutor = AZStd::make_unique<AZ::TaskExecutor>(4);
+            AZ::TaskExecutor::SetInstance(m_taskExecutor.get());
+
+            m_console->GetCvarValue<float>("sv_ClientAwarenessRadius", m_awarenessRadius);
+            m_console->PerformCommand("sv_ClientAwarenessRadius 30");
+        }
+
+        void TearDown() override
+        {
+            m_console->PerformCommand((AZStd::string("sv_ClientAwarenessRadius ") + AZStd::to_string(m_awarenessRadius)).c_str());
+
+            m_serialClients.clear();
+            m_taskGraphClients.clear();
+            m_interestGrid.reset();
+            m_entityInfos.clear();
+
+            if (&AZ::TaskExecutor::Instance() == m_taskExecutor.get())
+            {
+                AZ::TaskExecutor::SetInstance(nullptr);
+            }
+            m_taskExecutor.reset();
+
+            NetworkEntityTests::TearDown();
+        }
+
+        // A client connection that records the entities it sent updates for
+        class Client
+        {
+        public:
+            Client(ConnectionId connectionId, AzNetworking::IConnectionListener& connectionListener, NetworkEntityHandle controlledEntity)
+                : m_connection(connectionId, IpAddress("localhost", 1, ProtocolType::Udp), ConnectionRole::Acceptor)
+                , m_connectionData(&m_connection, connectionListener)
+            {
+                ON_CALL(m_connection, SendUnreliablePacket(_)).WillByDefault(Invoke(this, &Client::RecordPacket));
+                m_connection.SetUserData(&m_connectionData);
+                m_connectionData.SetControlledEntity(controlledEntity);
+                m_connectionData.SetCanSendUpdates(true);
+                m_connectionData.GetReplicationManager().SetReplicationWindow(
+                    AZStd::make_unique<ServerToClientReplicationWindow>(controlledEntity, &m_connection));
+            }
+
+            AzNetworking::PacketId RecordPacket(const AzNetworking::IPacket& packet)
+            {
+                if (packet.GetPacketType() == MultiplayerPackets::EntityUpdates::Type)
+                {
+                    const auto& entityUpdates = static_cast<const MultiplayerPackets::EntityUpdates&>(packet);
+                    for (const NetworkEntityUpdateMessage& updateMessage : entityUpdates.GetEntityMessages())
+                    {
+                        m_sentUpdates.push_back(updateMessage.GetEntityId());
+                    }
+                }
+                return ++m_lastPacketId;
+            }
+
+            AZStd::vector<AZStd::pair<NetEntityId, NetEntityRole>> GetReplicationSet()
+            {
+                AZStd::vector<AZStd::pair<NetEntityId, NetEntityRole>> replicationSet;
+                for (const auto& [entityHandle, replicationData] :
+                     m_connectionData.GetReplicationManager().GetReplicationWindow()->GetReplicationSet())
+                {
+                    replicationSet.emplace_back(entityHandle.GetNetEntityId(), replicationData.m_netEntityRole);
+                }
+                return replicationSet;
+            }
+
+            AZStd::vector<NetEntityId> TakeSentUpdates()
+            {
+                AZStd::vector<NetEntityId> sentUpdates = AZStd::move(m_sentUpdates);
+                m_sentUpdates.clear();
+                AZStd::sort(sentUpdates.begin(), sentUpdates.end());
+                return sentUpdates;
+            }
+
+            NiceMock<IMultiplayerConnectionMock> m_connection;
+            ServerToClientConnectionData m_connectionData;
+            AZStd::vector<NetEntityId> m_sentUpdates;
+            AzNetworking::PacketId m_lastPacketId = AzNetworking::PacketId{ 0 };
+        };
+
+        static AZStd::vector<IConnectionData*> GetConnections(AZStd::vector<AZStd::unique_ptr<Client>>& clients)
+        {
+            AZStd::vector<IConnectionData*> connections;
+            for (AZStd::unique_ptr<Client>& client : clients)
+            {
+                connections.push_back(&client->m_connectionData);
+            }
+            return connections;
+        }
+
+        // The serial path of MultiplayerSystemComponent::UpdateConnections
+        static void UpdateConnectionsSerially(const AZStd::vector<IConnectionData*>& connections)
+        {
+            for (IConnectionData* connectionData : connections)
+            {
+                if (connectionData->GetReplicationManager().UpdateReplicationSet())
+                {
+                    connectionData->GetReplicationManager().ApplyReplicationSet();
+                }
+                connectionData->Update();
+            }
+        }
+
+        void ExpectClientsMatch()
+        {
+            ASSERT_EQ(m_serialClients.size(), m_taskGraphClients.size());
+            for (size_t index = 0; index < m_serialClients.size(); ++index)
+            {
+                EXPECT_EQ(m_serialClients[index]->GetReplicationSet(), m_taskGraphClients[index]->GetReplicationSet());
+                EXPECT_EQ(m_serialClients[index]->TakeSentUpdates(), m_taskGraphClients[index]->TakeSentUpdates());
+            }
+        }
+
+        AZStd::unique_ptr<AZ::TaskExecutor> m_taskExecutor;
+        AZStd::unique_ptr<InterestGrid> m_interestGrid;
+        AZStd::vector<AZStd::unique_ptr<Client>> m_serialClients;
+        AZStd::vector<AZStd::unique_ptr<Client>> m_taskGraphClients;
+        float m_awarenessRadius = 0.0f;
+    };
+
+    TEST_F(TaskGraphConnectionUpdateTests, TestTaskGraphUpdatesMatchSerialUpdates)
+    {
+        constexpr uint32_t PlayerCount = 6;
+        constexpr uint32_t EntityCount = 64;
+
+        AZStd::vector<AZ::Entity*> players;
+        for (uint32_t index = 0; index < PlayerCount; ++index)
+        {
+            players.push_back(CreateEntity(NetEntityId{ index + 1 }, AZ::Vector3(static_cast<float>(index) * 25.0f, 0.0f, 0.0f)));
+        }
+        AZStd::vector<AZ::Entity*> entities;
+        for (uint32_t index = 0; index < EntityCount; ++index)
+        {
+            const float x = static_cast<float>((index * 37) % 160) - 10.0f;
+            const float y = static_cast<float>((index * 53) % 60) - 30.0f;
+            entities.push_back(CreateEntity(NetEntityId{ PlayerCount + index + 1 }, AZ::Vector3(x, y, 0.0f)));
+        }
+        m_interestGrid = AZStd::make_unique<InterestGrid>(10.0f);
+
+        // Every player is watched by two connections, one updated serially and one updated on the task graph
+        NetworkEntityTracker* networkEntityTracker = m_networkEntityManager->GetNetworkEntityTracker();
+        for (uint32_t index = 0; index < PlayerCount; ++index)
+        {
+            const NetworkEntityHandle controlledEntity = networkEntityTracker->Get(NetEntityId{ index + 1 });
+            m_serialClients.push_back(AZStd::make_unique<Client>(ConnectionId{ index + 1 }, *m_mockConnectionListener, controlledEntity));
+            m_taskGraphClients.push_back(
+                AZStd::make_unique<Client>(ConnectionId{ PlayerCount + index + 1 }, *m_mockConnectionListener, controlledEntity));
+        }
+
+        const AZStd::vector<IConnectionData*> serialConnections = GetConnections(m_serialClients);
+        const AZStd::vector<IConnectionData*> taskGraphConnections = GetConnections(m_taskGraphClients);
+
+        UpdateConnectionsSerially(serialConnections);
+        MultiplayerSystemComponent::UpdateConnectionsWithTaskGraph(taskGraphConnections, taskGraphConnections);
+        for (const AZStd::unique_ptr<Client>& client : m_taskGraphClients)
+        {
+            EXPECT_FALSE(client->m_sentUpdates.empty());
+            EXPECT_FALSE(client->m_connectionData.GetReplicationManager().HasPendingReplicationSetUpdate());
+        }
+        ExpectClientsMatch();
+
+        // Moving the players and entities changes every replication set
+        for (uint32_t index = 0; index < PlayerCount; ++index)
+        {
+            players[index]->GetTransform()->SetWorldTranslation(AZ::Vector3(static_cast<float>(index) * 25.0f + 12.0f, 5.0f, 0.0f));
+        }
+        for (uint32_t index = 0; index < EntityCount; index += 3)
+        {
+            const AZ::Vector3 position = entities[index]->GetTransform()->GetWorldTranslation();
+            entities[index]->GetTransform()->SetWorldTranslation(position + AZ::Vector3(40.0f, 0.0f, 0.0f));
+        }
+
+        for (uint32_t update = 0; update < 3; ++update)
+        {
+            UpdateConnectionsSerially(serialConnections);
+            MultiplayerSystemComponent::UpdateConnectionsWithTaskGraph(taskGraphConnections, taskGraphConnections);
+            ExpectClientsMatch();
+        }
+
+        // Connections without a pending replication set update only send their updates
+        UpdateConnectionsSerially(serialConnections);
+        MultiplayerSystemComponent::UpdateConnectionsWithTaskGraph(taskGraphConnections, {});
+        ExpectClientsMatch();
+    }
+}
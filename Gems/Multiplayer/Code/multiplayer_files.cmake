@@ -38,6 +38,7 @@ set(FILES
     Include/Multiplayer/NetworkEntity/EntityReplication/EntityReplicator.inl
     Include/Multiplayer/ConnectionData/IConnectionData.h
     Include/Multiplayer/EntityDomains/IEntityDomain.h
+    Include/Multiplayer/EntityDomains/SpatialGridEntityDomain.h
     Include/Multiplayer/IMultiplayer.h
     Include/Multiplayer/IMultiplayerTools.h
     Include/Multiplayer/INetworkSpawnableLibrary.h
@@ -47,6 +48,7 @@ set(FILES
     Include/Multiplayer/NetworkEntity/IFilterEntityManager.h
     Include/Multiplayer/NetworkEntity/INetworkEntityManager.h
     Include/Multiplayer/NetworkEntity/EntityReplication/ReplicationRecord.h
+    Include/Multiplayer/NetworkEntity/EntityReplication/StateDeltaCache.h
     Include/Multiplayer/NetworkInput/IMultiplayerComponentInput.h
     Include/Multiplayer/NetworkTime/INetworkTime.h
     Include/Multiplayer/NetworkTime/RewindableArray.h
@@ -73,6 +75,7 @@ set(FILES
     Source/EntityDomains/FullOwnershipEntityDomain.h
     Source/EntityDomains/NullEntityDomain.cpp
     Source/EntityDomains/NullEntityDomain.h
+    Source/EntityDomains/SpatialGridEntityDomain.cpp
     Source/MultiplayerStatSystemComponent.cpp
     Source/MultiplayerStatSystemComponent.h
     Source/MultiplayerStats.cpp
@@ -83,6 +86,7 @@ set(FILES
     Source/NetworkEntity/NetworkEntityTracker.inl
     Source/NetworkEntity/NetworkEntityUpdateMessage.cpp
     Source/NetworkEntity/EntityReplication/ReplicationRecord.cpp
+    Source/NetworkEntity/EntityReplication/StateDeltaCache.cpp
     Source/NetworkInput/NetworkInput.cpp
     Source/NetworkInput/NetworkInputArray.cpp
     Source/NetworkInput/NetworkInputChild.cpp
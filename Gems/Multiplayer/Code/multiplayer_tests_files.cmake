@@ -22,6 +22,7 @@ set(FILES
     Tests/IMultiplayerSpawnerMock.h
     Tests/Main.cpp
     Tests/MockInterfaces.h
+    Tests/InterestGridTests.cpp
     Tests/LocalPredictionPlayerInputTests.cpp
     Tests/MultiplayerComponentTests.cpp
     Tests/MultiplayerSystemTests.cpp
@@ -34,6 +35,9 @@ set(FILES
     Tests/RewindableObjectTests.cpp
     Tests/ServerHierarchyTests.cpp
     Tests/SimplePlayerSpawnerTests.cpp
+    Tests/SpatialGridEntityDomainTests.cpp
+    Tests/StateDeltaCacheTests.cpp
+    Tests/TaskGraphConnectionUpdateTests.cpp
     Tests/TestMultiplayerComponent.h
     Tests/TestMultiplayerComponent.cpp
 